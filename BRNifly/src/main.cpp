@@ -1,6 +1,7 @@
 #include <algorithm>
 #include <array>
 #include <cstdint>
+#include <cstdio>
 #include <filesystem>
 #include <fstream>
 #include <functional>
@@ -17,6 +18,7 @@
 
 #include <nlohmann/json.hpp>
 #include <spdlog/spdlog.h>
+#include <spdlog/sinks/stdout_color_sinks.h>
 
 #include <pxr/pxr.h>
 #include <pxr/base/gf/vec2f.h>
@@ -40,6 +42,8 @@
 #ifdef _WIN32
 #define WIN32_LEAN_AND_MEAN
 #include <windows.h>
+#include <fcntl.h>
+#include <io.h>
 #endif
 
 using json = nlohmann::json;
@@ -266,6 +270,7 @@ std::vector<std::string> ServiceList()
         "nif.describe",
         "nif.inspect.shaderFlags",
         "nif.convert.usd",
+        "nif.serve",
         "nif.stream.blocks",
         "nif.stream.geometry",
         "nif.stream.materials",
@@ -813,6 +818,8 @@ json DescribeServicesJson(const char* argv0)
     response["services"] = ServiceList();
     response["supportedGames"] = SupportedGames();
     response["preferredPayload"] = "usda-text";
+    response["payloadFormats"] = json::array({"usda-text", "usdc-file"});
+    response["frameProtocolVersion"] = 1;
     response["diagnostics"] = json::array();
     for (const Diagnostic& diagnostic : diagnostics) {
         response["diagnostics"].push_back(DiagnosticJson(diagnostic));
@@ -1557,7 +1564,7 @@ json ShaderFlagsJson(const char* argv0, const fs::path& nifPath)
 #endif
 }
 
-std::optional<std::string> ConvertShapesToUsd(
+SdfLayerRefPtr ConvertShapesToUsd(
     const std::vector<ShapeData>& shapes,
     std::vector<NodeData> nodes,
     const json& rootExtraData,
@@ -1570,7 +1577,7 @@ std::optional<std::string> ConvertShapesToUsd(
     UsdStageRefPtr stage = UsdStage::Open(rootLayer);
     if (!stage) {
         AddDiagnostic(diagnostics, "error", "Failed to create OpenUSD stage.");
-        return std::nullopt;
+        return nullptr;
     }
 
     UsdGeomSetStageUpAxis(stage, UsdGeomTokens->z);
@@ -1808,34 +1815,56 @@ std::optional<std::string> ConvertShapesToUsd(
 
     if (emittedMeshes == 0 && nodes.empty() && collisionProxies.empty() && rootExtraData.empty()) {
         AddDiagnostic(diagnostics, "error", "No USD-representable data was emitted from the NIF.");
-        return std::nullopt;
+        return nullptr;
     }
 
-    std::string usdText;
-    if (!rootLayer->ExportToString(&usdText)) {
-        AddDiagnostic(diagnostics, "error", "OpenUSD failed to export the generated layer.");
-        return std::nullopt;
+    AddDiagnostic(diagnostics, "info", "Converted " + std::to_string(emittedMeshes) + " NIF shape(s), " + std::to_string(nodes.size()) + " node(s), and " + std::to_string(collisionProxies.size()) + " collision proxy/proxies to USD.");
+    return rootLayer;
+}
+
+// Bumped whenever ConvertShapesToUsd changes its output, so content hashes (and
+// the renderer caches keyed on them) are invalidated along with it.
+constexpr const char* kConverterRevision = "brnifly-usd-2";
+
+struct NifConversion {
+    json response;
+    SdfLayerRefPtr layer;
+};
+
+json DiagnosticsJson(const std::vector<Diagnostic>& diagnostics)
+{
+    json result = json::array();
+    for (const Diagnostic& diagnostic : diagnostics) {
+        result.push_back(DiagnosticJson(diagnostic));
     }
+    return result;
+}
 
-    AddDiagnostic(diagnostics, "info", "Converted " + std::to_string(emittedMeshes) + " NIF shape(s), " + std::to_string(nodes.size()) + " node(s), and " + std::to_string(collisionProxies.size()) + " collision proxy/proxies to USD.");
-    return usdText;
+std::optional<std::string> ReadFileBytes(const fs::path& path)
+{
+    std::ifstream input(path, std::ios::binary);
+    if (!input) {
+        return std::nullopt;
+    }
+    std::ostringstream contents;
+    contents << input.rdbuf();
+    return contents.str();
 }
 
-json ConvertUsdJson(const char* argv0, const fs::path& nifPath)
+// Converts one NIF to an in-memory USD layer. The response carries every field
+// of the conversion envelope except the layer itself, which the caller exports
+// in whatever payload format was requested.
+NifConversion ConvertNif(const NiflyApi* api, std::vector<Diagnostic> diagnostics, const fs::path& nifPath)
 {
-    std::vector<Diagnostic> diagnostics;
-    json response;
+    NifConversion conversion;
+    json& response = conversion.response;
     response["status"] = "error";
     response["sourcePath"] = nifPath.string();
 
-    auto api = LoadNiflyApi(argv0, diagnostics);
     if (!api) {
         response["message"] = "Unable to load niflyDLL.";
-        response["diagnostics"] = json::array();
-        for (const Diagnostic& diagnostic : diagnostics) {
-            response["diagnostics"].push_back(DiagnosticJson(diagnostic));
-        }
-        return response;
+        response["diagnostics"] = DiagnosticsJson(diagnostics);
+        return conversion;
     }
 
 #ifdef _WIN32
@@ -1847,11 +1876,8 @@ json ConvertUsdJson(const char* argv0, const fs::path& nifPath)
     if (!nifHandle) {
         AddDiagnostic(diagnostics, "error", "niflyDLL failed to load '" + nifPath.string() + "'. " + GetMessageLog(*api));
         response["message"] = "niflyDLL failed to load the NIF file.";
-        response["diagnostics"] = json::array();
-        for (const Diagnostic& diagnostic : diagnostics) {
-            response["diagnostics"].push_back(DiagnosticJson(diagnostic));
-        }
-        return response;
+        response["diagnostics"] = DiagnosticsJson(diagnostics);
+        return conversion;
     }
 
     std::string gameName = "unknown";
@@ -1865,34 +1891,189 @@ json ConvertUsdJson(const char* argv0, const fs::path& nifPath)
     std::vector<CollisionProxyData> collisionProxies = ReadCollisionProxies(*api, nifHandle, nodes);
     api->destroy(nifHandle);
 
-    auto usdText = ConvertShapesToUsd(shapes, std::move(nodes), rootExtraData, collisionProxies, nifPath, gameName, diagnostics);
-    if (!usdText) {
+    SdfLayerRefPtr layer = ConvertShapesToUsd(shapes, std::move(nodes), rootExtraData, collisionProxies, nifPath, gameName, diagnostics);
+    if (!layer) {
         response["message"] = "NIF-to-USD conversion failed.";
-        response["diagnostics"] = json::array();
-        for (const Diagnostic& diagnostic : diagnostics) {
-            response["diagnostics"].push_back(DiagnosticJson(diagnostic));
-        }
-        return response;
+        response["diagnostics"] = DiagnosticsJson(diagnostics);
+        return conversion;
     }
 
-    const std::string hash = HexHash(Fnv1a64(nifPath.string() + *usdText));
+    // Hash the source rather than the exported layer so the identifier does not
+    // depend on which payload format the client asked for.
+    const std::string sourceBytes = ReadFileBytes(nifPath).value_or(std::string());
+    const std::string hash = HexHash(Fnv1a64(std::string(kConverterRevision) + "|" + nifPath.string() + "|" + sourceBytes));
     response["status"] = "ok";
     response["protocolVersion"] = "1.0";
     response["sourcePath"] = nifPath.string();
     response["sourceIdentifier"] = nifPath.string() + "#brnifly=" + hash;
     response["contentHash"] = hash;
-    response["rootLayerText"] = *usdText;
     response["dependencies"] = json::array();
     response["textureSearchRoots"] = json::array({nifPath.parent_path().string()});
-    response["diagnostics"] = json::array();
-    for (const Diagnostic& diagnostic : diagnostics) {
-        response["diagnostics"].push_back(DiagnosticJson(diagnostic));
-    }
-    return response;
+    response["diagnostics"] = DiagnosticsJson(diagnostics);
+    conversion.layer = std::move(layer);
+    return conversion;
 #else
     response["message"] = "BRNifly conversion is currently implemented for Windows only.";
-    return response;
+    return conversion;
+#endif
+}
+
+void MarkExportFailed(json& response)
+{
+    response["status"] = "error";
+    response["message"] = "OpenUSD failed to export the generated layer.";
+    response["diagnostics"].push_back(DiagnosticJson({"error", "OpenUSD failed to export the generated layer."}));
+}
+
+json ConvertUsdJson(const char* argv0, const fs::path& nifPath)
+{
+    std::vector<Diagnostic> diagnostics;
+    auto api = LoadNiflyApi(argv0, diagnostics);
+    NifConversion conversion = ConvertNif(api ? &*api : nullptr, std::move(diagnostics), nifPath);
+    if (conversion.layer) {
+        std::string usdText;
+        if (conversion.layer->ExportToString(&usdText)) {
+            conversion.response["rootLayerText"] = std::move(usdText);
+        }
+        else {
+            MarkExportFailed(conversion.response);
+        }
+    }
+    return conversion.response;
+}
+
+// --serve speaks a framed protocol on stdin/stdout so one process (and one
+// niflyDLL load) handles any number of conversions. Every frame is a fixed
+// little-endian header, a UTF-8 JSON document, then an opaque binary payload.
+// Keep these definitions in sync with BasicRenderer's BRNiflyClient.cpp.
+constexpr uint32_t kFrameMagic = 0x464E5242u; // "BRNF"
+constexpr uint16_t kFrameVersion = 1;
+constexpr uint32_t kMaxFrameJsonBytes = 16u * 1024u * 1024u;
+
+enum class FrameType : uint16_t {
+    ConvertRequest = 1,
+    ConvertResponse = 2,
+    Shutdown = 3,
+};
+
+struct FrameHeader {
+    uint32_t magic = kFrameMagic;
+    uint16_t version = kFrameVersion;
+    uint16_t type = 0;
+    uint32_t requestId = 0;
+    uint32_t jsonBytes = 0;
+    uint64_t payloadBytes = 0;
+};
+static_assert(sizeof(FrameHeader) == 24, "BRNifly frame header must stay 24 bytes");
+
+bool ReadExact(std::FILE* stream, void* data, size_t size)
+{
+    return size == 0 || std::fread(data, 1, size, stream) == size;
+}
+
+bool WriteFrame(std::FILE* stream, FrameType type, uint32_t requestId, const std::string& jsonText, const std::string& payload)
+{
+    FrameHeader header{};
+    header.type = static_cast<uint16_t>(type);
+    header.requestId = requestId;
+    header.jsonBytes = static_cast<uint32_t>(jsonText.size());
+    header.payloadBytes = payload.size();
+    return std::fwrite(&header, sizeof(header), 1, stream) == 1 &&
+        (jsonText.empty() || std::fwrite(jsonText.data(), 1, jsonText.size(), stream) == jsonText.size()) &&
+        (payload.empty() || std::fwrite(payload.data(), 1, payload.size(), stream) == payload.size()) &&
+        std::fflush(stream) == 0;
+}
+
+// Request: {"service":"nif.convert.usd","sourcePath":...,"payloadFormat":"usda-text"|"usdc-file","payloadPath":...}
+// "usda-text" returns the layer as the frame payload; "usdc-file" exports a crate
+// file to payloadPath, which the client opens directly and deletes afterwards.
+json HandleServeRequest(const NiflyApi* api, const std::vector<Diagnostic>& loadDiagnostics, const std::string& requestText, std::string& payload)
+{
+    json request;
+    try {
+        request = json::parse(requestText);
+    }
+    catch (const std::exception& ex) {
+        return json{{"status", "error"}, {"message", std::string("Invalid request JSON: ") + ex.what()}, {"diagnostics", json::array()}};
+    }
+
+    const std::string service = request.value("service", "nif.convert.usd");
+    if (service != "nif.convert.usd") {
+        return json{{"status", "error"}, {"message", "Unsupported service: " + service}, {"diagnostics", json::array()}};
+    }
+
+    const fs::path nifPath = request.value("sourcePath", "");
+    const std::string payloadFormat = request.value("payloadFormat", "usda-text");
+    const std::string payloadPath = request.value("payloadPath", "");
+
+    NifConversion conversion = ConvertNif(api, loadDiagnostics, nifPath);
+    if (!conversion.layer) {
+        return conversion.response;
+    }
+
+    if (payloadFormat == "usdc-file" && !payloadPath.empty()) {
+        if (!conversion.layer->Export(payloadPath)) {
+            MarkExportFailed(conversion.response);
+            return conversion.response;
+        }
+        conversion.response["payloadFormat"] = "usdc-file";
+        conversion.response["payloadPath"] = payloadPath;
+        return conversion.response;
+    }
+
+    if (!conversion.layer->ExportToString(&payload)) {
+        payload.clear();
+        MarkExportFailed(conversion.response);
+        return conversion.response;
+    }
+    conversion.response["payloadFormat"] = "usda-text";
+    return conversion.response;
+}
+
+int RunServer(const char* argv0)
+{
+    // stdout carries frames only; anything else would corrupt the stream.
+    spdlog::set_default_logger(spdlog::stderr_color_mt("BRNifly"));
+    spdlog::set_level(spdlog::level::warn);
+#ifdef _WIN32
+    _setmode(_fileno(stdin), _O_BINARY);
+    _setmode(_fileno(stdout), _O_BINARY);
 #endif
+
+    std::vector<Diagnostic> loadDiagnostics;
+    auto api = LoadNiflyApi(argv0, loadDiagnostics);
+
+    FrameHeader header{};
+    std::string requestText;
+    std::string payload;
+    while (ReadExact(stdin, &header, sizeof(header))) {
+        if (header.magic != kFrameMagic || header.version != kFrameVersion ||
+            header.jsonBytes > kMaxFrameJsonBytes || header.payloadBytes != 0)
+        {
+            std::cerr << "BRNifly --serve: malformed request frame." << std::endl;
+            return 1;
+        }
+
+        requestText.resize(header.jsonBytes);
+        if (!ReadExact(stdin, requestText.data(), requestText.size())) {
+            return 1;
+        }
+
+        if (header.type == static_cast<uint16_t>(FrameType::Shutdown)) {
+            return 0;
+        }
+        if (header.type != static_cast<uint16_t>(FrameType::ConvertRequest)) {
+            std::cerr << "BRNifly --serve: unexpected frame type " << header.type << "." << std::endl;
+            return 1;
+        }
+
+        payload.clear();
+        const json response = HandleServeRequest(api ? &*api : nullptr, loadDiagnostics, requestText, payload);
+        if (!WriteFrame(stdout, FrameType::ConvertResponse, header.requestId, response.dump(), payload)) {
+            return 1;
+        }
+    }
+    return 0;
 }
 
 int PrintUsage()
@@ -1903,7 +2084,8 @@ int PrintUsage()
         << "  BRNifly --shader-flags-json-file <file.nif> <response.json>\n"
         << "  BRNifly --convert-usd-json <file.nif>\n"
         << "  BRNifly --convert-usd-json-file <file.nif> <response.json>\n"
-        << "  BRNifly --convert <file.nif> --out <file.usda>\n";
+        << "  BRNifly --convert <file.nif> --out <file.usda>\n"
+        << "  BRNifly --serve\n";
     return 2;
 }
 
@@ -1918,6 +2100,10 @@ int main(int argc, char** argv)
         return 0;
     }
 
+    if (argc == 2 && std::string(argv[1]) == "--serve") {
+        return RunServer(argv[0]);
+    }
+
     if (argc == 3 && std::string(argv[1]) == "--convert-usd-json") {
         std::cout << ConvertUsdJson(argv[0], fs::path(argv[2])).dump(2) << std::endl;
         return 0;
@@ -0,0 +1,331 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include <assimp/Importer.hpp>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+
+#include "Import/SkinInfluencePacker.h"
+
+// Import-time cost of an Assimp asset (large FBX and OBJ files are the cases
+// that matter). Reports Assimp::Importer::ReadFile with and without
+// aiProcess_OptimizeGraph | aiProcess_OptimizeMeshes, then the CPU cost of
+// turning every aiMesh into MeshIngestBuilder-shaped vertex, skinning and
+// index streams two ways:
+//   "staged" - what AssimpGeometryExtractor did before: interleave each
+//              vertex into a staging vector, append it to the builder one
+//              vertex at a time, and keep a per-vertex top-8 influence table
+//              while scanning every bone.
+//   "direct" - the current path: size the builder storage once, copy each
+//              attribute array into it, and bucket influences with
+//              SkinInfluencePacker.
+// Extraction runs single-threaded and then with one worker per hardware
+// thread pulling meshes, as the extractor's ParallelFor does. CLod building is
+// not included; it dominates a cold import but is identical for both paths.
+//
+// Usage: AssimpImportBenchmark <file.fbx|file.obj|...> [iterations=5]
+
+namespace
+{
+    constexpr uint32_t kMaxInfluences = SkinInfluencePacker::kMaxInfluences;
+    constexpr size_t kSkinningInfluencesOffset = 24u;
+    constexpr size_t kSkinningVertexSize = kSkinningInfluencesOffset + SkinInfluencePacker::kPackedBytes;
+
+    constexpr unsigned int kBaseFlags = aiProcess_Triangulate | aiProcess_FlipUVs;
+    constexpr unsigned int kOptimizeFlags = aiProcess_OptimizeGraph | aiProcess_OptimizeMeshes;
+
+    // Stand-in for MeshIngestBuilder storage.
+    struct MeshStreams {
+        size_t vertexSize = 0;
+        std::vector<std::byte> vertices;
+        std::vector<std::byte> skinningVertices;
+        std::vector<uint32_t> indices;
+    };
+
+    size_t VertexSize(const aiMesh* mesh, size_t& texcoordOffset, size_t& colorOffset) {
+        size_t size = 24u;
+        texcoordOffset = size;
+        if (mesh->HasTextureCoords(0)) {
+            size += 8u;
+        }
+        colorOffset = size;
+        if (mesh->HasVertexColors(0)) {
+            size += 12u;
+        }
+        return size;
+    }
+
+    void ExtractStaged(const aiMesh* mesh, MeshStreams& out) {
+        size_t texcoordOffset = 0;
+        size_t colorOffset = 0;
+        const size_t vertexSize = VertexSize(mesh, texcoordOffset, colorOffset);
+        const uint32_t vertexCount = mesh->mNumVertices;
+        const bool hasBones = mesh->HasBones();
+
+        std::vector<std::byte> rawData(static_cast<size_t>(vertexCount) * vertexSize);
+        std::vector<std::byte> skinningData(hasBones ? static_cast<size_t>(vertexCount) * kSkinningVertexSize : 0u);
+        const float zero[3] = {};
+        for (uint32_t v = 0; v < vertexCount; ++v) {
+            std::byte* vertex = rawData.data() + static_cast<size_t>(v) * vertexSize;
+            std::memcpy(vertex, &mesh->mVertices[v], 12u);
+            std::memcpy(vertex + 12u, mesh->HasNormals() ? static_cast<const void*>(&mesh->mNormals[v]) : zero, 12u);
+            if (mesh->HasTextureCoords(0)) {
+                const float uv[2] = { mesh->mTextureCoords[0][v].x, -mesh->mTextureCoords[0][v].y };
+                std::memcpy(vertex + texcoordOffset, uv, sizeof(uv));
+            }
+            if (mesh->HasVertexColors(0)) {
+                const float color[3] = { mesh->mColors[0][v].r, mesh->mColors[0][v].g, mesh->mColors[0][v].b };
+                std::memcpy(vertex + colorOffset, color, sizeof(color));
+            }
+            if (hasBones) {
+                std::memcpy(skinningData.data() + static_cast<size_t>(v) * kSkinningVertexSize, vertex, 24u);
+            }
+        }
+
+        std::vector<uint32_t> indices;
+        indices.reserve(static_cast<size_t>(mesh->mNumFaces) * 3u);
+        for (unsigned int f = 0; f < mesh->mNumFaces; ++f) {
+            for (unsigned int i = 0; i < mesh->mFaces[f].mNumIndices; ++i) {
+                indices.push_back(mesh->mFaces[f].mIndices[i]);
+            }
+        }
+
+        if (hasBones) {
+            struct Influence {
+                uint32_t joint = 0;
+                float weight = 0.0f;
+            };
+            std::vector<std::array<Influence, kMaxInfluences>> influences(vertexCount);
+            std::vector<uint32_t> counts(vertexCount, 0u);
+            for (unsigned int b = 0; b < mesh->mNumBones; ++b) {
+                const aiBone* bone = mesh->mBones[b];
+                for (unsigned int w = 0; w < bone->mNumWeights; ++w) {
+                    const uint32_t vertexId = bone->mWeights[w].mVertexId;
+                    const float weight = bone->mWeights[w].mWeight;
+                    if (weight <= 0.0f || vertexId >= vertexCount) {
+                        continue;
+                    }
+                    auto& slots = influences[vertexId];
+                    uint32_t& count = counts[vertexId];
+                    if (count < kMaxInfluences) {
+                        slots[count++] = { b, weight };
+                        continue;
+                    }
+                    uint32_t smallest = 0;
+                    for (uint32_t i = 1; i < kMaxInfluences; ++i) {
+                        if (slots[i].weight < slots[smallest].weight) {
+                            smallest = i;
+                        }
+                    }
+                    if (weight > slots[smallest].weight) {
+                        slots[smallest] = { b, weight };
+                    }
+                }
+            }
+            for (uint32_t v = 0; v < vertexCount; ++v) {
+                auto slots = influences[v];
+                std::sort(slots.begin(), slots.begin() + counts[v], [](const Influence& a, const Influence& b) { return a.weight > b.weight; });
+                float sum = 0.0f;
+                for (uint32_t i = 0; i < counts[v]; ++i) {
+                    sum += slots[i].weight;
+                }
+                uint32_t joints[kMaxInfluences] = {};
+                float weights[kMaxInfluences] = {};
+                for (uint32_t i = 0; i < counts[v]; ++i) {
+                    joints[i] = slots[i].joint;
+                    weights[i] = slots[i].weight / sum;
+                }
+                std::byte* dst = skinningData.data() + static_cast<size_t>(v) * kSkinningVertexSize + kSkinningInfluencesOffset;
+                std::memcpy(dst, joints, sizeof(joints));
+                std::memcpy(dst + sizeof(joints), weights, sizeof(weights));
+            }
+        }
+
+        // Builder appends, one vertex at a time.
+        out.vertexSize = vertexSize;
+        out.vertices.clear();
+        out.skinningVertices.clear();
+        out.indices.clear();
+        out.vertices.reserve(rawData.size());
+        out.skinningVertices.reserve(skinningData.size());
+        for (uint32_t v = 0; v < vertexCount; ++v) {
+            const std::byte* vertex = rawData.data() + static_cast<size_t>(v) * vertexSize;
+            out.vertices.insert(out.vertices.end(), vertex, vertex + vertexSize);
+            if (hasBones) {
+                const std::byte* skin = skinningData.data() + static_cast<size_t>(v) * kSkinningVertexSize;
+                out.skinningVertices.insert(out.skinningVertices.end(), skin, skin + kSkinningVertexSize);
+            }
+        }
+        out.indices.insert(out.indices.end(), indices.begin(), indices.end());
+    }
+
+    void CopyVector3Stream(std::byte* dst, size_t stride, size_t offset, const aiVector3D* src, uint32_t count) {
+        for (uint32_t v = 0; v < count; ++v) {
+            std::memcpy(dst + static_cast<size_t>(v) * stride + offset, &src[v], 12u);
+        }
+    }
+
+    void ExtractDirect(const aiMesh* mesh, MeshStreams& out) {
+        size_t texcoordOffset = 0;
+        size_t colorOffset = 0;
+        const size_t vertexSize = VertexSize(mesh, texcoordOffset, colorOffset);
+        const uint32_t vertexCount = mesh->mNumVertices;
+
+        out.vertexSize = vertexSize;
+        out.vertices.clear();
+        out.vertices.resize(static_cast<size_t>(vertexCount) * vertexSize);
+        std::byte* vertices = out.vertices.data();
+        CopyVector3Stream(vertices, vertexSize, 0u, mesh->mVertices, vertexCount);
+        if (mesh->HasNormals()) {
+            CopyVector3Stream(vertices, vertexSize, 12u, mesh->mNormals, vertexCount);
+        }
+        if (mesh->HasTextureCoords(0)) {
+            for (uint32_t v = 0; v < vertexCount; ++v) {
+                const float uv[2] = { mesh->mTextureCoords[0][v].x, -mesh->mTextureCoords[0][v].y };
+                std::memcpy(vertices + static_cast<size_t>(v) * vertexSize + texcoordOffset, uv, sizeof(uv));
+            }
+        }
+        if (mesh->HasVertexColors(0)) {
+            for (uint32_t v = 0; v < vertexCount; ++v) {
+                const float color[3] = { mesh->mColors[0][v].r, mesh->mColors[0][v].g, mesh->mColors[0][v].b };
+                std::memcpy(vertices + static_cast<size_t>(v) * vertexSize + colorOffset, color, sizeof(color));
+            }
+        }
+
+        out.skinningVertices.clear();
+        if (mesh->HasBones()) {
+            out.skinningVertices.resize(static_cast<size_t>(vertexCount) * kSkinningVertexSize);
+            std::byte* skinning = out.skinningVertices.data();
+            CopyVector3Stream(skinning, kSkinningVertexSize, 0u, mesh->mVertices, vertexCount);
+            if (mesh->HasNormals()) {
+                CopyVector3Stream(skinning, kSkinningVertexSize, 12u, mesh->mNormals, vertexCount);
+            }
+
+            thread_local SkinInfluencePacker packer;
+            packer.Reset(vertexCount);
+            for (unsigned int b = 0; b < mesh->mNumBones; ++b) {
+                const aiBone* bone = mesh->mBones[b];
+                for (unsigned int w = 0; w < bone->mNumWeights; ++w) {
+                    packer.CountInfluence(bone->mWeights[w].mVertexId, bone->mWeights[w].mWeight);
+                }
+            }
+            for (unsigned int b = 0; b < mesh->mNumBones; ++b) {
+                const aiBone* bone = mesh->mBones[b];
+                for (unsigned int w = 0; w < bone->mNumWeights; ++w) {
+                    packer.AddInfluence(bone->mWeights[w].mVertexId, b, bone->mWeights[w].mWeight);
+                }
+            }
+            packer.Pack(skinning + kSkinningInfluencesOffset, kSkinningVertexSize);
+        }
+
+        out.indices.clear();
+        out.indices.resize(static_cast<size_t>(mesh->mNumFaces) * 3u);
+        for (unsigned int f = 0; f < mesh->mNumFaces; ++f) {
+            std::memcpy(out.indices.data() + static_cast<size_t>(f) * 3u, mesh->mFaces[f].mIndices, 3u * sizeof(uint32_t));
+        }
+    }
+
+    uint64_t Checksum(const std::vector<MeshStreams>& meshes) {
+        uint64_t hash = 1469598103934665603ull;
+        auto mix = [&](const void* data, size_t size) {
+            const auto* bytes = static_cast<const unsigned char*>(data);
+            for (size_t i = 0; i < size; ++i) {
+                hash = (hash ^ bytes[i]) * 1099511628211ull;
+            }
+        };
+        for (const MeshStreams& mesh : meshes) {
+            mix(mesh.vertices.data(), mesh.vertices.size());
+            mix(mesh.skinningVertices.data(), mesh.skinningVertices.size());
+            mix(mesh.indices.data(), mesh.indices.size() * sizeof(uint32_t));
+        }
+        return hash;
+    }
+
+    template<typename ExtractFn>
+    double TimeExtraction(const aiScene* scene, std::vector<MeshStreams>& out, unsigned int threadCount, uint32_t iterations, ExtractFn&& extract) {
+        out.assign(scene->mNumMeshes, {});
+        double best = 0.0;
+        for (uint32_t iteration = 0; iteration < iterations; ++iteration) {
+            std::atomic<unsigned int> next{ 0 };
+            const auto start = std::chrono::steady_clock::now();
+            auto worker = [&]() {
+                for (unsigned int i = next.fetch_add(1); i < scene->mNumMeshes; i = next.fetch_add(1)) {
+                    // Point and line meshes survive aiProcess_Triangulate; the extractor rejects them.
+                    if ((scene->mMeshes[i]->mPrimitiveTypes & (aiPrimitiveType_POINT | aiPrimitiveType_LINE)) == 0) {
+                        extract(scene->mMeshes[i], out[i]);
+                    }
+                }
+            };
+            std::vector<std::thread> threads;
+            for (unsigned int t = 1; t < threadCount; ++t) {
+                threads.emplace_back(worker);
+            }
+            worker();
+            for (auto& thread : threads) {
+                thread.join();
+            }
+            const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            best = iteration == 0 ? ms : (std::min)(best, ms);
+        }
+        return best;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        std::fprintf(stderr, "Usage: AssimpImportBenchmark <file> [iterations]\n");
+        return 2;
+    }
+    const char* path = argv[1];
+    const uint32_t iterations = (std::max)(argc > 2 ? static_cast<uint32_t>(std::strtoul(argv[2], nullptr, 10)) : 5u, 1u);
+    const unsigned int hardwareThreads = (std::max)(std::thread::hardware_concurrency(), 1u);
+
+    for (const unsigned int flags : { kBaseFlags | kOptimizeFlags, kBaseFlags }) {
+        Assimp::Importer importer;
+        const auto start = std::chrono::steady_clock::now();
+        const aiScene* scene = importer.ReadFile(path, flags);
+        const double readMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        if (!scene || (scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE) || !scene->mRootNode) {
+            std::fprintf(stderr, "Assimp failed to load %s: %s\n", path, importer.GetErrorString());
+            return 1;
+        }
+
+        uint64_t vertices = 0;
+        uint64_t skinnedVertices = 0;
+        for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+            vertices += scene->mMeshes[i]->mNumVertices;
+            skinnedVertices += scene->mMeshes[i]->HasBones() ? scene->mMeshes[i]->mNumVertices : 0u;
+        }
+        std::printf("%s: ReadFile %.1f ms, %u meshes, %llu vertices (%llu skinned)\n",
+            (flags & kOptimizeFlags) ? "optimized" : "unoptimized",
+            readMs,
+            scene->mNumMeshes,
+            static_cast<unsigned long long>(vertices),
+            static_cast<unsigned long long>(skinnedVertices));
+
+        std::vector<MeshStreams> staged;
+        std::vector<MeshStreams> direct;
+        for (const unsigned int threads : { 1u, hardwareThreads }) {
+            const double stagedMs = TimeExtraction(scene, staged, threads, iterations, ExtractStaged);
+            const double directMs = TimeExtraction(scene, direct, threads, iterations, ExtractDirect);
+            std::printf("  %2u thread(s): staged %8.2f ms   direct %8.2f ms\n", threads, stagedMs, directMs);
+        }
+
+        // Only influence order can differ: the staged table's unstable sort
+        // may swap equal weights. Report rather than fail on that.
+        if (Checksum(staged) != Checksum(direct)) {
+            std::printf("  note: staged and direct streams differ (equal-weight influence order)\n");
+        }
+    }
+    return 0;
+}
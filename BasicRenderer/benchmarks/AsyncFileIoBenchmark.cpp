@@ -0,0 +1,108 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Managers/Singletons/AsyncFileIoManager.h"
+
+// Sweeps AsyncFileIoManager queue depth over random page-sized reads from a
+// scratch file, mirroring the CLod streaming access pattern.
+//
+// Usage: AsyncFileIoBenchmark [fileSizeMiB=512] [readSizeKiB=64] [readsPerBatch=256] [batches=16]
+
+namespace
+{
+    std::filesystem::path CreateScratchFile(uint64_t sizeBytes)
+    {
+        const std::filesystem::path path = std::filesystem::temp_directory_path() / "basicrenderer_async_io_bench.bin";
+        std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+        std::vector<char> chunk(1u << 20u);
+        std::mt19937 rng(1234u);
+        for (char& value : chunk) {
+            value = static_cast<char>(rng());
+        }
+        for (uint64_t written = 0; written < sizeBytes; written += chunk.size()) {
+            stream.write(chunk.data(), static_cast<std::streamsize>(std::min<uint64_t>(chunk.size(), sizeBytes - written)));
+        }
+        return path;
+    }
+
+    void RunSweep(
+        AsyncFileIoBackend backend,
+        const std::filesystem::path& path,
+        uint64_t fileSizeBytes,
+        uint32_t readSizeBytes,
+        uint32_t readsPerBatch,
+        uint32_t batchCount)
+    {
+        std::mt19937_64 rng(42u);
+        std::uniform_int_distribution<uint64_t> offsetDist(0, (fileSizeBytes - readSizeBytes) / readSizeBytes);
+
+        for (uint32_t queueDepth = 1; queueDepth <= 256; queueDepth *= 2) {
+            auto& manager = AsyncFileIoManager::GetInstance();
+            manager.Initialize(backend, queueDepth);
+            if (manager.GetBackend() != backend) {
+                manager.Cleanup();
+                std::printf("  backend unavailable, skipping\n");
+                return;
+            }
+
+            std::vector<std::vector<AsyncFileReadRegion>> batches(batchCount);
+            for (auto& regions : batches) {
+                regions.resize(readsPerBatch);
+                for (AsyncFileReadRegion& region : regions) {
+                    region.sourceOffset = offsetDist(rng) * readSizeBytes;
+                    region.sourceSizeBytes = readSizeBytes;
+                }
+            }
+
+            const auto start = std::chrono::steady_clock::now();
+            std::vector<AsyncFileReadRequestHandle> handles;
+            handles.reserve(batchCount);
+            for (const auto& regions : batches) {
+                handles.push_back(manager.EnqueueReadFileRegions(path.wstring(), regions));
+            }
+            std::string message;
+            const bool succeeded = manager.WaitForRequests(handles, &message);
+            const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            manager.Cleanup();
+
+            const double totalMiB = static_cast<double>(readSizeBytes) * readsPerBatch * batchCount / (1024.0 * 1024.0);
+            std::printf(
+                "  qd=%3u  %8.1f MiB/s  %9.0f IOPS%s%s\n",
+                queueDepth,
+                totalMiB / seconds,
+                static_cast<double>(readsPerBatch) * batchCount / seconds,
+                succeeded ? "" : "  FAILED: ",
+                succeeded ? "" : message.c_str());
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const uint64_t fileSizeBytes = (argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 512ull) * 1024ull * 1024ull;
+    const uint32_t readSizeBytes = (argc > 2 ? static_cast<uint32_t>(std::strtoul(argv[2], nullptr, 10)) : 64u) * 1024u;
+    const uint32_t readsPerBatch = argc > 3 ? static_cast<uint32_t>(std::strtoul(argv[3], nullptr, 10)) : 256u;
+    const uint32_t batchCount = argc > 4 ? static_cast<uint32_t>(std::strtoul(argv[4], nullptr, 10)) : 16u;
+    if (fileSizeBytes < readSizeBytes || readSizeBytes == 0u) {
+        std::fprintf(stderr, "file size must be at least one read\n");
+        return 1;
+    }
+
+    const std::filesystem::path path = CreateScratchFile(fileSizeBytes);
+    std::printf("io_uring:\n");
+    RunSweep(AsyncFileIoBackend::IoUring, path, fileSizeBytes, readSizeBytes, readsPerBatch, batchCount);
+    std::printf("thread pool:\n");
+    RunSweep(AsyncFileIoBackend::ThreadPool, path, fileSizeBytes, readSizeBytes, readsPerBatch, batchCount);
+
+    std::error_code ec;
+    std::filesystem::remove(path, ec);
+    return 0;
+}
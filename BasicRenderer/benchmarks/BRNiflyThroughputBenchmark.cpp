@@ -0,0 +1,117 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "Import/BRNiflyClient.h"
+
+// Measures NIF-to-USD conversion throughput (NIFs/s) for the one-shot path (one
+// BRNifly process per NIF, USDA text), a single persistent server, and a pool
+// of servers, with both text and crate-file payloads.
+//
+// Usage: BRNiflyThroughputBenchmark <file.nif|directory> [servers=hardware/2] [limit=0]
+
+namespace
+{
+    struct Pass
+    {
+        const char* label;
+        bool usePersistentServer;
+        unsigned int servers;
+        BRNiflyClient::PayloadFormat payload;
+    };
+
+    void Measure(const Pass& pass, const std::vector<std::string>& nifPaths)
+    {
+        BRNiflyClient::ClientOptions options;
+        options.usePersistentServer = pass.usePersistentServer;
+        options.maxServerProcesses = pass.servers;
+        options.preferredPayload = pass.payload;
+
+        // Start the pool outside the timed region; start-up is a one-off cost.
+        BRNiflyClient::ShutdownServers();
+        BRNiflyClient::ConvertNifsToUsd({ nifPaths.front() }, options);
+
+        const auto start = std::chrono::steady_clock::now();
+        std::vector<BRNiflyClient::ConversionResult> results = BRNiflyClient::ConvertNifsToUsd(nifPaths, options);
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        size_t failures = 0;
+        size_t payloadBytes = 0;
+        for (const BRNiflyClient::ConversionResult& result : results) {
+            if (!result.package) {
+                ++failures;
+                continue;
+            }
+            if (result.package->payloadFormat == BRNiflyClient::PayloadFormat::UsdcFile) {
+                std::error_code ec;
+                payloadBytes += static_cast<size_t>(std::filesystem::file_size(result.package->rootLayerFile, ec));
+            }
+            else {
+                payloadBytes += result.package->rootLayerText.size();
+            }
+            BRNiflyClient::ReleasePayload(*result.package);
+        }
+
+        std::printf("  %-26s %8.1f NIFs/s  %8.1f MB/s payload  (%zu failed)\n",
+            pass.label,
+            static_cast<double>(results.size()) / seconds,
+            static_cast<double>(payloadBytes) / (1024.0 * 1024.0) / seconds,
+            failures);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        std::fprintf(stderr, "Usage: BRNiflyThroughputBenchmark <file.nif|directory> [servers] [limit]\n");
+        return 2;
+    }
+
+    const unsigned int servers = argc > 2 ? static_cast<unsigned int>(std::strtoul(argv[2], nullptr, 10)) : 0u;
+    const size_t limit = argc > 3 ? static_cast<size_t>(std::strtoull(argv[3], nullptr, 10)) : 0u;
+
+    std::vector<std::string> nifPaths;
+    const std::filesystem::path input(argv[1]);
+    if (std::filesystem::is_directory(input)) {
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(input)) {
+            if (entry.is_regular_file() && entry.path().extension() == ".nif") {
+                nifPaths.push_back(entry.path().string());
+            }
+        }
+    }
+    else {
+        nifPaths.push_back(input.string());
+    }
+    if (limit != 0 && nifPaths.size() > limit) {
+        nifPaths.resize(limit);
+    }
+    if (nifPaths.empty()) {
+        std::fprintf(stderr, "No .nif files found under %s\n", argv[1]);
+        return 1;
+    }
+
+    std::string errorMessage;
+    auto services = BRNiflyClient::DescribeServices({}, &errorMessage);
+    if (!services) {
+        std::fprintf(stderr, "BRNifly unavailable: %s\n", errorMessage.c_str());
+        return 1;
+    }
+
+    std::printf("BRNifly conversion throughput (%zu NIFs, %s):\n", nifPaths.size(), services->executablePath.c_str());
+    const Pass passes[] = {
+        { "one-shot per NIF, usda", false, servers, BRNiflyClient::PayloadFormat::UsdaText },
+        { "1 server, usda", true, 1u, BRNiflyClient::PayloadFormat::UsdaText },
+        { "1 server, usdc file", true, 1u, BRNiflyClient::PayloadFormat::UsdcFile },
+        { "server pool, usda", true, servers, BRNiflyClient::PayloadFormat::UsdaText },
+        { "server pool, usdc file", true, servers, BRNiflyClient::PayloadFormat::UsdcFile },
+    };
+    for (const Pass& pass : passes) {
+        Measure(pass, nifPaths);
+    }
+
+    BRNiflyClient::ShutdownServers();
+    return 0;
+}
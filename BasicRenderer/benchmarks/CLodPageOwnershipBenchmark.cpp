@@ -0,0 +1,322 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <span>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "Render/GraphExtensions/ClusterLOD/CLodPageOwnershipIndex.h"
+
+// Page ownership cost of cluster-LOD streaming at pool scale. A synthetic
+// workload fills the page pool with groups of 1-4 segments (a quarter of the
+// segments share a mesh page with an existing group), then churns it: pick a
+// victim page, scrub it, release every resident group the way
+// ReleaseGroupResidency does (drop residency, recount owners for the key,
+// find the next owner and its segment) and reallocate the freed pages to new
+// groups. The same operation stream runs against the hash-based maps the
+// streaming system used before CLodPageOwnershipIndex and against the index;
+// both must produce the same checksum.
+//
+// Usage: CLodPageOwnershipBenchmark [pages=1048576] [evictions=1000000]
+
+namespace
+{
+    constexpr uint64_t kInvalidKey = ~0ull;
+    constexpr uint32_t kMaxSegments = 4;
+
+    // The pre-index layout: a hash set of residents per page, and a pair of
+    // hash maps from group to per-segment pages and keys.
+    class LegacyOwnership {
+    public:
+        void Reset(uint32_t pageCount) {
+            m_pageResidentGroups.clear();
+            m_pageResidentGroups.resize(pageCount);
+            m_groupOwnedPages.clear();
+            m_groupOwnedMeshPageKeys.clear();
+        }
+
+        void AssignGroup(uint32_t group, std::span<const uint32_t> pages, std::span<const uint64_t> keys) {
+            m_groupOwnedPages[group].assign(pages.begin(), pages.end());
+            m_groupOwnedMeshPageKeys[group].assign(keys.begin(), keys.end());
+        }
+
+        bool EraseGroup(uint32_t group) {
+            m_groupOwnedMeshPageKeys.erase(group);
+            return m_groupOwnedPages.erase(group) != 0;
+        }
+
+        bool OwnsGroup(uint32_t group) const {
+            return m_groupOwnedPages.find(group) != m_groupOwnedPages.end();
+        }
+
+        std::span<const uint32_t> GroupPages(uint32_t group) const {
+            const auto it = m_groupOwnedPages.find(group);
+            return it != m_groupOwnedPages.end() ? std::span<const uint32_t>(it->second) : std::span<const uint32_t>();
+        }
+
+        std::span<const uint64_t> GroupKeys(uint32_t group) const {
+            const auto it = m_groupOwnedMeshPageKeys.find(group);
+            return it != m_groupOwnedMeshPageKeys.end() ? std::span<const uint64_t>(it->second) : std::span<const uint64_t>();
+        }
+
+        bool AddResident(uint32_t page, uint32_t group, uint32_t) {
+            return m_pageResidentGroups[page].insert(group).second;
+        }
+
+        bool RemoveResident(uint32_t page, uint32_t group) {
+            return m_pageResidentGroups[page].erase(group) != 0;
+        }
+
+        bool HasResidents(uint32_t page) const {
+            return !m_pageResidentGroups[page].empty();
+        }
+
+        void CollectResidents(uint32_t page, std::vector<uint32_t>& out) const {
+            out.insert(out.end(), m_pageResidentGroups[page].begin(), m_pageResidentGroups[page].end());
+        }
+
+        uint32_t CountResidentsForKey(uint32_t page, uint64_t key) const {
+            uint32_t count = 0;
+            for (uint32_t group : m_pageResidentGroups[page]) {
+                count += ReferencesPageKey(group, page, key) ? 1u : 0u;
+            }
+            return count;
+        }
+
+        uint32_t FindResidentForKey(uint32_t page, uint64_t key, uint32_t* outSlot) const {
+            for (uint32_t group : m_pageResidentGroups[page]) {
+                if (ReferencesPageKey(group, page, key)) {
+                    // The streaming system rescanned the owner's segments.
+                    const std::span<const uint32_t> pages = GroupPages(group);
+                    const std::span<const uint64_t> keys = GroupKeys(group);
+                    for (uint32_t slot = 0; slot < pages.size(); ++slot) {
+                        if (pages[slot] == page && keys[slot] == key) {
+                            *outSlot = slot;
+                            break;
+                        }
+                    }
+                    return group;
+                }
+            }
+            return ~0u;
+        }
+
+        uint32_t ScrubStaleResidents(uint32_t page) {
+            uint32_t removed = 0;
+            auto& residents = m_pageResidentGroups[page];
+            for (auto it = residents.begin(); it != residents.end();) {
+                const std::span<const uint32_t> pages = GroupPages(*it);
+                if (std::find(pages.begin(), pages.end(), page) == pages.end()) {
+                    it = residents.erase(it);
+                    ++removed;
+                } else {
+                    ++it;
+                }
+            }
+            return removed;
+        }
+
+    private:
+        bool ReferencesPageKey(uint32_t group, uint32_t page, uint64_t key) const {
+            const std::span<const uint32_t> pages = GroupPages(group);
+            const std::span<const uint64_t> keys = GroupKeys(group);
+            for (uint32_t slot = 0; slot < (std::min)(pages.size(), keys.size()); ++slot) {
+                if (pages[slot] == page && keys[slot] == key) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        std::vector<std::unordered_set<uint32_t>> m_pageResidentGroups;
+        std::unordered_map<uint32_t, std::vector<uint32_t>> m_groupOwnedPages;
+        std::unordered_map<uint32_t, std::vector<uint64_t>> m_groupOwnedMeshPageKeys;
+    };
+
+    struct Checksum {
+        uint64_t groupsReleased = 0;
+        uint64_t pagesFreed = 0;
+        uint64_t ownerHandoffs = 0;
+        uint64_t scrubbed = 0;
+        uint64_t residentRefs = 0;
+
+        bool operator==(const Checksum&) const = default;
+    };
+
+    // Drives one ownership implementation through the same allocate/evict
+    // stream. Page keys and free pages are tracked here, outside the structure
+    // under test, as the streaming system does.
+    template<typename Ownership>
+    class Simulation {
+    public:
+        Simulation(Ownership& ownership, uint32_t pageCount)
+            : m_ownership(ownership)
+            , m_pageKey(pageCount, kInvalidKey)
+            , m_pageOwner(pageCount, ~0u)
+            , m_livePageSlot(pageCount, ~0u) {
+            m_ownership.Reset(pageCount);
+            m_freePages.reserve(pageCount);
+            for (uint32_t page = pageCount; page-- > 0;) {
+                m_freePages.push_back(page);
+            }
+        }
+
+        // Allocate groups until fewer than kMaxSegments pages remain free.
+        void Fill(std::mt19937& rng) {
+            while (m_freePages.size() >= kMaxSegments) {
+                AllocateGroup(rng);
+            }
+        }
+
+        void Evict(uint32_t page, std::mt19937& rng) {
+            m_checksum.scrubbed += m_ownership.ScrubStaleResidents(page);
+            m_victims.clear();
+            m_ownership.CollectResidents(page, m_victims);
+            // Residents come back in structure order; release in a fixed one
+            // so both runs see the same page reuse.
+            std::sort(m_victims.begin(), m_victims.end());
+            for (uint32_t group : m_victims) {
+                ReleaseGroup(group);
+            }
+            while (m_freePages.size() >= kMaxSegments) {
+                AllocateGroup(rng);
+            }
+        }
+
+        uint32_t RandomResidentPage(std::mt19937& rng) {
+            std::uniform_int_distribution<uint32_t> pick(0u, static_cast<uint32_t>(m_pageKey.size()) - 1u);
+            for (;;) {
+                const uint32_t page = pick(rng);
+                if (m_pageKey[page] != kInvalidKey) {
+                    return page;
+                }
+            }
+        }
+
+        const Checksum& GetChecksum() const { return m_checksum; }
+
+    private:
+        void AllocateGroup(std::mt19937& rng) {
+            const uint32_t group = m_nextGroup++;
+            const uint32_t segments = 1u + rng() % kMaxSegments;
+            uint32_t pages[kMaxSegments];
+            uint64_t keys[kMaxSegments];
+            for (uint32_t seg = 0; seg < segments; ++seg) {
+                // Share an existing mesh page a quarter of the time.
+                if (!m_livePages.empty() && rng() % 4u == 0u) {
+                    pages[seg] = m_livePages[rng() % m_livePages.size()];
+                    keys[seg] = m_pageKey[pages[seg]];
+                    if (std::find(pages, pages + seg, pages[seg]) == pages + seg) {
+                        continue;
+                    }
+                }
+                pages[seg] = m_freePages.back();
+                m_freePages.pop_back();
+                keys[seg] = m_nextKey++;
+                m_pageKey[pages[seg]] = keys[seg];
+                m_pageOwner[pages[seg]] = group;
+                m_livePageSlot[pages[seg]] = static_cast<uint32_t>(m_livePages.size());
+                m_livePages.push_back(pages[seg]);
+            }
+
+            m_ownership.AssignGroup(group, std::span<const uint32_t>(pages, segments), std::span<const uint64_t>(keys, segments));
+            for (uint32_t seg = 0; seg < segments; ++seg) {
+                m_checksum.residentRefs += m_ownership.AddResident(pages[seg], group, seg) ? 1u : 0u;
+            }
+        }
+
+        void ReleaseGroup(uint32_t group) {
+            if (!m_ownership.OwnsGroup(group)) {
+                return;
+            }
+            const std::span<const uint32_t> pages = m_ownership.GroupPages(group);
+            const std::span<const uint64_t> keys = m_ownership.GroupKeys(group);
+            for (uint32_t slot = 0; slot < pages.size(); ++slot) {
+                const uint32_t page = pages[slot];
+                const uint64_t key = keys[slot];
+                if (!m_ownership.RemoveResident(page, group)) {
+                    continue;
+                }
+                --m_checksum.residentRefs;
+                if (m_ownership.CountResidentsForKey(page, key) != 0u) {
+                    uint32_t nextSlot = 0;
+                    const uint32_t next = m_ownership.FindResidentForKey(page, key, &nextSlot);
+                    m_pageOwner[page] = next;
+                    ++m_checksum.ownerHandoffs;
+                    continue;
+                }
+                FreePage(page);
+            }
+            m_ownership.EraseGroup(group);
+            ++m_checksum.groupsReleased;
+        }
+
+        void FreePage(uint32_t page) {
+            m_pageKey[page] = kInvalidKey;
+            m_pageOwner[page] = ~0u;
+            const uint32_t slot = m_livePageSlot[page];
+            m_livePages[slot] = m_livePages.back();
+            m_livePageSlot[m_livePages[slot]] = slot;
+            m_livePages.pop_back();
+            m_livePageSlot[page] = ~0u;
+            m_freePages.push_back(page);
+            ++m_checksum.pagesFreed;
+        }
+
+        Ownership& m_ownership;
+        std::vector<uint64_t> m_pageKey;
+        std::vector<uint32_t> m_pageOwner;
+        std::vector<uint32_t> m_freePages;
+        std::vector<uint32_t> m_livePages;
+        std::vector<uint32_t> m_livePageSlot;
+        std::vector<uint32_t> m_victims;
+        uint32_t m_nextGroup = 0;
+        uint64_t m_nextKey = 0;
+        Checksum m_checksum;
+    };
+
+    template<typename Ownership>
+    Checksum Run(const char* name, uint32_t pageCount, uint32_t evictions) {
+        Ownership ownership;
+        std::mt19937 rng(11u);
+
+        const auto fillStart = std::chrono::steady_clock::now();
+        Simulation<Ownership> simulation(ownership, pageCount);
+        simulation.Fill(rng);
+        const double fillMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - fillStart).count();
+
+        const auto churnStart = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < evictions; ++i) {
+            simulation.Evict(simulation.RandomResidentPage(rng), rng);
+        }
+        const double churnMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - churnStart).count();
+
+        const Checksum& checksum = simulation.GetChecksum();
+        std::printf("  %-8s fill %9.1f ms   churn %9.1f ms (%6.0f ns/eviction)   %llu groups released, %llu pages freed, %llu owner handoffs\n",
+            name, fillMs, churnMs, evictions != 0 ? churnMs * 1.0e6 / evictions : 0.0,
+            static_cast<unsigned long long>(checksum.groupsReleased),
+            static_cast<unsigned long long>(checksum.pagesFreed),
+            static_cast<unsigned long long>(checksum.ownerHandoffs));
+        return checksum;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const uint32_t pageCount = (std::max)(argc > 1 ? static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10)) : 1048576u, kMaxSegments * 2u);
+    const uint32_t evictions = argc > 2 ? static_cast<uint32_t>(std::strtoul(argv[2], nullptr, 10)) : 1000000u;
+
+    std::printf("%u pages, %u evictions\n", pageCount, evictions);
+    const Checksum legacy = Run<LegacyOwnership>("hashed", pageCount, evictions);
+    const Checksum flat = Run<CLodPageOwnershipIndex>("flat", pageCount, evictions);
+
+    const bool consistent = legacy == flat && legacy.scrubbed == 0u;
+    if (!consistent) {
+        std::printf("hashed and flat ownership disagree\n");
+    }
+    return consistent ? 0 : 1;
+}
@@ -0,0 +1,190 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "Resources/Buffers/DrawSetMembership.h"
+
+// Spawns and despawns objects whose draws land in several draw workloads and
+// compares draw-set maintenance cost: the sorted vector with per-call suffix
+// uploads that SortedUnsignedIntBuffer uses, against DrawSetMembership with
+// one coalesced commit per frame. Upload volume is counted, not performed.
+//
+// Usage: DrawSetMembershipBenchmark [objects=100000] [workloads=4] [frames=8]
+
+namespace
+{
+    struct UploadTotals {
+        uint64_t writes = 0;
+        uint64_t bytes = 0;
+    };
+
+    // Mirrors SortedUnsignedIntBuffer::Insert/Remove, minus the GPU.
+    class SortedVectorDrawSet {
+    public:
+        void Insert(uint32_t element, UploadTotals& uploads) {
+            auto it = std::lower_bound(m_data.begin(), m_data.end(), element);
+            if (it != m_data.end() && *it == element) {
+                return;
+            }
+            const size_t index = static_cast<size_t>(it - m_data.begin());
+            m_data.insert(it, element);
+            ++uploads.writes;
+            uploads.bytes += (m_data.size() - index) * sizeof(uint32_t);
+        }
+
+        void Remove(uint32_t element, UploadTotals& uploads) {
+            auto it = std::lower_bound(m_data.begin(), m_data.end(), element);
+            if (it == m_data.end() || *it != element) {
+                return;
+            }
+            const size_t index = static_cast<size_t>(it - m_data.begin());
+            m_data.erase(it);
+            if (index < m_data.size()) {
+                ++uploads.writes;
+                uploads.bytes += (m_data.size() - index) * sizeof(uint32_t);
+            }
+            ++uploads.writes;
+            uploads.bytes += sizeof(uint32_t);
+        }
+
+    private:
+        std::vector<uint32_t> m_data;
+    };
+
+    struct ObjectDraws {
+        std::vector<uint32_t> commandIndices;
+        std::vector<uint32_t> workloadMask;
+    };
+
+    // Frame-sized batches of spawns followed by frame-sized batches of despawns
+    // in random order, as when a streamed cell loads and later unloads.
+    std::vector<ObjectDraws> BuildScene(uint32_t objectCount, uint32_t workloadCount, std::mt19937& rng) {
+        std::vector<ObjectDraws> objects(objectCount);
+        std::uniform_int_distribution<uint32_t> drawCount(1u, 3u);
+        std::uniform_int_distribution<uint32_t> mask(1u, (1u << workloadCount) - 1u);
+        uint32_t nextCommand = 0;
+        for (ObjectDraws& object : objects) {
+            const uint32_t draws = drawCount(rng);
+            for (uint32_t i = 0; i < draws; ++i) {
+                object.commandIndices.push_back(nextCommand++);
+                object.workloadMask.push_back(mask(rng));
+            }
+        }
+        return objects;
+    }
+
+    template<typename Fn>
+    void ForEachMembership(const ObjectDraws& object, uint32_t workloadCount, Fn&& fn) {
+        for (size_t draw = 0; draw < object.commandIndices.size(); ++draw) {
+            for (uint32_t workload = 0; workload < workloadCount; ++workload) {
+                if (object.workloadMask[draw] & (1u << workload)) {
+                    fn(workload, object.commandIndices[draw]);
+                }
+            }
+        }
+    }
+
+    void Report(const char* label, double seconds, const UploadTotals& uploads) {
+        std::printf("  %-34s %9.2f ms  %10llu writes  %10.2f MiB uploaded\n",
+            label,
+            seconds * 1e3,
+            static_cast<unsigned long long>(uploads.writes),
+            static_cast<double>(uploads.bytes) / (1024.0 * 1024.0));
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const uint32_t objectCount = argc > 1 ? static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10)) : 100000u;
+    const uint32_t workloadCount = std::clamp<uint32_t>(argc > 2 ? static_cast<uint32_t>(std::strtoul(argv[2], nullptr, 10)) : 4u, 1u, 16u);
+    const uint32_t frames = (std::max)(argc > 3 ? static_cast<uint32_t>(std::strtoul(argv[3], nullptr, 10)) : 8u, 1u);
+
+    std::mt19937 rng(1234u);
+    const std::vector<ObjectDraws> objects = BuildScene(objectCount, workloadCount, rng);
+    std::vector<uint32_t> despawnOrder(objectCount);
+    std::iota(despawnOrder.begin(), despawnOrder.end(), 0u);
+    std::shuffle(despawnOrder.begin(), despawnOrder.end(), rng);
+    const uint32_t perFrame = (objectCount + frames - 1u) / frames;
+
+    std::printf("%u objects, %u draw workloads, spread over %u frames each way\n", objectCount, workloadCount, frames);
+
+    {
+        std::vector<SortedVectorDrawSet> sets(workloadCount);
+        UploadTotals spawnUploads;
+        auto start = std::chrono::steady_clock::now();
+        for (const ObjectDraws& object : objects) {
+            ForEachMembership(object, workloadCount, [&](uint32_t workload, uint32_t command) {
+                sets[workload].Insert(command, spawnUploads);
+            });
+        }
+        const double spawnSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        UploadTotals despawnUploads;
+        start = std::chrono::steady_clock::now();
+        for (uint32_t objectIndex : despawnOrder) {
+            ForEachMembership(objects[objectIndex], workloadCount, [&](uint32_t workload, uint32_t command) {
+                sets[workload].Remove(command, despawnUploads);
+            });
+        }
+        const double despawnSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        std::printf("sorted vector, upload per call:\n");
+        Report("spawn", spawnSeconds, spawnUploads);
+        Report("despawn", despawnSeconds, despawnUploads);
+    }
+
+    {
+        std::vector<DrawSetMembership> sets(workloadCount);
+        std::vector<DrawSetMembership::Span> spans;
+        auto commit = [&](UploadTotals& uploads) {
+            for (DrawSetMembership& set : sets) {
+                const uint32_t previousSize = set.GetCommittedSize();
+                set.CollectDirtySpans(spans);
+                for (const DrawSetMembership::Span& span : spans) {
+                    ++uploads.writes;
+                    uploads.bytes += static_cast<uint64_t>(span.slotCount) * sizeof(uint32_t);
+                }
+                if (set.Size() < previousSize) {
+                    ++uploads.writes;
+                    uploads.bytes += static_cast<uint64_t>(previousSize - set.Size()) * sizeof(uint32_t);
+                }
+            }
+        };
+
+        UploadTotals spawnUploads;
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t first = 0; first < objectCount; first += perFrame) {
+            const uint32_t last = (std::min)(objectCount, first + perFrame);
+            for (uint32_t objectIndex = first; objectIndex < last; ++objectIndex) {
+                ForEachMembership(objects[objectIndex], workloadCount, [&](uint32_t workload, uint32_t command) {
+                    sets[workload].Insert(command);
+                });
+            }
+            commit(spawnUploads);
+        }
+        const double spawnSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        UploadTotals despawnUploads;
+        start = std::chrono::steady_clock::now();
+        for (uint32_t first = 0; first < objectCount; first += perFrame) {
+            const uint32_t last = (std::min)(objectCount, first + perFrame);
+            for (uint32_t i = first; i < last; ++i) {
+                ForEachMembership(objects[despawnOrder[i]], workloadCount, [&](uint32_t workload, uint32_t command) {
+                    sets[workload].Remove(command);
+                });
+            }
+            commit(despawnUploads);
+        }
+        const double despawnSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        std::printf("dense set, one commit per frame:\n");
+        Report("spawn", spawnSeconds, spawnUploads);
+        Report("despawn", despawnSeconds, despawnUploads);
+    }
+    return 0;
+}
@@ -0,0 +1,247 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "Resources/Buffers/TlsfAllocator.h"
+
+// Churns a DynamicBuffer-style range allocator with a mix of small per-object
+// records and large mesh payloads, growing on failure the way DynamicBuffer
+// does. Compares the ordered map + best-fit set DynamicBuffer used before
+// against TlsfAllocator, then runs incremental defragmentation passes on the
+// TLSF heap. No GPU work is done; only allocator bookkeeping is measured.
+//
+// Usage: DynamicBufferAllocatorBenchmark [operations=2000000] [liveTarget=50000]
+
+namespace
+{
+    // Mirrors the previous DynamicBuffer::Allocate/Deallocate bookkeeping.
+    class OrderedBestFitAllocator {
+    public:
+        explicit OrderedBestFitAllocator(uint64_t capacity) {
+            m_blocks[0] = { capacity, true };
+            m_free.insert({ capacity, 0 });
+            m_capacity = capacity;
+        }
+
+        bool Allocate(uint64_t size, uint64_t& outOffset) {
+            auto freeIt = m_free.lower_bound({ size, 0 });
+            if (freeIt == m_free.end()) {
+                return false;
+            }
+            const uint64_t offset = freeIt->second;
+            m_free.erase(freeIt);
+            Block& block = m_blocks[offset];
+            const uint64_t remaining = block.size - size;
+            block.isFree = false;
+            block.size = size;
+            if (remaining > 0) {
+                m_blocks[offset + size] = { remaining, true };
+                m_free.insert({ remaining, offset + size });
+            }
+            outOffset = offset;
+            return true;
+        }
+
+        void Free(uint64_t offset) {
+            auto it = m_blocks.find(offset);
+            it->second.isFree = true;
+            auto next = std::next(it);
+            if (next != m_blocks.end() && next->second.isFree) {
+                m_free.erase({ next->second.size, next->first });
+                it->second.size += next->second.size;
+                m_blocks.erase(next);
+            }
+            if (it != m_blocks.begin()) {
+                auto prev = std::prev(it);
+                if (prev->second.isFree) {
+                    m_free.erase({ prev->second.size, prev->first });
+                    prev->second.size += it->second.size;
+                    m_blocks.erase(it);
+                    it = prev;
+                }
+            }
+            m_free.insert({ it->second.size, it->first });
+        }
+
+        void Grow(uint64_t newCapacity) {
+            uint64_t offset = m_capacity;
+            auto last = std::prev(m_blocks.end());
+            if (last->second.isFree) {
+                offset = last->first;
+                m_free.erase({ last->second.size, last->first });
+                m_blocks.erase(last);
+            }
+            m_capacity = newCapacity;
+            m_blocks[offset] = { m_capacity - offset, true };
+            m_free.insert({ m_capacity - offset, offset });
+        }
+
+        uint64_t GetCapacity() const { return m_capacity; }
+        uint64_t GetTrailingFreeBytes() const {
+            auto last = std::prev(m_blocks.end());
+            return last->second.isFree ? last->second.size : 0;
+        }
+        uint64_t GetLargestFreeBlock() const { return m_free.empty() ? 0 : m_free.rbegin()->first; }
+        size_t GetFreeBlockCount() const { return m_free.size(); }
+
+    private:
+        struct Block {
+            uint64_t size = 0;
+            bool isFree = false;
+        };
+        std::map<uint64_t, Block> m_blocks;
+        std::set<std::pair<uint64_t, uint64_t>> m_free;
+        uint64_t m_capacity = 0;
+    };
+
+    struct Live {
+        uint64_t offset = 0;
+        uint64_t size = 0;
+        uint32_t handle = TlsfAllocator::kInvalidHandle;
+    };
+
+    // 90% per-object constant records, 10% mesh-sized payloads.
+    uint64_t DrawSize(std::mt19937& rng) {
+        std::uniform_int_distribution<uint32_t> kind(0u, 9u);
+        if (kind(rng) != 0u) {
+            std::uniform_int_distribution<uint32_t> records(1u, 4u);
+            return static_cast<uint64_t>(records(rng)) * 256u;
+        }
+        std::uniform_int_distribution<uint32_t> payload(4u * 1024u, 512u * 1024u);
+        return payload(rng) & ~uint64_t(15u);
+    }
+
+    template<typename AllocateFn, typename FreeFn, typename GrowFn>
+    double Churn(uint32_t operations, uint32_t liveTarget, std::vector<Live>& live,
+        AllocateFn&& allocate, FreeFn&& freeFn, GrowFn&& grow, uint32_t& outGrows) {
+        std::mt19937 rng(7u);
+        outGrows = 0;
+        live.clear();
+        const auto start = std::chrono::steady_clock::now();
+        for (uint32_t op = 0; op < operations; ++op) {
+            // Bias towards allocation below the target and towards frees above it.
+            std::uniform_int_distribution<uint32_t> coin(0u, 2u * liveTarget);
+            if (!live.empty() && coin(rng) < live.size()) {
+                std::uniform_int_distribution<size_t> pick(0u, live.size() - 1u);
+                const size_t index = pick(rng);
+                freeFn(live[index]);
+                live[index] = live.back();
+                live.pop_back();
+                continue;
+            }
+
+            Live allocation{};
+            allocation.size = DrawSize(rng);
+            if (!allocate(allocation)) {
+                grow(allocation.size);
+                ++outGrows;
+                allocate(allocation);
+            }
+            live.push_back(allocation);
+        }
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    uint64_t GrowTarget(uint64_t capacity, uint64_t required, uint64_t trailingFree) {
+        const uint64_t newBlock = (std::max)(capacity, required);
+        return capacity + (newBlock > trailingFree ? newBlock - trailingFree : 0);
+    }
+
+    void Report(const char* label, double seconds, uint32_t operations, uint64_t capacity, uint64_t largestFree, uint64_t freeBytes, size_t freeBlocks, uint32_t grows) {
+        const double fragmentation = freeBytes ? 1.0 - static_cast<double>(largestFree) / static_cast<double>(freeBytes) : 0.0;
+        std::printf("  %-22s %8.2f ms  %6.1f ns/op  capacity %8.2f MiB  %6zu free blocks  largest %8.2f MiB  fragmentation %.3f  %u grows\n",
+            label,
+            seconds * 1e3,
+            seconds * 1e9 / operations,
+            static_cast<double>(capacity) / (1024.0 * 1024.0),
+            freeBlocks,
+            static_cast<double>(largestFree) / (1024.0 * 1024.0),
+            fragmentation,
+            grows);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const uint32_t operations = argc > 1 ? static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10)) : 2000000u;
+    const uint32_t liveTarget = (std::max)(argc > 2 ? static_cast<uint32_t>(std::strtoul(argv[2], nullptr, 10)) : 50000u, 1u);
+    constexpr uint64_t kInitialCapacity = 64u * 1024u;
+
+    std::printf("%u operations, ~%u live allocations\n", operations, liveTarget);
+    std::vector<Live> live;
+
+    {
+        OrderedBestFitAllocator allocator(kInitialCapacity);
+        uint32_t grows = 0;
+        const double seconds = Churn(operations, liveTarget, live,
+            [&](Live& allocation) { return allocator.Allocate(allocation.size, allocation.offset); },
+            [&](const Live& allocation) { allocator.Free(allocation.offset); },
+            [&](uint64_t required) { allocator.Grow(GrowTarget(allocator.GetCapacity(), required, allocator.GetTrailingFreeBytes())); },
+            grows);
+        uint64_t liveBytes = 0;
+        for (const Live& allocation : live) {
+            liveBytes += allocation.size;
+        }
+        Report("ordered map + set", seconds, operations, allocator.GetCapacity(), allocator.GetLargestFreeBlock(),
+            allocator.GetCapacity() - liveBytes, allocator.GetFreeBlockCount(), grows);
+    }
+
+    TlsfAllocator allocator(kInitialCapacity);
+    {
+        uint32_t grows = 0;
+        const double seconds = Churn(operations, liveTarget, live,
+            [&](Live& allocation) {
+                allocation.handle = allocator.Allocate(allocation.size, allocation.offset);
+                return allocation.handle != TlsfAllocator::kInvalidHandle;
+            },
+            [&](const Live& allocation) { allocator.Free(allocation.handle, allocation.offset, allocation.size); },
+            [&](uint64_t required) { allocator.Grow(GrowTarget(allocator.GetCapacity(), required, allocator.GetTrailingFreeBytes())); },
+            grows);
+        const TlsfAllocator::Stats stats = allocator.GetStats();
+        Report("tlsf", seconds, operations, stats.capacity, stats.largestFreeBlock, stats.freeBytes, stats.freeBlockCount, grows);
+    }
+
+    // Apply 4 MiB of moves per pass, as a renderer would spread compaction over frames.
+    constexpr uint64_t kMoveBudget = 4u * 1024u * 1024u;
+    std::vector<TlsfAllocator::Move> moves;
+    std::vector<size_t> liveBySourceHandle;
+    uint64_t totalMoved = 0;
+    uint32_t passes = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (; passes < 64; ++passes) {
+        allocator.PlanDefragmentation(kMoveBudget, moves);
+        if (moves.empty()) {
+            break;
+        }
+        for (size_t i = 0; i < live.size(); ++i) {
+            if (live[i].handle >= liveBySourceHandle.size()) {
+                liveBySourceHandle.resize(live[i].handle + 1u);
+            }
+            liveBySourceHandle[live[i].handle] = i;
+        }
+        for (const TlsfAllocator::Move& move : moves) {
+            Live& allocation = live[liveBySourceHandle[move.sourceHandle]];
+            allocator.Free(move.sourceHandle, move.sourceOffset, move.size);
+            allocation.handle = move.destinationHandle;
+            allocation.offset = move.destinationOffset;
+            totalMoved += move.size;
+        }
+    }
+    const double defragSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    const TlsfAllocator::Stats stats = allocator.GetStats();
+    std::printf("  defragmentation: %u passes, %.2f MiB moved, %.2f ms planning -> %u free blocks, largest %.2f MiB, fragmentation %.3f, trailing free %.2f MiB\n",
+        passes,
+        static_cast<double>(totalMoved) / (1024.0 * 1024.0),
+        defragSeconds * 1e3,
+        stats.freeBlockCount,
+        static_cast<double>(stats.largestFreeBlock) / (1024.0 * 1024.0),
+        stats.fragmentation,
+        static_cast<double>(allocator.GetTrailingFreeBytes()) / (1024.0 * 1024.0));
+    return 0;
+}
@@ -0,0 +1,223 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "Scene/InstanceClusterBVH.h"
+
+// Build and cull cost of InstanceClusterBVH on a synthetic scatter: foliage
+// and rocks over a square terrain with a few building-sized occluders. Each
+// view is culled hierarchically, with flat per-cluster tests, and with a
+// per-instance sphere-frustum loop (what expanding every instance into its
+// own object costs the CPU before any draw work). The hierarchical and flat
+// results must match.
+//
+// Usage: InstanceClusterBenchmark [instances=10000000] [clusterSize=256]
+
+namespace
+{
+    using Float3 = InstanceClusterBVH::Float3;
+    using Plane = InstanceClusterBVH::Plane;
+
+    constexpr float kTerrainHalfExtent = 5000.0f;
+    constexpr uint32_t kPrototypeCount = 8;
+
+    struct Scatter {
+        std::vector<Float3> centers;
+        std::vector<float> radii;
+        std::vector<uint32_t> prototypes;
+    };
+
+    Scatter BuildScatter(uint32_t instanceCount) {
+        Scatter scatter;
+        scatter.centers.resize(instanceCount);
+        scatter.radii.resize(instanceCount);
+        scatter.prototypes.resize(instanceCount);
+
+        std::mt19937 rng(7u);
+        std::uniform_real_distribution<float> ground(-kTerrainHalfExtent, kTerrainHalfExtent);
+        std::uniform_int_distribution<uint32_t> prototype(0u, kPrototypeCount - 1u);
+        std::uniform_real_distribution<float> scale(0.5f, 1.5f);
+        for (uint32_t i = 0; i < instanceCount; ++i) {
+            const float x = ground(rng);
+            const float z = ground(rng);
+            scatter.prototypes[i] = prototype(rng);
+            // Prototype 0 is a tree, the rest grass and rocks.
+            const float size = (scatter.prototypes[i] == 0 ? 4.0f : 0.5f) * scale(rng);
+            scatter.centers[i] = { x, size + 20.0f * std::sin(x * 0.002f) * std::cos(z * 0.002f), z };
+            scatter.radii[i] = size;
+        }
+        return scatter;
+    }
+
+    float Dot(const Float3& a, const Float3& b) {
+        return a.x * b.x + a.y * b.y + a.z * b.z;
+    }
+
+    Float3 Cross(const Float3& a, const Float3& b) {
+        return { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x };
+    }
+
+    Float3 Normalize(const Float3& v) {
+        const float length = std::sqrt(Dot(v, v));
+        return { v.x / length, v.y / length, v.z / length };
+    }
+
+    Plane MakePlane(const Float3& normal, const Float3& point) {
+        const Float3 n = Normalize(normal);
+        return { n, -Dot(n, point) };
+    }
+
+    struct View {
+        const char* name;
+        Float3 eye;
+        Float3 forward;
+        float farPlane;
+        float maxDistance;
+        bool prototypeLimits;
+        bool occluders;
+    };
+
+    std::vector<Plane> BuildFrustum(const View& view, float verticalFov, float aspect) {
+        const Float3 forward = Normalize(view.forward);
+        const Float3 right = Normalize(Cross(forward, { 0.0f, 1.0f, 0.0f }));
+        const Float3 up = Cross(right, forward);
+        const float tanY = std::tan(verticalFov * 0.5f);
+        const float tanX = tanY * aspect;
+        auto along = [&](float f, float r, float u) {
+            return Float3{ forward.x * f + right.x * r + up.x * u, forward.y * f + right.y * r + up.y * u, forward.z * f + right.z * r + up.z * u };
+        };
+        const Float3 farPoint = { view.eye.x + forward.x * view.farPlane, view.eye.y + forward.y * view.farPlane, view.eye.z + forward.z * view.farPlane };
+        // Each side plane contains the eye and one frustum edge direction; its
+        // inward normal leans towards the view direction.
+        auto side = [&](const Float3& a, const Float3& b) {
+            Float3 normal = Cross(a, b);
+            if (Dot(normal, forward) < 0.0f) {
+                normal = { -normal.x, -normal.y, -normal.z };
+            }
+            return MakePlane(normal, view.eye);
+        };
+        return {
+            MakePlane(forward, { view.eye.x + forward.x * 0.1f, view.eye.y + forward.y * 0.1f, view.eye.z + forward.z * 0.1f }),
+            MakePlane({ -forward.x, -forward.y, -forward.z }, farPoint),
+            side(up, along(1.0f, -tanX, 0.0f)),
+            side(up, along(1.0f, tanX, 0.0f)),
+            side(right, along(1.0f, 0.0f, tanY)),
+            side(right, along(1.0f, 0.0f, -tanY)),
+        };
+    }
+
+    size_t CullInstances(const Scatter& scatter, const std::vector<Plane>& planes, const Float3& eye, float maxDistance) {
+        size_t visible = 0;
+        for (size_t i = 0; i < scatter.centers.size(); ++i) {
+            const Float3& c = scatter.centers[i];
+            const float r = scatter.radii[i];
+            bool inside = true;
+            for (const Plane& plane : planes) {
+                if (Dot(plane.normal, c) + plane.distance < -r) {
+                    inside = false;
+                    break;
+                }
+            }
+            const Float3 d = { c.x - eye.x, c.y - eye.y, c.z - eye.z };
+            const float reach = maxDistance + r;
+            visible += inside && Dot(d, d) <= reach * reach;
+        }
+        return visible;
+    }
+
+    template<typename Fn>
+    double TimeMs(uint32_t repeats, Fn&& fn) {
+        const auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < repeats; ++i) {
+            fn();
+        }
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / repeats;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const uint32_t instanceCount = (std::max)(argc > 1 ? static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10)) : 10000000u, 1u);
+    const uint32_t clusterSize = (std::max)(argc > 2 ? static_cast<uint32_t>(std::strtoul(argv[2], nullptr, 10)) : 256u, 1u);
+
+    const Scatter scatter = BuildScatter(instanceCount);
+
+    InstanceClusterBVH bvh;
+    InstanceClusterBVH::BuildSettings settings;
+    settings.maxInstancesPerCluster = clusterSize;
+    const double buildMs = TimeMs(1, [&]() {
+        bvh.Build(scatter.centers, scatter.radii, scatter.prototypes, settings);
+    });
+    std::printf("%u instances, %zu clusters, %zu nodes, build %.1f ms\n",
+        instanceCount, bvh.GetClusters().size(), bvh.GetNodes().size(), buildMs);
+
+    // City blocks near the origin that hide the foliage behind them.
+    std::vector<InstanceClusterBVH::Aabb> occluders;
+    for (int i = 0; i < 6; ++i) {
+        const float x = -150.0f + 60.0f * i;
+        occluders.push_back({ { x, -50.0f, 40.0f }, { x + 40.0f, 80.0f, 80.0f } });
+    }
+    // Grass and rocks fade out long before trees.
+    std::vector<float> prototypeMaxDistances(kPrototypeCount, 300.0f);
+    prototypeMaxDistances[0] = 2000.0f;
+
+    const View views[] = {
+        { "ground, no limits", { 0.0f, 2.0f, 0.0f }, { 0.0f, -0.05f, 1.0f }, 10000.0f, 10000.0f, false, false },
+        { "ground, 2 km limit", { 0.0f, 2.0f, 0.0f }, { 0.0f, -0.05f, 1.0f }, 10000.0f, 2000.0f, false, false },
+        { "ground, per-prototype limits", { 0.0f, 2.0f, 0.0f }, { 0.0f, -0.05f, 1.0f }, 10000.0f, 2000.0f, true, false },
+        { "street behind occluders", { 0.0f, 2.0f, 0.0f }, { 0.0f, 0.0f, 1.0f }, 10000.0f, 2000.0f, true, true },
+        { "aerial, looking down", { 0.0f, 1500.0f, -1500.0f }, { 0.0f, -1.0f, 0.6f }, 10000.0f, 10000.0f, false, false },
+    };
+
+    bool consistent = true;
+    std::vector<uint32_t> hierarchical;
+    std::vector<uint32_t> flat;
+    for (const View& view : views) {
+        const std::vector<Plane> planes = BuildFrustum(view, 1.0f, 16.0f / 9.0f);
+
+        InstanceClusterBVH::CullParams params;
+        params.frustumPlanes = planes;
+        params.eye = view.eye;
+        params.maxDistance = view.maxDistance;
+        if (view.prototypeLimits) {
+            params.prototypeMaxDistances = prototypeMaxDistances;
+        }
+        if (view.occluders) {
+            params.occluders = occluders;
+        }
+
+        InstanceClusterBVH::CullStats stats;
+        InstanceClusterBVH::CullStats flatStats;
+        const double bvhMs = TimeMs(20, [&]() {
+            hierarchical.clear();
+            bvh.Cull(params, hierarchical, &stats);
+        });
+        const double flatMs = TimeMs(5, [&]() {
+            flat.clear();
+            bvh.CullFlat(params, flat, &flatStats);
+        });
+        size_t instanceVisible = 0;
+        const double instanceMs = TimeMs(1, [&]() {
+            instanceVisible = CullInstances(scatter, planes, view.eye, view.maxDistance);
+        });
+
+        std::printf("  %s\n", view.name);
+        std::printf("    bvh      %8.3f ms  %6u nodes  %7u clusters tested  %7u visible (%llu instances)  culled: %u frustum, %u distance, %u occluded\n",
+            bvhMs, stats.nodesVisited, stats.clustersTested, stats.clustersVisible,
+            static_cast<unsigned long long>(stats.visibleInstances), stats.frustumCulled, stats.distanceCulled, stats.occluded);
+        std::printf("    flat     %8.3f ms  %7u clusters tested\n", flatMs, flatStats.clustersTested);
+        std::printf("    instance %8.3f ms  %zu instances visible (no occlusion, no per-prototype limits)\n", instanceMs, instanceVisible);
+
+        consistent = consistent && hierarchical == flat && stats.visibleInstances == flatStats.visibleInstances;
+    }
+
+    if (!consistent) {
+        std::printf("hierarchical and flat cull disagree\n");
+    }
+    return consistent ? 0 : 1;
+}
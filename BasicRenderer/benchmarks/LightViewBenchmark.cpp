@@ -0,0 +1,249 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <DirectXMath.h>
+
+#include "Managers/LightViewBuilder.h"
+
+// Per-frame CPU cost of refreshing point and spot light shadow views.
+// "full" rebuilds every light each frame the way LightManager used to: six
+// XMMatrixLookToRH calls per point light, one CameraInfo at a time. "batched"
+// rebuilds every light through BuildLocalLightViews on worker threads.
+// "dirty" first compares each light's LightViewSignature and only rebuilds
+// the lights that moved. The ViewManager upload is not included.
+//
+// Usage: LightViewBenchmark [lights=10000] [frames=60] [movingPercent=2]
+
+using namespace DirectX;
+
+namespace
+{
+	struct Light {
+		XMFLOAT4X4 matrix;
+		XMFLOAT4X4 projection;
+		bool isPoint;
+		std::vector<std::array<ClippingPlane, 6>> planes;
+	};
+
+	std::vector<Light> BuildLights(uint32_t count, std::mt19937& rng) {
+		std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+		std::vector<Light> lights(count);
+		for (Light& light : lights) {
+			light.isPoint = unit(rng) < 0.6f;
+			const XMMATRIX world = XMMatrixRotationRollPitchYaw(unit(rng) * XM_PI, unit(rng) * XM_PI, 0.0f)
+				* XMMatrixTranslation(unit(rng) * 200.0f, unit(rng) * 20.0f, unit(rng) * 200.0f);
+			XMStoreFloat4x4(&light.matrix, world);
+			XMStoreFloat4x4(&light.projection, light.isPoint
+				? XMMatrixPerspectiveFovRH(XM_PIDIV2, 1.0f, 0.1f, 25.0f)
+				: XMMatrixPerspectiveFovRH(XM_PIDIV4, 1.0f, 0.1f, 40.0f));
+			light.planes.resize(light.isPoint ? 6u : 1u);
+		}
+		return lights;
+	}
+
+	// The per-light path LightManager::UpdateLightViewInfo used before batching.
+	void BuildFull(const std::vector<Light>& lights, std::vector<CameraInfo>& cameras) {
+		static const XMVECTOR targets[6] = {
+			XMVectorSet(1.0f, 0.0f, 0.0f, 0.0f), XMVectorSet(-1.0f, 0.0f, 0.0f, 0.0f),
+			XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f), XMVectorSet(0.0f, -1.0f, 0.0f, 0.0f),
+			XMVectorSet(0.0f, 0.0f, -1.0f, 0.0f), XMVectorSet(0.0f, 0.0f, 1.0f, 0.0f),
+		};
+		static const XMVECTOR ups[6] = {
+			XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f), XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f),
+			XMVectorSet(0.0f, 0.0f, 1.0f, 0.0f), XMVectorSet(0.0f, 0.0f, -1.0f, 0.0f),
+			XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f), XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f),
+		};
+
+		size_t cameraIndex = 0;
+		for (const Light& light : lights) {
+			const XMMATRIX world = XMLoadFloat4x4(&light.matrix);
+			const XMMATRIX projection = XMLoadFloat4x4(&light.projection);
+			const XMFLOAT3 position = { light.matrix._41, light.matrix._42, light.matrix._43 };
+			const int faceCount = light.isPoint ? 6 : 1;
+			for (int face = 0; face < faceCount; ++face) {
+				CameraInfo info = {};
+				info.positionWorldSpace = { position.x, position.y, position.z, 1.0f };
+				info.view = light.isPoint
+					? XMMatrixLookToRH(XMLoadFloat3(&position), targets[face], ups[face])
+					: XMMatrixLookToRH(XMLoadFloat3(&position), XMVector3Normalize(world.r[2]), ups[0]);
+				info.unjitteredProjection = projection;
+				info.jitteredProjection = projection;
+				info.prevView = info.view;
+				info.prevJitteredProjection = projection;
+				info.prevUnjitteredProjection = projection;
+				info.viewProjection = XMMatrixMultiply(info.view, projection);
+				for (int i = 0; i < 6; ++i) {
+					info.clippingPlanes[i] = light.planes[face][i];
+				}
+				info.depthBufferArrayIndex = face;
+				info.depthResX = 2048;
+				info.depthResY = 2048;
+				info.uvScaleToNextPowerOfTwo = { 1.0f, 1.0f };
+				info.numDepthMips = static_cast<uint32_t>(std::floor(std::log2(2048.0))) + 1u;
+				cameras[cameraIndex++] = info;
+			}
+		}
+	}
+
+	LightViewSignature BuildSignature(const Light& light) {
+		LightViewSignature signature{};
+		signature.lightMatrix = light.matrix;
+		signature.projection = light.projection;
+		signature.viewCount = light.isPoint ? 6u : 1u;
+		signature.depthResX = 2048;
+		signature.depthResY = 2048;
+		signature.planesHash = HashFrustumPlanes(light.planes);
+		return signature;
+	}
+
+	void AddToBatch(LocalLightViewBatch& batch, const Light& light) {
+		const XMFLOAT3 position = { light.matrix._41, light.matrix._42, light.matrix._43 };
+		const XMMATRIX projection = XMLoadFloat4x4(&light.projection);
+		if (light.isPoint) {
+			batch.AddPoint(position, projection, { 2048, 2048 }, light.planes.data());
+		}
+		else {
+			XMFLOAT3 direction;
+			XMStoreFloat3(&direction, XMVector3Normalize(XMLoadFloat4x4(&light.matrix).r[2]));
+			batch.AddSpot(position, direction, projection, { 2048, 2048 }, light.planes.data());
+		}
+	}
+
+	// Stand-in for TaskSchedulerManager::ParallelFor, with the same 64-light tasks as LightManager.
+	void BuildParallel(LocalLightViewBatch& batch, uint32_t threadCount) {
+		static constexpr size_t kLightsPerTask = 64;
+		const size_t lightCount = batch.Size();
+		const size_t taskCount = (lightCount + kLightsPerTask - 1) / kLightsPerTask;
+		if (taskCount <= 1 || threadCount <= 1) {
+			BuildLocalLightViews(batch, 0, lightCount);
+			return;
+		}
+
+		std::atomic<size_t> next{ 0 };
+		std::vector<std::thread> workers;
+		for (uint32_t t = 0; t < threadCount; ++t) {
+			workers.emplace_back([&]() {
+				for (size_t task = next.fetch_add(1u); task < taskCount; task = next.fetch_add(1u)) {
+					const size_t begin = task * kLightsPerTask;
+					BuildLocalLightViews(batch, begin, (std::min)(begin + kLightsPerTask, lightCount));
+				}
+			});
+		}
+		for (std::thread& worker : workers) {
+			worker.join();
+		}
+	}
+
+	void Animate(std::vector<Light>& lights, const std::vector<uint32_t>& moving, uint32_t frame) {
+		const float offset = (frame & 1u) ? 0.05f : -0.05f;
+		for (uint32_t index : moving) {
+			lights[index].matrix._41 += offset;
+			lights[index].matrix._43 -= offset;
+		}
+	}
+
+	template<typename Fn>
+	double TimeSeconds(Fn&& fn) {
+		const auto start = std::chrono::steady_clock::now();
+		fn();
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const uint32_t lightCount = (std::max)(argc > 1 ? static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10)) : 10000u, 1u);
+	const uint32_t frames = (std::max)(argc > 2 ? static_cast<uint32_t>(std::strtoul(argv[2], nullptr, 10)) : 60u, 1u);
+	const double movingPercent = argc > 3 ? std::strtod(argv[3], nullptr) : 2.0;
+	const uint32_t threadCount = (std::max)(std::thread::hardware_concurrency(), 1u);
+
+	std::mt19937 rng(7u);
+	std::vector<Light> lights = BuildLights(lightCount, rng);
+	std::vector<uint32_t> moving;
+	std::bernoulli_distribution isMoving(movingPercent / 100.0);
+	for (uint32_t i = 0; i < lightCount; ++i) {
+		if (isMoving(rng)) {
+			moving.push_back(i);
+		}
+	}
+
+	size_t cameraCount = 0;
+	for (const Light& light : lights) {
+		cameraCount += light.isPoint ? 6u : 1u;
+	}
+	std::printf("%u lights (%zu shadow views), %zu moving, %u frames, %u threads\n", lightCount, cameraCount, moving.size(), frames, threadCount);
+
+	std::vector<CameraInfo> fullCameras(cameraCount);
+	double fullSeconds = 0.0;
+	for (uint32_t frame = 0; frame < frames; ++frame) {
+		Animate(lights, moving, frame);
+		fullSeconds += TimeSeconds([&]() { BuildFull(lights, fullCameras); });
+	}
+
+	LocalLightViewBatch batch;
+	double batchedSeconds = 0.0;
+	for (uint32_t frame = 0; frame < frames; ++frame) {
+		Animate(lights, moving, frame);
+		batchedSeconds += TimeSeconds([&]() {
+			batch.Clear();
+			batch.Reserve(lights.size());
+			for (const Light& light : lights) {
+				AddToBatch(batch, light);
+			}
+			BuildParallel(batch, threadCount);
+		});
+	}
+
+	// Both paths just ran on the same final light state.
+	BuildFull(lights, fullCameras);
+	float maxViewError = 0.0f;
+	for (size_t i = 0; i < cameraCount; ++i) {
+		for (int row = 0; row < 4; ++row) {
+			const XMVECTOR diff = XMVectorAbs(XMVectorSubtract(fullCameras[i].view.r[row], batch.cameras[i].view.r[row]));
+			maxViewError = (std::max)(maxViewError, XMVectorGetX(XMVector4Dot(diff, XMVectorSplatOne())));
+		}
+	}
+
+	std::unordered_map<uint32_t, LightViewSignature> signatures;
+	for (uint32_t i = 0; i < lightCount; ++i) {
+		signatures.emplace(i, BuildSignature(lights[i]));
+	}
+	double dirtySeconds = 0.0;
+	size_t rebuilt = 0;
+	for (uint32_t frame = 0; frame < frames; ++frame) {
+		Animate(lights, moving, frame);
+		dirtySeconds += TimeSeconds([&]() {
+			batch.Clear();
+			for (uint32_t i = 0; i < lightCount; ++i) {
+				const LightViewSignature signature = BuildSignature(lights[i]);
+				LightViewSignature& cached = signatures[i];
+				if (cached == signature) {
+					continue;
+				}
+				cached = signature;
+				AddToBatch(batch, lights[i]);
+			}
+			BuildParallel(batch, threadCount);
+		});
+		rebuilt += batch.Size();
+	}
+
+	const double fullMs = fullSeconds * 1e3 / frames;
+	const double batchedMs = batchedSeconds * 1e3 / frames;
+	const double dirtyMs = dirtySeconds * 1e3 / frames;
+	std::printf("  %-28s %9.3f ms/frame\n", "full, per light", fullMs);
+	std::printf("  %-28s %9.3f ms/frame  %6.1fx\n", "batched, every light", batchedMs, fullMs / batchedMs);
+	std::printf("  %-28s %9.3f ms/frame  %6.1fx  (%.1f lights rebuilt/frame)\n", "dirty-driven", dirtyMs, fullMs / dirtyMs, static_cast<double>(rebuilt) / frames);
+	std::printf("  max view matrix difference vs full: %g\n", maxViewError);
+	return maxViewError < 1e-3f ? 0 : 1;
+}
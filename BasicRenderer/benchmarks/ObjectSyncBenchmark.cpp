@@ -0,0 +1,214 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include <DirectXMath.h>
+
+#include "Utilities/AffineInverse.h"
+
+// Per-frame CPU cost of RenderResourceSync's object pass over scenes with
+// different animated fractions. "full" visits every object with two general
+// XMMatrixInverse calls and a determinant. "change-driven" visits only moved
+// objects through ComputeAffineInverse, plus a prevModelMatrix-only settle
+// visit on the frame after an object stops. Single-threaded; the renderer
+// spreads the same work over ParallelFor.
+//
+// Usage: ObjectSyncBenchmark [objects=200000] [frames=60]
+
+using namespace DirectX;
+
+namespace
+{
+    // Same layout role as PerObjectCB: model, prev model, inverse, flags.
+    struct alignas(16) ObjectRecord {
+        XMMATRIX modelMatrix;
+        XMMATRIX prevModelMatrix;
+        XMMATRIX modelInverseMatrix;
+        uint32_t objectFlags;
+    };
+
+    struct Scene {
+        std::vector<XMMATRIX> world;
+        std::vector<ObjectRecord> records;
+        std::vector<XMFLOAT4X4> normalMatrices;
+        std::vector<uint8_t> animated;
+        std::vector<uint8_t> scratch;
+    };
+
+    Scene BuildScene(uint32_t objectCount, double animatedFraction, std::mt19937& rng) {
+        Scene scene;
+        scene.world.resize(objectCount);
+        scene.records.resize(objectCount);
+        scene.normalMatrices.resize(objectCount);
+        scene.animated.resize(objectCount);
+        scene.scratch.resize(static_cast<size_t>(objectCount) * (sizeof(ObjectRecord) + sizeof(XMFLOAT4X4)));
+
+        std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+        std::uniform_real_distribution<float> scale(0.5f, 2.0f);
+        std::bernoulli_distribution isAnimated(animatedFraction);
+        for (uint32_t i = 0; i < objectCount; ++i) {
+            scene.world[i] = XMMatrixScaling(scale(rng), scale(rng), scale(rng))
+                * XMMatrixRotationRollPitchYaw(unit(rng) * XM_PI, unit(rng) * XM_PI, unit(rng) * XM_PI)
+                * XMMatrixTranslation(unit(rng) * 500.0f, unit(rng) * 500.0f, unit(rng) * 500.0f);
+            scene.animated[i] = isAnimated(rng) ? 1u : 0u;
+            scene.records[i].modelMatrix = scene.world[i];
+        }
+        return scene;
+    }
+
+    void Animate(Scene& scene, uint32_t frame) {
+        const XMMATRIX step = XMMatrixRotationY(0.01f) * XMMatrixTranslation(0.0f, 0.001f * static_cast<float>(frame & 1u ? 1 : -1), 0.0f);
+        for (size_t i = 0; i < scene.world.size(); ++i) {
+            if (scene.animated[i] != 0u) {
+                scene.world[i] = scene.world[i] * step;
+            }
+        }
+    }
+
+    void WriteRecord(Scene& scene, size_t index) {
+        std::memcpy(scene.scratch.data() + index * sizeof(ObjectRecord), &scene.records[index], sizeof(ObjectRecord));
+    }
+
+    void WriteNormalMatrix(Scene& scene, size_t index) {
+        const size_t base = scene.records.size() * sizeof(ObjectRecord);
+        std::memcpy(scene.scratch.data() + base + index * sizeof(XMFLOAT4X4), &scene.normalMatrices[index], sizeof(XMFLOAT4X4));
+    }
+
+    void SyncFull(Scene& scene) {
+        for (size_t i = 0; i < scene.world.size(); ++i) {
+            ObjectRecord& record = scene.records[i];
+            const XMMATRIX world = scene.world[i];
+            record.prevModelMatrix = record.modelMatrix;
+            record.modelMatrix = world;
+            record.modelInverseMatrix = XMMatrixInverse(nullptr, world);
+            record.objectFlags = XMVectorGetX(XMMatrixDeterminant(world)) < 0.0f ? 1u : 0u;
+            WriteRecord(scene, i);
+
+            const XMMATRIX upperLeft3x3 = XMMatrixSet(
+                XMVectorGetX(world.r[0]), XMVectorGetY(world.r[0]), XMVectorGetZ(world.r[0]), 0.0f,
+                XMVectorGetX(world.r[1]), XMVectorGetY(world.r[1]), XMVectorGetZ(world.r[1]), 0.0f,
+                XMVectorGetX(world.r[2]), XMVectorGetY(world.r[2]), XMVectorGetZ(world.r[2]), 0.0f,
+                0.0f, 0.0f, 0.0f, 1.0f);
+            XMStoreFloat4x4(&scene.normalMatrices[i], XMMatrixInverse(nullptr, upperLeft3x3));
+            WriteNormalMatrix(scene, i);
+        }
+    }
+
+    // The renderer gets these lists by comparing RenderTransformStamp against
+    // RenderTransformSyncWindow; here they are maintained directly.
+    void SyncChangeDriven(Scene& scene, std::vector<uint32_t>& moved, std::vector<uint32_t>& settling) {
+        for (uint32_t index : settling) {
+            ObjectRecord& record = scene.records[index];
+            record.prevModelMatrix = record.modelMatrix;
+            WriteRecord(scene, index);
+        }
+        settling.clear();
+
+        for (uint32_t index : moved) {
+            ObjectRecord& record = scene.records[index];
+            const XMMATRIX world = scene.world[index];
+            record.prevModelMatrix = record.modelMatrix;
+            record.modelMatrix = world;
+            const AffineInverse inverse = ComputeAffineInverse(world);
+            record.modelInverseMatrix = inverse.inverse;
+            record.objectFlags = inverse.reverseWinding ? 1u : 0u;
+            WriteRecord(scene, index);
+            XMStoreFloat4x4(&scene.normalMatrices[index], inverse.normalMatrix);
+            WriteNormalMatrix(scene, index);
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const uint32_t objectCount = argc > 1 ? static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10)) : 200000u;
+    const uint32_t frames = (std::max)(argc > 2 ? static_cast<uint32_t>(std::strtoul(argv[2], nullptr, 10)) : 60u, 1u);
+    const double fractions[] = { 0.0, 0.01, 0.05, 0.25, 1.0 };
+
+    std::printf("%u objects, %u frames per case\n", objectCount, frames);
+    std::printf("  %-10s %14s %18s %10s\n", "animated", "full ms/frame", "change ms/frame", "speedup");
+    for (double fraction : fractions) {
+        std::mt19937 rng(99u);
+        Scene fullScene = BuildScene(objectCount, fraction, rng);
+        rng.seed(99u);
+        Scene changeScene = BuildScene(objectCount, fraction, rng);
+
+        // Half of the animated objects come to rest midway, exercising the settle visit.
+        const uint32_t stopFrame = frames / 2u;
+        auto stopHalf = [](Scene& scene) {
+            for (size_t i = 0; i < scene.animated.size(); i += 2u) {
+                scene.animated[i] = 0u;
+            }
+        };
+
+        double fullSeconds = 0.0;
+        for (uint32_t frame = 0; frame < frames; ++frame) {
+            if (frame == stopFrame) {
+                stopHalf(fullScene);
+            }
+            Animate(fullScene, frame);
+            const auto start = std::chrono::steady_clock::now();
+            SyncFull(fullScene);
+            fullSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        }
+
+        std::vector<uint32_t> moved;
+        std::vector<uint32_t> settling;
+        double changeSeconds = 0.0;
+        for (uint32_t frame = 0; frame < frames; ++frame) {
+            if (frame == stopFrame) {
+                stopHalf(changeScene);
+            }
+            Animate(changeScene, frame);
+            const auto start = std::chrono::steady_clock::now();
+            // Moved last frame but not this one: settle once.
+            std::vector<uint32_t> movedThisFrame;
+            for (uint32_t index : moved) {
+                if (changeScene.animated[index] == 0u) {
+                    settling.push_back(index);
+                }
+            }
+            if (frame == 0u) {
+                moved.clear();
+                for (uint32_t i = 0; i < objectCount; ++i) {
+                    moved.push_back(i);
+                }
+            }
+            else {
+                for (uint32_t index : moved) {
+                    if (changeScene.animated[index] != 0u) {
+                        movedThisFrame.push_back(index);
+                    }
+                }
+                moved.swap(movedThisFrame);
+            }
+            SyncChangeDriven(changeScene, moved, settling);
+            changeSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        }
+
+        const double fullMs = fullSeconds * 1e3 / frames;
+        const double changeMs = changeSeconds * 1e3 / frames;
+        std::printf("  %8.0f%% %14.3f %18.3f %9.1fx\n", fraction * 100.0, fullMs, changeMs, changeMs > 0.0 ? fullMs / changeMs : 0.0);
+
+        // Both paths must leave identical per-object state behind.
+        float maxError = 0.0f;
+        for (uint32_t i = 0; i < objectCount; ++i) {
+            const ObjectRecord& full = fullScene.records[i];
+            const ObjectRecord& change = changeScene.records[i];
+            for (int row = 0; row < 4; ++row) {
+                const XMVECTOR inverseDiff = XMVectorAbs(XMVectorSubtract(full.modelInverseMatrix.r[row], change.modelInverseMatrix.r[row]));
+                const XMVECTOR prevDiff = XMVectorAbs(XMVectorSubtract(full.prevModelMatrix.r[row], change.prevModelMatrix.r[row]));
+                maxError = (std::max)(maxError, XMVectorGetX(XMVector4Dot(XMVectorAdd(inverseDiff, prevDiff), XMVectorSplatOne())));
+            }
+        }
+        if (maxError > 1e-3f) {
+            std::printf("    state mismatch: max row error %g\n", maxError);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,65 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "Managers/Singletons/SettingsManager.h"
+
+// Compares the per-read cost of the setting access paths used on hot code:
+// name lookup + std::function getter (old call-site pattern), a cached
+// std::function getter, a typed handle read, and a frame snapshot read.
+//
+// Usage: SettingsBenchmark [iterations=50000000]
+
+namespace
+{
+    volatile uint32_t g_sink = 0;
+
+    template<typename Fn>
+    void Measure(const char* label, uint64_t iterations, Fn&& read)
+    {
+        uint32_t accumulator = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (uint64_t i = 0; i < iterations; ++i) {
+            accumulator += read();
+        }
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        g_sink = accumulator;
+        std::printf("  %-28s %8.2f ns/read\n", label, seconds * 1e9 / static_cast<double>(iterations));
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const uint64_t iterations = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 50000000ull;
+    const uint64_t lookupIterations = iterations / 10u + 1u;
+
+    auto& settingsManager = SettingsManager::GetInstance();
+    // Roughly the size of the renderer's registry, so name lookups hash into a realistic table.
+    for (uint32_t i = 0; i < 128u; ++i) {
+        settingsManager.registerSetting<uint32_t>("benchmarkPadding" + std::to_string(i), i);
+    }
+    const SettingHandle<uint32_t> handle = settingsManager.registerSetting<uint32_t>("usdPointInstancerMaxInstances", 10000u);
+    const SettingsSnapshot& snapshot = settingsManager.publishSnapshot();
+
+    std::printf("setting reads (%llu iterations):\n", static_cast<unsigned long long>(iterations));
+    Measure("name lookup + getter", lookupIterations, [&]() {
+        return settingsManager.getSettingGetter<uint32_t>("usdPointInstancerMaxInstances")();
+    });
+    const auto getter = settingsManager.getSettingGetter<uint32_t>("usdPointInstancerMaxInstances");
+    Measure("cached std::function getter", iterations, [&]() {
+        return getter();
+    });
+    Measure("typed handle", iterations, [&]() {
+        return settingsManager.get(handle);
+    });
+    Measure("frame snapshot", iterations, [&]() {
+        return snapshot.get(handle);
+    });
+    Measure("acquire snapshot + read", iterations, [&]() {
+        return settingsManager.acquireSnapshot().get(handle);
+    });
+    return 0;
+}
@@ -0,0 +1,305 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <DirectXMath.h>
+#include <flecs.h>
+
+#include "Render/RenderableIngestOps.h"
+#include "Render/RendererComponents.h"
+#include "Render/SnapshotIngestPlan.h"
+
+// Per-frame CPU cost of SceneRenderBridge's renderable ingestion in a real
+// flecs render world, with every bridged renderable changed each frame.
+//
+// "tagged" replays what the bridge and renderer did before
+// SnapshotIngestPlan: per renderable, re-copy the common components, add
+// RenderTransformUpdated and add or remove each scene tag; after the frame,
+// run the renderer's deferred Updated -> Settling cleanup queries.
+// "planned" runs the current path: classify the changes with
+// SnapshotIngestPlan, apply the few tag transitions grouped by kind through
+// ApplyRenderableTagTransition, resolve the Matrix and RenderTransformStamp
+// columns serially, write them in parallel chunks, and advance the
+// RenderTransformSyncWindow singleton. Mesh-derived state is left out; both
+// paths only rebuild it when meshes change. Both must produce the same
+// checksum.
+//
+// Usage: SnapshotIngestBenchmark [renderables=100000] [frames=60] [tagChurnPercent=1]
+
+namespace
+{
+    constexpr size_t kChunkSize = 1024;
+
+    // Mirrors the bridge's private tag for entities it owns.
+    struct BridgedSceneEntity {};
+
+    // The per-frame transform tags the stamp replaced.
+    struct RenderTransformUpdated {};
+    struct RenderTransformSettling {};
+
+    struct Change {
+        uint32_t entity = 0;
+        uint8_t targetTags = 0;
+        Components::Matrix matrix;
+    };
+
+    struct RenderWorld {
+        flecs::world world;
+        std::vector<flecs::entity> entities;
+        std::vector<std::string> names;
+        std::vector<uint8_t> appliedTags;   // BridgedEntityState::renderableTags
+    };
+
+    void Populate(RenderWorld& render, uint32_t renderables, bool stamped) {
+        if (stamped) {
+            render.world.set<Components::RenderTransformSyncWindow>({});
+        }
+        render.entities.resize(renderables);
+        render.names.resize(renderables);
+        render.appliedTags.assign(renderables, br::render::RenderableTag::Named);
+        for (uint32_t i = 0; i < renderables; ++i) {
+            render.names[i] = "Renderable_" + std::to_string(i);
+            flecs::entity e = render.world.entity();
+            e.add<BridgedSceneEntity>();
+            e.add<Components::Active>();
+            e.set<Components::StableSceneID>({ i + 1ull });
+            e.set<Components::Matrix>(Components::Matrix{});
+            e.set<Components::Name>(render.names[i]);
+            e.set<Components::RenderableObject>(Components::RenderableObject{});
+            if (stamped) {
+                e.set<Components::RenderTransformStamp>({ 0 });
+            }
+            render.entities[i] = e;
+        }
+    }
+
+    // Every renderable moves each frame; tagChurnPercent of them also flip
+    // Skinned, SkinningPassEligible or SkipShadowPass.
+    void BuildFrame(std::vector<Change>& changes, std::vector<uint8_t>& sceneTags, uint32_t frame, uint32_t tagChurnPercent, std::mt19937& rng) {
+        std::uniform_int_distribution<uint32_t> percent(0, 99);
+        std::uniform_int_distribution<uint32_t> tagBit(0, 2);
+        for (uint32_t entity = 0; entity < changes.size(); ++entity) {
+            if (percent(rng) < tagChurnPercent) {
+                sceneTags[entity] ^= static_cast<uint8_t>(1u << tagBit(rng));
+            }
+            Change& change = changes[entity];
+            change.entity = entity;
+            change.targetTags = sceneTags[entity];
+            change.matrix = Components::Matrix(DirectX::XMMatrixTranslation(
+                static_cast<float>(frame) * 0.01f + static_cast<float>(entity & 1023u), 0.0f, 0.0f));
+        }
+    }
+
+    template<typename Fn>
+    void ParallelChunks(size_t count, unsigned threadCount, Fn&& fn) {
+        const size_t chunkCount = (count + kChunkSize - 1) / kChunkSize;
+        std::vector<std::thread> threads;
+        threads.reserve(threadCount);
+        for (unsigned t = 0; t < threadCount; ++t) {
+            threads.emplace_back([&, t]() {
+                for (size_t chunk = t; chunk < chunkCount; chunk += threadCount) {
+                    const size_t begin = chunk * kChunkSize;
+                    fn(begin, (std::min)(count, begin + kChunkSize));
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+    class TaggedIngest {
+    public:
+        explicit TaggedIngest(flecs::world& world)
+            : m_settlingEnd(world.query_builder<>()
+                .with<RenderTransformSettling>()
+                .without<RenderTransformUpdated>()
+                .build())
+            , m_settlingBegin(world.query_builder<>()
+                .with<Components::RenderableObject>()
+                .with<RenderTransformUpdated>()
+                .build())
+            , m_updatedCleanup(world.query_builder<>()
+                .with<RenderTransformUpdated>()
+                .build()) {
+        }
+
+        void operator()(RenderWorld& render, const std::vector<Change>& changes, uint64_t) {
+            for (const Change& change : changes) {
+                flecs::entity dst = render.entities[change.entity];
+                dst.add<BridgedSceneEntity>();
+                dst.add<Components::Active>();
+                dst.set<Components::StableSceneID>({ change.entity + 1ull });
+                dst.set<Components::Matrix>(change.matrix);
+                dst.set<Components::Name>(render.names[change.entity]);
+                dst.add<RenderTransformUpdated>();
+
+                if (change.targetTags & br::render::RenderableTag::Skinned) {
+                    dst.add<Components::Skinned>();
+                } else {
+                    dst.remove<Components::Skinned>();
+                }
+                if (change.targetTags & br::render::RenderableTag::SkinningPassEligible) {
+                    dst.add<Components::SkinningPassEligible>();
+                } else {
+                    dst.remove<Components::SkinningPassEligible>();
+                }
+                if (change.targetTags & br::render::RenderableTag::SkipShadowPass) {
+                    dst.add<Components::SkipShadowPass>();
+                } else {
+                    dst.remove<Components::SkipShadowPass>();
+                }
+            }
+
+            // Frame-end cleanup, as the renderer ran it after the render graph.
+            render.world.defer_begin();
+            m_settlingEnd.each([](flecs::entity e) {
+                e.remove<RenderTransformSettling>();
+            });
+            m_settlingBegin.each([](flecs::entity e) {
+                e.add<RenderTransformSettling>();
+            });
+            m_updatedCleanup.each([](flecs::entity e) {
+                e.remove<RenderTransformUpdated>();
+            });
+            render.world.defer_end();
+        }
+
+    private:
+        flecs::query<> m_settlingEnd;
+        flecs::query<> m_settlingBegin;
+        flecs::query<> m_updatedCleanup;
+    };
+
+    class PlannedIngest {
+    public:
+        explicit PlannedIngest(unsigned threadCount) : m_threadCount(threadCount) {}
+
+        void operator()(RenderWorld& render, const std::vector<Change>& changes, uint64_t frame) {
+            m_plan.Clear();
+            m_plan.Reserve(changes.size());
+            for (uint32_t i = 0; i < changes.size(); ++i) {
+                const Change& change = changes[i];
+                m_plan.Add({ i, render.appliedTags[change.entity], change.targetTags, false });
+            }
+            m_plan.Build();
+
+            const auto structural = m_plan.StructuralChanges();
+            for (const br::render::SnapshotIngestGroup& group : m_plan.Groups()) {
+                for (uint32_t changeIndex : structural.subspan(group.first, group.count)) {
+                    const Change& change = changes[changeIndex];
+                    br::render::ApplyRenderableTagTransition(render.entities[change.entity], group.addTags, group.removeTags);
+                    render.appliedTags[change.entity] = change.targetTags;
+                }
+            }
+
+            m_columns.resize(changes.size());
+            for (size_t i = 0; i < changes.size(); ++i) {
+                m_columns[i] = br::render::ResolveRenderableColumns(render.entities[changes[i].entity]);
+            }
+            ParallelChunks(changes.size(), m_threadCount, [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    br::render::WriteRenderableColumns(m_columns[i], changes[i].matrix, true, frame);
+                }
+            });
+
+            // What the renderer does once the frame's passes have read the window.
+            auto& window = render.world.get_mut<Components::RenderTransformSyncWindow>();
+            window.settlingAfter = window.updatedAfter;
+            window.updatedAfter = frame;
+        }
+
+        const br::render::SnapshotIngestStats& GetStats() const { return m_plan.GetStats(); }
+
+    private:
+        unsigned m_threadCount = 1;
+        br::render::SnapshotIngestPlan m_plan;
+        std::vector<br::render::RenderableColumns> m_columns;
+    };
+
+    double Checksum(const RenderWorld& render) {
+        double sum = 0.0;
+        for (uint32_t i = 0; i < render.entities.size(); ++i) {
+            const flecs::entity e = render.entities[i];
+            DirectX::XMFLOAT4X4 matrix;
+            DirectX::XMStoreFloat4x4(&matrix, e.get<Components::Matrix>().matrix);
+            const int tags = (e.has<Components::Skinned>() ? 1 : 0)
+                + (e.has<Components::SkinningPassEligible>() ? 2 : 0)
+                + (e.has<Components::SkipShadowPass>() ? 4 : 0);
+            sum += matrix._41 * (i % 7 + 1) + matrix._11 + tags * 0.25;
+        }
+        return sum;
+    }
+
+    struct Result {
+        double ms = 0.0;
+        double checksum = 0.0;
+        int32_t tables = 0;
+    };
+
+    template<typename Ingest>
+    Result Run(RenderWorld& render, uint32_t frames, uint32_t tagChurnPercent, Ingest& ingest) {
+        const uint32_t renderables = static_cast<uint32_t>(render.entities.size());
+        std::vector<Change> changes(renderables);
+        std::vector<uint8_t> sceneTags(renderables, br::render::RenderableTag::Named);
+        std::mt19937 rng(1234u);
+
+        Result result{};
+        for (uint32_t frame = 1; frame <= frames; ++frame) {
+            BuildFrame(changes, sceneTags, frame, tagChurnPercent, rng);
+            const auto start = std::chrono::steady_clock::now();
+            ingest(render, changes, frame);
+            result.ms += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        }
+        result.checksum = Checksum(render);
+        result.tables = render.world.get_info()->table_count;
+        return result;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const uint32_t renderables = (std::max)(argc > 1 ? static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10)) : 100000u, 1u);
+    const uint32_t frames = (std::max)(argc > 2 ? static_cast<uint32_t>(std::strtoul(argv[2], nullptr, 10)) : 60u, 1u);
+    const uint32_t tagChurnPercent = (std::min)(argc > 3 ? static_cast<uint32_t>(std::strtoul(argv[3], nullptr, 10)) : 1u, 100u);
+    const unsigned threadCount = (std::max)(std::thread::hardware_concurrency(), 1u);
+
+    std::printf("%u bridged renderables changed per frame, %u frames, %u%% tag churn, %u threads\n", renderables, frames, tagChurnPercent, threadCount);
+
+    Result tagged;
+    {
+        RenderWorld render;
+        Populate(render, renderables, false);
+        TaggedIngest ingest(render.world);
+        tagged = Run(render, frames, tagChurnPercent, ingest);
+    }
+
+    Result planned;
+    br::render::SnapshotIngestStats stats;
+    {
+        RenderWorld render;
+        Populate(render, renderables, true);
+        PlannedIngest ingest(threadCount);
+        planned = Run(render, frames, tagChurnPercent, ingest);
+        stats = ingest.GetStats();
+    }
+
+    auto report = [&](const char* name, const Result& result) {
+        std::printf("  %-8s %8.2f ms/frame   %4d tables\n", name, result.ms / frames, result.tables);
+    };
+    report("tagged", tagged);
+    report("planned", planned);
+    std::printf("  last frame: %u column-only, %u structural in %u groups\n", stats.columnOnly, stats.structural, stats.groups);
+
+    if (tagged.checksum != planned.checksum) {
+        std::printf("tagged and planned ingestion disagree\n");
+        return 1;
+    }
+    return 0;
+}
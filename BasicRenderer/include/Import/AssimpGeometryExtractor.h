@@ -30,7 +30,14 @@ struct ExtractionResult {
 	std::vector<ExtractedMesh> meshes;
 };
 
-// Extract from an already-loaded aiScene (for renderer use).
+// Post-process flags for Assimp::Importer::ReadFile. aiProcess_OptimizeGraph
+// and aiProcess_OptimizeMeshes run single-threaded inside the importer before
+// any mesh can be extracted; set BASICRENDERER_ASSIMP_SKIP_SCENE_OPTIMIZE=1 to
+// drop them for very large scenes, at the cost of more (unmerged) meshes.
+unsigned int GetImportProcessFlags();
+
+// Extract from an already-loaded aiScene (for renderer use). Meshes are
+// extracted in parallel, writing straight into each MeshIngestBuilder.
 ExtractionResult ExtractAll(const aiScene* scene, const std::string& sourceFilePath);
 
 // Convenience: load file via Assimp + extract (for CLI tool).
@@ -21,11 +21,22 @@ struct ServiceInfo {
     std::vector<Diagnostic> diagnostics;
 };
 
+enum class PayloadFormat {
+    // The root layer comes back as USDA text in rootLayerText.
+    UsdaText,
+    // BRNifly exports a binary crate file to rootLayerFile, which the consumer
+    // opens directly and removes with ReleasePayload once the stage is loaded.
+    // Only the persistent server supports it; one-shot conversions fall back to text.
+    UsdcFile,
+};
+
 struct UsdAssetPackage {
     std::string sourcePath;
     std::string sourceIdentifier;
     std::string contentHash;
+    PayloadFormat payloadFormat = PayloadFormat::UsdaText;
     std::string rootLayerText;
+    std::string rootLayerFile;
     std::vector<std::string> dependencies;
     std::vector<std::string> textureSearchRoots;
     std::vector<Diagnostic> diagnostics;
@@ -34,10 +45,32 @@ struct UsdAssetPackage {
 struct ClientOptions {
     std::string executablePath;
     int timeoutMilliseconds = 120000;
+    PayloadFormat preferredPayload = PayloadFormat::UsdaText;
+    // Convert through long-lived `BRNifly --serve` processes when the executable
+    // advertises nif.serve, instead of launching BRNifly once per NIF.
+    bool usePersistentServer = true;
+    // Upper bound on concurrent server processes; 0 uses half the hardware threads.
+    unsigned int maxServerProcesses = 0;
+};
+
+struct ConversionResult {
+    std::string nifPath;
+    std::optional<UsdAssetPackage> package;
+    std::string errorMessage;
 };
 
 std::optional<std::string> DiscoverExecutable(const ClientOptions& options = {});
 std::optional<ServiceInfo> DescribeServices(const ClientOptions& options = {}, std::string* errorMessage = nullptr);
 std::optional<UsdAssetPackage> ConvertNifToUsd(const std::string& nifPath, const ClientOptions& options = {}, std::string* errorMessage = nullptr);
 
+// Converts a batch across a pool of server processes. Results are returned in
+// input order; a NIF that crashes its server only fails that entry.
+std::vector<ConversionResult> ConvertNifsToUsd(const std::vector<std::string>& nifPaths, const ClientOptions& options = {});
+
+// Deletes the crate file behind a UsdcFile package. Safe to call for text packages.
+void ReleasePayload(const UsdAssetPackage& package);
+
+// Asks every pooled server process to exit. Pools restart on the next conversion.
+void ShutdownServers();
+
 } // namespace BRNiflyClient
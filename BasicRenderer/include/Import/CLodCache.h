@@ -99,6 +99,26 @@ bool LoadMeshPagesSelectiveDirectStorage(
 	LoadedGroupPayload& outPayload,
 	std::string* outMessage = nullptr);
 
+// Portable batched reads through AsyncFileIoManager (io_uring on Linux,
+// positional-read thread pool elsewhere). All selected pages are put in flight
+// as one request instead of being read with serial seeks.
+bool LoadMeshPagesSelectiveAsyncFileIo(
+	const std::wstring& containerPath,
+	std::span<const ClusterLODGroupDiskLocator> pageLocators,
+	uint32_t firstPage,
+	uint32_t pageCount,
+	const std::vector<bool>& pageNeedsFetch,
+	LoadedGroupPayload& outPayload,
+	std::string* outMessage = nullptr);
+
+bool LoadMeshPagesSelectiveAsyncFileIo(
+	const std::wstring& containerPath,
+	std::span<const ClusterLODGroupDiskLocator> pageLocators,
+	std::span<const uint32_t> meshPageIndices,
+	const std::vector<bool>& pageNeedsFetch,
+	LoadedGroupPayload& outPayload,
+	std::string* outMessage = nullptr);
+
 // Open a container file and validate its header.  Returns true on success.
 // The caller keeps the ifstream around for repeated mesh-page interval loads.
 bool OpenContainerFile(const ClusterLODCacheSource& cacheSource,
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <span>
+#include <vector>
+
+namespace CLodCache {
+
+struct ReadCoalescingOptions {
+	// Unrequested bytes tolerated between two page blobs before the read is split.
+	uint32_t maxGapBytes = 64u * 1024u;
+	// Upper bound on one merged read. Larger single blobs are read on their own.
+	uint32_t maxReadBytes = 1024u * 1024u;
+};
+
+// One page blob a streamed group needs from the container.
+struct PageRead {
+	uint64_t offset = 0;
+	uint32_t sizeBytes = 0;
+	uint32_t requestIndex = 0; // Caller's group request
+	uint32_t pageSlot = 0;     // Output slot within that request
+};
+
+// A contiguous file range covering reads [firstRead, firstRead + readCount).
+struct ReadExtent {
+	uint64_t offset = 0;
+	uint32_t sizeBytes = 0;
+	uint32_t firstRead = 0;
+	uint32_t readCount = 0;
+};
+
+struct ReadScheduleStats {
+	uint32_t pageReads = 0;   // Reads before coalescing
+	uint32_t issuedReads = 0; // Extents actually submitted
+	uint64_t requestedBytes = 0;
+	uint64_t bytesRead = 0;   // Includes gap bytes; overlapping blobs are read once
+};
+
+// Plans the disk reads for one container.
+//
+// Page blobs of sibling groups are written next to each other, so the pages a
+// frame requests tend to cluster. Reads are sorted by file offset and merged
+// while the hole between them is at most maxGapBytes and the merged read stays
+// within maxReadBytes. Scatter() splits the extent data back into per-page
+// blobs for each request.
+//
+// No IO happens here; the caller reads Extents() through whichever backend is
+// available (DirectStorage, async file IO or a plain stream).
+class ReadScheduler {
+public:
+	using PageSink = std::function<void(uint32_t requestIndex, uint32_t pageSlot, std::span<const std::byte> data)>;
+
+	ReadScheduler() = default;
+	explicit ReadScheduler(const ReadCoalescingOptions& options) : m_options(options) {}
+
+	void SetOptions(const ReadCoalescingOptions& options) { m_options = options; }
+	const ReadCoalescingOptions& GetOptions() const { return m_options; }
+
+	void Clear();
+	void AddRead(uint32_t requestIndex, uint32_t pageSlot, uint64_t offset, uint32_t sizeBytes);
+	// Sorts the reads and builds the extents. AddRead after Build starts a new plan.
+	void Build();
+
+	std::span<const ReadExtent> Extents() const { return m_extents; }
+	// Reads in extent order; ExtentReads(i) are the ones extent i covers.
+	std::span<const PageRead> Reads() const { return m_reads; }
+	std::span<const PageRead> ExtentReads(uint32_t extentIndex) const;
+	const ReadScheduleStats& GetStats() const { return m_stats; }
+
+	// Hands each page in the extent to sink. Returns false, without calling
+	// sink, if data is not exactly the extent size.
+	bool Scatter(uint32_t extentIndex, std::span<const std::byte> data, const PageSink& sink) const;
+
+private:
+	ReadCoalescingOptions m_options;
+	std::vector<PageRead> m_reads;
+	std::vector<ReadExtent> m_extents;
+	ReadScheduleStats m_stats;
+	bool m_built = false;
+};
+
+// Positional read of one extent for the stream fallback path.
+bool ReadExtentFromStream(std::ifstream& file, const ReadExtent& extent, std::vector<std::byte>& outData);
+
+}
@@ -7,19 +7,22 @@ enum class ImageFiletype {
 	HDR,
 	DDS,
 	TGA,
-	WIC
+	WIC,
+	KTX2
 };
 
 enum class ImageLoader {
 	UNKNOWN,
 	STBImage,
-	DirectXTex
+	DirectXTex,
+	BasisUniversal
 };
 
 static std::unordered_map<ImageFiletype, ImageLoader> imageFiletypeToLoader = {
 	{ImageFiletype::WIC, ImageLoader::DirectXTex},
 	{ImageFiletype::UNKNOWN, ImageLoader::STBImage},
-	{ImageFiletype::DDS, ImageLoader::DirectXTex}
+	{ImageFiletype::DDS, ImageLoader::DirectXTex},
+	{ImageFiletype::KTX2, ImageLoader::BasisUniversal}
 };
 
 static std::unordered_map<std::string, ImageFiletype> extensionToFiletype = {
@@ -30,13 +33,15 @@ static std::unordered_map<std::string, ImageFiletype> extensionToFiletype = {
 	{".dds", ImageFiletype::DDS},
 	{".hdr", ImageFiletype::HDR},
 	{".tga", ImageFiletype::TGA},
+	{".ktx2", ImageFiletype::KTX2},
 	{"png", ImageFiletype::WIC},
 	{"jpg", ImageFiletype::WIC},
 	{"jpeg", ImageFiletype::WIC},
 	{"bmp", ImageFiletype::WIC},
 	{"dds", ImageFiletype::DDS},
 	{"hdr", ImageFiletype::HDR},
-	{"tga", ImageFiletype::TGA }
+	{"tga", ImageFiletype::TGA },
+	{"ktx2", ImageFiletype::KTX2 }
 };
 
 static std::unordered_set<ImageFiletype> DirectXTexSupportedFiletypes = {
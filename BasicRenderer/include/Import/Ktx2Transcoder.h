@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include "Resources/Texture.h"
+
+class Sampler;
+
+// Native loader for KTX2 containers carrying Basis Universal (ETC1S or UASTC)
+// payloads. Levels are transcoded straight to the BC format the texture
+// processor would otherwise encode for the semantic, so no CPU BC encode runs.
+namespace Ktx2Transcoder {
+
+struct TranscodeRequest {
+	TextureSemantic semantic = TextureSemantic::Unknown;
+	bool preferSRGB = false;
+	bool preservePackedChannels = false;
+};
+
+struct TranscodeResult {
+	std::shared_ptr<TextureSourceData> sourceData;
+	bool hasAlpha = false;
+	bool isUastc = false;
+};
+
+bool IsKtx2Container(const void* bytes, size_t byteCount);
+bool IsTranscoderAvailable();
+
+// Transcodes every level, layer and face; levels run in parallel on the task
+// scheduler. Throws std::runtime_error if the container cannot be transcoded.
+TranscodeResult Transcode(const void* bytes, size_t byteCount, const TranscodeRequest& request);
+
+std::shared_ptr<TextureAsset> CreateTextureAsset(const TranscodeResult& result, std::shared_ptr<Sampler> sampler);
+
+inline std::shared_ptr<TextureAsset> LoadTextureFromMemory(
+	const void* bytes,
+	size_t byteCount,
+	std::shared_ptr<Sampler> sampler,
+	const TranscodeRequest& request)
+{
+	return CreateTextureAsset(Transcode(bytes, byteCount, request), std::move(sampler));
+}
+
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Builds per-vertex skin influences from bone-major weight lists, the way
+// Assimp and FBX store them, and packs them into the skinning vertex stream
+// as uint4 joints0, uint4 joints1, float4 weights0, float4 weights1.
+//
+// Influences are bucketed by vertex with a counting sort: call CountInfluence
+// for every weight, then AddInfluence for the same weights in the same order.
+// Each vertex then owns a contiguous run of (joint, weight) pairs, so Pack only
+// orders a handful of entries per vertex instead of maintaining a fixed-size
+// top-N table while bones are scanned.
+//
+// Reuse one packer per worker thread; Reset keeps the allocations.
+class SkinInfluencePacker {
+public:
+	static constexpr uint32_t kMaxInfluences = 8u;
+	static constexpr size_t kPackedBytes = kMaxInfluences * (sizeof(uint32_t) + sizeof(float));
+
+	void Reset(uint32_t vertexCount);
+
+	// Pass 1. Non-positive weights and out-of-range vertices are ignored here
+	// and in AddInfluence, so both passes see the same set.
+	void CountInfluence(uint32_t vertexId, float weight) {
+		if (weight > 0.0f && vertexId < m_vertexCount) {
+			++m_offsets[vertexId + 1u];
+		}
+	}
+
+	// Pass 2. Must follow every CountInfluence call.
+	void AddInfluence(uint32_t vertexId, uint32_t joint, float weight) {
+		if (!(weight > 0.0f) || vertexId >= m_vertexCount) {
+			return;
+		}
+		if (!m_scattering) {
+			BeginScatter();
+		}
+		uint32_t& cursor = m_cursor[vertexId];
+		if (cursor < m_offsets[vertexId + 1u]) {
+			m_influences[cursor++] = { joint, weight };
+		}
+	}
+
+	// Writes kPackedBytes per vertex at dst + vertex * strideBytes. Keeps the
+	// kMaxInfluences heaviest influences (earlier joints win ties), orders them
+	// by descending weight and renormalizes them to sum to one. Vertices with
+	// no influence get zero joints and weights.
+	void Pack(std::byte* dst, size_t strideBytes);
+
+	uint32_t MaxInfluenceCount() const { return m_maxInfluenceCount; }
+	// Vertices that had more than kMaxInfluences weights in the last Pack.
+	uint32_t TruncatedVertexCount() const { return m_truncatedVertexCount; }
+
+private:
+	struct Influence {
+		uint32_t joint = 0;
+		float weight = 0.0f;
+	};
+
+	void BeginScatter();
+
+	uint32_t m_vertexCount = 0;
+	bool m_scattering = false;
+	uint32_t m_maxInfluenceCount = 0;
+	uint32_t m_truncatedVertexCount = 0;
+	std::vector<uint32_t> m_offsets; // vertexCount + 1 prefix sums
+	std::vector<uint32_t> m_cursor;
+	std::vector<Influence> m_influences;
+};
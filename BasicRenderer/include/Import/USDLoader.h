@@ -29,4 +29,10 @@ namespace USDLoader {
 		const std::string& usdText,
 		const InMemoryStageOptions& options,
 		const ImportSettings& settings = {});
+	// Opens a generated layer file (e.g. a BRNifly crate payload) as an anonymous
+	// layer, so the file can be deleted once the scene is built.
+	std::shared_ptr<Scene> LoadModelFromUsdFile(
+		const std::string& layerPath,
+		const InMemoryStageOptions& options,
+		const ImportSettings& settings = {});
 }
\ No newline at end of file
@@ -13,6 +13,7 @@
 #include "Resources/Buffers/LazyDynamicStructuredBuffer.h"
 #include "Resources/Buffers/DynamicStructuredBuffer.h"
 #include "Scene/Components.h"
+#include "Managers/LightViewBuilder.h"
 
 class ShadowMaps;
 class LinearShadowMaps;
@@ -39,6 +40,12 @@ public:
 	void SetViewManager(ViewManager* viewManager);
 	void UpdateLightBufferView(BufferView* view, const LightInfo& data);
     void UpdateLightViewInfo(flecs::entity light);
+	// Refreshes shadow views for the given lights, skipping any whose inputs
+	// are unchanged since their last update.
+	void UpdateLightViewInfos(const std::vector<flecs::entity>& lights);
+	// Forces the next UpdateLightViewInfos to rebuild this light's views, for
+	// callers that overwrite its buffer entry with values the view update derives.
+	void InvalidateLightView(uint64_t lightEntityId);
 	unsigned int GetLightPagePoolSize() { return m_lightPagePoolSize; }
 	std::shared_ptr<Resource> ProvideResource(ResourceIdentifier const& key) override;
 	std::vector<ResourceIdentifier> GetSupportedKeys() override;
@@ -71,12 +78,17 @@ private:
 	std::function<uint8_t()> getNumDirectionalLightCascades;
     std::function<uint16_t()> getShadowResolution;
 	std::function<float()> getDirectionalVirtualShadowSourceAngleDegrees;
+	std::function<float()> getDirectionalShadowVerticalExtent;
     std::function<void(std::shared_ptr<void>)> markForDelete;
 	ViewManager* m_pViewManager = nullptr;
 	unsigned int m_lightPagePoolSize = 0;
 
 	std::mutex m_lightUpdateMutex;
 
+	std::unordered_map<uint64_t, LightViewSignature> m_lightViewSignatures; // Keyed by light entity id
+	LocalLightViewBatch m_localLightViewBatch;
+	std::vector<uint64_t> m_localLightViewIds; // Parallel to m_localLightViewBatch.cameras
+
     std::pair<Components::LightViewInfo, std::optional<Components::FrustumPlanes>>
         CreatePointLightViewInfo(const LightInfo& info, uint64_t entityId);
 	std::pair<Components::LightViewInfo, std::optional<Components::FrustumPlanes>>
@@ -84,6 +96,8 @@ private:
 	std::pair<Components::LightViewInfo, std::optional<Components::FrustumPlanes>>
 		CreateDirectionalLightViewInfo(const LightInfo& info, uint64_t entityId);
 	void RebuildDirectionalLightViewInfoBuffer(std::optional<uint64_t> excludedLightEntityId = std::nullopt);
+	LightViewSignature BuildLightViewSignature(flecs::entity light);
+	void UpdateDirectionalLightViewInfo(flecs::entity light);
 
 	void RemoveLightViewInfo(flecs::entity light);
 };
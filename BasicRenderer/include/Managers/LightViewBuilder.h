@@ -0,0 +1,79 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <DirectXMath.h>
+
+#include "ShaderBuffers.h"
+
+// Everything a light's shadow views are derived from. Two equal signatures
+// produce identical CameraInfos, so the light can be skipped.
+struct LightViewSignature {
+	DirectX::XMFLOAT4X4 lightMatrix = {};
+	DirectX::XMFLOAT4X4 projection = {};
+	uint64_t firstViewId = 0;
+	uint32_t viewCount = 0;
+	uint32_t depthResX = 0;
+	uint32_t depthResY = 0;
+	uint64_t planesHash = 0;
+
+	// Directional lights also follow the primary camera and cascade settings.
+	DirectX::XMFLOAT4X4 cameraMatrix = {};
+	float cameraZNear = 0.0f;
+	float cameraZFar = 0.0f;
+	float cameraFov = 0.0f;
+	float cameraAspect = 0.0f;
+	float clipVerticalExtent = 0.0f;
+	float sourceAngleDegrees = 0.0f;
+	uint32_t numCascades = 0;
+
+	bool operator==(const LightViewSignature& other) const {
+		return std::memcmp(&lightMatrix, &other.lightMatrix, sizeof(lightMatrix)) == 0
+			&& std::memcmp(&projection, &other.projection, sizeof(projection)) == 0
+			&& firstViewId == other.firstViewId
+			&& viewCount == other.viewCount
+			&& depthResX == other.depthResX
+			&& depthResY == other.depthResY
+			&& planesHash == other.planesHash
+			&& std::memcmp(&cameraMatrix, &other.cameraMatrix, sizeof(cameraMatrix)) == 0
+			&& cameraZNear == other.cameraZNear
+			&& cameraZFar == other.cameraZFar
+			&& cameraFov == other.cameraFov
+			&& cameraAspect == other.cameraAspect
+			&& clipVerticalExtent == other.clipVerticalExtent
+			&& sourceAngleDegrees == other.sourceAngleDegrees
+			&& numCascades == other.numCascades;
+	}
+};
+
+uint64_t HashFrustumPlanes(const std::vector<std::array<ClippingPlane, 6>>& planes);
+
+// Point and spot shadow views for many lights, stored as parallel arrays.
+// Lights are appended serially, then BuildLocalLightViews fills 'cameras'
+// for any sub-range; disjoint ranges can be built concurrently.
+struct LocalLightViewBatch {
+	std::vector<DirectX::XMFLOAT3> positions;
+	std::vector<DirectX::XMFLOAT3> directions;   // Spot lights only
+	std::vector<DirectX::XMFLOAT4X4> projections;
+	std::vector<DirectX::XMUINT2> depthResolutions;
+	std::vector<const std::array<ClippingPlane, 6>*> planes; // First face's planes, owned by the caller; may be null
+	std::vector<uint32_t> firstCamera;
+	std::vector<uint8_t> isPoint;
+
+	std::vector<CameraInfo> cameras;
+
+	void Clear();
+	void Reserve(size_t lightCount);
+	size_t Size() const { return positions.size(); }
+
+	// Returns the index of the light's first camera; point lights own six.
+	uint32_t AddPoint(const DirectX::XMFLOAT3& position, DirectX::FXMMATRIX projection, DirectX::XMUINT2 depthResolution, const std::array<ClippingPlane, 6>* firstFacePlanes);
+	uint32_t AddSpot(const DirectX::XMFLOAT3& position, const DirectX::XMFLOAT3& direction, DirectX::FXMMATRIX projection, DirectX::XMUINT2 depthResolution, const std::array<ClippingPlane, 6>* planes);
+};
+
+// Cube face views share a fixed rotation per face, so only the translation
+// row depends on the light position.
+void BuildLocalLightViews(LocalLightViewBatch& batch, size_t beginLight, size_t endLight);
@@ -9,6 +9,7 @@
 #include "Resources/ResourceGroup.h"
 #include "Render/IndirectCommand.h"
 #include "Render/RasterBucketFlags.h"
+#include "Utilities/MemoryBudgetArbiter.h"
 
 namespace rg::runtime {
 class IReadbackService;
@@ -45,6 +46,9 @@ public:
 	void ProcessPendingMaterialUpdates(uint64_t frameIndex, TextureFactory& textureFactory);
 	void RequestTextureStreamingFeedbackReadback(rg::runtime::IReadbackService* readbackService);
 	MaterialTextureStreamingStats GetMaterialTextureStreamingStats() const;
+	// Memory budget hooks. Covers streamable textures only; a cap of 0 is unlimited.
+	void GatherTextureStreamingMemoryDemand(budget::MemoryDemand& demand) const;
+	void SetTextureStreamingBudgetBytes(uint64_t capBytes) { m_textureStreamingBudgetBytes = capBytes; }
 
 	void UpdateMaterialDataBuffer(Material& material);
 	void MarkMaterialDirty(Material& material);
@@ -86,6 +90,7 @@ private:
 	void UpdateTextureStreamingMetadata(const Material& material);
 	void UpdateTextureStreamingMetadata(const std::shared_ptr<TextureAsset>& texture);
 	void MarkTextureStreamingMetadataDirty(const std::shared_ptr<TextureAsset>& texture, bool needsUploadAdvance = false);
+	void ApplyTextureStreamingBudget();
 	void FlushDirtyMaterial(Material& material, TextureFactory* textureFactory = nullptr);
 	void FlushDirtyTextureMetadata(const std::shared_ptr<TextureAsset>& texture);
 	void EnsureTextureUploadAdvanced(const std::shared_ptr<TextureAsset>& texture, TextureFactory& textureFactory);
@@ -156,5 +161,10 @@ private:
 	std::unordered_set<uint32_t> m_dirtyTextureStreamingIDSet;
 	std::vector<uint32_t> m_texturesNeedingUploadAdvance;
 	std::unordered_set<uint32_t> m_texturesNeedingUploadAdvanceSet;
+	// Top mip each texture would request without a budget, and the coarser one
+	// the budget currently holds it to.
+	std::unordered_map<uint32_t, uint32_t> m_textureStreamingDesiredTopMips;
+	std::unordered_map<uint32_t, uint32_t> m_textureStreamingBudgetTopMips;
+	uint64_t m_textureStreamingBudgetBytes = 0u;
 	uint32_t m_textureStreamingMetadataCapacity = 1u;
 };
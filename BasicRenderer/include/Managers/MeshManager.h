@@ -14,8 +14,11 @@
 #include "ShaderBuffers.h"
 #include "Mesh/Mesh.h"
 #include "Import/CLodCache.h"
+#include "Import/CLodReadScheduler.h"
+#include "Render/GraphExtensions/ClusterLOD/CLodMotionPrefetcher.h"
 #include "Managers/Singletons/DirectStorageManager.h"
 #include "Managers/Singletons/SettingsManager.h"
+#include "Managers/Singletons/TaskSchedulerManager.h"
 #include "RenderPasses/Base/PassReturn.h"
 #include "Resources/Buffers/LazyDynamicStructuredBuffer.h"
 #include "Resources/Buffers/PagePool.h"
@@ -44,6 +47,10 @@ public:
 		uint64_t residentAllocationBytes = 0;
 		uint64_t completedResultBytes = 0;
 		uint64_t totalStreamedBytes = 0;
+		// Cumulative disk reads: page blobs requested versus coalesced reads issued.
+		uint64_t diskPageReads = 0;
+		uint64_t diskIssuedReads = 0;
+		uint64_t diskBytesRead = 0;
 	};
 
 	struct CLodRayTracingResidentGroup {
@@ -62,6 +69,35 @@ public:
 		uint64_t pagePoolGeneration = 0;
 	};
 
+	enum class CLodResidencyChange : uint8_t {
+		BecameResident,
+		Evicted,
+		PagesRemapped,
+	};
+
+	struct CLodResidencyJournalEntry {
+		uint32_t groupGlobalIndex = 0;
+		CLodResidencyChange change = CLodResidencyChange::BecameResident;
+	};
+
+	// Groups whose residency changed since a consumer's journal position. Each
+	// touched group is reported once with its current state: residentGroups holds
+	// groups that are resident now (newly or with remapped pages), evictedGroups
+	// holds groups that are not. fullResync means the journal could not cover the
+	// gap and residentGroups is the complete resident set.
+	struct CLodRayTracingResidencyDelta {
+		std::vector<CLodRayTracingResidentGroup> residentGroups;
+		std::vector<uint32_t> evictedGroups;
+		PagePool* pagePool = nullptr;
+		uint64_t pagePoolGeneration = 0;
+		uint64_t journalEpoch = 0;
+		uint64_t journalSequence = 0;
+		uint32_t becameResidentEvents = 0;
+		uint32_t evictedEvents = 0;
+		uint32_t remappedEvents = 0;
+		bool fullResync = false;
+	};
+
 	// Represents the outcome of a single disk-streamed group IO.
 	struct CLodPrefetchedChildLayout {
 		uint32_t groupGlobalIndex = 0;
@@ -110,6 +146,13 @@ public:
 	};
 	void GetCLodStreamingDomainSnapshot(CLodStreamingDomainSnapshot& outSnapshot) const;
 
+	// CPU mirror of CLod hierarchies and instance placement for predictive
+	// prefetch. Instances whose transform was never set are left out.
+	void SetCLodInstanceWorldTransform(const MeshInstance* instance, const DirectX::XMMATRIX& world);
+	// One entry per unique CLod mesh; the mesh spans point into outGroups.
+	void GetCLodPrefetchMeshes(std::vector<CLodPrefetchGroup>& outGroups, std::vector<CLodPrefetchMesh>& outMeshes) const;
+	void GetCLodPrefetchInstances(std::vector<CLodPrefetchInstance>& outInstances) const;
+
 	// Patch a single group's error field in the GPU groups buffer.
 	// Used by the streaming system to override error for residency transitions.
 	void PatchCLodGroupError(uint32_t groupGlobalIndex, float error);
@@ -122,6 +165,14 @@ public:
 
 	CLodStreamingDebugStats GetCLodStreamingDebugStats() const;
 	void GetCLodRayTracingResidencySnapshot(CLodRayTracingResidencySnapshot& outSnapshot) const;
+	// Incremental alternative to the snapshot. Pass the epoch/sequence returned by
+	// the previous call (0/0 initially); a mismatched epoch, a different page-pool
+	// generation or a trimmed journal yields a full resync.
+	void GetCLodRayTracingResidencyDelta(
+		uint64_t journalEpoch,
+		uint64_t sinceSequence,
+		uint64_t pagePoolGeneration,
+		CLodRayTracingResidencyDelta& outDelta) const;
 	void ProcessCLodDiskStreamingIO();
 
 	// Drains groups that completed disk streaming since the last call.
@@ -304,6 +355,8 @@ private:
 		uint32_t groupsBase = 0;
 		uint32_t groupCount = 0;
 		std::shared_ptr<CLodSharedStreamingState> sharedMeshState;
+		CLodPrefetchInstance prefetch; // Placement for predictive prefetch
+		bool hasWorldTransform = false;
 	};
 
 	std::unordered_map<uint32_t, CLodStreamingInstanceState> m_clodStreamingStateByInstanceIndex;
@@ -315,11 +368,18 @@ private:
 	std::atomic<bool> m_clodStreamingStructureDirty{true};
 	std::atomic<bool> m_clodStreamingDirectStorageEnabled{true};
 	SettingsManager::Subscription m_clodStreamingDirectStorageSubscription;
+	std::atomic<uint32_t> m_clodReadCoalesceGapBytes{CLodCache::ReadCoalescingOptions{}.maxGapBytes};
+	std::atomic<uint32_t> m_clodReadCoalesceMaxBytes{CLodCache::ReadCoalescingOptions{}.maxReadBytes};
+	SettingsManager::Subscription m_clodReadCoalesceGapSubscription;
+	SettingsManager::Subscription m_clodReadCoalesceMaxSubscription;
 
 	// Incremental debug-stats counters — updated in place by residency mutations.
 	std::atomic<uint32_t> m_debugResidentGroups{0};
 	std::atomic<uint32_t> m_debugResidentAllocations{0};
 	std::atomic<uint64_t> m_debugTotalStreamedBytes{0};
+	std::atomic<uint64_t> m_debugDiskPageReads{0};
+	std::atomic<uint64_t> m_debugDiskIssuedReads{0};
+	std::atomic<uint64_t> m_debugDiskBytesRead{0};
 	std::function<void(const CLodPageMapWriteEvent&)> m_clodPageMapWriteCallback;
 	std::atomic<uint32_t> m_clodActiveMaxTraversalDepth{0};
 
@@ -403,6 +463,9 @@ private:
 
 	// Generation counter for invalidating in-flight disk IO across rebuilds.
 	std::atomic<uint64_t> m_clodDiskStreamingGeneration{0};
+	// Cancelled alongside each generation bump so queued IO tasks from the old
+	// generation are dropped before they touch the disk (guarded by m_clodDiskStreamingMutex).
+	TaskCancellationToken m_clodDiskStreamingCancellation = TaskCancellationToken::Create();
 
 	// Guards m_clodDiskStreamingResults and m_clodDiskStreamingCompletions.
 	mutable std::mutex m_clodDiskStreamingResultsMutex;
@@ -423,10 +486,33 @@ private:
 	// m_clodPagePool, and m_clodSharedGroupChunks UpdateView calls.
 	mutable std::mutex m_clodResidencyMutex;
 
+	// Residency change journal feeding GetCLodRayTracingResidencyDelta (guarded by
+	// m_clodResidencyMutex). Entry i has sequence m_clodResidencyJournalFirstSequence + i.
+	// Structural changes bump the epoch, which invalidates every consumer position.
+	std::vector<CLodResidencyJournalEntry> m_clodResidencyJournal;
+	uint64_t m_clodResidencyJournalFirstSequence = 0;
+	std::atomic<uint64_t> m_clodResidencyJournalEpoch{1};
+	static constexpr size_t kMaxResidencyJournalEntries = 1u << 16;
+
 	// Maximum number of IO requests dispatched per ProcessCLodDiskStreamingIO call.
 	static constexpr uint32_t kMaxIoBatchSize = 128u;
 
 	void DispatchCLodDiskStreamingBatch();
+
+	// Container stream kept open per IO thread for the fallback read path.
+	struct ThreadContainerFile {
+		std::wstring containerFileName;
+		std::string sourceIdentifier;
+		std::ifstream file;
+		uint32_t pageCount = 0;
+		bool valid = false;
+	};
+	static ThreadContainerFile& AcquireThreadContainerFile(const ClusterLODCacheSource& cacheSource);
+	// IO thread: reads one request's pages and pushes its result.
+	void ExecuteCLodDiskStreamingRequest(CLodDiskStreamingRequest& request);
+	// IO thread: reads same-container requests through one coalesced plan and
+	// splits the extents back into per-group results.
+	void ExecuteCLodCoalescedDiskStreamingRequests(std::vector<CLodDiskStreamingRequest>& requests, const CLodCache::ReadScheduler& plan);
 	bool QueueCLodDiskStreamingRequest(uint32_t groupGlobalIndex, CLodSharedStreamingState& state, uint32_t groupLocalIndex, bool& outQueued, const std::vector<bool>& segmentNeedsFetch = {}, const std::vector<uint32_t>& preAllocatedPages = {}, uint32_t priority = 0u);
 	bool QueueCLodDiskStreamingRequest(uint32_t groupGlobalIndex, CLodSharedStreamingState& state, uint32_t groupLocalIndex, bool& outQueued, const std::vector<bool>& segmentNeedsFetch = {}, const std::vector<uint32_t>& preAllocatedPages = {}, uint32_t priority = 0u, const CLodCache::GroupPayloadLayoutMetadata* prefetchedLayout = nullptr);
 
@@ -449,6 +535,12 @@ private:
 	void ReleaseAllCLodGroupChunkAllocations(CLodSharedStreamingState& state);
  	static void ZeroCLodGroupChunkCounts(ClusterLODGroupChunk& chunk);
 	bool ApplyCLodGroupEviction(CLodSharedStreamingState& state, uint32_t groupLocalIndex, bool clearPageMapEntries);
+	void RecordCLodResidencyChange(uint32_t groupGlobalIndex, CLodResidencyChange change);
+	bool BuildCLodRayTracingResidentGroup(
+		const CLodSharedStreamingState& state,
+		uint32_t groupGlobalIndex,
+		uint32_t groupLocalIndex,
+		CLodRayTracingResidentGroup& outGroup) const;
 
 	void RebuildCLodSharedStreamingRangeIndex();
 	void RecomputeCLodActiveMaxTraversalDepth();
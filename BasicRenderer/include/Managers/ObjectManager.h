@@ -8,7 +8,7 @@
 #include "Resources/Buffers/LazyDynamicStructuredBuffer.h"
 #include "Resources/Buffers/DynamicStructuredBuffer.h"
 #include "ShaderBuffers.h"
-#include "Resources/Buffers/SortedUnsignedIntBuffer.h"
+#include "Resources/Buffers/DrawSetIndexBuffer.h"
 #include "Render/IndirectCommand.h"
 #include "Scene/Components.h"
 #include "Interfaces/IResourceProvider.h"
@@ -39,7 +39,7 @@ public:
 
 	std::shared_ptr<Resource> ProvideResource(ResourceIdentifier const& key) override;
 	std::vector<ResourceIdentifier> GetSupportedKeys() override;
-	std::shared_ptr<SortedUnsignedIntBuffer> GetActiveDrawSetIndices(const DrawWorkloadKey& workloadKey) {
+	std::shared_ptr<DrawSetIndexBuffer> GetActiveDrawSetIndices(const DrawWorkloadKey& workloadKey) {
 		auto it = m_activeDrawSetIndices.find(workloadKey);
 		if (it != m_activeDrawSetIndices.end()) {
 			return it->second;
@@ -47,10 +47,13 @@ public:
 			throw std::runtime_error("Active draw set indices for given flags not found");
 		}
 	}
-	std::shared_ptr<SortedUnsignedIntBuffer> GetActiveDrawSetIndices(MaterialCompileFlags flags, const RenderPhase& renderPhase, bool clodOnly = false) {
+	std::shared_ptr<DrawSetIndexBuffer> GetActiveDrawSetIndices(MaterialCompileFlags flags, const RenderPhase& renderPhase, bool clodOnly = false) {
         return GetActiveDrawSetIndices(DrawWorkloadKey { flags, renderPhase, clodOnly });
     }
     uint64_t GetDrawSetDeclarationRevision() const { return m_drawSetDeclarationRevision; }
+	// Uploads draw-set membership changed by AddObject/RemoveObject since the last call.
+	// Must run once per frame before upload policies are flushed.
+	void CommitDrawSetChanges();
 
 private:
 	ObjectManager();
@@ -58,7 +61,7 @@ private:
 	std::shared_ptr<DynamicBuffer> m_perObjectBuffers; // Per object constant buffer
 	std::shared_ptr<DynamicBuffer> m_masterIndirectCommandsBuffer; // Indirect draw command buffer
 	std::shared_ptr<LazyDynamicStructuredBuffer<DirectX::XMFLOAT4X4>> m_normalMatrixBuffer; // Normal matrices for each object
-	std::unordered_map<DrawWorkloadKey, std::shared_ptr<SortedUnsignedIntBuffer>, DrawWorkloadKey::Hasher> m_activeDrawSetIndices; // Indices into m_drawSetCommandsBuffer for active objects per workload
+	std::unordered_map<DrawWorkloadKey, std::shared_ptr<DrawSetIndexBuffer>, DrawWorkloadKey::Hasher> m_activeDrawSetIndices; // Indices into m_drawSetCommandsBuffer for active objects per workload
 	std::shared_ptr<LazyDynamicStructuredBuffer<PerMeshInstanceCB>> m_perMeshInstanceBuffers; // Indices into m_perObjectBuffers for each mesh instance in each object
     uint64_t m_drawSetDeclarationRevision = 1u;
 	std::mutex m_objectUpdateMutex; // Mutex for thread safety
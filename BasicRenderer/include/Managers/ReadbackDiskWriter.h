@@ -0,0 +1,97 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+namespace br {
+
+struct ReadbackImageDesc {
+    uint32_t width = 0;
+    uint32_t height = 0;
+    uint32_t mipLevels = 1;
+    uint32_t arraySize = 1;     // Faces for a cubemap
+    bool cubemap = false;
+    uint32_t dxgiFormat = 0;    // DXGI_FORMAT value, written to the DX10 header
+};
+
+// Where one subresource sits in the mapped readback buffer. Rows are
+// block rows for compressed formats.
+struct ReadbackSubresourceLayout {
+    uint64_t offset = 0;
+    uint32_t rowPitch = 0;      // Source stride (footprint-aligned)
+    uint32_t rowBytes = 0;      // Tight row size written to disk
+    uint32_t rowCount = 0;
+};
+
+// Writes a DDS file (with DX10 header) straight from mapped footprint rows.
+// Subresources are in DDS order: every mip of slice 0, then slice 1, and so on.
+bool WriteReadbackDds(
+    std::ostream& out,
+    const ReadbackImageDesc& image,
+    const std::vector<ReadbackSubresourceLayout>& subresources,
+    const std::byte* mapped);
+
+// Same payload as WriteReadbackDds with no header.
+bool WriteReadbackRaw(
+    std::ostream& out,
+    const std::vector<ReadbackSubresourceLayout>& subresources,
+    const std::byte* mapped);
+
+struct ReadbackWriteJob {
+    ReadbackImageDesc image;
+    std::vector<ReadbackSubresourceLayout> subresources;
+    uint64_t footprintBytes = 0;        // Charged against the in-flight budget until the job finishes
+    std::filesystem::path ddsPath;      // Empty to skip
+    std::filesystem::path rawPath;      // Empty to skip
+
+    // Run on the IO worker around the write.
+    std::function<const std::byte*()> map;
+    std::function<void()> unmap;
+    std::function<void(bool succeeded)> onComplete;
+};
+
+// Hands mapped readbacks to IO workers and bounds how many footprint bytes
+// are outstanding at once. A job is always admitted when nothing is in
+// flight, so a single readback larger than the budget still makes progress.
+class ReadbackDiskWriter {
+public:
+    using TaskRunner = std::function<void(std::function<void()>)>;
+
+    ReadbackDiskWriter(uint64_t maxInFlightBytes, TaskRunner runTask);
+    ~ReadbackDiskWriter();
+
+    ReadbackDiskWriter(const ReadbackDiskWriter&) = delete;
+    ReadbackDiskWriter& operator=(const ReadbackDiskWriter&) = delete;
+
+    // Takes the job only if it fits the budget; otherwise leaves it untouched.
+    bool TrySubmit(ReadbackWriteJob& job);
+
+    // Blocks until the job fits the budget.
+    void Submit(ReadbackWriteJob job);
+
+    void WaitIdle();
+
+    uint64_t GetInFlightBytes() const;
+    uint64_t GetMaxInFlightBytes() const { return m_maxInFlightBytes; }
+
+private:
+    bool FitsLocked(uint64_t bytes) const;
+    void Launch(ReadbackWriteJob job);
+    void Run(ReadbackWriteJob& job);
+
+    uint64_t m_maxInFlightBytes;
+    TaskRunner m_runTask;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_changed;
+    uint64_t m_inFlightBytes = 0;
+    uint32_t m_inFlightJobs = 0;
+};
+
+} // namespace br
@@ -10,6 +10,7 @@
 #include <rhi.h>
 
 #include "OpenRenderGraph/OpenRenderGraph.h"
+#include "Managers/ReadbackDiskWriter.h"
 
 namespace br {
 
@@ -40,8 +41,8 @@ private:
         std::vector<rhi::CopyableFootprint> layouts;
         uint64_t totalSize = 0;
         std::wstring outputFile;
-        std::function<void()> callback;
         uint64_t fenceValue = 0;
+        ReadbackWriteJob writeJob; // Submitted to m_diskWriter once fenceValue completes
     };
 
     class ReadbackPass : public RenderPass, public IHasImmediateModeCommands {
@@ -68,6 +69,7 @@ private:
         ReadbackManager& m_owner;
         rhi::Timeline m_readbackFence;
         uint64_t m_pendingFenceValue = 0;
+        size_t m_recordedCount = 0;
         bool m_hasWork = false;
     };
 
@@ -75,13 +77,15 @@ private:
         return m_nextFenceValue.fetch_add(1, std::memory_order_relaxed) + 1;
     }
 
-    void ClearReadbacks();
+    void ClearReadbacks(size_t count);
+    uint64_t GetPendingReadbackBytesLocked() const;
 
     void SaveCubemapToDDS(
         rhi::Device& device,
         rg::imm::ImmediateCommandList& commandList,
         std::shared_ptr<PixelBuffer> cubemap,
         const std::wstring& outputFile,
+        std::function<void()> callback,
         uint64_t fenceValue);
 
     void SaveTextureToDDS(
@@ -89,6 +93,7 @@ private:
         rg::imm::ImmediateCommandList& commandList,
         PixelBuffer* texture,
         const std::wstring& outputFile,
+        std::function<void()> callback,
         uint64_t fenceValue);
 
     std::shared_ptr<ReadbackPass> m_readbackPass;
@@ -97,6 +102,7 @@ private:
     std::mutex m_mutex;
     std::vector<ReadbackInfo> m_queuedReadbacks;
     std::vector<ReadbackRequest> m_readbackRequests;
+    std::unique_ptr<ReadbackDiskWriter> m_diskWriter;
 };
 
 } // namespace br
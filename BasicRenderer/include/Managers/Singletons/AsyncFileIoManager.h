@@ -0,0 +1,118 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace br {
+
+// Portable counterpart to DirectStorageManager's system-memory queue. Reads are
+// batched per request and completed asynchronously; on Linux they go through
+// io_uring (O_DIRECT + registered buffers), everywhere else through a small
+// positional-read thread pool.
+enum class AsyncFileIoBackend : uint8_t {
+    None = 0,
+    IoUring,
+    ThreadPool,
+};
+
+struct AsyncFileReadRegion {
+    uint64_t sourceOffset = 0;
+    uint32_t sourceSizeBytes = 0;
+};
+
+enum class AsyncFileReadRequestState : uint8_t {
+    Invalid = 0,
+    Pending,
+    Ready,
+    Failed,
+};
+
+struct AsyncFileReadRequestStatus {
+    AsyncFileReadRequestState state = AsyncFileReadRequestState::Invalid;
+    std::string message;
+};
+
+class AsyncFileReadRequestHandle {
+public:
+    AsyncFileReadRequestHandle() = default;
+
+    bool IsValid() const noexcept;
+
+private:
+    struct State;
+
+    explicit AsyncFileReadRequestHandle(std::shared_ptr<State> state);
+
+    std::shared_ptr<State> m_state;
+
+    friend class AsyncFileIoManager;
+};
+
+class AsyncFileIoManager {
+public:
+    static constexpr uint32_t kDefaultQueueDepth = 64;
+
+    static AsyncFileIoManager& GetInstance();
+
+    void Initialize(uint32_t queueDepth = kDefaultQueueDepth);
+    void Initialize(AsyncFileIoBackend preferredBackend, uint32_t queueDepth);
+    void Cleanup();
+
+    bool IsInitialized() const {
+        return m_initialized;
+    }
+
+    AsyncFileIoBackend GetBackend() const {
+        return m_backend;
+    }
+
+    uint32_t GetQueueDepth() const {
+        return m_queueDepth;
+    }
+
+    const std::string& GetStatusMessage() const {
+        return m_statusMessage;
+    }
+
+    void ReleaseFileHandle(const std::wstring& path);
+
+    // Enqueues all regions as one request. Each region lands in its own blob,
+    // retrieved with TakeRequestData once the request reports Ready.
+    AsyncFileReadRequestHandle EnqueueReadFileRegions(
+        const std::wstring& path,
+        const std::vector<AsyncFileReadRegion>& regions,
+        std::string* outMessage = nullptr);
+    bool ReadFileRegionsToMemory(
+        const std::wstring& path,
+        const std::vector<AsyncFileReadRegion>& regions,
+        std::vector<std::vector<std::byte>>& outBlobs,
+        std::string* outMessage = nullptr);
+
+    AsyncFileReadRequestStatus PollRequest(const AsyncFileReadRequestHandle& handle) const;
+    bool WaitForRequest(const AsyncFileReadRequestHandle& handle, std::string* outMessage = nullptr) const;
+    bool WaitForRequests(const std::vector<AsyncFileReadRequestHandle>& handles, std::string* outMessage = nullptr) const;
+    bool TakeRequestData(const AsyncFileReadRequestHandle& handle, std::vector<std::vector<std::byte>>& outBlobs) const;
+
+private:
+    AsyncFileIoManager() = default;
+
+    struct Impl;
+
+    std::unique_ptr<Impl> m_impl;
+    AsyncFileIoBackend m_backend = AsyncFileIoBackend::None;
+    uint32_t m_queueDepth = 0;
+    bool m_initialized = false;
+    std::string m_statusMessage;
+};
+
+}
+
+using AsyncFileIoManager = br::AsyncFileIoManager;
+using AsyncFileIoBackend = br::AsyncFileIoBackend;
+using AsyncFileReadRegion = br::AsyncFileReadRegion;
+using AsyncFileReadRequestHandle = br::AsyncFileReadRequestHandle;
+using AsyncFileReadRequestState = br::AsyncFileReadRequestState;
+using AsyncFileReadRequestStatus = br::AsyncFileReadRequestStatus;
@@ -1,5 +1,11 @@
 ﻿#pragma once
 
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <functional>
 #include <memory>
 #include <string>
@@ -7,17 +13,173 @@
 #include <typeinfo>
 #include <type_traits>
 #include <stdexcept>
+#include <vector>
 
 #include "Setting.h"
 
+// Settings that fit in a snapshot slot are copied into the per-frame snapshot.
+// Everything else (strings, vectors, callbacks) is only reachable through the
+// live accessors.
+template<typename T>
+inline constexpr bool kSettingSnapshotEligible =
+    std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T> && sizeof(T) <= 16 && alignof(T) <= 16;
+
+// Typed index into SettingsManager, resolved once by name (at registration or
+// with getSettingHandle) so hot paths never hash a string or go through a
+// std::function.
+template<typename T>
+class SettingHandle {
+public:
+    static constexpr uint32_t kInvalidIndex = ~0u;
+
+    constexpr SettingHandle() = default;
+
+    constexpr bool IsValid() const { return m_index != kInvalidIndex; }
+    constexpr uint32_t GetIndex() const { return m_index; }
+
+private:
+    explicit constexpr SettingHandle(uint32_t index) : m_index(index) {}
+
+    uint32_t m_index = kInvalidIndex;
+
+    friend class SettingsManager;
+};
+
+// Immutable copy of every snapshot-eligible setting, published once per frame.
+// Readers on any thread load it without locks; a snapshot stays intact for
+// SettingsManager::kSnapshotRingSize - 1 further publishes, so workers must not
+// hold one across frames.
+class SettingsSnapshot {
+public:
+    template<typename T>
+    bool contains(SettingHandle<T> handle) const {
+        return handle.GetIndex() < m_slots.size();
+    }
+
+    template<typename T>
+    T get(SettingHandle<T> handle) const {
+        static_assert(kSettingSnapshotEligible<T>, "Setting type is not stored in snapshots");
+        assert(contains(handle));
+        T value;
+        std::memcpy(&value, m_slots[handle.GetIndex()].bytes, sizeof(T));
+        return value;
+    }
+
+    // Value of SettingsManager's change counter when this snapshot was taken.
+    uint64_t getVersion() const { return m_version; }
+    // Monotonic publish counter; differs between any two distinct snapshots.
+    uint64_t getSequence() const { return m_sequence; }
+
+private:
+    struct alignas(16) Slot {
+        std::byte bytes[16];
+    };
+
+    std::vector<Slot> m_slots;
+    uint64_t m_version = 0;
+    uint64_t m_sequence = 0;
+
+    friend class SettingsManager;
+};
+
 class SettingsManager {
 public:
+    static constexpr uint32_t kSnapshotRingSize = 4;
+
     static SettingsManager& GetInstance();
 
     // Registers a setting with the given name and initial value
     template<typename T>
-    void registerSetting(const std::string& name, T initialValue) {
-        settings[name] = std::make_unique<Setting<T>>(initialValue);
+    SettingHandle<T> registerSetting(const std::string& name, T initialValue) {
+        auto setting = std::make_unique<Setting<T>>(initialValue);
+        setting->bindChangeCounter(&m_changeCounter);
+
+        uint32_t index;
+        auto it = m_settingIndices.find(name);
+        if (it != m_settingIndices.end()) {
+            index = it->second;
+            m_settings[index] = std::move(setting);
+        }
+        else {
+            index = static_cast<uint32_t>(m_settings.size());
+            m_settingIndices.emplace(name, index);
+            m_settings.push_back(std::move(setting));
+            m_snapshotCopyFns.push_back(nullptr);
+        }
+
+        if constexpr (kSettingSnapshotEligible<T>) {
+            m_snapshotCopyFns[index] = [](const ISetting& setting, std::byte* dst) {
+                std::memcpy(dst, &static_cast<const Setting<T>&>(setting).getValue(), sizeof(T));
+            };
+        }
+        else {
+            m_snapshotCopyFns[index] = nullptr;
+        }
+        m_changeCounter.fetch_add(1, std::memory_order_release);
+        return SettingHandle<T>(index);
+    }
+
+    // Resolves a typed handle by name. Do this once and keep the handle.
+    template<typename T>
+    SettingHandle<T> getSettingHandle(const std::string& name) const {
+        const uint32_t index = getSettingIndex(name);
+        if (m_settings[index]->getType() != typeid(T)) {
+            throw std::runtime_error("Type mismatch for setting: " + name);
+        }
+        return SettingHandle<T>(index);
+    }
+
+    // Live read; no lookup, no indirect call.
+    template<typename T>
+    const T& get(SettingHandle<T> handle) const {
+        return getTypedSetting(handle).getValue();
+    }
+
+    // Live write; observers fire synchronously, as with the name-based setter.
+    template<typename T>
+    void set(SettingHandle<T> handle, const T& value) {
+        getTypedSetting(handle).setValue(value);
+    }
+
+    // Called by the render thread once per frame. Copies the snapshot-eligible
+    // settings into the next ring slot if anything changed since the previous
+    // publish; otherwise the current snapshot is kept.
+    const SettingsSnapshot& publishSnapshot() {
+        const uint64_t version = m_changeCounter.load(std::memory_order_acquire);
+        const SettingsSnapshot* current = m_currentSnapshot.load(std::memory_order_relaxed);
+        if (current != nullptr && current->m_version == version) {
+            return *current;
+        }
+
+        m_snapshotRingCursor = (m_snapshotRingCursor + 1) % kSnapshotRingSize;
+        SettingsSnapshot& next = m_snapshotRing[m_snapshotRingCursor];
+        next.m_slots.resize(m_settings.size());
+        for (size_t i = 0; i < m_settings.size(); ++i) {
+            if (m_snapshotCopyFns[i] != nullptr) {
+                m_snapshotCopyFns[i](*m_settings[i], next.m_slots[i].bytes);
+            }
+        }
+        next.m_version = version;
+        next.m_sequence = ++m_snapshotSequence;
+        m_currentSnapshot.store(&next, std::memory_order_release);
+        return next;
+    }
+
+    // Most recently published snapshot (empty before the first publish).
+    const SettingsSnapshot& acquireSnapshot() const {
+        const SettingsSnapshot* current = m_currentSnapshot.load(std::memory_order_acquire);
+        return current != nullptr ? *current : m_emptySnapshot;
+    }
+
+    // Reads from the current snapshot, falling back to the live value for
+    // settings registered after the last publish.
+    template<typename T>
+    T getSnapshotOrLive(SettingHandle<T> handle) const {
+        const SettingsSnapshot& snapshot = acquireSnapshot();
+        if (snapshot.contains(handle)) {
+            return snapshot.get(handle);
+        }
+        return get(handle);
     }
 
     // Returns a setter callable for the specified setting by name
@@ -108,6 +270,15 @@ public:
         s.removeObserver(id);
     }
 
+    template<typename T>
+    Subscription addObserver(SettingHandle<T> handle, std::function<void(const T&)> obs)
+    {
+        size_t id = getTypedSetting(handle).addObserver(std::move(obs));
+        return Subscription([this, handle, id]() {
+            getTypedSetting(handle).removeObserver(id);
+            });
+    }
+
     // Registers a dependency where 'controlledName' is updated based on 'controllerName' changing.
     // The resolver function takes (newControllerValue, currentControlledValue) and returns the newControlledValue.
     template<typename TController, typename TControlled>
@@ -380,16 +551,39 @@ public:
     }
 
 private:
-    std::unordered_map<std::string, std::unique_ptr<ISetting>> settings;
+    using SnapshotCopyFn = void(*)(const ISetting&, std::byte*);
+
+    std::unordered_map<std::string, uint32_t> m_settingIndices;
+    std::vector<std::unique_ptr<ISetting>> m_settings;
+    std::vector<SnapshotCopyFn> m_snapshotCopyFns;
     std::vector<Subscription> m_dependencySubscriptions;
 
+    std::atomic<uint64_t> m_changeCounter{ 0 };
+    std::array<SettingsSnapshot, kSnapshotRingSize> m_snapshotRing;
+    std::atomic<const SettingsSnapshot*> m_currentSnapshot{ nullptr };
+    SettingsSnapshot m_emptySnapshot;
+    uint32_t m_snapshotRingCursor = 0;
+    uint64_t m_snapshotSequence = 0;
+
     SettingsManager() = default;
-    // Helper function to retrieve a setting by name
-    ISetting& getSettingByName(const std::string& name) {
-        if (settings.find(name) == settings.end()) {
+
+    uint32_t getSettingIndex(const std::string& name) const {
+        auto it = m_settingIndices.find(name);
+        if (it == m_settingIndices.end()) {
             throw std::runtime_error("Setting not found: " + name);
         }
-        return *settings[name];
+        return it->second;
+    }
+
+    // Helper function to retrieve a setting by name
+    ISetting& getSettingByName(const std::string& name) {
+        return *m_settings[getSettingIndex(name)];
+    }
+
+    template<typename T>
+    Setting<T>& getTypedSetting(SettingHandle<T> handle) const {
+        assert(handle.GetIndex() < m_settings.size());
+        return static_cast<Setting<T>&>(*m_settings[handle.GetIndex()]);
     }
 };
 
@@ -4,8 +4,6 @@
 #include <cstdint>
 #include <algorithm>
 #include <atomic>
-#include <condition_variable>
-#include <deque>
 #include <exception>
 #include <future>
 #include <mutex>
@@ -20,6 +18,80 @@
 
 namespace br {
 
+// IO and background tasks are dispatched strictly by priority class; within a
+// class, workers drain their own deque first and then steal from siblings.
+enum class TaskPriority : uint8_t {
+    High = 0,
+    Normal,
+    Low,
+};
+
+inline constexpr size_t kTaskPriorityCount = 3;
+
+// Shared cancellation flag. Tasks whose token is cancelled before they are
+// dequeued are dropped without running; dependents are still released.
+class TaskCancellationToken {
+public:
+    TaskCancellationToken() = default;
+
+    static TaskCancellationToken Create() {
+        TaskCancellationToken token;
+        token.m_cancelled = std::make_shared<std::atomic<bool>>(false);
+        return token;
+    }
+
+    bool IsValid() const noexcept {
+        return static_cast<bool>(m_cancelled);
+    }
+
+    void Cancel() const noexcept {
+        if (m_cancelled) {
+            m_cancelled->store(true, std::memory_order_release);
+        }
+    }
+
+    bool IsCancelled() const noexcept {
+        return m_cancelled && m_cancelled->load(std::memory_order_acquire);
+    }
+
+private:
+    std::shared_ptr<std::atomic<bool>> m_cancelled;
+};
+
+class TaskHandle {
+public:
+    TaskHandle() = default;
+
+    bool IsValid() const noexcept {
+        return static_cast<bool>(m_state);
+    }
+
+    // True once the task has run or was dropped by cancellation.
+    bool IsDone() const noexcept;
+
+    // Blocks until IsDone(). Do not wait on a task queued behind the calling
+    // worker's own pool from inside that pool.
+    void Wait() const;
+
+private:
+    struct State;
+
+    explicit TaskHandle(std::shared_ptr<State> state)
+        : m_state(std::move(state)) {
+    }
+
+    std::shared_ptr<State> m_state;
+
+    friend class TaskSchedulerManager;
+};
+
+struct TaskOptions {
+    TaskPriority priority = TaskPriority::Normal;
+    TaskCancellationToken cancellationToken;
+    // The task is enqueued only once every dependency is done.
+    std::vector<TaskHandle> dependencies;
+};
+
 class TaskSchedulerManager {
 public:
     static TaskSchedulerManager& GetInstance();
@@ -28,10 +100,13 @@ public:
     void Cleanup();
     void RunIoTask(std::function<void()>&& task);
     void RunIoTask(std::string_view taskName, std::function<void()>&& task);
+    void RunIoTask(std::string_view taskName, std::function<void()>&& task, TaskPriority priority);
     void QueueIoTask(std::function<void()>&& task);
     void QueueIoTask(std::string_view taskName, std::function<void()>&& task);
+    TaskHandle QueueIoTask(std::string_view taskName, std::function<void()>&& task, const TaskOptions& options);
     void RunBackgroundTask(std::function<void()>&& task);
     void RunBackgroundTask(std::string_view taskName, std::function<void()>&& task);
+    TaskHandle RunBackgroundTask(std::string_view taskName, std::function<void()>&& task, const TaskOptions& options);
 
     bool IsInitialized() const {
         return m_initialized;
@@ -41,13 +116,8 @@ public:
         return m_initialized ? m_workerThreadCount : 0u;
     }
 
-    uint32_t GetNumIoThreads() const {
-        return static_cast<uint32_t>(m_ioThreads.size());
-    }
-
-    uint32_t GetNumBackgroundThreads() const {
-        return static_cast<uint32_t>(m_backgroundThreads.size());
-    }
+    uint32_t GetNumIoThreads() const;
+    uint32_t GetNumBackgroundThreads() const;
 
     template <typename Func>
     void ParallelFor(size_t itemCount, Func&& func) {
@@ -66,25 +136,17 @@ public:
 
 private:
     struct RuntimeState;
+    struct WorkerPool;
 
-    TaskSchedulerManager() = default;
+    TaskSchedulerManager();
+    ~TaskSchedulerManager();
 
-    void IoWorkerLoop();
-    void BackgroundWorkerLoop();
+    TaskHandle Submit(WorkerPool& pool, std::string_view taskName, std::function<void()>&& task, const TaskOptions& options);
     void ParallelForImpl(std::string_view taskName, size_t itemCount, std::function<void(size_t)>&& func);
 
     std::unique_ptr<RuntimeState> m_runtimeState;
-    std::vector<std::thread> m_ioThreads;
-    std::vector<std::thread> m_backgroundThreads;
-    std::deque<std::function<void()>> m_ioTasks;
-    std::deque<std::function<void()>> m_backgroundTasks;
-    std::mutex m_ioMutex;
-    std::mutex m_backgroundMutex;
-    std::condition_variable m_ioCv;
-    std::condition_variable m_backgroundCv;
-    std::atomic<uint32_t> m_ioRoundRobin = 0;
-    std::atomic<bool> m_ioShutdownRequested = false;
-    std::atomic<bool> m_backgroundShutdownRequested = false;
+    std::unique_ptr<WorkerPool> m_ioPool;
+    std::unique_ptr<WorkerPool> m_backgroundPool;
     uint32_t m_workerThreadCount = 0;
     bool m_initialized = false;
 };
@@ -92,3 +154,7 @@ private:
 }
 
 using TaskSchedulerManager = br::TaskSchedulerManager;
+using TaskPriority = br::TaskPriority;
+using TaskCancellationToken = br::TaskCancellationToken;
+using TaskHandle = br::TaskHandle;
+using TaskOptions = br::TaskOptions;
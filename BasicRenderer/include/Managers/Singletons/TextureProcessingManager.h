@@ -53,6 +53,9 @@ public:
 	bool ShouldProcess(const TextureFileMeta& meta) const;
 	bool NeedsProcessing(const TextureSourceData& sourceData, const TextureFileMeta& meta) const;
 	std::wstring GetExistingCachePathForFile(const TextureFileMeta& meta) const;
+	// Writes already-conditioned source data (e.g. transcoded KTX2) straight to the
+	// conditioned cache. Returns the cache path, or empty if the data still needs processing.
+	std::wstring StoreConditionedSourceData(const TextureSourceData& sourceData, const TextureFileMeta& meta) const;
 
 private:
 	TextureProcessingManager() = default;
@@ -1801,6 +1801,12 @@ inline void Menu::Render(const RenderContext& context, rhi::CommandList commandL
                 clodRtStats.tlasBuildSubmitted ? "yes" : "no",
                 clodRtStats.rayPipelineReady ? "yes" : "no",
                 clodRtStats.traceRaysSubmitted ? "yes" : "no");
+            ImGui::TextDisabled(
+                "CLod RT residency delta: %u events, %u groups patched, %u removed%s",
+                clodRtStats.residencyDeltaEvents,
+                clodRtStats.residencyGroupsPatched,
+                clodRtStats.residencyGroupsRemoved,
+                clodRtStats.residencyFullResync ? " (full resync)" : "");
         }
         if (ImGui::Checkbox("Enable Jitter", &m_jitterEnabled)) {
             setJitterEnabled(m_jitterEnabled);
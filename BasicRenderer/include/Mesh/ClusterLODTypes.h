@@ -184,6 +184,15 @@ enum class ClusterLODVoxelPruningMode : uint8_t
 	Coverage,
 };
 
+// Order in which group segments are packed into mesh pages (and pages into
+// the container). HierarchyLocality keeps siblings and parent/child groups on
+// the same or adjacent pages; DepthMajor is the original breadth-first order.
+enum class ClusterLODPagePackingMode : uint8_t
+{
+	DepthMajor,
+	HierarchyLocality,
+};
+
 struct ClusterLODBuilderSettings
 {
 	bool disableSloppyFallback = false;
@@ -209,6 +218,8 @@ struct ClusterLODBuilderSettings
 	bool voxelFallbackCarryZeroCoverage = false;
 	ClusterLODVoxelPruningMode voxelFallbackPruningMode = ClusterLODVoxelPruningMode::None;
 	bool doubleSidedVoxelSourceNormals = false;
+
+	ClusterLODPagePackingMode pagePackingMode = ClusterLODPagePackingMode::HierarchyLocality;
 };
 
 inline std::string GetClusterLODEnvironmentVariable(const char* name)
@@ -317,6 +328,19 @@ inline ClusterLODBuilderSettings ApplyClusterLODBuilderEnvironmentOverrides(Clus
 		}
 	}
 
+	const std::string pagePackingString = GetClusterLODEnvironmentVariable("BASICRENDERER_CLOD_PAGE_PACKING");
+	if (!pagePackingString.empty())
+	{
+		if (pagePackingString == "depth" || pagePackingString == "depth-major" || pagePackingString == "legacy")
+		{
+			settings.pagePackingMode = ClusterLODPagePackingMode::DepthMajor;
+		}
+		else if (pagePackingString == "hierarchy" || pagePackingString == "locality")
+		{
+			settings.pagePackingMode = ClusterLODPagePackingMode::HierarchyLocality;
+		}
+	}
+
 	return settings;
 }
 
@@ -388,6 +412,24 @@ public:
 		m_skinningVertices.insert(m_skinningVertices.end(), data, data + byteCount);
 	}
 
+	// Grows the vertex stream by vertexCount zeroed vertices and returns the
+	// first new byte, so importers can write attributes in place instead of
+	// staging whole vertices for AppendVertexBytes.
+	std::byte* AppendVertexStorage(size_t vertexCount) {
+		const size_t first = m_vertices.size();
+		m_vertices.resize(first + vertexCount * static_cast<size_t>(m_vertexSize));
+		return m_vertices.data() + first;
+	}
+
+	std::byte* AppendSkinningVertexStorage(size_t vertexCount) {
+		if (m_skinningVertexSize == 0) {
+			throw std::runtime_error("MeshIngestBuilder has no skinning vertex format");
+		}
+		const size_t first = m_skinningVertices.size();
+		m_skinningVertices.resize(first + vertexCount * static_cast<size_t>(m_skinningVertexSize));
+		return m_skinningVertices.data() + first;
+	}
+
 	void AppendIndex(uint32_t index) {
 		m_indices.push_back(index);
 	}
@@ -396,6 +438,12 @@ public:
 		m_indices.insert(m_indices.end(), data, data + count);
 	}
 
+	uint32_t* AppendIndexStorage(size_t count) {
+		const size_t first = m_indices.size();
+		m_indices.resize(first + count);
+		return m_indices.data() + first;
+	}
+
 	void SetUvSets(std::vector<MeshUvSetData> uvSets) {
 		m_uvSets = std::move(uvSets);
 	}
@@ -404,6 +452,12 @@ public:
 		return m_uvSets;
 	}
 
+	// Per-vertex tangents (w = handedness) supplied by the source asset. When
+	// present and valid, ClusterLOD uses them instead of running MikkTSpace.
+	void SetSourceTangents(std::vector<DirectX::XMFLOAT4> tangents) {
+		m_sourceTangents = std::move(tangents);
+	}
+
 	// GPU-side: creates a Mesh object with buffer views.
 	// Only implemented in the renderer (Mesh.cpp); not available in headless builds.
 	std::shared_ptr<Mesh> Build(
@@ -430,5 +484,6 @@ private:
 	std::vector<std::byte> m_skinningVertices;
 	std::vector<uint32_t> m_indices;
 	std::vector<MeshUvSetData> m_uvSets;
+	std::vector<DirectX::XMFLOAT4> m_sourceTangents;
 	ClusterLODBuilderSettings m_clusterLODBuilderSettings{};
 };
@@ -9,5 +9,6 @@ ClusterLODPrebuildArtifacts BuildClusterLODArtifactsFromGeometry(
 	unsigned int skinningVertexSize,
 	const std::vector<uint32_t>& indices,
 	const std::vector<MeshUvSetData>& uvSets,
+	const std::vector<DirectX::XMFLOAT4>* sourceTangents,
 	unsigned int flags,
 	const ClusterLODBuilderSettings& settings);
@@ -12,6 +12,7 @@
 #include <meshoptimizer.h>
 
 #include "Mesh/ClusterLODTypes.h"
+#include "Mesh/SkinnedBounds.h"
 #include "Import/MeshData.h"
 #include "ShaderBuffers.h"
 #include "Resources/Buffers/BufferView.h"
@@ -253,6 +254,9 @@ private:
 	unsigned int m_skinningVertexSize = 0;
 	std::vector<MeshUvSetData> m_uvSets;
 	mutable std::vector<BoundingSphere> m_animationBoundingSpheres;
+	// Bind-space bounds of each bone's influenced vertices; empty when the
+	// skinning stream could not be bounded per bone.
+	std::vector<BoneInfluenceSphere> m_boneInfluenceSpheres;
 	std::unique_ptr<BufferView> m_perMeshBufferView;
 	MeshManager* m_pCurrentMeshManager = nullptr;
 
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+#include <vector>
+#include <directxmath.h>
+
+struct MikkTangentGeneratorOptions
+{
+	// Faces per MikkTSpace invocation. Chunks are cut from a fixed spatial
+	// ordering, so the result depends on this value but never on thread count.
+	uint32_t facesPerChunk = 1u << 15;
+
+	// Runs body(i) for every i in [0, count), possibly concurrently.
+	// Left empty, chunks are processed serially.
+	std::function<void(size_t count, const std::function<void(size_t)>& body)> parallelFor;
+};
+
+// Per-vertex MikkTSpace tangents (xyz, w = handedness) for an interleaved
+// MeshVertexLayout stream with normals and texcoords. Vertices with no usable
+// contribution get a tangent perpendicular to their normal.
+//
+// Chunked path: faces are ordered along a Morton curve of their centroids and
+// split into chunks that run genTangSpaceDefault independently. Each corner's
+// result is written to its own slot and then summed per vertex in original
+// corner order, so shared vertices resolve identically regardless of which
+// thread produced each chunk.
+bool GenerateMikkTangentsChunked(
+	const std::vector<std::byte>& vertices,
+	size_t vertexStrideBytes,
+	const std::vector<uint32_t>& indices,
+	std::vector<DirectX::XMFLOAT4>& outTangents,
+	const MikkTangentGeneratorOptions& options = {});
+
+// Whole-mesh, single-threaded reference path.
+bool GenerateMikkTangentsSerial(
+	const std::vector<std::byte>& vertices,
+	size_t vertexStrideBytes,
+	const std::vector<uint32_t>& indices,
+	std::vector<DirectX::XMFLOAT4>& outTangents);
+
+// True when sourceTangents holds one finite, non-degenerate tangent with a
+// +-1 handedness per vertex, i.e. generation can be skipped.
+bool HasValidSourceTangents(const std::vector<DirectX::XMFLOAT4>& sourceTangents, size_t vertexCount);
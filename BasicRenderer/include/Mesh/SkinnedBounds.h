@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// Bind-space sphere around the vertices one bone influences.
+struct BoneInfluenceSphere {
+	float center[3] = { 0.0f, 0.0f, 0.0f };
+	float radius = 0.0f;
+	uint32_t boneIndex = 0;
+};
+
+struct SkinnedBoundsSphere {
+	float center[3] = { 0.0f, 0.0f, 0.0f };
+	float radius = 0.0f;
+};
+
+// Builds one sphere per bone from the packed skinning vertex stream
+// (float3 position, float3 normal, uint4 joints0, uint4 joints1, float4
+// weights0, float4 weights1), indexed by joint. Bones with no weighted vertices
+// get no sphere.
+//
+// A linearly blended vertex is a convex combination of its position
+// transformed by each influencing bone, so it stays inside the union of those
+// bones' posed spheres. That only holds for non-negative weights summing to
+// one; streams with other weights return false and the caller should keep the
+// whole-mesh bound. The caller must also check every boneIndex against the
+// skeleton it poses with.
+bool BuildBoneInfluenceSpheres(
+	std::span<const std::byte> skinningVertices,
+	size_t skinningVertexStrideBytes,
+	std::vector<BoneInfluenceSphere>& outSpheres);
+
+// Accumulates posed bone spheres over any number of poses and returns one
+// sphere containing all of them.
+class SkinnedBoundsBuilder {
+public:
+	explicit SkinnedBoundsBuilder(std::span<const BoneInfluenceSphere> boneSpheres) : m_boneSpheres(boneSpheres) {}
+
+	// skinMatrices holds 16 floats per skeleton bone: the row-vector affine
+	// skin matrix (bone * inverse bind) as XMMATRIX stores it.
+	void AddPose(std::span<const float> skinMatrices);
+
+	bool Empty() const { return m_posed.empty(); }
+	void Clear();
+	SkinnedBoundsSphere Build() const;
+
+private:
+	std::span<const BoneInfluenceSphere> m_boneSpheres;
+	std::vector<SkinnedBoundsSphere> m_posed;
+	float m_min[3] = {};
+	float m_max[3] = {};
+};
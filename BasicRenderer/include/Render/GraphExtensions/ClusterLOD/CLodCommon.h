@@ -14,7 +14,18 @@
 
 inline constexpr const char* CLodStreamingMeshManagerGetterSettingName = "getMeshManager";
 inline constexpr const char* CLodStreamingCpuUploadBudgetSettingName = "clodStreamingCpuUploadBudgetRequests";
+// Cap on resident streamed page bytes, published by the frame memory budget. 0 = pool capacity.
+inline constexpr const char* CLodStreamingResidentBudgetBytesSettingName = "clodStreamingResidentBudgetBytes";
 inline constexpr const char* CLodStreamingEnableDirectStorageSettingName = "clodStreamingEnableDirectStorage";
+// Disk read coalescing: largest hole bridged between page blobs, and the cap on one merged read (0 = off).
+inline constexpr const char* CLodStreamingReadCoalesceGapBytesSettingName = "clodStreamingReadCoalesceGapBytes";
+inline constexpr const char* CLodStreamingReadCoalesceMaxBytesSettingName = "clodStreamingReadCoalesceMaxBytes";
+// Motion-predictive prefetch: speculative loads for where the primary camera is heading.
+inline constexpr const char* CLodStreamingPrefetchEnabledSettingName = "clodStreamingPrefetchEnabled";
+inline constexpr const char* CLodStreamingPrefetchLookaheadFramesSettingName = "clodStreamingPrefetchLookaheadFrames";
+inline constexpr const char* CLodStreamingPrefetchMaxRequestsSettingName = "clodStreamingPrefetchMaxRequests";
+// std::function<bool(CLodPrefetchCameraPose&)>; false while there is no primary camera.
+inline constexpr const char* CLodStreamingPrefetchCameraGetterSettingName = "getCLodPrefetchCamera";
 inline constexpr const char* CLodDisableReyesRasterizationSettingName = "clodDisableReyesRasterization";
 inline constexpr const char* CLodReyesResourceBudgetBytesSettingName = "clodReyesResourceBudgetBytes";
 inline constexpr const char* CLodDisableVirtualShadowPageCachingSettingName = "clodDisableVirtualShadowPageCaching";
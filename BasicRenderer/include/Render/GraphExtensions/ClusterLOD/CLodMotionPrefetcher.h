@@ -0,0 +1,191 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+// Camera state the prefetcher extrapolates. Mirrors the fields the GPU LOD
+// metric reads from the culling camera.
+struct CLodPrefetchCameraPose {
+    float position[3] = { 0.0f, 0.0f, 0.0f };
+    float forward[3] = { 0.0f, 0.0f, 1.0f }; // Unit length
+    float errorOverDistanceThreshold = 0.0f;
+    float tanHalfFovY = 1.0f;
+    float aspectRatio = 1.0f;
+    float zNear = 0.1f;
+    bool isOrtho = false;
+};
+
+// Mesh-local group bounds and hierarchy link, copied from ClusterLODGroup.
+struct CLodPrefetchGroup {
+    float center[3] = { 0.0f, 0.0f, 0.0f };
+    float radius = 0.0f;
+    float error = 0.0f;
+    int32_t parentLocal = -1;
+};
+
+// One mesh hierarchy occupying [groupsBase, groupsBase + groups.size()).
+struct CLodPrefetchMesh {
+    uint32_t groupsBase = 0;
+    std::span<const CLodPrefetchGroup> groups;
+};
+
+struct CLodPrefetchInstance {
+    uint32_t groupsBase = 0;
+    // Row-vector affine transform (rows 0-2 are the basis, row 3 the
+    // translation), matching the object model matrix.
+    float rows[4][3] = {};
+    float uniformScale = 1.0f; // Max axis scale, as lodUniformScale
+};
+
+// Predictive CLod prefetch.
+//
+// The GPU only requests a group once the current view needs it, so a fast
+// camera sees coarse geometry for the length of the IO round trip. This
+// extrapolates the camera a few frames ahead (constant linear and angular
+// velocity over a short history), evaluates the group error metric on the
+// CPU for the predicted views and returns the groups those views would
+// request.
+//
+// The metric is the per-group one from the streaming priority path:
+// (error * scale) / max(distance - radius, zNear), refining a group's
+// children while it is above the camera threshold, with a widened view cone
+// in place of frustum and occlusion culling. A group culled by the cone
+// prunes its subtree.
+//
+// It also tracks what happens to the speculative loads it caused, so the
+// caller can report hit rate and wasted IO:
+// - hit: demanded while resident, the load fully hid the latency;
+// - late hit: demanded while its IO was in flight, so part of the latency
+//   was hidden;
+// - wasted: loaded but evicted or not demanded within expiryFrames;
+// - cancelled: dropped before any IO was issued.
+// A request the GPU asks for while still queued just becomes a regular one
+// and counts as none of these.
+//
+// Thread safety: none - intended to be owned by the streaming system.
+class CLodMotionPrefetcher {
+public:
+    struct Options {
+        uint32_t lookaheadFrames = 8;
+        // Predicted views evaluated per update, evenly spread over the lookahead.
+        uint32_t predictionSamples = 2;
+        uint32_t historyFrames = 4;
+        uint32_t maxCandidatesPerUpdate = 64;
+        // Bounds CPU cost; groups past the budget are not visited this update.
+        uint32_t maxGroupVisitsPerSample = 1u << 16;
+        float coneMarginRadians = 0.15f;
+        uint32_t expiryFrames = 120;
+    };
+
+    struct Candidate {
+        uint32_t groupIndex = 0;
+        float errorOverDistance = 0.0f;
+    };
+
+    struct Stats {
+        uint64_t queued = 0;
+        uint64_t cancelled = 0;
+        uint64_t issued = 0;
+        uint64_t issuedBytes = 0;
+        uint64_t hits = 0;
+        uint64_t lateHits = 0;
+        uint64_t wasted = 0;
+        uint64_t wastedBytes = 0;
+
+        // Share of resolved speculative loads that were demanded.
+        double HitRate() const {
+            const uint64_t resolved = hits + lateHits + wasted;
+            return resolved != 0 ? static_cast<double>(hits + lateHits) / static_cast<double>(resolved) : 0.0;
+        }
+    };
+
+    void SetOptions(const Options& options) { m_options = options; }
+    const Options& GetOptions() const { return m_options; }
+
+    // Camera history. Call once per frame.
+    void ObserveCamera(const CLodPrefetchCameraPose& pose);
+    void ResetCameraHistory() { m_history.clear(); }
+    // Extrapolated pose framesAhead frames after the last observation. Returns
+    // false until two poses have been observed.
+    bool PredictPose(float framesAhead, CLodPrefetchCameraPose& outPose) const;
+
+    // Scene. Meshes are copied; instances are read during CollectCandidates only.
+    void SetMeshes(std::span<const CLodPrefetchMesh> meshes);
+    void SetInstances(std::span<const CLodPrefetchInstance> instances) { m_instances = instances; }
+    uint32_t MeshCount() const { return static_cast<uint32_t>(m_meshes.size()); }
+
+    // Groups the predicted views need, highest error over distance first.
+    // skip returns true for groups that should not be requested (resident,
+    // already queued, outside the streaming domain).
+    void CollectCandidates(const std::function<bool(uint32_t)>& skip, std::vector<Candidate>& out);
+
+    // Speculative load outcomes.
+
+    void OnSpeculativeQueued(uint32_t groupIndex);
+    void OnSpeculativeCancelled(uint32_t groupIndex);
+    // IO was submitted for the group's pages.
+    void OnSpeculativeIssued(uint32_t groupIndex, uint64_t bytes);
+    void OnGroupResidencyChanged(uint32_t groupIndex, bool resident);
+    // The GPU requested or rendered the group.
+    void OnGroupDemanded(uint32_t groupIndex);
+
+    // Queued speculative requests that have not started IO yet.
+    bool IsSpeculativeQueued(uint32_t groupIndex) const;
+    void CollectQueued(std::vector<uint32_t>& out) const;
+    uint32_t TrackedCount() const { return static_cast<uint32_t>(m_tracked.size()); }
+
+    // Ages tracked loads. Resident loads past expiryFrames count as wasted;
+    // queued ones are appended to expiredQueued for the caller to cancel.
+    void AdvanceFrame(std::vector<uint32_t>& expiredQueued);
+
+    const Stats& GetStats() const { return m_stats; }
+    void ResetStats() { m_stats = {}; }
+
+private:
+    enum class TrackState : uint8_t {
+        Queued,
+        InFlight,
+        Resident,
+    };
+
+    struct TrackedGroup {
+        TrackState state = TrackState::Queued;
+        uint32_t frame = 0;
+        uint64_t bytes = 0;
+    };
+
+    struct MeshRange {
+        uint32_t groupsBase = 0;
+        uint32_t groupCount = 0;
+        uint32_t firstGroup = 0; // Into m_groups
+        uint32_t firstRoot = 0;  // Into m_roots
+        uint32_t rootCount = 0;
+    };
+
+    const MeshRange* FindMesh(uint32_t groupsBase) const;
+    void EvaluateView(const CLodPrefetchCameraPose& pose);
+    void Untrack(uint32_t groupIndex);
+    bool IsTracked(uint32_t groupIndex) const;
+
+    Options m_options;
+    std::vector<CLodPrefetchCameraPose> m_history; // Oldest first
+
+    std::vector<MeshRange> m_meshes; // Sorted by groupsBase
+    std::vector<CLodPrefetchGroup> m_groups;
+    std::vector<uint32_t> m_childOffsets; // CSR per m_groups entry, local child indices
+    std::vector<uint32_t> m_children;
+    std::vector<uint32_t> m_roots;
+    std::span<const CLodPrefetchInstance> m_instances;
+
+    std::vector<uint32_t> m_instanceOrder;
+    std::vector<uint32_t> m_stack;
+    std::vector<Candidate> m_visited;
+
+    std::unordered_map<uint32_t, TrackedGroup> m_tracked;
+    std::vector<uint32_t> m_trackedBits; // Cheap negative test for OnGroupDemanded
+    uint32_t m_frame = 0;
+    Stats m_stats;
+};
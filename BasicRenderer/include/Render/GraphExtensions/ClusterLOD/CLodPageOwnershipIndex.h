@@ -0,0 +1,126 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// Page ownership bookkeeping for cluster-LOD streaming.
+//
+// - Group side: every owned group has one contiguous range of per-segment
+//   physical pages and mesh-page keys in two flat arrays, addressed by a dense
+//   per-group table. Reassigning a group with the same segment count rewrites
+//   its range in place; otherwise the range is appended and the old one left
+//   as garbage until Assign compacts the arrays.
+// - Page side: every physical page heads an intrusive doubly-linked list of
+//   resident owners. Nodes carry the owning segment slot, so key lookups read
+//   the owner's key straight out of the flat arrays and every per-page query
+//   is O(owners) with no hashing.
+//
+// Residency is tracked separately from ownership, as before: erasing or
+// reassigning a group does not unlink its resident nodes. Readers validate a
+// node against the group's current pages and ScrubStaleResidents() drops the
+// ones that no longer match.
+//
+// Spans returned by GroupPages()/GroupKeys() are invalidated by AssignGroup().
+//
+// Thread safety: none - intended to be owned by a single thread (the worker).
+class CLodPageOwnershipIndex {
+public:
+    static constexpr uint32_t kInvalidPage = ~0u;
+    static constexpr uint32_t kInvalidGroup = ~0u;
+    static constexpr uint64_t kInvalidKey = ~0ull;
+
+    // Drop all ownership and residency and size the page table.
+    void Reset(uint32_t pageCount);
+    // Grow the page table, keeping existing residents.
+    void ResizePages(uint32_t pageCount);
+    void Clear();
+
+    uint32_t PageCount() const { return static_cast<uint32_t>(m_pageHeads.size()); }
+
+    // Group ownership.
+
+    // Replace the group's pages and keys. keys may be shorter than pages; the
+    // missing slots read as kInvalidKey.
+    void AssignGroup(uint32_t groupIndex, std::span<const uint32_t> pages, std::span<const uint64_t> keys);
+    // Returns false if the group owned nothing.
+    bool EraseGroup(uint32_t groupIndex);
+
+    bool OwnsGroup(uint32_t groupIndex) const {
+        return groupIndex < m_groups.size() && m_groups[groupIndex].ownedListIndex != kInvalidGroup;
+    }
+    std::span<const uint32_t> GroupPages(uint32_t groupIndex) const;
+    std::span<const uint64_t> GroupKeys(uint32_t groupIndex) const;
+    uint64_t GroupKey(uint32_t groupIndex, uint32_t slot) const;
+
+    bool GroupReferencesPage(uint32_t groupIndex, uint32_t page) const;
+    bool GroupReferencesPageKey(uint32_t groupIndex, uint32_t page, uint64_t key) const;
+
+    // Owned groups in no particular order.
+    const std::vector<uint32_t>& OwnedGroups() const { return m_ownedGroups; }
+    uint32_t OwnedGroupCount() const { return static_cast<uint32_t>(m_ownedGroups.size()); }
+
+    // Page residency.
+
+    // Record that groupIndex has committed residency on page through the given
+    // segment slot. Returns false if the group is already resident there.
+    bool AddResident(uint32_t page, uint32_t groupIndex, uint32_t slot);
+    // Returns false if the group was not resident on the page.
+    bool RemoveResident(uint32_t page, uint32_t groupIndex);
+    void ClearResidents(uint32_t page);
+
+    bool IsResident(uint32_t page, uint32_t groupIndex) const;
+    bool HasResidents(uint32_t page) const {
+        return page < m_pageHeads.size() && m_pageHeads[page] != kNoNode;
+    }
+    uint32_t ResidentCount(uint32_t page) const {
+        return page < m_pageResidentCounts.size() ? m_pageResidentCounts[page] : 0u;
+    }
+
+    // Resident groups whose current pages still hold key on this page.
+    uint32_t CountResidentsForKey(uint32_t page, uint64_t key) const;
+    // Returns kInvalidGroup if none. outSlot receives the matching segment.
+    uint32_t FindResidentForKey(uint32_t page, uint64_t key, uint32_t* outSlot = nullptr) const;
+
+    // Append the page's resident groups to out.
+    void CollectResidents(uint32_t page, std::vector<uint32_t>& out) const;
+
+    // Unlink residents whose group no longer references the page. Returns the
+    // number removed.
+    uint32_t ScrubStaleResidents(uint32_t page);
+
+private:
+    static constexpr uint32_t kNoNode = ~0u;
+
+    struct GroupRange {
+        uint32_t offset = 0;
+        uint32_t count = 0;
+        uint32_t ownedListIndex = kInvalidGroup; // Into m_ownedGroups
+    };
+
+    struct ResidentNode {
+        uint32_t groupIndex = kInvalidGroup;
+        uint32_t slot = 0;
+        uint32_t prev = kNoNode;
+        uint32_t next = kNoNode;
+    };
+
+    // Slot of page in the group's current range, checking the hinted slot
+    // first. Returns ~0u if the group no longer references the page (with key,
+    // if key is valid).
+    uint32_t ResolveSlot(uint32_t groupIndex, uint32_t hintSlot, uint32_t page, uint64_t key) const;
+    uint32_t FindNode(uint32_t page, uint32_t groupIndex) const;
+    void UnlinkNode(uint32_t page, uint32_t node);
+    void CompactSegments();
+
+    std::vector<GroupRange> m_groups;
+    std::vector<uint32_t> m_ownedGroups;
+    std::vector<uint32_t> m_segmentPages;
+    std::vector<uint64_t> m_segmentKeys;
+    uint32_t m_liveSegments = 0;
+
+    std::vector<uint32_t> m_pageHeads;
+    std::vector<uint32_t> m_pageResidentCounts;
+    std::vector<ResidentNode> m_nodes;
+    uint32_t m_freeNodes = kNoNode; // Free list threaded through next
+};
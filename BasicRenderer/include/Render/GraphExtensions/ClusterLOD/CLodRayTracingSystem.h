@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 #include "Managers/MeshManager.h"
@@ -24,6 +25,11 @@ public:
         uint32_t triangles = 0;
         uint32_t buildableClusters = 0;
         uint64_t snapshotGeneration = 0;
+        // Residency journal traffic consumed by the last Refresh.
+        uint32_t residencyDeltaEvents = 0;
+        uint32_t residencyGroupsPatched = 0;
+        uint32_t residencyGroupsRemoved = 0;
+        bool residencyFullResync = false;
         bool hasPagePool = false;
         bool gpuResourcesReady = false;
         bool clasBuildSubmitted = false;
@@ -62,7 +68,6 @@ public:
     void ExecuteTraceRays(rhi::Device device, rhi::CommandList commandList, PixelBuffer& output, uint32_t width, uint32_t height);
 
     const Stats& GetStats() const { return m_stats; }
-    const MeshManager::CLodRayTracingResidencySnapshot& GetSnapshot() const { return m_snapshot; }
     const std::vector<PageSource>& GetPageSources() const { return m_pageSources; }
     uint32_t GetGpuPageSourceCount() const { return static_cast<uint32_t>(m_gpuPageSources.size()); }
     bool HasBuildableGeometry() const { return m_stats.buildableGroups > 0; }
@@ -87,6 +92,20 @@ public:
     rhi::AccelerationStructure GetTlas() const { return m_tlas ? m_tlas.Get() : rhi::AccelerationStructure{}; }
 
 private:
+    // Build inputs for one resident group, patched in place from the residency journal.
+    struct ResidentGroupRecord {
+        uint32_t groupGlobalIndex = 0;
+        uint32_t residentPages = 0;
+        uint32_t meshlets = 0;
+        uint32_t buildableClusters = 0;
+        bool buildable = false;
+        std::vector<PageSource> pageSources;
+    };
+
+    void ApplyResidencyDelta(const MeshManager::CLodRayTracingResidencyDelta& delta);
+    void UpsertGroup(const MeshManager::CLodRayTracingResidentGroup& group);
+    void RemoveGroup(uint32_t groupGlobalIndex);
+    void BuildGroupRecord(const MeshManager::CLodRayTracingResidentGroup& group, ResidentGroupRecord& outRecord) const;
     void EnsureBuffers(
         uint32_t pageSourceCount,
         uint32_t clusterCount,
@@ -95,7 +114,15 @@ private:
         uint64_t blasDataBytes,
         uint64_t blasScratchBytes);
 
-    MeshManager::CLodRayTracingResidencySnapshot m_snapshot;
+    MeshManager::CLodRayTracingResidencyDelta m_residencyDelta;
+    uint64_t m_residencyJournalEpoch = 0;
+    uint64_t m_residencyJournalSequence = 0;
+    uint64_t m_pagePoolGeneration = 0;
+    PagePool* m_pagePool = nullptr;
+    std::vector<ResidentGroupRecord> m_groups;
+    std::unordered_map<uint32_t, uint32_t> m_groupSlotByGlobalIndex;
+    Stats m_totals{};
+    bool m_pageSourcesDirty = true;
     std::vector<PageSource> m_pageSources;
     std::vector<GpuPageSource> m_gpuPageSources;
     Stats m_stats{};
@@ -16,7 +16,9 @@
 #include "Render/RenderGraph/RenderGraph.h"
 #include "Render/GraphExtensions/CLodTelemetry.h"
 #include "Render/GraphExtensions/ClusterLOD/CLodCommon.h"
+#include "Render/GraphExtensions/ClusterLOD/CLodMotionPrefetcher.h"
 #include "Render/GraphExtensions/ClusterLOD/CLodPageLRU.h"
+#include "Render/GraphExtensions/ClusterLOD/CLodPageOwnershipIndex.h"
 #include "Resources/Buffers/Buffer.h"
 
 class UploadInstance;
@@ -115,6 +117,8 @@ private:
     void EvictPrefetchedChildLayoutsForOwner(uint32_t ownerGroupIndex);
     void ClearPrefetchedChildLayouts();
     void PollCompletedReadbackSlots();
+    void UpdateMotionPrefetch(MeshManager* meshManager);
+    void CancelQueuedSpeculativeRequests();
     void StreamingWorkerMain();
     void ProcessStreamingRequestsBudgeted();
     void PrepareStreamingFrameWork();
@@ -155,7 +159,7 @@ private:
     bool DoesGroupReferencePhysicalPage(uint32_t groupIndex, uint32_t page) const;
     bool DoesGroupReferencePageKey(uint32_t groupIndex, uint32_t page, uint64_t key) const;
     uint32_t CountResidentGroupsForPageKey(uint32_t page, uint64_t key) const;
-    uint32_t FindResidentGroupForPageKey(uint32_t page, uint64_t key) const;
+    uint32_t FindResidentGroupForPageKey(uint32_t page, uint64_t key, uint32_t* outSegment = nullptr) const;
     uint32_t ScrubStaleResidentGroups(uint32_t page);
     void ProtectGroupAndAncestors(uint32_t groupIndex);
     void BeginPageProtectionUpdate();
@@ -163,6 +167,7 @@ private:
     bool IsPhysicalPageCleanForFreshAllocation(uint32_t page) const;
     bool IsPhysicalPageEvictable(uint32_t page) const;
     bool EvictPhysicalPage(uint32_t page, MeshManager* meshManager);
+    uint32_t TrimResidentPagesToBudget(uint64_t residentPages, uint64_t maxResidentPages, MeshManager* meshManager);
     void MarkStreamingNonResidentBitsDirtyWord(uint32_t wordAddress);
     void MarkStreamingNonResidentBitsDirtyAll();
     void MarkStreamingActiveGroupsBitsDirty();
@@ -241,10 +246,10 @@ private:
     std::vector<uint32_t> m_pendingPageOwnerGroup;
     std::vector<uint32_t> m_pendingPageOwnerSegment;
     std::vector<uint64_t> m_pageOwnerMeshPageKey;
-    std::vector<std::unordered_set<uint32_t>> m_pageResidentGroups;
     std::vector<uint8_t> m_pageProtectedThisUpdate;
-    std::unordered_map<uint32_t, std::vector<uint32_t>> m_groupOwnedPages; // group to page IDs by segment (~0u = no page)
-    std::unordered_map<uint32_t, std::vector<uint64_t>> m_groupOwnedMeshPageKeys; // group to mesh-page keys by page slot
+    // Group to page IDs and mesh-page keys by segment (~0u = no page), and
+    // page to committed resident groups.
+    CLodPageOwnershipIndex m_pageOwnership;
     std::unordered_map<uint32_t, CommittedGroupPageMap> m_groupCommittedPageMaps;
     std::unordered_map<uint64_t, PageMapWriteProvenance> m_pageMapWriteProvenance;
     std::unordered_map<uint64_t, uint32_t> m_residentMeshPageToPhysicalPage;
@@ -277,6 +282,22 @@ private:
     uint64_t m_streamingNonResidentBitsQueuedTick = 0u;
     std::function<MeshManager*()> m_getMeshManager = []() { return nullptr; };
     std::function<uint32_t()> m_getStreamingCpuUploadBudgetRequests;
+    std::function<uint64_t()> m_getStreamingResidentBudgetBytes;
+
+    // Speculative loads ahead of the camera. They sit at priority 0, below
+    // every GPU request, and are cancelled first when pages run short.
+    CLodMotionPrefetcher m_motionPrefetcher;
+    std::function<bool()> m_getPrefetchEnabled;
+    std::function<uint32_t()> m_getPrefetchLookaheadFrames;
+    std::function<uint32_t()> m_getPrefetchMaxRequests;
+    std::function<bool(CLodPrefetchCameraPose&)> m_getPrefetchCamera;
+    bool m_prefetchMeshesDirty = true;
+    uint32_t m_prefetchBackoffFrames = 0u; // Set when speculative loads were cancelled for lack of pages
+    std::vector<CLodPrefetchGroup> m_prefetchGroups;
+    std::vector<CLodPrefetchMesh> m_prefetchMeshes;
+    std::vector<CLodPrefetchInstance> m_prefetchInstances;
+    std::vector<CLodMotionPrefetcher::Candidate> m_prefetchCandidatesScratch;
+    std::vector<uint32_t> m_prefetchCancelScratch;
 
     std::vector<PendingStreamingRequest> m_pendingStreamingRequests;
     std::vector<uint32_t> m_pendingStreamingRequestHeapIndexByGroup;
@@ -40,6 +40,6 @@ private:
     std::shared_ptr<Buffer> m_directionalPageViewInfoBuffer;
     std::shared_ptr<Buffer> m_statsBuffer;
     uint32_t m_pendingInputCount = 0u;
-    flecs::query<const Components::ObjectDrawInfo> m_transformChangedQuery;
+    flecs::query<const Components::ObjectDrawInfo, const Components::RenderTransformStamp> m_transformChangedQuery;
     flecs::query<const Components::ObjectDrawInfo> m_skinnedObjectsQuery;
 };
\ No newline at end of file
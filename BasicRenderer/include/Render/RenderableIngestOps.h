@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+
+#include <flecs.h>
+
+#include "Render/RendererComponents.h"
+#include "Render/SnapshotIngestPlan.h"
+
+namespace br::render {
+
+// The render-world side of SceneRenderBridge's renderable ingestion. Kept
+// apart from the bridge so SnapshotIngestBenchmark drives the same table
+// moves and column writes against a real world.
+
+// Moves the entity along one RenderableTag transition. Named is carried by
+// Components::Name, which the caller sets with the name itself.
+inline void ApplyRenderableTagTransition(flecs::entity dst, uint8_t addTags, uint8_t removeTags) {
+    if (addTags & RenderableTag::Skinned) dst.add<Components::Skinned>();
+    if (removeTags & RenderableTag::Skinned) dst.remove<Components::Skinned>();
+    if (addTags & RenderableTag::SkinningPassEligible) dst.add<Components::SkinningPassEligible>();
+    if (removeTags & RenderableTag::SkinningPassEligible) dst.remove<Components::SkinningPassEligible>();
+    if (addTags & RenderableTag::SkipShadowPass) dst.add<Components::SkipShadowPass>();
+    if (removeTags & RenderableTag::SkipShadowPass) dst.remove<Components::SkipShadowPass>();
+}
+
+struct RenderableColumns {
+    Components::Matrix* matrix = nullptr;
+    Components::RenderTransformStamp* stamp = nullptr;
+};
+
+// Valid until the entity next changes archetype. Resolve serially: flecs
+// entity accessors are not safe to call concurrently, but the returned
+// columns can then be written from any thread.
+inline RenderableColumns ResolveRenderableColumns(flecs::entity dst) {
+    return { dst.try_get_mut<Components::Matrix>(), dst.try_get_mut<Components::RenderTransformStamp>() };
+}
+
+// Writes one changed renderable's transform in place.
+inline void WriteRenderableColumns(const RenderableColumns& columns, const Components::Matrix& matrix, bool stampTransform, uint64_t ingestionFrame) {
+    if (columns.matrix) {
+        *columns.matrix = matrix;
+    }
+    if (columns.stamp && stampTransform) {
+        columns.stamp->frame = ingestionFrame;
+    }
+}
+
+} // namespace br::render
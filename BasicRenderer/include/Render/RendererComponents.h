@@ -74,8 +74,24 @@ namespace Components {
         std::unordered_map<uint64_t, std::vector<std::shared_ptr<MeshInstance>>> meshesByPass;
     };
 
-    /// Tag added to render-world entities whose data was updated during IngestSnapshot.
-    /// Consumed by RunRenderResourceSyncStage to limit GPU buffer writes.
-    struct RenderTransformUpdated {};
+    /// Ingestion frame at which IngestSnapshot last wrote the entity's transform.
+    /// Written in place, so a moving entity keeps its archetype; consumers compare
+    /// it against RenderTransformSyncWindow instead of querying a per-frame tag.
+    struct RenderTransformStamp {
+        uint64_t frame = 0;
+    };
+
+    /// World singleton advanced by the renderer once per frame. A stamp above
+    /// updatedAfter moved since the previous frame. A stamp in
+    /// (settlingAfter, updatedAfter] moved the frame before, and gets one more
+    /// visit in RunRenderResourceSyncStage so prevModelMatrix catches up with
+    /// modelMatrix.
+    struct RenderTransformSyncWindow {
+        uint64_t settlingAfter = 0;
+        uint64_t updatedAfter = 0;
+
+        bool IsUpdated(const RenderTransformStamp& stamp) const { return stamp.frame > updatedAfter; }
+        bool IsSettling(const RenderTransformStamp& stamp) const { return stamp.frame > settlingAfter && stamp.frame <= updatedAfter; }
+    };
 
 } // namespace Components
@@ -7,9 +7,11 @@
 #include <flecs.h>
 
 #include "Render/SceneFrameSnapshot.h"
+#include "Render/SnapshotIngestPlan.h"
 #include "Scene/Scene.h"
 
 class ManagerInterface;
+class ObjectManager;
 class ViewManager;
 
 namespace br::render {
@@ -21,6 +23,10 @@ public:
         uint64_t lastSeenFrame = 0;
         uint64_t meshGeneration = 0;
         DirectX::XMMATRIX lastMatrix = DirectX::XMMatrixIdentity();
+        // RenderableTag bits and name hash last applied, so unchanged ones are
+        // not re-added or re-copied every time the renderable moves.
+        uint8_t renderableTags = 0;
+        size_t nameHash = 0;
     };
 
     SceneFrameSnapshot ExportSnapshot(Scene& scene, uint64_t snapshotSequence, uint64_t sourceFrameNumber) const;
@@ -28,6 +34,10 @@ public:
     void Sync(Scene& scene, const ManagerInterface& managerInterface);
     void Clear(const ManagerInterface& managerInterface);
 
+    // Incremented once per IngestSnapshot; the value written to
+    // Components::RenderTransformStamp for entities that moved.
+    uint64_t GetIngestionFrame() const { return m_currentIngestionFrame; }
+
     bool HasPrimaryCamera() const;
     flecs::entity GetPrimaryCameraEntity() const;
     void ResyncPrimaryCameraDepth(ViewManager& viewManager, uint32_t renderWidth, uint32_t renderHeight);
@@ -35,10 +45,12 @@ public:
 private:
     void EnsureExportQueries(flecs::world& sceneWorld) const;
     void InvalidateExportQueries();
+    void IngestChangedRenderables(const SceneFrameSnapshot& snapshot, flecs::world& renderWorld, ObjectManager& objectManager);
 
     std::unordered_map<uint64_t, BridgedEntityState> m_bridgedEntities;
     uint64_t m_primaryCameraEntityId = 0;
     uint64_t m_currentIngestionFrame = 0;
+    SnapshotIngestPlan m_renderableIngestPlan;
 
     // Cached export queries (mutable because ExportSnapshot is const)
     mutable flecs::query<Components::StableSceneID, Components::Matrix, Components::MeshInstances> m_exportRenderableQuery;
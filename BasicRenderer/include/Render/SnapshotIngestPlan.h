@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace br::render {
+
+// Tags SceneRenderBridge mirrors from the scene onto bridged renderables.
+namespace RenderableTag {
+    constexpr uint8_t Skinned = 1u << 0;
+    constexpr uint8_t SkinningPassEligible = 1u << 1;
+    constexpr uint8_t SkipShadowPass = 1u << 2;
+    constexpr uint8_t Named = 1u << 3;
+}
+
+struct SnapshotIngestItem {
+    uint32_t changeIndex = 0;
+    uint8_t currentTags = 0;
+    uint8_t targetTags = 0;
+    // New entity, new mesh set or renamed: needs per-entity work beyond tags.
+    bool rebuild = false;
+};
+
+// A run of structural changes that all perform the same tag transition.
+struct SnapshotIngestGroup {
+    uint8_t addTags = 0;
+    uint8_t removeTags = 0;
+    bool rebuild = false;
+    uint32_t first = 0; // Into StructuralChanges()
+    uint32_t count = 0;
+};
+
+struct SnapshotIngestStats {
+    uint32_t changes = 0;
+    uint32_t columnOnly = 0;
+    uint32_t structural = 0;
+    uint32_t groups = 0;
+};
+
+// Splits a snapshot's changed renderables into the ones that only need
+// component writes and the ones that change archetype.
+//
+// In steady state almost every changed renderable just moved: its tags match
+// what the entity already has, so its matrix and transform stamp are written
+// in place. The rest are sorted by (added tags, removed tags, rebuild) so the
+// ECS applies the same archetype transition back to back instead of
+// alternating between tables.
+class SnapshotIngestPlan {
+public:
+    void Clear();
+    void Reserve(size_t changeCount);
+    void Add(const SnapshotIngestItem& item);
+    void Build();
+
+    // changeIndex of each column-only change, in snapshot order.
+    std::span<const uint32_t> ColumnOnlyChanges() const { return m_columnOnly; }
+    // changeIndex of each structural change, grouped by Groups().
+    std::span<const uint32_t> StructuralChanges() const { return m_structural; }
+    std::span<const SnapshotIngestGroup> Groups() const { return m_groups; }
+    const SnapshotIngestStats& GetStats() const { return m_stats; }
+
+private:
+    struct PendingStructural {
+        uint32_t key = 0;
+        uint32_t changeIndex = 0;
+    };
+
+    std::vector<SnapshotIngestItem> m_items;
+    std::vector<PendingStructural> m_pending;
+    std::vector<uint32_t> m_columnOnly;
+    std::vector<uint32_t> m_structural;
+    std::vector<SnapshotIngestGroup> m_groups;
+    SnapshotIngestStats m_stats;
+};
+
+} // namespace br::render
@@ -31,6 +31,8 @@
 #include "Managers/MaterialManager.h"
 #include "Managers/SkeletonManager.h"
 #include "Managers/ReadbackManager.h"
+#include "Resources/Buffers/DirtyRangeTracker.h"
+#include "Utilities/MemoryBudgetArbiter.h"
 #include "Factories/TextureFactory.h"
 #include "Scene/MovementState.h"
 #include "Telemetry/FrameTaskGraphTelemetry.h"
@@ -40,6 +42,7 @@
 #include "Render/OpenPBRLookupResources.h"
 #include "Render/SceneRenderBridge.h"
 #include "Render/GraphExtensions/ClusterLOD/CLodRayTracingSystem.h"
+#include "Render/GraphExtensions/CLodTelemetry.h"
 
 class DynamicResource;
 class ExternalTextureResource;
@@ -191,6 +194,8 @@ private:
     void SetSceneRenderOverlapEnabled(bool enabled);
     void InvalidateSceneOverlapState();
     void RunRenderResourceSyncStage();
+    void SetupMemoryBudgetArbiter();
+    void UpdateMemoryBudget();
     void FlushPendingSceneExplorerEdits();
     void QueueSceneNodePositionEdit(uint64_t stableSceneID, DirectX::XMFLOAT3 position);
     void QueueSceneNodeUniformScaleEdit(uint64_t stableSceneID, float uniformScale);
@@ -228,7 +233,7 @@ private:
 
     std::function<uint16_t()> getShadowResolution;
 	std::function<void(float)> setCameraSpeed;
-	std::function<float()> getCameraSpeed;
+	SettingHandle<float> m_cameraSpeedSetting;
 	std::function<void(bool)> setWireframeEnabled;
 	std::function<bool()> getWireframeEnabled;
 	std::function<void(bool)> setShadowsEnabled;
@@ -239,8 +244,12 @@ private:
 	std::function<bool()> getMeshShadersEnabled;
     std::function<bool()> getIndirectDrawsEnabled;
 	std::function<uint8_t()> getNumFramesInFlight;
+    std::function<uint32_t()> getFrameMemoryBudgetMiB;
     std::function<bool()> getDrawBoundingSpheres;
 	std::function<bool()> getImageBasedLightingEnabled;
+	SettingHandle<DirectX::XMUINT2> m_renderResolutionSetting;
+	SettingHandle<DirectX::XMUINT2> m_outputResolutionSetting;
+	SettingHandle<bool> m_renderGraphBatchTraceSetting;
 
 	std::vector<SettingsManager::Subscription> m_settingsSubscriptions;
 
@@ -252,11 +261,25 @@ private:
     bool m_loggedSwapChainNotReady = false;
 
     // Cached renderer ECS queries for RunRenderResourceSyncStage
-    flecs::query<Components::Matrix, Components::RenderableObject, Components::ObjectDrawInfo, Components::MeshInstances> m_renderSyncObjectQuery;
+    flecs::query<Components::Matrix, Components::RenderableObject, Components::ObjectDrawInfo, Components::MeshInstances, const Components::RenderTransformStamp> m_renderSyncObjectQuery;
     flecs::query<Components::Matrix, Components::Camera, Components::RenderViewRef> m_renderSyncCameraQuery;
     flecs::query<Components::Matrix, Components::Light> m_renderSyncLightQuery;
-    flecs::query<> m_renderTransformUpdatedCleanupQuery;
+    flecs::query<Components::RenderableObject, Components::ObjectDrawInfo, const Components::RenderTransformStamp> m_renderSyncSettlingObjectQuery;
     bool m_renderSyncQueriesBuilt = false;
+    // Dirty bytes of the per-object and normal-matrix bulk writes, reused across frames.
+    DirtyRangeTracker m_perObjectDirtyRanges;
+    DirtyRangeTracker m_normalMatrixDirtyRanges;
+    // Splits "frameMemoryBudgetMiB" between texture mip streaming and CLod
+    // pages. Idle while the setting is 0.
+    budget::MemoryBudgetArbiter m_memoryBudgetArbiter;
+    std::function<void(uint64_t)> m_setCLodStreamingResidentBudgetBytes;
+    // Primary camera as seen by the CLod motion prefetcher, refreshed in CameraSync.
+    CLodPrefetchCameraPose m_clodPrefetchCamera = {};
+    bool m_clodPrefetchCameraValid = false;
+    uint64_t m_clodStreamingOpsSequence = 0;
+    CLodStreamingOperationStats m_clodStreamingOpsLatest = {};
+    bool m_memoryBudgetArbiterActive = false;
+    std::vector<DirtyRangeTracker::Range> m_objectUploadRanges;
     std::shared_ptr<br::render::SceneFrameSnapshot> m_completedSceneSnapshot;
     mutable std::mutex m_sceneSnapshotMutex;
     bool m_hasCommittedSceneSnapshot = false;
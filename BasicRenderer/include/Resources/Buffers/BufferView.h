@@ -13,9 +13,17 @@ public:
 	static std::unique_ptr<BufferView> CreateUnique(std::weak_ptr<ViewedDynamicBufferBase> buffer, uint64_t offset, uint64_t size, uint64_t elementSize) {
 		return std::unique_ptr<BufferView>(new BufferView(buffer, offset, size, elementSize));
 	}
+	// allocationHandle identifies the owning buffer's allocator block, so frees skip the offset lookup.
+	static std::unique_ptr<BufferView> CreateUnique(std::weak_ptr<ViewedDynamicBufferBase> buffer, uint64_t offset, uint64_t size, uint64_t elementSize, uint32_t allocationHandle) {
+		auto view = std::unique_ptr<BufferView>(new BufferView(buffer, offset, size, elementSize));
+		view->m_allocationHandle = allocationHandle;
+		return view;
+	}
 
     uint64_t GetOffset() const { return m_offset; }
     uint64_t GetSize() const { return m_size; }
+    uint64_t GetElementSize() const { return m_elementSize; }
+    uint32_t GetAllocationHandle() const { return m_allocationHandle; }
     std::shared_ptr<ViewedDynamicBufferBase> GetBuffer() const;
 
 private:
@@ -26,4 +34,5 @@ private:
     uint64_t m_offset;
     uint64_t m_size;
     uint64_t m_elementSize;
+    uint32_t m_allocationHandle = ~0u;
 };
\ No newline at end of file
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Records which bytes of a bulk-written buffer changed this frame and turns
+// them into upload ranges. Writes set bits in a page bitmap, so marking is
+// O(1) and collection is a linear scan over the touched words instead of a
+// sort. Runs separated by at most the merge gap are uploaded as one range,
+// trading a few unchanged bytes for fewer copy commands. Not thread-safe;
+// kept free of GPU types so it can be benchmarked headless.
+class DirtyRangeTracker {
+public:
+    struct Range {
+        size_t offset = 0;
+        size_t size = 0;
+    };
+
+    // Totals for the most recent CollectRanges call.
+    struct Stats {
+        uint64_t changedBytes = 0;      // Sum of marked sizes
+        uint64_t uploadedBytes = 0;     // Sum of emitted range sizes
+        uint32_t markCount = 0;
+        uint32_t rangeCount = 0;
+    };
+
+    explicit DirtyRangeTracker(uint32_t pageBytes = 64u, size_t maxGapBytes = 1024u)
+        : m_pageShift(static_cast<uint32_t>(std::countr_zero(std::bit_ceil((std::max)(pageBytes, 1u)))))
+        , m_maxGapBytes(maxGapBytes) {
+    }
+
+    void SetMaxGapBytes(size_t maxGapBytes) { m_maxGapBytes = maxGapBytes; }
+    size_t GetMaxGapBytes() const { return m_maxGapBytes; }
+    uint32_t GetPageBytes() const { return 1u << m_pageShift; }
+
+    void Mark(size_t offset, size_t size) {
+        if (size == 0) {
+            return;
+        }
+        const size_t end = offset + size;
+        const size_t firstPage = offset >> m_pageShift;
+        const size_t lastPage = (end - 1u) >> m_pageShift;
+        const size_t lastWord = lastPage >> 6;
+        if (lastWord >= m_bits.size()) {
+            m_bits.resize((std::max)(lastWord + 1u, m_bits.size() * 2u), 0u);
+        }
+
+        for (size_t page = firstPage; page <= lastPage; ++page) {
+            m_bits[page >> 6] |= uint64_t(1) << (page & 63u);
+        }
+        m_minWord = (std::min)(m_minWord, firstPage >> 6);
+        m_maxWord = (std::max)(m_maxWord, lastWord);
+        m_highWater = (std::max)(m_highWater, end);
+        m_pendingChangedBytes += size;
+        ++m_pendingMarkCount;
+    }
+
+    bool HasPendingRanges() const { return m_pendingMarkCount != 0; }
+
+    // Emits the dirty runs in ascending order and resets the bitmap. Ranges are
+    // page-aligned except that the last one stops at the highest marked byte,
+    // so nothing past the end of the buffer is ever requested.
+    void CollectRanges(std::vector<Range>& outRanges) {
+        outRanges.clear();
+        m_stats = {};
+        m_stats.changedBytes = m_pendingChangedBytes;
+        m_stats.markCount = m_pendingMarkCount;
+        if (m_pendingMarkCount == 0) {
+            return;
+        }
+
+        const size_t maxGapPages = m_maxGapBytes >> m_pageShift;
+        size_t runBegin = 0;
+        size_t runEnd = 0;
+        bool haveRun = false;
+
+        auto emit = [&]() {
+            const size_t offset = runBegin << m_pageShift;
+            const size_t end = (std::min)(runEnd << m_pageShift, m_highWater);
+            outRanges.push_back({ offset, end - offset });
+            m_stats.uploadedBytes += end - offset;
+        };
+
+        for (size_t word = m_minWord; word <= m_maxWord; ++word) {
+            uint64_t bits = m_bits[word];
+            m_bits[word] = 0u;
+            while (bits != 0u) {
+                const uint32_t start = static_cast<uint32_t>(std::countr_zero(bits));
+                const uint32_t length = static_cast<uint32_t>(std::countr_one(bits >> start));
+                const size_t pageBegin = (word << 6) + start;
+                const size_t pageEnd = pageBegin + length;
+                if (haveRun && pageBegin - runEnd <= maxGapPages) {
+                    runEnd = pageEnd;
+                }
+                else {
+                    if (haveRun) {
+                        emit();
+                    }
+                    runBegin = pageBegin;
+                    runEnd = pageEnd;
+                    haveRun = true;
+                }
+                bits = start + length >= 64u ? 0u : bits & (~uint64_t(0) << (start + length));
+            }
+        }
+        if (haveRun) {
+            emit();
+        }
+
+        m_stats.rangeCount = static_cast<uint32_t>(outRanges.size());
+        m_minWord = SIZE_MAX;
+        m_maxWord = 0;
+        m_highWater = 0;
+        m_pendingChangedBytes = 0;
+        m_pendingMarkCount = 0;
+    }
+
+    const Stats& GetLastStats() const { return m_stats; }
+
+private:
+    uint32_t m_pageShift;
+    size_t m_maxGapBytes;
+
+    std::vector<uint64_t> m_bits;
+    size_t m_minWord = SIZE_MAX;
+    size_t m_maxWord = 0;
+    size_t m_highWater = 0;
+    uint64_t m_pendingChangedBytes = 0;
+    uint32_t m_pendingMarkCount = 0;
+    Stats m_stats;
+};
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <rhi.h>
+
+#include "Resources/Buffers/Buffer.h"
+#include "Resources/Resource.h"
+#include "Resources/Buffers/DynamicBufferBase.h"
+#include "Resources/Buffers/DrawSetMembership.h"
+#include "Interfaces/IHasMemoryMetadata.h"
+#include "Render/Runtime/UploadPolicyServiceAccess.h"
+
+// GPU list of active indirect command indices for one draw workload. Unlike
+// SortedUnsignedIntBuffer the order is arbitrary: Insert/Remove are O(1) on the
+// CPU and nothing reaches the GPU until Commit, which grows the buffer at most
+// once and uploads only the slots that changed.
+class DrawSetIndexBuffer : public BufferBase, public IHasMemoryMetadata {
+public:
+    struct CommitStats {
+        uint32_t spans = 0;
+        uint32_t uploadedSlots = 0;
+    };
+
+    static std::shared_ptr<DrawSetIndexBuffer> CreateShared(uint64_t capacity = 64, std::string name = "", bool UAV = false) {
+        return std::shared_ptr<DrawSetIndexBuffer>(new DrawSetIndexBuffer(capacity, name, UAV));
+    }
+
+    void Insert(unsigned int element) { m_membership.Insert(element); }
+    void Remove(unsigned int element) { m_membership.Remove(element); }
+    bool Contains(unsigned int element) const { return m_membership.Contains(element); }
+
+    // Applies every Insert/Remove since the previous Commit.
+    void Commit();
+
+    bool HasPendingChanges() const { return m_membership.HasPendingChanges(); }
+    const CommitStats& GetLastCommitStats() const { return m_lastCommitStats; }
+
+    UINT Size() const {
+        return static_cast<UINT>(m_membership.Size());
+    }
+
+private:
+    DrawSetIndexBuffer(uint64_t capacity = 64, std::string name = "", bool UAV = false)
+        : m_capacity(capacity), m_UAV(UAV) {
+        SetUploadPolicyTag(rg::runtime::UploadPolicyTag::CoalescedRetained);
+        CreateBuffer(capacity);
+        SetName(name);
+    }
+
+    void OnUploadPolicyBeginFrame() override {
+        SyncUploadPolicyState();
+        m_uploadPolicyState.BeginFrame();
+    }
+
+    void OnUploadPolicyFlush() override {
+        SyncUploadPolicyState();
+        m_uploadPolicyState.FlushToUploadService(rg::runtime::UploadTarget::FromShared(shared_from_this()));
+    }
+
+    bool HasPendingUploadPolicyWork() const override {
+        return m_uploadPolicyState.HasPendingWork();
+    }
+
+    uint64_t GetUploadPolicyLastFlushWrites() const override {
+        return m_uploadPolicyState.GetLastFlushStats().flushedWrites;
+    }
+
+    uint64_t GetUploadPolicyLastFlushBytes() const override {
+        return m_uploadPolicyState.GetLastFlushStats().flushedBytes;
+    }
+
+    void OnSetName() override;
+
+    void AssignDescriptorSlots();
+
+    DrawSetMembership m_membership;
+    std::vector<DrawSetMembership::Span> m_dirtySpans;
+    std::vector<unsigned int> m_zeroes;
+    CommitStats m_lastCommitStats{};
+
+    uint64_t m_capacity;
+
+    std::vector<EntityComponentBundle> m_metadataBundles;
+
+    inline static std::string m_name = "DrawSetIndexBuffer";
+
+    bool m_UAV = false;
+
+    void CreateBuffer(uint64_t capacity);
+
+    void GrowBuffer(uint64_t newSize);
+
+    void SyncUploadPolicyState() {
+        const auto tag = GetUploadPolicyTag();
+        if (m_uploadPolicyState.GetPolicy().tag == tag) {
+            return;
+        }
+
+        rg::runtime::UploadPolicyConfig config{};
+        config.tag = tag;
+        m_uploadPolicyState.SetPolicy(config, GetBufferSize());
+    }
+
+    void StageOrUpload(const void* data, size_t size, size_t offset);
+
+    void ApplyMetadataComponentBundle(const EntityComponentBundle& bundle) override {
+        m_metadataBundles.emplace_back(bundle);
+        ApplyMetadataToBacking(bundle);
+    }
+
+    rg::runtime::BufferUploadPolicyState m_uploadPolicyState{};
+};
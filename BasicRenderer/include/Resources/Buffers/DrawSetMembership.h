@@ -0,0 +1,128 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+// CPU side of a draw-set index buffer: a dense, unordered set of indirect
+// command indices. Insert and Remove are O(1) (append / swap-with-last) and
+// only record which slots changed; CollectDirtySpans coalesces them into the
+// few contiguous ranges that need uploading. Kept free of GPU types so it can
+// be benchmarked headless.
+class DrawSetMembership {
+public:
+    struct Span {
+        uint32_t firstSlot = 0;
+        uint32_t slotCount = 0;
+    };
+
+    // Returns false if the element was already present.
+    bool Insert(uint32_t element) {
+        if (element >= m_slotOfElement.size()) {
+            m_slotOfElement.resize((std::max)(static_cast<size_t>(element) + 1u, m_slotOfElement.size() * 2u), kAbsent);
+        }
+        if (m_slotOfElement[element] != kAbsent) {
+            return false;
+        }
+
+        const uint32_t slot = static_cast<uint32_t>(m_elements.size());
+        m_elements.push_back(element);
+        m_slotOfElement[element] = slot;
+        MarkDirty(slot);
+        return true;
+    }
+
+    // Returns false if the element was not present.
+    bool Remove(uint32_t element) {
+        if (element >= m_slotOfElement.size() || m_slotOfElement[element] == kAbsent) {
+            return false;
+        }
+
+        const uint32_t slot = m_slotOfElement[element];
+        const uint32_t lastSlot = static_cast<uint32_t>(m_elements.size() - 1u);
+        if (slot != lastSlot) {
+            const uint32_t moved = m_elements[lastSlot];
+            m_elements[slot] = moved;
+            m_slotOfElement[moved] = slot;
+            MarkDirty(slot);
+        }
+        m_elements.pop_back();
+        m_slotOfElement[element] = kAbsent;
+        return true;
+    }
+
+    bool Contains(uint32_t element) const {
+        return element < m_slotOfElement.size() && m_slotOfElement[element] != kAbsent;
+    }
+
+    uint32_t Size() const { return static_cast<uint32_t>(m_elements.size()); }
+    const uint32_t* Data() const { return m_elements.data(); }
+    bool HasPendingChanges() const { return !m_dirtySlots.empty() || m_committedSize != m_elements.size(); }
+
+    // Size as of the last CollectDirtySpans; slots in [Size(), GetCommittedSize())
+    // hold stale indices and are cleared by the caller.
+    uint32_t GetCommittedSize() const { return m_committedSize; }
+
+    // Emits the changed live slots as sorted spans and resets the dirty state.
+    // Spans separated by at most maxGapSlots unchanged slots are merged, since
+    // re-uploading a few live indices is cheaper than another copy command.
+    void CollectDirtySpans(std::vector<Span>& outSpans, uint32_t maxGapSlots = 16u) {
+        outSpans.clear();
+        const uint32_t size = Size();
+
+        auto appendSlot = [&](uint32_t slot) {
+            if (!outSpans.empty()) {
+                Span& last = outSpans.back();
+                const uint32_t lastEnd = last.firstSlot + last.slotCount;
+                if (slot <= lastEnd + maxGapSlots) {
+                    last.slotCount = slot + 1u - last.firstSlot;
+                    return;
+                }
+            }
+            outSpans.push_back({ slot, 1u });
+        };
+
+        // Bulk spawns/despawns dirty a large fraction of the set; a linear pass
+        // over the flags is then cheaper than sorting the slot list.
+        if (m_dirtySlots.size() * 8u > m_slotDirty.size()) {
+            for (uint32_t slot = 0; slot < m_slotDirty.size(); ++slot) {
+                if (m_slotDirty[slot] != 0u) {
+                    m_slotDirty[slot] = 0u;
+                    if (slot < size) {
+                        appendSlot(slot);
+                    }
+                }
+            }
+        }
+        else {
+            std::sort(m_dirtySlots.begin(), m_dirtySlots.end());
+            for (uint32_t slot : m_dirtySlots) {
+                m_slotDirty[slot] = 0u;
+                if (slot < size) {
+                    appendSlot(slot);
+                }
+            }
+        }
+        m_dirtySlots.clear();
+        m_committedSize = size;
+    }
+
+private:
+    static constexpr uint32_t kAbsent = ~0u;
+
+    void MarkDirty(uint32_t slot) {
+        if (slot >= m_slotDirty.size()) {
+            m_slotDirty.resize((std::max)(static_cast<size_t>(slot) + 1u, m_slotDirty.size() * 2u), 0u);
+        }
+        if (m_slotDirty[slot] == 0u) {
+            m_slotDirty[slot] = 1u;
+            m_dirtySlots.push_back(slot);
+        }
+    }
+
+    std::vector<uint32_t> m_elements;
+    std::vector<uint32_t> m_slotOfElement;
+    std::vector<uint32_t> m_dirtySlots;
+    std::vector<uint8_t> m_slotDirty;
+    uint32_t m_committedSize = 0;
+};
@@ -3,8 +3,6 @@
 #pragma once
 
 #include <vector>
-#include <map>
-#include <set>
 #include <functional>
 #include <typeinfo>
 #include <string>
@@ -12,7 +10,7 @@
 #include "Resources/Resource.h"
 #include "Resources/Buffers/BufferView.h"
 #include "Resources/Buffers/DynamicBufferBase.h"
-#include "Resources/Buffers/MemoryBlock.h"
+#include "Resources/Buffers/TlsfAllocator.h"
 #include "Interfaces/IHasMemoryMetadata.h"
 #include "Render/Runtime/UploadPolicyServiceAccess.h"
 
@@ -28,6 +26,21 @@ public:
 	std::unique_ptr<BufferView> AddData(const void* data, size_t size, size_t elementSize, size_t fullAllocationSize = 0);
 	void UpdateView(BufferView* view, const void* data) override;
 
+    TlsfAllocator::Stats GetAllocatorStats() const {
+        return m_allocator.GetStats();
+    }
+
+    // Plans up to maxMoveBytes of moves that pack allocations toward the front
+    // of the buffer. Destinations are reserved immediately; for each move the
+    // owner of the view at sourceOffset calls ApplyDefragmentationMove, re-uploads
+    // its data through the returned view, and drops the old one.
+    std::vector<TlsfAllocator::Move> PlanDefragmentation(size_t maxMoveBytes) {
+        std::vector<TlsfAllocator::Move> moves;
+        m_allocator.PlanDefragmentation(maxMoveBytes, moves);
+        return moves;
+    }
+    std::unique_ptr<BufferView> ApplyDefragmentationMove(const BufferView* view, const TlsfAllocator::Move& move);
+
     rg::runtime::BulkWriteHandle BeginBulkWrite() {
         SyncUploadPolicyState();
         EnsureUploadPolicyRegistration();
@@ -112,8 +125,7 @@ private:
     size_t m_capacity;
     bool m_needsUpdate;
 
-    std::map<size_t, MemoryBlock> m_blocksByOffset;
-    std::set<std::pair<size_t, size_t>> m_freeBlocks; // (size, offset)
+    TlsfAllocator m_allocator;
 
     std::weak_ptr<ViewedDynamicBufferBase> m_cachedWeakPtr;
     bool m_weakPtrCached = false;
@@ -127,6 +139,7 @@ private:
 
     void CreateBuffer(size_t capacity);
     void GrowBuffer(size_t newSize);
+    const std::weak_ptr<ViewedDynamicBufferBase>& GetCachedWeakPtr();
 
     void SyncUploadPolicyState() {
         const auto tag = GetUploadPolicyTag();
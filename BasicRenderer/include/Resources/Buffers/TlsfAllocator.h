@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// Two-level segregated-fit (TLSF) range allocator over [0, capacity). Allocate
+// and Free are O(1): free blocks live in size-class lists indexed by two
+// bitmaps, and physical neighbours are linked so frees coalesce without a
+// search. Allocations are exact-size; only the search rounds up to a class.
+// Holds no memory itself, so DynamicBuffer uses it for GPU ranges and the
+// stress benchmark runs it headless.
+class TlsfAllocator {
+public:
+    static constexpr uint32_t kInvalidHandle = ~0u;
+
+    struct Stats {
+        uint64_t capacity = 0;
+        uint64_t allocatedBytes = 0;
+        uint64_t freeBytes = 0;
+        uint64_t largestFreeBlock = 0;
+        uint32_t allocationCount = 0;
+        uint32_t freeBlockCount = 0;
+        // 0 when all free space is one block, approaching 1 as it splinters.
+        double fragmentation = 0.0;
+    };
+
+    // One step of a defragmentation plan. The destination is already allocated
+    // under destinationHandle; the caller copies the data and then frees
+    // sourceHandle, after which the source range can be reused.
+    struct Move {
+        uint32_t sourceHandle = kInvalidHandle;
+        uint64_t sourceOffset = 0;
+        uint32_t destinationHandle = kInvalidHandle;
+        uint64_t destinationOffset = 0;
+        uint64_t size = 0;
+    };
+
+    explicit TlsfAllocator(uint64_t capacity = 0);
+
+    // Returns kInvalidHandle if no free block can hold size bytes.
+    uint32_t Allocate(uint64_t size, uint64_t& outOffset);
+    // Rejects handles that are stale or do not describe this offset/size.
+    bool Free(uint32_t handle, uint64_t offset, uint64_t size);
+
+    // Extends the range; the new space merges with a free tail block.
+    void Grow(uint64_t newCapacity);
+
+    uint64_t GetCapacity() const { return m_capacity; }
+    // Free bytes at the very end of the range, which a Grow would extend.
+    uint64_t GetTrailingFreeBytes() const;
+    Stats GetStats() const;
+
+    // Moves allocations from the end of the range into the lowest free block
+    // that holds them, until maxMoveBytes would be exceeded. Incremental: call
+    // again after applying the returned moves to continue compacting.
+    void PlanDefragmentation(uint64_t maxMoveBytes, std::vector<Move>& outMoves);
+
+private:
+    static constexpr uint32_t kSecondLevelBits = 5;
+    static constexpr uint32_t kSecondLevelCount = 1u << kSecondLevelBits;
+    // Sizes below this share first level 0 with one-byte classes.
+    static constexpr uint64_t kSmallBlockSize = 1ull << kSecondLevelBits;
+    static constexpr uint32_t kFirstLevelCount = 64 - kSecondLevelBits + 1;
+
+    struct Block {
+        uint64_t offset = 0;
+        uint64_t size = 0;
+        uint32_t prevPhysical = kInvalidHandle;
+        uint32_t nextPhysical = kInvalidHandle;
+        uint32_t prevFree = kInvalidHandle;
+        uint32_t nextFree = kInvalidHandle;
+        bool isFree = false;
+        bool inUse = false;
+    };
+
+    static void MapSize(uint64_t size, uint32_t& outFirstLevel, uint32_t& outSecondLevel);
+    uint32_t FindFreeBlock(uint64_t size) const;
+
+    uint32_t AcquireNode();
+    void ReleaseNode(uint32_t index);
+    void InsertFree(uint32_t index);
+    void RemoveFree(uint32_t index);
+    // Carves size bytes from the front of free block index; returns the allocated block.
+    uint32_t UseFreeBlock(uint32_t index, uint64_t size);
+
+    std::vector<Block> m_blocks;
+    std::vector<uint32_t> m_unusedNodes;
+    uint32_t m_freeHeads[kFirstLevelCount][kSecondLevelCount];
+    uint64_t m_firstLevelBitmap = 0;
+    uint32_t m_secondLevelBitmaps[kFirstLevelCount] = {};
+    uint32_t m_firstPhysical = kInvalidHandle;
+    uint32_t m_lastPhysical = kInvalidHandle;
+    uint64_t m_capacity = 0;
+    uint64_t m_allocatedBytes = 0;
+    uint32_t m_allocationCount = 0;
+    uint32_t m_freeBlockCount = 0;
+};
@@ -1,6 +1,8 @@
 #pragma once
 #include <atomic>
+#include <condition_variable>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <mutex>
 
@@ -15,6 +17,7 @@
 
 struct RenderContext;
 struct TextureProcessingJobHandle;
+class TextureAsset;
 
 enum class TextureSemantic : uint8_t {
     Unknown = 0,
@@ -182,6 +185,35 @@ struct TextureDirectStorageReloadJobHandle {
     std::string error;
 };
 
+enum class TextureDecodeJobState : uint8_t {
+    Queued = 0,
+    Decoding,
+    Ready,
+    Failed,
+};
+
+// Import-time decode of an encoded image container into a CPU-side TextureAsset.
+// A waiter that finds the job still queued runs it inline instead of blocking
+// on a worker that has not picked it up yet.
+struct TextureDecodeJobHandle {
+    std::atomic<TextureDecodeJobState> state = TextureDecodeJobState::Queued;
+    std::mutex mutex;
+    std::condition_variable completed;
+    std::string label;
+    std::function<std::shared_ptr<TextureAsset>()> decode;
+    std::shared_ptr<TextureAsset> decoded;
+    std::string error;
+    double decodeMilliseconds = 0.0;
+};
+
+std::shared_ptr<TextureDecodeJobHandle> RequestTextureDecodeAsync(
+    std::string label,
+    std::function<std::shared_ptr<TextureAsset>()> decode);
+// Returns the decoded asset, or nullptr with outError set if the decode failed.
+std::shared_ptr<TextureAsset> WaitForTextureDecode(
+    const std::shared_ptr<TextureDecodeJobHandle>& handle,
+    std::string* outError = nullptr);
+
 // Helper for std::visit with multiple lambdas
 template<class... Ts>
 struct Overloaded : Ts... { using Ts::operator()...; };
@@ -212,6 +244,14 @@ public:
             std::move(meta)
 		));
     }
+
+    // Creates an asset whose source is still being decoded. It binds a neutral
+    // placeholder until the decode job finishes, then adopts the decoded source
+    // in EnsureUploaded.
+    static std::shared_ptr<TextureAsset> CreatePendingDecode(
+        std::shared_ptr<TextureDecodeJobHandle> decodeHandle,
+        std::shared_ptr<Sampler> defaultSampler,
+        TextureFileMeta meta);
     
 	// Resolve to a vector of bytes
     const BytesList& ResolveToBytes() const
@@ -254,6 +294,7 @@ public:
     bool IsMipStreamingEligible() const { return m_streamingState.eligible; }
     bool IsMipStreamingEnabled() const { return m_streamingState.enabled; }
     bool IsUsingFallbackImage() const { return m_hasUploadedPlaceholder && !m_hasUploadedFinalImage; }
+    bool IsDecodePending() const { return m_decodeHandle != nullptr; }
     bool HasUsableImage() const { return m_image && m_image->HasValidBackingResource(); }
     uint64_t GetBindingRevision() const { return m_streamingState.bindingRevision; }
     uint64_t GetStreamingStateRevision() const { return m_streamingState.stateRevision; }
@@ -266,6 +307,7 @@ public:
         return !HasUsableImage() ||
             needsStreamingReload ||
             m_hasUploadedPlaceholder ||
+            m_decodeHandle != nullptr ||
             m_processingHandle != nullptr ||
             m_reloadHandle != nullptr ||
             m_directStorageReloadHandle != nullptr;
@@ -337,6 +379,7 @@ private:
     std::shared_ptr<Sampler> m_sampler;
     TextureFileMeta m_meta;
 	std::shared_ptr<TextureProcessingJobHandle> m_processingHandle;
+    std::shared_ptr<TextureDecodeJobHandle> m_decodeHandle;
     std::shared_ptr<TextureReloadJobHandle> m_reloadHandle;
     std::shared_ptr<TextureDirectStorageReloadJobHandle> m_directStorageReloadHandle;
     TextureStreamingState m_streamingState;
@@ -353,6 +396,9 @@ private:
     TextureUploadPathTelemetry m_lastReportedUploadPath = TextureUploadPathTelemetry::Unknown;
 
     void RefreshStreamingStateFromDescription();
+    bool AdvancePendingDecode(const TextureFactory& factory);
+    void AdoptDecodedSource(const TextureAsset& decoded);
+    void UploadPlaceholderImage(const TextureFactory& factory, const std::string& detail);
 	void UpdateSourceShapeFromDescription(const TextureDescription& desc, uint32_t totalMipCountHint = 0u);
     void ApplySourceShapeHint(uint32_t fullWidth, uint32_t fullHeight, uint32_t totalMipCount);
 	void ApplyStreamingBootstrapTopMip();
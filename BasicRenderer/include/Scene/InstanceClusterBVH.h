@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+// Spatial grouping for very large point-instancer populations. Instances of
+// the same prototype are sorted along a Morton curve and chunked into
+// clusters; a BVH over the clusters lets frustum, distance and occluder-proxy
+// tests reject whole regions before any per-cluster work. Plain float types
+// only, so the build and cull can run headless.
+class InstanceClusterBVH {
+public:
+	struct Float3 {
+		float x = 0.0f;
+		float y = 0.0f;
+		float z = 0.0f;
+	};
+
+	struct Aabb {
+		Float3 min = { std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max() };
+		Float3 max = { std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest() };
+	};
+
+	// dot(normal, p) + distance >= 0 is inside.
+	struct Plane {
+		Float3 normal;
+		float distance = 0.0f;
+	};
+
+	struct Cluster {
+		Aabb bounds;
+		uint32_t prototype = 0;
+		uint32_t firstInstance = 0;     // Into GetInstanceOrder()
+		uint32_t instanceCount = 0;
+	};
+
+	// Interior nodes have count == 0 and children at first and first + 1.
+	// Leaves cover clusters [first, first + count).
+	struct Node {
+		Aabb bounds;
+		uint32_t first = 0;
+		uint32_t count = 0;
+	};
+
+	struct BuildSettings {
+		uint32_t maxInstancesPerCluster = 256;
+		uint32_t maxClustersPerLeaf = 4;
+	};
+
+	struct CullParams {
+		std::span<const Plane> frustumPlanes;
+		Float3 eye;
+		float maxDistance = std::numeric_limits<float>::infinity();
+		// Optional per-prototype limit, applied on top of maxDistance.
+		std::span<const float> prototypeMaxDistances;
+		// Solid boxes that hide anything entirely behind them from the eye.
+		std::span<const Aabb> occluders;
+	};
+
+	struct CullStats {
+		uint32_t nodesVisited = 0;
+		uint32_t clustersTested = 0;
+		uint32_t clustersVisible = 0;
+		uint32_t frustumCulled = 0;     // Nodes and clusters rejected by each test
+		uint32_t distanceCulled = 0;
+		uint32_t occluded = 0;
+		uint64_t visibleInstances = 0;
+	};
+
+	// centers, radii and prototypes are parallel arrays, one entry per instance.
+	void Build(
+		std::span<const Float3> centers,
+		std::span<const float> radii,
+		std::span<const uint32_t> prototypes,
+		const BuildSettings& settings);
+	void Build(std::span<const Float3> centers, std::span<const float> radii, std::span<const uint32_t> prototypes) {
+		Build(centers, radii, prototypes, BuildSettings{});
+	}
+
+	// Appends the indices of clusters that pass every test, in BVH order.
+	void Cull(const CullParams& params, std::vector<uint32_t>& visibleClusters, CullStats* stats = nullptr) const;
+
+	// Per-cluster tests without the hierarchy; same result as Cull.
+	void CullFlat(const CullParams& params, std::vector<uint32_t>& visibleClusters, CullStats* stats = nullptr) const;
+
+	const std::vector<Cluster>& GetClusters() const { return m_clusters; }
+	const std::vector<Node>& GetNodes() const { return m_nodes; }
+	// Instance indices grouped by cluster.
+	const std::vector<uint32_t>& GetInstanceOrder() const { return m_instanceOrder; }
+	size_t GetInstanceCount() const { return m_instanceOrder.size(); }
+
+private:
+	void BuildNode(uint32_t nodeIndex, uint32_t begin, uint32_t end, uint32_t leafLimit);
+
+	std::vector<Cluster> m_clusters;
+	std::vector<Node> m_nodes;
+	std::vector<uint32_t> m_instanceOrder;
+	uint32_t m_prototypeCount = 0;
+};
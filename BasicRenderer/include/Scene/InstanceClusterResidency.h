@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "Scene/InstanceClusterBVH.h"
+
+// Decides which clusters of one InstanceClusterBVH are materialized. Each
+// update admits the visible clusters nearest first until the instance budget
+// is spent; a cluster that leaves the view stays resident for a few updates
+// so turning back does not rebuild it. Clusters whose prototype has nothing
+// to draw are never admitted and never charged to the budget.
+class InstanceClusterResidency {
+public:
+	struct Settings {
+		uint64_t maxResidentInstances = 0;  // 0 is unlimited
+		uint32_t lingerUpdates = 30;
+	};
+
+	struct Changes {
+		std::vector<uint32_t> added;
+		std::vector<uint32_t> removed;
+	};
+
+	// drawablePrototypes[p] != 0 when prototype p has something to draw;
+	// prototypes past its end have nothing.
+	void Reset(const InstanceClusterBVH& bvh, std::span<const uint8_t> drawablePrototypes);
+
+	// visibleClusters is this update's cull of the BVH passed to Reset, eye
+	// the point the cull measured distances from.
+	void Update(
+		const InstanceClusterBVH& bvh,
+		std::span<const uint32_t> visibleClusters,
+		const InstanceClusterBVH::Float3& eye,
+		const Settings& settings,
+		Changes& changes);
+
+	bool IsResident(uint32_t cluster) const { return cluster < m_resident.size() && m_resident[cluster] != 0; }
+	const std::vector<uint32_t>& GetResidentClusters() const { return m_residentClusters; }
+	uint64_t GetResidentInstanceCount() const { return m_residentInstances; }
+
+private:
+	struct Candidate {
+		bool lingering = false;
+		float distanceSquared = 0.0f;
+		uint32_t cluster = 0;
+	};
+
+	std::vector<uint8_t> m_drawable;            // Per cluster
+	std::vector<uint8_t> m_resident;            // Per cluster
+	std::vector<uint8_t> m_keep;                // Per cluster, scratch
+	std::vector<uint64_t> m_lastVisibleUpdate;  // Per cluster
+	std::vector<uint32_t> m_residentClusters;
+	std::vector<Candidate> m_candidates;
+	uint64_t m_update = 0;
+	uint64_t m_residentInstances = 0;
+};
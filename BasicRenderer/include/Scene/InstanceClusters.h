@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <DirectXMath.h>
+#include <flecs.h>
+
+#include "Scene/InstanceClusterBVH.h"
+#include "Scene/InstanceClusterResidency.h"
+
+class Mesh;
+
+// A PointInstancer's instances, clustered in the space of the instancer's
+// entity. Immutable once built; clones of the scene share it.
+struct InstanceClusterSet {
+	struct Transform {
+		DirectX::XMFLOAT3 position = { 0.0f, 0.0f, 0.0f };
+		DirectX::XMFLOAT4 rotation = { 0.0f, 0.0f, 0.0f, 1.0f };
+		DirectX::XMFLOAT3 scale = { 1.0f, 1.0f, 1.0f };
+	};
+
+	struct PrototypeRenderable {
+		std::vector<std::shared_ptr<Mesh>> meshes;
+		Transform localTransform;   // Relative to the instance
+		std::wstring name;
+	};
+
+	std::wstring name;
+	InstanceClusterBVH bvh;
+	std::vector<Transform> instances;
+	// Indexed by cluster prototype. Clusters past the end, or with no
+	// renderables, are never materialized.
+	std::vector<std::vector<PrototypeRenderable>> prototypes;
+	std::vector<uint8_t> drawablePrototypes;
+};
+
+namespace Components {
+
+	// On a PointInstancer's entity. Each update, Scene materializes the
+	// clusters the primary camera can see as children of that entity.
+	struct InstanceClusters {
+		std::shared_ptr<const InstanceClusterSet> set;
+	};
+
+	// Added by Scene on the first update of an active InstanceClusters entity.
+	// Not carried over to clones.
+	struct InstanceClusterStreaming {
+		InstanceClusterResidency residency;
+		std::unordered_map<uint32_t, flecs::entity> clusterEntities;
+	};
+
+	// Root of one materialized cluster's subtree.
+	struct StreamedInstanceCluster {};
+
+} // namespace Components
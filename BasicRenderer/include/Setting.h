@@ -1,5 +1,7 @@
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <typeinfo>
 #include <functional>
 
@@ -19,8 +21,7 @@ public:
 	// Setter callable takes a void pointer to the value and casts it
 	std::function<void(void*)> getSetter() override {
 		return [this](void* newValuePtr) {
-			value = *static_cast<T*>(newValuePtr);
-			notifyObservers();
+			setValue(*static_cast<T*>(newValuePtr));
 		};
 	}
 
@@ -31,6 +32,24 @@ public:
 		};
 	}
 
+	const T& getValue() const {
+		return value;
+	}
+
+	void setValue(const T& newValue) {
+		value = newValue;
+		if (_changeCounter) {
+			_changeCounter->fetch_add(1, std::memory_order_release);
+		}
+		notifyObservers();
+	}
+
+	// Bumped on every write; SettingsManager uses it to tell whether its
+	// published snapshot is stale.
+	void bindChangeCounter(std::atomic<uint64_t>* counter) {
+		_changeCounter = counter;
+	}
+
 	size_t addObserver(ObserverFn obs) {
 		const size_t id = ++_nextId;
 		_observers.emplace_back(id, std::move(obs));
@@ -46,6 +65,7 @@ public:
 private:
 	T value;
 	size_t _nextId = 0;
+	std::atomic<uint64_t>* _changeCounter = nullptr;
 	std::vector<std::pair<size_t, ObserverFn>> _observers;
 
 	void notifyObservers() {
@@ -0,0 +1,54 @@
+#pragma once
+#include <DirectXMath.h>
+
+// Everything per-object sync derives from a world matrix, from one 3x3 adjugate.
+struct AffineInverse
+{
+    DirectX::XMMATRIX inverse;      // Full inverse of the world matrix
+    DirectX::XMMATRIX normalMatrix; // Inverse of the upper 3x3, translation cleared
+    bool reverseWinding;            // Upper 3x3 determinant is negative
+};
+
+// Rows of the inverse 3x3 are the transposed cross products of the basis rows
+// divided by the determinant, so the determinant, winding, normal matrix and
+// affine inverse come from three cross products and one reciprocal instead of
+// two general 4x4 inverses plus a determinant. Non-affine input (a projective
+// last column) falls back to XMMatrixInverse for the full inverse.
+inline AffineInverse XM_CALLCONV ComputeAffineInverse(DirectX::FXMMATRIX m)
+{
+    using namespace DirectX;
+
+    const XMVECTOR c0 = XMVector3Cross(m.r[1], m.r[2]);
+    const XMVECTOR c1 = XMVector3Cross(m.r[2], m.r[0]);
+    const XMVECTOR c2 = XMVector3Cross(m.r[0], m.r[1]);
+    const XMVECTOR det = XMVector3Dot(m.r[0], c0);
+    const XMVECTOR invDet = XMVectorReciprocal(det);
+
+    XMMATRIX adjugate;
+    adjugate.r[0] = XMVectorMultiply(c0, invDet);
+    adjugate.r[1] = XMVectorMultiply(c1, invDet);
+    adjugate.r[2] = XMVectorMultiply(c2, invDet);
+    adjugate.r[3] = g_XMIdentityR3;
+
+    AffineInverse result;
+    result.normalMatrix = XMMatrixTranspose(adjugate);
+    result.reverseWinding = XMVectorGetX(det) < 0.0f;
+
+    const bool isAffine = XMVectorGetW(m.r[0]) == 0.0f && XMVectorGetW(m.r[1]) == 0.0f
+        && XMVectorGetW(m.r[2]) == 0.0f && XMVectorGetW(m.r[3]) == 1.0f;
+    if (!isAffine) {
+        result.inverse = XMMatrixInverse(nullptr, m);
+        result.reverseWinding = XMVectorGetX(XMMatrixDeterminant(m)) < 0.0f;
+        return result;
+    }
+
+    // Translation row of the inverse is -t * inverse(upper 3x3).
+    const XMVECTOR t = m.r[3];
+    XMVECTOR translated = XMVectorMultiply(XMVectorSplatX(t), result.normalMatrix.r[0]);
+    translated = XMVectorMultiplyAdd(XMVectorSplatY(t), result.normalMatrix.r[1], translated);
+    translated = XMVectorMultiplyAdd(XMVectorSplatZ(t), result.normalMatrix.r[2], translated);
+
+    result.inverse = result.normalMatrix;
+    result.inverse.r[3] = XMVectorSelect(g_XMIdentityR3, XMVectorNegate(translated), g_XMSelect1110);
+    return result;
+}
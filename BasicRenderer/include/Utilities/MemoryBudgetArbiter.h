@@ -0,0 +1,451 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "Utilities/ProportionalBudgetAllocator.h"
+
+// Splits one memory budget between the streaming pools (texture mips, CLod
+// pages, ...). Every frame each consumer describes what more memory would buy
+// it as a demand curve; the arbiter solves for the split with the most total
+// quality and publishes the result as per-consumer caps. Caps move with
+// hysteresis so noisy demand does not make the pools evict and reload the
+// same data back and forth.
+//
+// Quality units are shared between consumers, so each one has to express its
+// curve on the same scale. The renderer counts one unit per LOD refinement the
+// view asked for (one texture mip level, one CLod group).
+
+namespace budget {
+
+inline constexpr double kBytesPerMiB = 1024.0 * 1024.0;
+
+// Granting `bytes` more memory buys `qualityPerMiB` quality per MiB.
+struct MemoryDemandSegment {
+    uint64_t bytes = 0u;
+    double qualityPerMiB = 0.0;
+};
+
+struct MemoryDemand {
+    uint64_t minBytes = 0u;        // Granted before any segment
+    uint64_t quantumBytes = 1u;    // Allocation granularity
+    // Filled in order; a segment is only granted after the ones before it.
+    std::vector<MemoryDemandSegment> segments;
+
+    uint64_t TotalBytes() const
+    {
+        uint64_t total = minBytes;
+        for (const MemoryDemandSegment& segment : segments) {
+            total += segment.bytes;
+        }
+        return total;
+    }
+};
+
+// Rounds minBytes and every segment boundary up to the quantum, then replaces
+// the curve by its concave envelope (pool adjacent segments until quality per
+// MiB never increases). A greedy fill is optimal for concave curves; for the
+// others it fills a step that only pays off together with the next one as a
+// single averaged step.
+inline MemoryDemand NormalizeMemoryDemand(const MemoryDemand& demand)
+{
+    struct Block {
+        uint64_t bytes = 0u;
+        double quality = 0.0;
+    };
+
+    MemoryDemand normalized;
+    normalized.quantumBytes = demand.quantumBytes == 0u ? 1u : demand.quantumBytes;
+    normalized.minBytes = detail::RoundUpToQuantum(demand.minBytes, normalized.quantumBytes);
+
+    std::vector<Block> blocks;
+    blocks.reserve(demand.segments.size());
+    uint64_t rawEnd = normalized.minBytes;
+    uint64_t quantizedEnd = normalized.minBytes;
+    double carriedQuality = 0.0;
+    for (const MemoryDemandSegment& segment : demand.segments) {
+        if (segment.bytes == 0u) {
+            continue;
+        }
+        rawEnd += segment.bytes;
+        carriedQuality += static_cast<double>(segment.bytes) / kBytesPerMiB * (std::max)(segment.qualityPerMiB, 0.0);
+
+        const uint64_t end = detail::RoundUpToQuantum(rawEnd, normalized.quantumBytes);
+        if (end == quantizedEnd) {
+            continue;   // Smaller than a quantum; its quality rides on the next block.
+        }
+        blocks.push_back({ end - quantizedEnd, carriedQuality });
+        quantizedEnd = end;
+        carriedQuality = 0.0;
+    }
+    if (carriedQuality > 0.0 && !blocks.empty()) {
+        blocks.back().quality += carriedQuality;
+    }
+
+    std::vector<Block> hull;
+    hull.reserve(blocks.size());
+    for (const Block& block : blocks) {
+        hull.push_back(block);
+        while (hull.size() >= 2u) {
+            const Block& last = hull[hull.size() - 1u];
+            const Block& previous = hull[hull.size() - 2u];
+            // last.quality / last.bytes > previous.quality / previous.bytes
+            if (last.quality * static_cast<double>(previous.bytes) <= previous.quality * static_cast<double>(last.bytes)) {
+                break;
+            }
+            const Block merged{ previous.bytes + last.bytes, previous.quality + last.quality };
+            hull.pop_back();
+            hull.back() = merged;
+        }
+    }
+
+    normalized.segments.reserve(hull.size());
+    for (const Block& block : hull) {
+        normalized.segments.push_back({ block.bytes, block.quality / (static_cast<double>(block.bytes) / kBytesPerMiB) });
+    }
+    return normalized;
+}
+
+// Merges neighbouring segments so at most maxSegments remain, keeping the total
+// bytes and quality. Segments must already be ordered by falling quality per
+// MiB; merging neighbours keeps that order.
+inline void CoarsenMemoryDemand(MemoryDemand& demand, size_t maxSegments)
+{
+    if (maxSegments == 0u || demand.segments.size() <= maxSegments) {
+        return;
+    }
+
+    const size_t perGroup = (demand.segments.size() + maxSegments - 1u) / maxSegments;
+    std::vector<MemoryDemandSegment> merged;
+    merged.reserve(maxSegments);
+    for (size_t begin = 0; begin < demand.segments.size(); begin += perGroup) {
+        const size_t end = (std::min)(begin + perGroup, demand.segments.size());
+        uint64_t bytes = 0u;
+        double quality = 0.0;
+        for (size_t i = begin; i < end; ++i) {
+            bytes += demand.segments[i].bytes;
+            quality += static_cast<double>(demand.segments[i].bytes) / kBytesPerMiB * demand.segments[i].qualityPerMiB;
+        }
+        if (bytes != 0u) {
+            merged.push_back({ bytes, quality / (static_cast<double>(bytes) / kBytesPerMiB) });
+        }
+    }
+    demand.segments = std::move(merged);
+}
+
+struct MemoryBudgetSolution {
+    std::vector<uint64_t> allocatedBytes;   // One per demand, in input order
+    uint64_t allocatedTotalBytes = 0u;
+    uint64_t minimumTotalBytes = 0u;
+    uint64_t demandTotalBytes = 0u;
+    double quality = 0.0;
+    bool satisfiesMinimumBudget = true;
+};
+
+// Water-fills the budget across all consumers: minimums first, then segments
+// in order of falling quality per MiB. Demands must be normalized. A segment
+// that only partly fits is granted in whole quanta and ends that consumer's
+// share; cheaper segments of other consumers may still use what is left.
+inline MemoryBudgetSolution SolveMemoryBudget(const std::vector<MemoryDemand>& demands, uint64_t totalBudgetBytes)
+{
+    MemoryBudgetSolution solution;
+    solution.allocatedBytes.resize(demands.size(), 0u);
+    for (size_t i = 0; i < demands.size(); ++i) {
+        solution.allocatedBytes[i] = demands[i].minBytes;
+        solution.minimumTotalBytes += demands[i].minBytes;
+        solution.demandTotalBytes += demands[i].TotalBytes();
+    }
+    solution.allocatedTotalBytes = solution.minimumTotalBytes;
+    if (solution.minimumTotalBytes > totalBudgetBytes) {
+        solution.satisfiesMinimumBudget = false;
+        return solution;
+    }
+
+    struct SegmentRef {
+        uint32_t demand = 0u;
+        uint32_t segment = 0u;
+        double qualityPerMiB = 0.0;
+    };
+    std::vector<SegmentRef> order;
+    for (size_t i = 0; i < demands.size(); ++i) {
+        for (size_t s = 0; s < demands[i].segments.size(); ++s) {
+            order.push_back({ static_cast<uint32_t>(i), static_cast<uint32_t>(s), demands[i].segments[s].qualityPerMiB });
+        }
+    }
+    // Ties keep each consumer's own order, so segments are granted as prefixes.
+    std::stable_sort(order.begin(), order.end(), [](const SegmentRef& lhs, const SegmentRef& rhs) {
+        return lhs.qualityPerMiB > rhs.qualityPerMiB;
+    });
+
+    std::vector<bool> saturated(demands.size(), false);
+    uint64_t remaining = totalBudgetBytes - solution.minimumTotalBytes;
+    for (const SegmentRef& ref : order) {
+        if (saturated[ref.demand]) {
+            continue;
+        }
+        const MemoryDemand& demand = demands[ref.demand];
+        const MemoryDemandSegment& segment = demand.segments[ref.segment];
+        uint64_t granted = segment.bytes;
+        if (granted > remaining) {
+            granted = detail::RoundDownToQuantum(remaining, demand.quantumBytes);
+            saturated[ref.demand] = true;
+        }
+        if (granted == 0u) {
+            continue;
+        }
+        solution.allocatedBytes[ref.demand] += granted;
+        solution.allocatedTotalBytes += granted;
+        solution.quality += static_cast<double>(granted) / kBytesPerMiB * segment.qualityPerMiB;
+        remaining -= granted;
+    }
+    return solution;
+}
+
+struct MemoryBudgetArbiterSettings {
+    // A cap moves once its solved target has been further away than the
+    // deadband (the larger of the two) for settleFrames frames in a row, all
+    // in the same direction.
+    uint64_t deadbandBytes = 8ull * 1024ull * 1024ull;
+    double deadbandFraction = 0.05;
+    uint32_t settleFrames = 8u;
+};
+
+class MemoryBudgetArbiter {
+public:
+    using GatherDemand = std::function<void(MemoryDemand&)>;
+    using PublishCap = std::function<void(uint64_t capBytes)>;
+
+    struct ConsumerStats {
+        std::string name;
+        uint64_t minBytes = 0u;
+        uint64_t demandBytes = 0u;
+        uint64_t targetBytes = 0u;     // This frame's solution
+        uint64_t capBytes = 0u;        // Published, after hysteresis
+        uint32_t pendingFrames = 0u;   // Frames the target has been outside the deadband
+    };
+
+    struct Stats {
+        uint64_t budgetBytes = 0u;
+        uint64_t minimumTotalBytes = 0u;
+        uint64_t demandTotalBytes = 0u;
+        uint64_t targetTotalBytes = 0u;
+        uint64_t capTotalBytes = 0u;
+        double quality = 0.0;
+        uint32_t capChanges = 0u;
+        bool satisfiesMinimumBudget = true;
+    };
+
+    MemoryBudgetArbiter() = default;
+    explicit MemoryBudgetArbiter(const MemoryBudgetArbiterSettings& settings)
+        : m_settings(settings)
+    {
+    }
+
+    void SetSettings(const MemoryBudgetArbiterSettings& settings) { m_settings = settings; }
+    const MemoryBudgetArbiterSettings& GetSettings() const { return m_settings; }
+
+    // publish is called on the first update and whenever the cap changes.
+    void AddConsumer(std::string name, GatherDemand gather, PublishCap publish)
+    {
+        if (FindConsumer(name) != nullptr) {
+            throw std::runtime_error("Memory budget consumer '" + name + "' is already registered.");
+        }
+        Consumer consumer;
+        consumer.stats.name = std::move(name);
+        consumer.gather = std::move(gather);
+        consumer.publish = std::move(publish);
+        m_consumers.push_back(std::move(consumer));
+    }
+
+    bool RemoveConsumer(std::string_view name)
+    {
+        const auto it = std::find_if(m_consumers.begin(), m_consumers.end(), [name](const Consumer& consumer) {
+            return consumer.stats.name == name;
+        });
+        if (it == m_consumers.end()) {
+            return false;
+        }
+        m_consumers.erase(it);
+        return true;
+    }
+
+    // Forgets the published caps; the next update publishes every consumer again.
+    void Reset()
+    {
+        for (Consumer& consumer : m_consumers) {
+            consumer.initialized = false;
+            consumer.pendingDirection = 0;
+            consumer.stats.pendingFrames = 0u;
+        }
+    }
+
+    // Gathers demand, solves and publishes. Call once per frame.
+    const Stats& Update(uint64_t totalBudgetBytes)
+    {
+        std::vector<MemoryDemand> demands;
+        demands.reserve(m_consumers.size());
+        for (Consumer& consumer : m_consumers) {
+            MemoryDemand demand;
+            if (consumer.gather) {
+                consumer.gather(demand);
+            }
+            demands.push_back(NormalizeMemoryDemand(demand));
+        }
+
+        const MemoryBudgetSolution solution = SolveMemoryBudget(demands, totalBudgetBytes);
+        m_stats = {};
+        m_stats.budgetBytes = totalBudgetBytes;
+        m_stats.minimumTotalBytes = solution.minimumTotalBytes;
+        m_stats.demandTotalBytes = solution.demandTotalBytes;
+        m_stats.targetTotalBytes = solution.allocatedTotalBytes;
+        m_stats.quality = solution.quality;
+        m_stats.satisfiesMinimumBudget = solution.satisfiesMinimumBudget;
+
+        std::vector<uint64_t> nextCaps(m_consumers.size());
+        for (size_t i = 0; i < m_consumers.size(); ++i) {
+            Consumer& consumer = m_consumers[i];
+            consumer.stats.minBytes = demands[i].minBytes;
+            consumer.stats.demandBytes = demands[i].TotalBytes();
+            consumer.stats.targetBytes = solution.allocatedBytes[i];
+            nextCaps[i] = NextCap(consumer);
+        }
+
+        // Shrinks that were held back must land at once if the held caps no
+        // longer fit, e.g. when the budget itself dropped.
+        uint64_t capTotal = 0u;
+        for (uint64_t cap : nextCaps) {
+            capTotal += cap;
+        }
+        if (capTotal > totalBudgetBytes) {
+            capTotal = 0u;
+            for (size_t i = 0; i < m_consumers.size(); ++i) {
+                nextCaps[i] = (std::min)(nextCaps[i], m_consumers[i].stats.targetBytes);
+                capTotal += nextCaps[i];
+            }
+        }
+
+        // Growth is granted only from headroom, so a consumer never grows into
+        // memory another one has not released yet. Minimums are exempt.
+        for (size_t i = 0; i < m_consumers.size(); ++i) {
+            Consumer& consumer = m_consumers[i];
+            if (nextCaps[i] <= consumer.stats.capBytes || !consumer.initialized) {
+                continue;
+            }
+            const uint64_t others = capTotal - nextCaps[i];
+            const uint64_t headroom = totalBudgetBytes > others ? totalBudgetBytes - others : 0u;
+            const uint64_t limit = (std::max)(
+                consumer.stats.minBytes,
+                (std::max)(consumer.stats.capBytes, detail::RoundDownToQuantum(headroom, demands[i].quantumBytes)));
+            if (nextCaps[i] > limit) {
+                capTotal -= nextCaps[i] - limit;
+                nextCaps[i] = limit;
+            }
+        }
+
+        for (size_t i = 0; i < m_consumers.size(); ++i) {
+            Consumer& consumer = m_consumers[i];
+            const bool changed = !consumer.initialized || nextCaps[i] != consumer.stats.capBytes;
+            // A grow cut short by headroom keeps its pending state and
+            // continues next frame without settling again.
+            if (nextCaps[i] == consumer.stats.targetBytes) {
+                consumer.stats.pendingFrames = 0u;
+                consumer.pendingDirection = 0;
+            }
+            consumer.stats.capBytes = nextCaps[i];
+            consumer.initialized = true;
+            m_stats.capTotalBytes += nextCaps[i];
+            if (changed) {
+                ++m_stats.capChanges;
+                if (consumer.publish) {
+                    consumer.publish(nextCaps[i]);
+                }
+            }
+        }
+        return m_stats;
+    }
+
+    uint64_t GetCap(std::string_view name) const
+    {
+        const Consumer* consumer = FindConsumer(name);
+        if (consumer == nullptr) {
+            throw std::runtime_error("Requested memory budget consumer was not found.");
+        }
+        return consumer->stats.capBytes;
+    }
+
+    const Stats& GetStats() const { return m_stats; }
+
+    std::vector<ConsumerStats> GetConsumerStats() const
+    {
+        std::vector<ConsumerStats> stats;
+        stats.reserve(m_consumers.size());
+        for (const Consumer& consumer : m_consumers) {
+            stats.push_back(consumer.stats);
+        }
+        return stats;
+    }
+
+private:
+    struct Consumer {
+        ConsumerStats stats;
+        GatherDemand gather;
+        PublishCap publish;
+        int pendingDirection = 0;
+        bool initialized = false;
+    };
+
+    const Consumer* FindConsumer(std::string_view name) const
+    {
+        for (const Consumer& consumer : m_consumers) {
+            if (consumer.stats.name == name) {
+                return &consumer;
+            }
+        }
+        return nullptr;
+    }
+
+    // The cap this consumer would move to on its own, before the budget checks.
+    uint64_t NextCap(Consumer& consumer) const
+    {
+        ConsumerStats& stats = consumer.stats;
+        if (!consumer.initialized) {
+            return stats.targetBytes;
+        }
+        if (stats.capBytes < stats.minBytes) {
+            return stats.targetBytes;   // Pinned data has to fit regardless.
+        }
+
+        const uint64_t difference = stats.targetBytes > stats.capBytes
+            ? stats.targetBytes - stats.capBytes
+            : stats.capBytes - stats.targetBytes;
+        const uint64_t deadband = (std::max)(
+            m_settings.deadbandBytes,
+            static_cast<uint64_t>(static_cast<double>(stats.capBytes) * m_settings.deadbandFraction));
+        if (difference <= deadband) {
+            stats.pendingFrames = 0u;
+            consumer.pendingDirection = 0;
+            return stats.capBytes;
+        }
+
+        const int direction = stats.targetBytes > stats.capBytes ? 1 : -1;
+        if (direction != consumer.pendingDirection) {
+            consumer.pendingDirection = direction;
+            stats.pendingFrames = 0u;
+        }
+        ++stats.pendingFrames;
+        return stats.pendingFrames >= m_settings.settleFrames ? stats.targetBytes : stats.capBytes;
+    }
+
+    MemoryBudgetArbiterSettings m_settings;
+    std::vector<Consumer> m_consumers;
+    Stats m_stats;
+};
+
+} // namespace budget
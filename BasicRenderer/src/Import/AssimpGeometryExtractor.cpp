@@ -1,8 +1,7 @@
 #include "Import/AssimpGeometryExtractor.h"
 
-#include <algorithm>
+#include <cstdlib>
 #include <cstring>
-#include <array>
 #include <optional>
 #include <stdexcept>
 #include <string>
@@ -16,6 +15,7 @@
 #include <spdlog/spdlog.h>
 
 #include "Import/CLodCacheLoader.h"
+#include "Import/SkinInfluencePacker.h"
 #include "Managers/Singletons/TaskSchedulerManager.h"
 #include "Mesh/ClusterLODTypes.h"
 #include "Mesh/VertexLayout.h"
@@ -25,15 +25,19 @@
 
 namespace {
 
-constexpr uint32_t kMaxSkinInfluences = 8u;
+static_assert(sizeof(aiVector3D) == sizeof(DirectX::XMFLOAT3), "Assimp built with double precision");
+static_assert(sizeof(unsigned int) == sizeof(uint32_t), "aiFace indices are copied as uint32_t");
 
-struct PackedSkinningInfluences
+// float3 position, float3 normal, then the packed influences.
+constexpr size_t kSkinningInfluencesOffset = 2u * sizeof(DirectX::XMFLOAT3);
+constexpr unsigned int kSkinningVertexSize = static_cast<unsigned int>(kSkinningInfluencesOffset + SkinInfluencePacker::kPackedBytes);
+
+void CopyVector3Stream(std::byte* dst, size_t strideBytes, size_t offsetBytes, const aiVector3D* src, uint32_t count)
 {
-	DirectX::XMUINT4 joints0{ 0, 0, 0, 0 };
-	DirectX::XMUINT4 joints1{ 0, 0, 0, 0 };
-	DirectX::XMFLOAT4 weights0{ 0, 0, 0, 0 };
-	DirectX::XMFLOAT4 weights1{ 0, 0, 0, 0 };
-};
+	for (uint32_t v = 0; v < count; ++v) {
+		std::memcpy(dst + static_cast<size_t>(v) * strideBytes + offsetBytes, &src[v], sizeof(DirectX::XMFLOAT3));
+	}
+}
 
 CLodCacheLoader::MeshCacheIdentity BuildAssimpCacheIdentity(
 	const std::string& sourceFilePath,
@@ -99,153 +103,87 @@ ExtractionResult ExtractAll(const aiScene* pScene, const std::string& sourceFile
 
 		const uint32_t numVertices = static_cast<uint32_t>(aMesh->mNumVertices);
 		const unsigned int vertexSize = MeshVertexLayout::VertexSize(meshFlags);
-		const unsigned int skinningVertexSize =
-			sizeof(DirectX::XMFLOAT3) + sizeof(DirectX::XMFLOAT3) + sizeof(PackedSkinningInfluences);
 
-		// Pack vertex data
-		std::vector<std::byte> rawData(static_cast<size_t>(numVertices) * vertexSize);
-		std::vector<std::byte> skinningData;
-		if (hasBones) {
-			skinningData.resize(static_cast<size_t>(numVertices) * skinningVertexSize);
+		for (unsigned int f = 0; f < aMesh->mNumFaces; f++) {
+			if (aMesh->mFaces[f].mNumIndices != 3) {
+				throw std::runtime_error("Assimp mesh contains non-triangle face; expected triangulated input");
+			}
 		}
 
-		const DirectX::XMFLOAT3 defaultNormal{ 0.0f, 0.0f, 0.0f };
-		for (uint32_t v = 0; v < numVertices; ++v) {
-			const auto& pos = aMesh->mVertices[v];
-			const DirectX::XMFLOAT3 position{ pos.x, pos.y, pos.z };
-			const DirectX::XMFLOAT3 normal = hasNormals
-				? DirectX::XMFLOAT3{ aMesh->mNormals[v].x, aMesh->mNormals[v].y, aMesh->mNormals[v].z }
-				: defaultNormal;
-
-			const size_t baseOffset = static_cast<size_t>(v) * vertexSize;
-			std::memcpy(rawData.data() + baseOffset, &position, sizeof(position));
-			std::memcpy(rawData.data() + baseOffset + MeshVertexLayout::NormalOffset, &normal, sizeof(normal));
-
-			if (hasTexcoords) {
-				const DirectX::XMFLOAT2 texcoord{ aMesh->mTextureCoords[0][v].x, -aMesh->mTextureCoords[0][v].y };
-				std::memcpy(rawData.data() + baseOffset + MeshVertexLayout::TexcoordOffset(meshFlags), &texcoord, sizeof(texcoord));
-			}
+		// CLod cache identity + try load
+		auto cacheIdentity = BuildAssimpCacheIdentity(sourceFilePath, aMesh, i);
+		auto prebuiltData = CLodCacheLoader::TryLoadPrebuilt(cacheIdentity);
 
-			if (hasColors) {
-				const aiColor4D& color = aMesh->mColors[0][v];
-				const DirectX::XMFLOAT3 packedColor{ color.r, color.g, color.b };
-				std::memcpy(rawData.data() + baseOffset + MeshVertexLayout::ColorOffset(meshFlags), &packedColor, sizeof(packedColor));
-			}
+		// Populate MeshIngestBuilder. Assimp keeps each attribute in its own
+		// array, so copy one attribute at a time straight into the builder's
+		// interleaved storage; attributes the mesh lacks stay zero.
+		MeshIngestBuilder ingest(vertexSize, hasBones ? kSkinningVertexSize : 0, meshFlags, GetDefaultBuilderSettings());
+		ingest.SetUvSets(std::move(uvSets));
 
-			if (hasBones) {
-				const size_t skinBaseOffset = static_cast<size_t>(v) * skinningVertexSize;
-				std::memcpy(skinningData.data() + skinBaseOffset, &position, sizeof(position));
-				size_t skinOffset = sizeof(DirectX::XMFLOAT3);
-				std::memcpy(skinningData.data() + skinBaseOffset + skinOffset, &normal, sizeof(normal));
-			}
+		std::byte* vertices = ingest.AppendVertexStorage(numVertices);
+		CopyVector3Stream(vertices, vertexSize, MeshVertexLayout::PositionOffset, aMesh->mVertices, numVertices);
+		if (hasNormals) {
+			CopyVector3Stream(vertices, vertexSize, MeshVertexLayout::NormalOffset, aMesh->mNormals, numVertices);
 		}
-
-		// Pack index data
-		std::vector<UINT32> indices;
-		indices.reserve(aMesh->mNumFaces * 3);
-		for (unsigned int f = 0; f < aMesh->mNumFaces; f++) {
-			const aiFace& face = aMesh->mFaces[f];
-			if (face.mNumIndices != 3) {
-				throw std::runtime_error("Assimp mesh contains non-triangle face; expected triangulated input");
+		if (hasTexcoords) {
+			const size_t texcoordOffset = MeshVertexLayout::TexcoordOffset(meshFlags);
+			const aiVector3D* texcoords = aMesh->mTextureCoords[0];
+			for (uint32_t v = 0; v < numVertices; ++v) {
+				const DirectX::XMFLOAT2 texcoord{ texcoords[v].x, -texcoords[v].y };
+				std::memcpy(vertices + static_cast<size_t>(v) * vertexSize + texcoordOffset, &texcoord, sizeof(texcoord));
 			}
-			for (unsigned int idx = 0; idx < face.mNumIndices; idx++) {
-				indices.push_back(face.mIndices[idx]);
+		}
+		if (hasColors) {
+			const size_t colorOffset = MeshVertexLayout::ColorOffset(meshFlags);
+			const aiColor4D* colors = aMesh->mColors[0];
+			for (uint32_t v = 0; v < numVertices; ++v) {
+				const DirectX::XMFLOAT3 packedColor{ colors[v].r, colors[v].g, colors[v].b };
+				std::memcpy(vertices + static_cast<size_t>(v) * vertexSize + colorOffset, &packedColor, sizeof(packedColor));
 			}
 		}
 
 		if (hasBones) {
-			struct VertexInfluence
-			{
-				uint32_t joint = 0;
-				float weight = 0.0f;
-			};
-
-			std::vector<std::array<VertexInfluence, kMaxSkinInfluences>> vertexInfluences(aMesh->mNumVertices);
-			std::vector<uint32_t> influenceCount(aMesh->mNumVertices, 0u);
+			std::byte* skinningVertices = ingest.AppendSkinningVertexStorage(numVertices);
+			CopyVector3Stream(skinningVertices, kSkinningVertexSize, 0, aMesh->mVertices, numVertices);
+			if (hasNormals) {
+				CopyVector3Stream(skinningVertices, kSkinningVertexSize, sizeof(DirectX::XMFLOAT3), aMesh->mNormals, numVertices);
+			}
+
+			// Workers keep their packer across meshes so its buckets are reused.
+			thread_local SkinInfluencePacker packer;
+			packer.Reset(numVertices);
 			for (unsigned int b = 0; b < aMesh->mNumBones; b++) {
-				aiBone* bone = aMesh->mBones[b];
+				const aiBone* bone = aMesh->mBones[b];
 				for (unsigned int w = 0; w < bone->mNumWeights; w++) {
-					const aiVertexWeight& vw = bone->mWeights[w];
-					unsigned int vertexID = vw.mVertexId;
-					float weight = vw.mWeight;
-
-					if (weight <= 0.0f) {
-						continue;
-					}
-
-					auto& influences = vertexInfluences[vertexID];
-					uint32_t& count = influenceCount[vertexID];
-					if (count < kMaxSkinInfluences) {
-						influences[count++] = VertexInfluence{ b, weight };
-						continue;
-					}
-
-					uint32_t smallestIndex = 0u;
-					for (uint32_t influenceIndex = 1; influenceIndex < kMaxSkinInfluences; ++influenceIndex) {
-						if (influences[influenceIndex].weight < influences[smallestIndex].weight) {
-							smallestIndex = influenceIndex;
-						}
-					}
-					if (weight > influences[smallestIndex].weight) {
-						influences[smallestIndex] = VertexInfluence{ b, weight };
-					}
+					packer.CountInfluence(bone->mWeights[w].mVertexId, bone->mWeights[w].mWeight);
 				}
 			}
-
-			for (uint32_t vertexID = 0; vertexID < numVertices; ++vertexID) {
-				auto influences = vertexInfluences[vertexID];
-				const uint32_t count = influenceCount[vertexID];
-				std::sort(influences.begin(), influences.begin() + count, [](const VertexInfluence& lhs, const VertexInfluence& rhs) {
-					return lhs.weight > rhs.weight;
-				});
-
-				float weightSum = 0.0f;
-				for (uint32_t influenceIndex = 0; influenceIndex < count; ++influenceIndex) {
-					weightSum += influences[influenceIndex].weight;
-				}
-				const float invWeightSum = weightSum > 0.0f ? (1.0f / weightSum) : 0.0f;
-
-				PackedSkinningInfluences packed{};
-				uint32_t jointValues[kMaxSkinInfluences] = {};
-				float weightValues[kMaxSkinInfluences] = {};
-				for (uint32_t influenceIndex = 0; influenceIndex < count; ++influenceIndex) {
-					jointValues[influenceIndex] = influences[influenceIndex].joint;
-					weightValues[influenceIndex] = influences[influenceIndex].weight * invWeightSum;
+			for (unsigned int b = 0; b < aMesh->mNumBones; b++) {
+				const aiBone* bone = aMesh->mBones[b];
+				for (unsigned int w = 0; w < bone->mNumWeights; w++) {
+					packer.AddInfluence(bone->mWeights[w].mVertexId, b, bone->mWeights[w].mWeight);
 				}
-				packed.joints0 = DirectX::XMUINT4(jointValues[0], jointValues[1], jointValues[2], jointValues[3]);
-				packed.joints1 = DirectX::XMUINT4(jointValues[4], jointValues[5], jointValues[6], jointValues[7]);
-				packed.weights0 = DirectX::XMFLOAT4(weightValues[0], weightValues[1], weightValues[2], weightValues[3]);
-				packed.weights1 = DirectX::XMFLOAT4(weightValues[4], weightValues[5], weightValues[6], weightValues[7]);
-
-				const size_t vertexBase = static_cast<size_t>(vertexID) * skinningVertexSize;
-				const size_t influencesOffset = sizeof(DirectX::XMFLOAT3) + sizeof(DirectX::XMFLOAT3);
-				std::memcpy(skinningData.data() + vertexBase + influencesOffset, &packed, sizeof(PackedSkinningInfluences));
 			}
+			packer.Pack(skinningVertices + kSkinningInfluencesOffset, kSkinningVertexSize);
 		}
 
-		// CLod cache identity + try load
-		auto cacheIdentity = BuildAssimpCacheIdentity(sourceFilePath, aMesh, i);
-		auto prebuiltData = CLodCacheLoader::TryLoadPrebuilt(cacheIdentity);
-
-		// Populate MeshIngestBuilder
-		MeshIngestBuilder ingest(vertexSize, hasBones ? skinningVertexSize : 0, meshFlags, GetDefaultBuilderSettings());
-        ingest.SetUvSets(std::move(uvSets));
-		ingest.ReserveVertices(numVertices);
-		if (hasBones) {
-			ingest.ReserveVertices(numVertices);
+		uint32_t* indices = ingest.AppendIndexStorage(static_cast<size_t>(aMesh->mNumFaces) * 3u);
+		for (unsigned int f = 0; f < aMesh->mNumFaces; f++) {
+			std::memcpy(indices + static_cast<size_t>(f) * 3u, aMesh->mFaces[f].mIndices, 3u * sizeof(uint32_t));
 		}
-		for (uint32_t v = 0; v < numVertices; ++v) {
-			const size_t baseOffset = static_cast<size_t>(v) * vertexSize;
-			ingest.AppendVertexBytes(rawData.data() + baseOffset, vertexSize);
-			if (hasBones) {
-				const size_t skinBaseOffset = static_cast<size_t>(v) * skinningVertexSize;
-				ingest.AppendSkinningVertexBytes(skinningData.data() + skinBaseOffset, skinningVertexSize);
+
+		if (aMesh->HasTangentsAndBitangents() && aMesh->HasNormals()) {
+			std::vector<DirectX::XMFLOAT4> tangents(numVertices);
+			for (uint32_t v = 0; v < numVertices; ++v) {
+				const aiVector3D& tangent = aMesh->mTangents[v];
+				const aiVector3D& bitangent = aMesh->mBitangents[v];
+				const aiVector3D normalCrossTangent = aMesh->mNormals[v] ^ tangent;
+				const float handedness = (normalCrossTangent * bitangent) < 0.0f ? -1.0f : 1.0f;
+				tangents[v] = DirectX::XMFLOAT4(tangent.x, tangent.y, tangent.z, handedness);
 			}
+			ingest.SetSourceTangents(std::move(tangents));
 		}
 
-		ingest.ReserveIndices(indices.size());
-		ingest.AppendIndices(indices.data(), indices.size());
-
 		// Build CLod cache if needed
 		if (!prebuiltData.has_value()) {
 			ClusterLODPrebuildArtifacts artifacts = ingest.BuildClusterLODArtifacts();
@@ -289,14 +227,20 @@ ExtractionResult ExtractAll(const aiScene* pScene, const std::string& sourceFile
 	return result;
 }
 
+unsigned int GetImportProcessFlags() {
+	unsigned int flags = aiProcess_Triangulate | aiProcess_FlipUVs;
+	const char* skipOptimize = std::getenv("BASICRENDERER_ASSIMP_SKIP_SCENE_OPTIMIZE");
+	const bool skip = skipOptimize != nullptr &&
+		(skipOptimize[0] == '1' || skipOptimize[0] == 't' || skipOptimize[0] == 'T' || skipOptimize[0] == 'y' || skipOptimize[0] == 'Y');
+	if (!skip) {
+		flags |= aiProcess_OptimizeGraph | aiProcess_OptimizeMeshes;
+	}
+	return flags;
+}
+
 ExtractionResult ExtractAll(const std::string& filePath) {
 	Assimp::Importer importer;
-	constexpr unsigned int kAssimpProcessFlags =
-		aiProcess_Triangulate |
-		aiProcess_FlipUVs |
-		aiProcess_OptimizeGraph |
-		aiProcess_OptimizeMeshes;
-	const aiScene* pScene = importer.ReadFile(filePath, kAssimpProcessFlags);
+	const aiScene* pScene = importer.ReadFile(filePath, GetImportProcessFlags());
 
 	if (!pScene || pScene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !pScene->mRootNode) {
 		spdlog::error("Assimp loading failed for {}. Error: {}", filePath, importer.GetErrorString());
@@ -797,12 +797,7 @@ namespace AssimpLoader {
 
     std::shared_ptr<Scene> LoadModel(std::string filePath) {
         Assimp::Importer importer;
-        constexpr unsigned int kAssimpProcessFlags =
-            aiProcess_Triangulate |
-            aiProcess_FlipUVs |
-            aiProcess_OptimizeGraph |
-            aiProcess_OptimizeMeshes;
-        const aiScene* pScene = importer.ReadFile(filePath, kAssimpProcessFlags);
+        const aiScene* pScene = importer.ReadFile(filePath, AssimpGeometryExtractor::GetImportProcessFlags());
 
         if (!pScene || pScene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !pScene->mRootNode) {
             spdlog::error("Model loading failed for {}. Error: {}", filePath, importer.GetErrorString());
@@ -1,12 +1,21 @@
 #include "Import/BRNiflyClient.h"
 
 #include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
 #include <cstdint>
 #include <cstdlib>
 #include <filesystem>
 #include <fstream>
+#include <limits>
+#include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <thread>
+#include <unordered_map>
 
 #include <nlohmann/json.hpp>
 #include <spdlog/spdlog.h>
@@ -14,6 +23,16 @@
 #ifdef _WIN32
 #define WIN32_LEAN_AND_MEAN
 #include <windows.h>
+#else
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <spawn.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+extern char** environ;
 #endif
 
 namespace BRNiflyClient {
@@ -37,6 +56,37 @@ std::string QuoteArgument(const std::string& arg)
     return quoted;
 }
 
+// Handles are briefly inheritable while a child is being created; serializing
+// launches keeps one child from inheriting another's pipe ends (which would
+// stop it from ever seeing EOF).
+std::mutex& ProcessLaunchMutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+unsigned long CurrentProcessId()
+{
+#ifdef _WIN32
+    return GetCurrentProcessId();
+#else
+    return static_cast<unsigned long>(getpid());
+#endif
+}
+
+std::string MakeTempPath(const char* prefix, const char* extension)
+{
+    static std::atomic<uint64_t> serial{ 0 };
+    std::error_code ec;
+    fs::path directory = fs::temp_directory_path(ec);
+    if (ec) {
+        directory = fs::current_path();
+    }
+    directory /= "BRNifly";
+    fs::create_directories(directory, ec);
+    return (directory / (std::string(prefix) + std::to_string(CurrentProcessId()) + "_" + std::to_string(serial.fetch_add(1)) + extension)).string();
+}
+
 #ifdef _WIN32
 std::optional<std::string> GetEnvironmentString(const char* name)
 {
@@ -93,6 +143,7 @@ std::optional<ProcessResult> RunProcessCapture(
     HANDLE stderrRead = nullptr;
     HANDLE stderrWrite = nullptr;
 
+    std::unique_lock<std::mutex> launchLock(ProcessLaunchMutex());
     if (!CreatePipe(&stdoutRead, &stdoutWrite, &securityAttributes, 0) ||
         !SetHandleInformation(stdoutRead, HANDLE_FLAG_INHERIT, 0) ||
         !CreatePipe(&stderrRead, &stderrWrite, &securityAttributes, 0) ||
@@ -137,6 +188,7 @@ std::optional<ProcessResult> RunProcessCapture(
 
     CloseHandle(stdoutWrite);
     CloseHandle(stderrWrite);
+    launchLock.unlock();
 
     if (!created) {
         if (errorMessage) {
@@ -285,8 +337,7 @@ std::optional<json> RunJsonFileCommand(
     std::string* executablePath,
     std::string* errorMessage)
 {
-    const fs::path responsePath = fs::temp_directory_path() /
-        ("brnifly_response_" + std::to_string(reinterpret_cast<std::uintptr_t>(errorMessage)) + ".json");
+    const fs::path responsePath = MakeTempPath("response_", ".json");
 
     auto envelope = RunJsonCommand(options, { "--convert-usd-json-file", nifPath, responsePath.string() }, executablePath, errorMessage);
     if (!envelope) {
@@ -317,6 +368,665 @@ std::optional<json> RunJsonFileCommand(
     }
 }
 
+
+// Framed protocol spoken by `BRNifly --serve` on its stdin/stdout. Each frame is
+// this little-endian header, header.jsonBytes of JSON, then header.payloadBytes
+// of opaque payload. Keep in sync with BRNifly/src/main.cpp.
+constexpr uint32_t kFrameMagic = 0x464E5242u; // "BRNF"
+constexpr uint16_t kFrameVersion = 1;
+constexpr uint32_t kMaxFrameJsonBytes = 16u * 1024u * 1024u;
+constexpr uint64_t kMaxFramePayloadBytes = 2ull * 1024ull * 1024ull * 1024ull;
+
+enum class FrameType : uint16_t {
+    ConvertRequest = 1,
+    ConvertResponse = 2,
+    Shutdown = 3,
+};
+
+struct FrameHeader {
+    uint32_t magic = kFrameMagic;
+    uint16_t version = kFrameVersion;
+    uint16_t type = 0;
+    uint32_t requestId = 0;
+    uint32_t jsonBytes = 0;
+    uint64_t payloadBytes = 0;
+};
+static_assert(sizeof(FrameHeader) == 24, "BRNifly frame header must stay 24 bytes");
+
+using Clock = std::chrono::steady_clock;
+
+int RemainingMilliseconds(Clock::time_point deadline)
+{
+    const long long remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - Clock::now()).count();
+    return static_cast<int>(std::clamp<long long>(remaining, 0, (std::numeric_limits<int>::max)()));
+}
+
+// One `BRNifly --serve` child. Not thread-safe; the pool hands each process to
+// a single caller at a time.
+class ServerProcess {
+public:
+    static std::unique_ptr<ServerProcess> Launch(const std::string& executable, std::string* errorMessage);
+
+    ~ServerProcess()
+    {
+        if (m_alive) {
+            FrameHeader header{};
+            header.type = static_cast<uint16_t>(FrameType::Shutdown);
+            WriteAll(&header, sizeof(header));
+        }
+        Close(1000);
+    }
+
+    ServerProcess(const ServerProcess&) = delete;
+    ServerProcess& operator=(const ServerProcess&) = delete;
+
+    bool IsAlive() const { return m_alive; }
+
+    // Sends one request and blocks for its response. A transport failure or
+    // timeout kills the process, since the stream can no longer be trusted.
+    std::optional<json> Exchange(const json& request, std::string& payload, int timeoutMilliseconds, std::string* errorMessage)
+    {
+        const std::string requestText = request.dump();
+        FrameHeader header{};
+        header.type = static_cast<uint16_t>(FrameType::ConvertRequest);
+        header.requestId = m_nextRequestId++;
+        header.jsonBytes = static_cast<uint32_t>(requestText.size());
+
+        auto fail = [&](const char* message) -> std::optional<json> {
+            Close(0);
+            if (errorMessage) {
+                *errorMessage = message;
+            }
+            return std::nullopt;
+        };
+
+        if (!WriteAll(&header, sizeof(header)) || !WriteAll(requestText.data(), requestText.size())) {
+            return fail("BRNifly server exited before accepting the request.");
+        }
+
+        const Clock::time_point deadline = Clock::now() + std::chrono::milliseconds(timeoutMilliseconds);
+        bool timedOut = false;
+        FrameHeader response{};
+        if (!ReadAll(&response, sizeof(response), deadline, &timedOut)) {
+            return fail(timedOut ? "BRNifly server timed out." : "BRNifly server exited before responding.");
+        }
+        if (response.magic != kFrameMagic ||
+            response.version != kFrameVersion ||
+            response.type != static_cast<uint16_t>(FrameType::ConvertResponse) ||
+            response.requestId != header.requestId ||
+            response.jsonBytes > kMaxFrameJsonBytes ||
+            response.payloadBytes > kMaxFramePayloadBytes)
+        {
+            return fail("BRNifly server sent a malformed response frame.");
+        }
+
+        std::string responseText(response.jsonBytes, '\0');
+        payload.resize(static_cast<size_t>(response.payloadBytes));
+        if (!ReadAll(responseText.data(), responseText.size(), deadline, &timedOut) ||
+            !ReadAll(payload.data(), payload.size(), deadline, &timedOut))
+        {
+            return fail(timedOut ? "BRNifly server timed out." : "BRNifly server exited mid-response.");
+        }
+
+        try {
+            return json::parse(responseText);
+        }
+        catch (const std::exception& ex) {
+            if (errorMessage) {
+                *errorMessage = std::string("BRNifly server returned invalid JSON: ") + ex.what();
+            }
+            return std::nullopt;
+        }
+    }
+
+private:
+    ServerProcess() = default;
+
+    bool WriteAll(const void* data, size_t size);
+    bool ReadAll(void* data, size_t size, Clock::time_point deadline, bool* timedOut);
+    // Waits up to graceMilliseconds for a clean exit, then kills the process.
+    void Close(int graceMilliseconds);
+
+#ifdef _WIN32
+    HANDLE m_process = nullptr;
+    HANDLE m_stdinWrite = nullptr;
+    HANDLE m_stdoutRead = nullptr;
+    HANDLE m_readEvent = nullptr;
+#else
+    pid_t m_pid = -1;
+    int m_socket = -1;
+#endif
+    uint32_t m_nextRequestId = 1;
+    bool m_alive = false;
+};
+
+#ifdef _WIN32
+std::unique_ptr<ServerProcess> ServerProcess::Launch(const std::string& executable, std::string* errorMessage)
+{
+    SECURITY_ATTRIBUTES securityAttributes{};
+    securityAttributes.nLength = sizeof(SECURITY_ATTRIBUTES);
+    securityAttributes.bInheritHandle = TRUE;
+
+    HANDLE stdinRead = nullptr;
+    HANDLE stdinWrite = nullptr;
+    HANDLE stdoutRead = nullptr;
+    HANDLE stdoutWrite = nullptr;
+    auto closeAll = [&]() {
+        if (stdinRead) CloseHandle(stdinRead);
+        if (stdinWrite) CloseHandle(stdinWrite);
+        if (stdoutRead) CloseHandle(stdoutRead);
+        if (stdoutWrite) CloseHandle(stdoutWrite);
+    };
+
+    std::unique_lock<std::mutex> launchLock(ProcessLaunchMutex());
+
+    // Anonymous pipes cannot be read with a timeout, so the response side is a
+    // named pipe whose read end is opened for overlapped I/O.
+    static std::atomic<uint32_t> pipeSerial{ 0 };
+    const std::string pipeName = "\\\\.\\pipe\\BRNifly." + std::to_string(CurrentProcessId()) + "." + std::to_string(pipeSerial.fetch_add(1));
+    stdoutRead = CreateNamedPipeA(
+        pipeName.c_str(),
+        PIPE_ACCESS_INBOUND | FILE_FLAG_OVERLAPPED | FILE_FLAG_FIRST_PIPE_INSTANCE,
+        PIPE_TYPE_BYTE | PIPE_WAIT | PIPE_REJECT_REMOTE_CLIENTS,
+        1,
+        0,
+        1u << 20,
+        0,
+        nullptr);
+    if (stdoutRead == INVALID_HANDLE_VALUE) {
+        stdoutRead = nullptr;
+    }
+    if (stdoutRead) {
+        stdoutWrite = CreateFileA(pipeName.c_str(), GENERIC_WRITE, 0, &securityAttributes, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (stdoutWrite == INVALID_HANDLE_VALUE) {
+            stdoutWrite = nullptr;
+        }
+    }
+
+    if (!stdoutRead || !stdoutWrite ||
+        !CreatePipe(&stdinRead, &stdinWrite, &securityAttributes, 0) ||
+        !SetHandleInformation(stdinWrite, HANDLE_FLAG_INHERIT, 0))
+    {
+        if (errorMessage) {
+            *errorMessage = "Failed to create BRNifly server pipes.";
+        }
+        closeAll();
+        return nullptr;
+    }
+
+    std::string commandLine = QuoteArgument(executable) + " --serve";
+
+    STARTUPINFOA startupInfo{};
+    startupInfo.cb = sizeof(startupInfo);
+    startupInfo.dwFlags = STARTF_USESTDHANDLES;
+    startupInfo.hStdInput = stdinRead;
+    startupInfo.hStdOutput = stdoutWrite;
+    startupInfo.hStdError = GetStdHandle(STD_ERROR_HANDLE);
+
+    PROCESS_INFORMATION processInfo{};
+    BOOL created = CreateProcessA(
+        executable.c_str(),
+        commandLine.data(),
+        nullptr,
+        nullptr,
+        TRUE,
+        CREATE_NO_WINDOW,
+        nullptr,
+        fs::path(executable).parent_path().string().c_str(),
+        &startupInfo,
+        &processInfo);
+
+    CloseHandle(stdinRead);
+    stdinRead = nullptr;
+    CloseHandle(stdoutWrite);
+    stdoutWrite = nullptr;
+    launchLock.unlock();
+
+    if (!created) {
+        if (errorMessage) {
+            *errorMessage = "Failed to launch BRNifly server: " + executable;
+        }
+        closeAll();
+        return nullptr;
+    }
+    CloseHandle(processInfo.hThread);
+
+    std::unique_ptr<ServerProcess> server(new ServerProcess());
+    server->m_process = processInfo.hProcess;
+    server->m_stdinWrite = stdinWrite;
+    server->m_stdoutRead = stdoutRead;
+    server->m_readEvent = CreateEventA(nullptr, TRUE, FALSE, nullptr);
+    if (!server->m_readEvent) {
+        if (errorMessage) {
+            *errorMessage = "Failed to create BRNifly server read event.";
+        }
+        return nullptr;
+    }
+    server->m_alive = true;
+    return server;
+}
+
+bool ServerProcess::WriteAll(const void* data, size_t size)
+{
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    while (m_alive && size > 0) {
+        DWORD written = 0;
+        if (!WriteFile(m_stdinWrite, bytes, static_cast<DWORD>((std::min)(size, size_t{ 1u << 20 })), &written, nullptr) || written == 0) {
+            return false;
+        }
+        bytes += written;
+        size -= written;
+    }
+    return m_alive;
+}
+
+bool ServerProcess::ReadAll(void* data, size_t size, Clock::time_point deadline, bool* timedOut)
+{
+    auto* bytes = static_cast<uint8_t*>(data);
+    while (m_alive && size > 0) {
+        OVERLAPPED overlapped{};
+        overlapped.hEvent = m_readEvent;
+        ResetEvent(m_readEvent);
+
+        DWORD bytesRead = 0;
+        if (!ReadFile(m_stdoutRead, bytes, static_cast<DWORD>((std::min)(size, size_t{ 1u << 24 })), nullptr, &overlapped)) {
+            if (GetLastError() != ERROR_IO_PENDING) {
+                return false;
+            }
+            // The read also completes (with ERROR_BROKEN_PIPE) if the server exits.
+            if (WaitForSingleObject(m_readEvent, static_cast<DWORD>(RemainingMilliseconds(deadline))) != WAIT_OBJECT_0) {
+                CancelIoEx(m_stdoutRead, &overlapped);
+                GetOverlappedResult(m_stdoutRead, &overlapped, &bytesRead, TRUE);
+                *timedOut = true;
+                return false;
+            }
+        }
+        if (!GetOverlappedResult(m_stdoutRead, &overlapped, &bytesRead, FALSE) || bytesRead == 0) {
+            return false;
+        }
+        bytes += bytesRead;
+        size -= bytesRead;
+    }
+    return m_alive;
+}
+
+void ServerProcess::Close(int graceMilliseconds)
+{
+    if (m_process) {
+        if (WaitForSingleObject(m_process, static_cast<DWORD>(graceMilliseconds)) != WAIT_OBJECT_0) {
+            TerminateProcess(m_process, 0xFFFF);
+        }
+        CloseHandle(m_process);
+    }
+    if (m_stdinWrite) CloseHandle(m_stdinWrite);
+    if (m_stdoutRead) CloseHandle(m_stdoutRead);
+    if (m_readEvent) CloseHandle(m_readEvent);
+    m_process = nullptr;
+    m_stdinWrite = nullptr;
+    m_stdoutRead = nullptr;
+    m_readEvent = nullptr;
+    m_alive = false;
+}
+#else
+#ifdef MSG_NOSIGNAL
+constexpr int kSendFlags = MSG_NOSIGNAL;
+#else
+constexpr int kSendFlags = 0;
+#endif
+
+std::unique_ptr<ServerProcess> ServerProcess::Launch(const std::string& executable, std::string* errorMessage)
+{
+    std::unique_lock<std::mutex> launchLock(ProcessLaunchMutex());
+
+    // A Unix socket pair serves as both stdin and stdout of the child.
+    int sockets[2] = { -1, -1 };
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, sockets) != 0) {
+        if (errorMessage) {
+            *errorMessage = "Failed to create BRNifly server socket pair.";
+        }
+        return nullptr;
+    }
+    fcntl(sockets[0], F_SETFD, FD_CLOEXEC);
+    fcntl(sockets[1], F_SETFD, FD_CLOEXEC);
+
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+    posix_spawn_file_actions_adddup2(&actions, sockets[1], STDIN_FILENO);
+    posix_spawn_file_actions_adddup2(&actions, sockets[1], STDOUT_FILENO);
+
+    std::string executableArg = executable;
+    std::string serveArg = "--serve";
+    char* argv[] = { executableArg.data(), serveArg.data(), nullptr };
+    pid_t pid = -1;
+    const int spawnResult = posix_spawn(&pid, executable.c_str(), &actions, nullptr, argv, environ);
+    posix_spawn_file_actions_destroy(&actions);
+    close(sockets[1]);
+    launchLock.unlock();
+
+    if (spawnResult != 0) {
+        close(sockets[0]);
+        if (errorMessage) {
+            *errorMessage = "Failed to launch BRNifly server: " + executable;
+        }
+        return nullptr;
+    }
+
+    std::unique_ptr<ServerProcess> server(new ServerProcess());
+    server->m_pid = pid;
+    server->m_socket = sockets[0];
+    server->m_alive = true;
+    return server;
+}
+
+bool ServerProcess::WriteAll(const void* data, size_t size)
+{
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    while (m_alive && size > 0) {
+        const ssize_t written = send(m_socket, bytes, size, kSendFlags);
+        if (written < 0 && errno == EINTR) {
+            continue;
+        }
+        if (written <= 0) {
+            return false;
+        }
+        bytes += written;
+        size -= static_cast<size_t>(written);
+    }
+    return m_alive;
+}
+
+bool ServerProcess::ReadAll(void* data, size_t size, Clock::time_point deadline, bool* timedOut)
+{
+    auto* bytes = static_cast<uint8_t*>(data);
+    while (m_alive && size > 0) {
+        pollfd descriptor{};
+        descriptor.fd = m_socket;
+        descriptor.events = POLLIN;
+        const int ready = poll(&descriptor, 1, RemainingMilliseconds(deadline));
+        if (ready < 0 && errno == EINTR) {
+            continue;
+        }
+        if (ready == 0) {
+            *timedOut = true;
+            return false;
+        }
+        if (ready < 0) {
+            return false;
+        }
+
+        const ssize_t received = recv(m_socket, bytes, size, 0);
+        if (received < 0 && errno == EINTR) {
+            continue;
+        }
+        if (received <= 0) {
+            return false;
+        }
+        bytes += received;
+        size -= static_cast<size_t>(received);
+    }
+    return m_alive;
+}
+
+void ServerProcess::Close(int graceMilliseconds)
+{
+    if (m_socket >= 0) {
+        close(m_socket);
+    }
+    if (m_pid > 0) {
+        const Clock::time_point deadline = Clock::now() + std::chrono::milliseconds(graceMilliseconds);
+        while (waitpid(m_pid, nullptr, WNOHANG) == 0) {
+            if (Clock::now() >= deadline) {
+                kill(m_pid, SIGKILL);
+                waitpid(m_pid, nullptr, 0);
+                break;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+    }
+    m_socket = -1;
+    m_pid = -1;
+    m_alive = false;
+}
+#endif
+
+// Lazily grows to maxProcesses server processes; callers block while all of
+// them are busy. Dead processes are dropped on release and relaunched on demand.
+class ServerPool {
+public:
+    explicit ServerPool(std::string executable)
+        : m_executable(std::move(executable))
+    {
+    }
+
+    void Reserve(unsigned int maxProcesses)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_maxProcesses = (std::max)(m_maxProcesses, maxProcesses);
+        }
+        m_available.notify_all();
+    }
+
+    std::unique_ptr<ServerProcess> Acquire(std::string* errorMessage)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_available.wait(lock, [this]() { return !m_idle.empty() || m_liveProcesses < m_maxProcesses; });
+        if (!m_idle.empty()) {
+            std::unique_ptr<ServerProcess> server = std::move(m_idle.back());
+            m_idle.pop_back();
+            return server;
+        }
+
+        ++m_liveProcesses;
+        lock.unlock();
+        std::unique_ptr<ServerProcess> server = ServerProcess::Launch(m_executable, errorMessage);
+        if (!server) {
+            lock.lock();
+            --m_liveProcesses;
+            lock.unlock();
+            m_available.notify_one();
+        }
+        return server;
+    }
+
+    void Release(std::unique_ptr<ServerProcess> server)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (server->IsAlive()) {
+                m_idle.push_back(std::move(server));
+            }
+            else {
+                --m_liveProcesses;
+            }
+        }
+        m_available.notify_one();
+    }
+
+    void ShutdownIdle()
+    {
+        std::vector<std::unique_ptr<ServerProcess>> idle;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            idle.swap(m_idle);
+            m_liveProcesses -= static_cast<unsigned int>(idle.size());
+        }
+        m_available.notify_all();
+    }
+
+private:
+    std::string m_executable;
+    std::mutex m_mutex;
+    std::condition_variable m_available;
+    std::vector<std::unique_ptr<ServerProcess>> m_idle;
+    unsigned int m_liveProcesses = 0;
+    unsigned int m_maxProcesses = 1;
+};
+
+struct ClientState {
+    std::mutex mutex;
+    std::unordered_map<std::string, ServiceInfo> services;
+    std::unordered_map<std::string, std::shared_ptr<ServerPool>> pools;
+};
+
+ClientState& State()
+{
+    static ClientState state;
+    return state;
+}
+
+unsigned int ResolveMaxServerProcesses(const ClientOptions& options)
+{
+    if (options.maxServerProcesses != 0) {
+        return options.maxServerProcesses;
+    }
+    return (std::max)(1u, std::thread::hardware_concurrency() / 2u);
+}
+
+std::shared_ptr<ServerPool> GetServerPool(const std::string& executable, const ClientOptions& options)
+{
+    std::shared_ptr<ServerPool> pool;
+    {
+        ClientState& state = State();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        auto& entry = state.pools[executable];
+        if (!entry) {
+            entry = std::make_shared<ServerPool>(executable);
+        }
+        pool = entry;
+    }
+    pool->Reserve(ResolveMaxServerProcesses(options));
+    return pool;
+}
+
+// --describe-services costs a process launch, so the answer is kept per executable.
+std::optional<ServiceInfo> DescribeServicesCached(const ClientOptions& options, std::string* errorMessage)
+{
+    ClientState& state = State();
+    if (auto executable = DiscoverExecutable(options)) {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        auto it = state.services.find(*executable);
+        if (it != state.services.end()) {
+            return it->second;
+        }
+    }
+
+    auto info = DescribeServices(options, errorMessage);
+    if (info) {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        state.services[info->executablePath] = *info;
+    }
+    return info;
+}
+
+bool HasService(const ServiceInfo& services, const char* name)
+{
+    return std::find(services.services.begin(), services.services.end(), name) != services.services.end();
+}
+
+std::optional<UsdAssetPackage> PackageFromResponse(const json& response, const std::string& nifPath, std::string payload, std::string* errorMessage)
+{
+    if (response.value("status", "") != "ok") {
+        if (errorMessage) {
+            *errorMessage = response.value("message", "BRNifly conversion failed.");
+        }
+        return std::nullopt;
+    }
+
+    UsdAssetPackage package{};
+    package.sourcePath = response.value("sourcePath", nifPath);
+    package.sourceIdentifier = response.value("sourceIdentifier", package.sourcePath);
+    package.contentHash = response.value("contentHash", "");
+    package.dependencies = JsonStringArray(response.value("dependencies", json::array()));
+    package.textureSearchRoots = JsonStringArray(response.value("textureSearchRoots", json::array()));
+    package.diagnostics = JsonDiagnostics(response.value("diagnostics", json::array()));
+
+    if (response.value("payloadFormat", "usda-text") == "usdc-file") {
+        package.payloadFormat = PayloadFormat::UsdcFile;
+        package.rootLayerFile = response.value("payloadPath", "");
+        if (package.rootLayerFile.empty()) {
+            if (errorMessage) {
+                *errorMessage = "BRNifly did not report where it wrote the USD crate payload.";
+            }
+            return std::nullopt;
+        }
+        return package;
+    }
+
+    package.rootLayerText = payload.empty() ? response.value("rootLayerText", "") : std::move(payload);
+    if (package.rootLayerText.empty()) {
+        if (errorMessage) {
+            *errorMessage = "BRNifly returned an empty USD layer.";
+        }
+        return std::nullopt;
+    }
+    return package;
+}
+
+std::optional<UsdAssetPackage> ConvertWithServer(
+    ServerPool& pool,
+    const std::string& nifPath,
+    const ClientOptions& options,
+    std::string* errorMessage,
+    bool* serverUnavailable)
+{
+    std::unique_ptr<ServerProcess> server = pool.Acquire(errorMessage);
+    if (!server) {
+        *serverUnavailable = true;
+        return std::nullopt;
+    }
+
+    json request{ { "service", "nif.convert.usd" }, { "sourcePath", nifPath }, { "payloadFormat", "usda-text" } };
+    std::string payloadPath;
+    if (options.preferredPayload == PayloadFormat::UsdcFile) {
+        payloadPath = MakeTempPath("payload_", ".usdc");
+        request["payloadFormat"] = "usdc-file";
+        request["payloadPath"] = payloadPath;
+    }
+
+    std::string payload;
+    auto response = server->Exchange(request, payload, options.timeoutMilliseconds, errorMessage);
+    pool.Release(std::move(server));
+
+    std::optional<UsdAssetPackage> package;
+    if (response) {
+        package = PackageFromResponse(*response, nifPath, std::move(payload), errorMessage);
+    }
+    if (!package && !payloadPath.empty()) {
+        std::error_code ec;
+        fs::remove(payloadPath, ec);
+    }
+    return package;
+}
+
+std::optional<UsdAssetPackage> ConvertOneShot(const std::string& nifPath, const ClientOptions& options, std::string* errorMessage)
+{
+    std::string executablePath;
+    auto response = RunJsonFileCommand(options, nifPath, &executablePath, errorMessage);
+    if (!response) {
+        return std::nullopt;
+    }
+    return PackageFromResponse(*response, nifPath, {}, errorMessage);
+}
+
+std::optional<UsdAssetPackage> ConvertWithServices(
+    const std::string& nifPath,
+    const ClientOptions& options,
+    const ServiceInfo& services,
+    std::string* errorMessage)
+{
+    if (options.usePersistentServer && HasService(services, "nif.serve")) {
+        auto pool = GetServerPool(services.executablePath, options);
+        bool serverUnavailable = false;
+        auto package = ConvertWithServer(*pool, nifPath, options, errorMessage, &serverUnavailable);
+        if (package || !serverUnavailable) {
+            return package;
+        }
+        spdlog::warn("BRNifly server unavailable ({}); converting '{}' in a one-shot process.", errorMessage ? *errorMessage : std::string(), nifPath);
+    }
+    return ConvertOneShot(nifPath, options, errorMessage);
+}
+
 } // namespace
 
 std::optional<std::string> DiscoverExecutable(const ClientOptions& options)
@@ -373,48 +1083,88 @@ std::optional<ServiceInfo> DescribeServices(const ClientOptions& options, std::s
 
 std::optional<UsdAssetPackage> ConvertNifToUsd(const std::string& nifPath, const ClientOptions& options, std::string* errorMessage)
 {
-    auto services = DescribeServices(options, errorMessage);
+    auto services = DescribeServicesCached(options, errorMessage);
     if (!services) {
         return std::nullopt;
     }
 
-    const bool hasConvertService = std::find(services->services.begin(), services->services.end(), "nif.convert.usd") != services->services.end();
-    if (!hasConvertService) {
+    if (!HasService(*services, "nif.convert.usd")) {
         if (errorMessage) {
             *errorMessage = "BRNifly does not advertise nif.convert.usd.";
         }
         return std::nullopt;
     }
 
-    std::string executablePath;
-    auto response = RunJsonFileCommand(options, nifPath, &executablePath, errorMessage);
-    if (!response) {
-        return std::nullopt;
+    return ConvertWithServices(nifPath, options, *services, errorMessage);
+}
+
+std::vector<ConversionResult> ConvertNifsToUsd(const std::vector<std::string>& nifPaths, const ClientOptions& options)
+{
+    std::vector<ConversionResult> results(nifPaths.size());
+    for (size_t i = 0; i < nifPaths.size(); ++i) {
+        results[i].nifPath = nifPaths[i];
+    }
+    if (nifPaths.empty()) {
+        return results;
     }
 
-    if (response->value("status", "") != "ok") {
-        if (errorMessage) {
-            *errorMessage = response->value("message", "BRNifly conversion failed.");
+    std::string errorMessage;
+    auto services = DescribeServicesCached(options, &errorMessage);
+    if (services && !HasService(*services, "nif.convert.usd")) {
+        services.reset();
+        errorMessage = "BRNifly does not advertise nif.convert.usd.";
+    }
+    if (!services) {
+        for (ConversionResult& result : results) {
+            result.errorMessage = errorMessage;
         }
-        return std::nullopt;
+        return results;
     }
 
-    UsdAssetPackage package{};
-    package.sourcePath = response->value("sourcePath", nifPath);
-    package.sourceIdentifier = response->value("sourceIdentifier", package.sourcePath);
-    package.contentHash = response->value("contentHash", "");
-    package.rootLayerText = response->value("rootLayerText", "");
-    package.dependencies = JsonStringArray((*response)["dependencies"]);
-    package.textureSearchRoots = JsonStringArray((*response)["textureSearchRoots"]);
-    package.diagnostics = JsonDiagnostics((*response)["diagnostics"]);
-    if (package.rootLayerText.empty()) {
-        if (errorMessage) {
-            *errorMessage = "BRNifly returned an empty USD layer.";
+    // Plain threads rather than scheduler tasks: each worker spends its time
+    // blocked on a server pipe, which would starve the task scheduler.
+    const size_t workerCount = (std::min)(nifPaths.size(), static_cast<size_t>(ResolveMaxServerProcesses(options)));
+    std::atomic<size_t> nextIndex{ 0 };
+    auto worker = [&]() {
+        for (size_t index = nextIndex.fetch_add(1); index < results.size(); index = nextIndex.fetch_add(1)) {
+            ConversionResult& result = results[index];
+            result.package = ConvertWithServices(result.nifPath, options, *services, &result.errorMessage);
         }
-        return std::nullopt;
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(workerCount - 1);
+    for (size_t i = 1; i < workerCount; ++i) {
+        workers.emplace_back(worker);
+    }
+    worker();
+    for (std::thread& thread : workers) {
+        thread.join();
     }
+    return results;
+}
 
-    return package;
+void ReleasePayload(const UsdAssetPackage& package)
+{
+    if (package.payloadFormat == PayloadFormat::UsdcFile && !package.rootLayerFile.empty()) {
+        std::error_code ec;
+        fs::remove(package.rootLayerFile, ec);
+    }
+}
+
+void ShutdownServers()
+{
+    std::vector<std::shared_ptr<ServerPool>> pools;
+    {
+        ClientState& state = State();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        for (auto& [executable, pool] : state.pools) {
+            pools.push_back(pool);
+        }
+    }
+    for (const auto& pool : pools) {
+        pool->ShutdownIdle();
+    }
 }
 
 } // namespace BRNiflyClient
@@ -25,6 +25,7 @@
 #if BASICRENDERER_HAS_DIRECTSTORAGE
 #include "Managers/Singletons/DirectStorageManager.h"
 #endif
+#include "Managers/Singletons/AsyncFileIoManager.h"
 #include "Utilities/CachePathUtilities.h"
 
 #include "../shaders/Common/defines.h"
@@ -277,6 +278,60 @@ namespace CLodCache {
 			return file.good();
 		}
 
+		// pageIndices[i] is the container page for output slot i.
+		bool LoadPagesThroughAsyncFileIo(
+			const std::wstring& containerPath,
+			std::span<const ClusterLODGroupDiskLocator> pageLocators,
+			std::span<const uint32_t> pageIndices,
+			const std::vector<bool>& pageNeedsFetch,
+			LoadedGroupPayload& outPayload,
+			std::string* outMessage)
+		{
+			if (outMessage) {
+				outMessage->clear();
+			}
+			auto& asyncFileIo = AsyncFileIoManager::GetInstance();
+			if (!asyncFileIo.IsInitialized()) {
+				if (outMessage) {
+					*outMessage = "async file IO service unavailable";
+				}
+				return false;
+			}
+
+			outPayload.pageBlobs.assign(pageIndices.size(), {});
+			std::vector<AsyncFileReadRegion> regions;
+			std::vector<uint32_t> regionSlots;
+			regions.reserve(pageIndices.size());
+			regionSlots.reserve(pageIndices.size());
+			for (uint32_t pageOffset = 0; pageOffset < static_cast<uint32_t>(pageIndices.size()); ++pageOffset) {
+				if (!pageNeedsFetch.empty() &&
+					pageOffset < static_cast<uint32_t>(pageNeedsFetch.size()) &&
+					!pageNeedsFetch[pageOffset]) {
+					continue;
+				}
+				const uint32_t pageIndex = pageIndices[pageOffset];
+				if (pageIndex >= pageLocators.size()) {
+					return false;
+				}
+				const ClusterLODGroupDiskLocator& locator = pageLocators[pageIndex];
+				regions.push_back({ locator.blobOffset, locator.blobSizeBytes });
+				regionSlots.push_back(pageOffset);
+			}
+
+			std::vector<std::vector<std::byte>> blobs;
+			if (!asyncFileIo.ReadFileRegionsToMemory(containerPath, regions, blobs, outMessage) ||
+				blobs.size() != regions.size()) {
+				return false;
+			}
+			for (size_t regionIndex = 0; regionIndex < regions.size(); ++regionIndex) {
+				outPayload.pageBlobs[regionSlots[regionIndex]] = std::move(blobs[regionIndex]);
+			}
+			if (outMessage) {
+				*outMessage = "loaded selected CLod mesh pages through async file IO";
+			}
+			return true;
+		}
+
 		std::wstring BuildGroupContainerFileName(const CacheKey& key, uint64_t buildConfigHash)
 		{
 			size_t hashSeed = 0;
@@ -616,6 +671,8 @@ namespace CLodCache {
 		hashEnvironmentString("BASICRENDERER_CLOD_VOXEL_OPACITY_THRESHOLD");
 		hashEnvironmentString("BASICRENDERER_CLOD_VOXEL_CARRY_ZERO_COVERAGE");
 		hashEnvironmentString("BASICRENDERER_CLOD_VOXEL_PRUNING");
+		boost::hash_combine(seed, static_cast<uint32_t>(1));  // hierarchy-locality mesh page packing by default
+		hashEnvironmentString("BASICRENDERER_CLOD_PAGE_PACKING");
 		return static_cast<uint64_t>(seed);
 	}
 
@@ -993,6 +1050,42 @@ namespace CLodCache {
 #endif
 	}
 
+	bool LoadMeshPagesSelectiveAsyncFileIo(
+		const std::wstring& containerPath,
+		std::span<const ClusterLODGroupDiskLocator> pageLocators,
+		uint32_t firstPage,
+		uint32_t pageCount,
+		const std::vector<bool>& pageNeedsFetch,
+		LoadedGroupPayload& outPayload,
+		std::string* outMessage)
+	{
+		const uint64_t endPage = static_cast<uint64_t>(firstPage) + static_cast<uint64_t>(pageCount);
+		if (endPage > pageLocators.size()) {
+			return false;
+		}
+		std::vector<uint32_t> pageIndices(pageCount);
+		for (uint32_t pageOffset = 0; pageOffset < pageCount; ++pageOffset) {
+			pageIndices[pageOffset] = firstPage + pageOffset;
+		}
+		return LoadPagesThroughAsyncFileIo(
+			containerPath,
+			pageLocators,
+			std::span<const uint32_t>(pageIndices.data(), pageIndices.size()),
+			pageNeedsFetch,
+			outPayload,
+			outMessage);
+	}
+
+	bool LoadMeshPagesSelectiveAsyncFileIo(
+		const std::wstring& containerPath,
+		std::span<const ClusterLODGroupDiskLocator> pageLocators,
+		std::span<const uint32_t> meshPageIndices,
+		const std::vector<bool>& pageNeedsFetch,
+		LoadedGroupPayload& outPayload,
+		std::string* outMessage)
+	{
+		return LoadPagesThroughAsyncFileIo(containerPath, pageLocators, meshPageIndices, pageNeedsFetch, outPayload, outMessage);
+	}
 
 	bool OpenContainerFile(const ClusterLODCacheSource& cacheSource,
 		std::ifstream& outFile,
@@ -0,0 +1,122 @@
+#include "Import/CLodReadScheduler.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace CLodCache {
+
+	void ReadScheduler::Clear()
+	{
+		m_reads.clear();
+		m_extents.clear();
+		m_stats = {};
+		m_built = false;
+	}
+
+	void ReadScheduler::AddRead(uint32_t requestIndex, uint32_t pageSlot, uint64_t offset, uint32_t sizeBytes)
+	{
+		if (m_built) {
+			Clear();
+		}
+		PageRead read{};
+		read.offset = offset;
+		read.sizeBytes = sizeBytes;
+		read.requestIndex = requestIndex;
+		read.pageSlot = pageSlot;
+		m_reads.push_back(read);
+	}
+
+	void ReadScheduler::Build()
+	{
+		m_extents.clear();
+		m_stats = {};
+		m_built = true;
+
+		std::sort(m_reads.begin(), m_reads.end(), [](const PageRead& a, const PageRead& b) {
+			if (a.offset != b.offset) {
+				return a.offset < b.offset;
+			}
+			if (a.requestIndex != b.requestIndex) {
+				return a.requestIndex < b.requestIndex;
+			}
+			return a.pageSlot < b.pageSlot;
+		});
+
+		const uint64_t maxReadBytes = (std::max)(m_options.maxReadBytes, 1u);
+		uint64_t extentEnd = 0;
+		for (uint32_t i = 0; i < static_cast<uint32_t>(m_reads.size()); ++i) {
+			const PageRead& read = m_reads[i];
+			const uint64_t readEnd = read.offset + read.sizeBytes;
+			m_stats.requestedBytes += read.sizeBytes;
+
+			if (!m_extents.empty()) {
+				ReadExtent& extent = m_extents.back();
+				const uint64_t mergedEnd = (std::max)(extentEnd, readEnd);
+				// Sorted by offset, so read.offset >= extent.offset.
+				const bool closeEnough = read.offset <= extentEnd + m_options.maxGapBytes;
+				if (closeEnough && mergedEnd - extent.offset <= maxReadBytes) {
+					extentEnd = mergedEnd;
+					extent.sizeBytes = static_cast<uint32_t>(extentEnd - extent.offset);
+					++extent.readCount;
+					continue;
+				}
+			}
+
+			ReadExtent extent{};
+			extent.offset = read.offset;
+			extent.sizeBytes = read.sizeBytes;
+			extent.firstRead = i;
+			extent.readCount = 1u;
+			m_extents.push_back(extent);
+			extentEnd = readEnd;
+		}
+
+		m_stats.pageReads = static_cast<uint32_t>(m_reads.size());
+		m_stats.issuedReads = static_cast<uint32_t>(m_extents.size());
+		for (const ReadExtent& extent : m_extents) {
+			m_stats.bytesRead += extent.sizeBytes;
+		}
+	}
+
+	std::span<const PageRead> ReadScheduler::ExtentReads(uint32_t extentIndex) const
+	{
+		if (extentIndex >= m_extents.size()) {
+			return {};
+		}
+		const ReadExtent& extent = m_extents[extentIndex];
+		return std::span<const PageRead>(m_reads.data() + extent.firstRead, extent.readCount);
+	}
+
+	bool ReadScheduler::Scatter(uint32_t extentIndex, std::span<const std::byte> data, const PageSink& sink) const
+	{
+		if (extentIndex >= m_extents.size()) {
+			return false;
+		}
+		const ReadExtent& extent = m_extents[extentIndex];
+		if (data.size() != extent.sizeBytes) {
+			return false;
+		}
+		for (const PageRead& read : ExtentReads(extentIndex)) {
+			sink(read.requestIndex, read.pageSlot, data.subspan(static_cast<size_t>(read.offset - extent.offset), read.sizeBytes));
+		}
+		return true;
+	}
+
+	bool ReadExtentFromStream(std::ifstream& file, const ReadExtent& extent, std::vector<std::byte>& outData)
+	{
+		if (extent.offset > static_cast<uint64_t>((std::numeric_limits<std::streamoff>::max)())) {
+			return false;
+		}
+		file.seekg(static_cast<std::streamoff>(extent.offset), std::ios::beg);
+		if (!file.good()) {
+			return false;
+		}
+		outData.resize(extent.sizeBytes);
+		if (extent.sizeBytes == 0u) {
+			return true;
+		}
+		file.read(reinterpret_cast<char*>(outData.data()), static_cast<std::streamsize>(extent.sizeBytes));
+		return file.good();
+	}
+
+}
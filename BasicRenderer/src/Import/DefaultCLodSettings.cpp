@@ -26,5 +26,7 @@ ClusterLODBuilderSettings GetDefaultBuilderSettings()
     settings.voxelFallbackCarryZeroCoverage = false;
     settings.voxelFallbackPruningMode = ClusterLODVoxelPruningMode::Coverage;
 
+    settings.pagePackingMode = ClusterLODPagePackingMode::HierarchyLocality;
+
     return settings;
 }
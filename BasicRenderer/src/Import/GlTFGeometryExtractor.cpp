@@ -1075,6 +1075,33 @@ MeshPreprocessResult BuildPrimitivePreprocessData(
 			meshIndex, primitiveIndex, vertexCount);
 	}
 
+	// Authored tangents let ClusterLOD skip MikkTSpace generation entirely.
+	if (attributes.contains("TANGENT")) {
+		const size_t tangentAccessorIndex = attributes["TANGENT"].get<size_t>();
+		const AccessorInfo tangentAccessor = GetAccessorInfo(doc.gltf, tangentAccessorIndex);
+		if (tangentAccessor.count == vertexCount && NumComponentsForType(tangentAccessor.type) == 4) {
+			std::vector<XMFLOAT4> tangents(vertexCount);
+			constexpr size_t kTangentChunkSize = 32768;
+			for (size_t firstVertex = 0; firstVertex < vertexCount; firstVertex += kTangentChunkSize) {
+				const size_t chunkVertexCount = std::min(kTangentChunkSize, vertexCount - firstVertex);
+				size_t stride = 0;
+				size_t components = 0;
+				int componentType = 0;
+				const auto tangentBytes = ReadAccessorRawWindow(doc, tangentAccessorIndex, firstVertex, chunkVertexCount, &stride, &components, &componentType);
+				const size_t componentBytes = BytesPerComponent(componentType);
+				for (size_t i = 0; i < chunkVertexCount; ++i) {
+					const size_t tangentBase = i * stride;
+					tangents[firstVertex + i] = XMFLOAT4(
+						static_cast<float>(ReadComponentAsDouble(tangentBytes, componentType, tangentBase + componentBytes * 0, tangentAccessor.normalized)),
+						static_cast<float>(ReadComponentAsDouble(tangentBytes, componentType, tangentBase + componentBytes * 1, tangentAccessor.normalized)),
+						static_cast<float>(ReadComponentAsDouble(tangentBytes, componentType, tangentBase + componentBytes * 2, tangentAccessor.normalized)),
+						static_cast<float>(ReadComponentAsDouble(tangentBytes, componentType, tangentBase + componentBytes * 3, tangentAccessor.normalized)));
+				}
+			}
+			ingest.SetSourceTangents(std::move(tangents));
+		}
+	}
+
 	ingest.ReserveVertices(vertexCount);
 
 	constexpr size_t kVertexChunkSize = 32768;
@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <array>
 #include <cctype>
+#include <chrono>
 #include <cstdint>
 #include <cstring>
 #include <filesystem>
@@ -19,11 +20,13 @@
 #include <nlohmann/json.hpp>
 #include <spdlog/spdlog.h>
 
+#include "Managers/Singletons/SettingsManager.h"
 #include "Managers/Singletons/TextureProcessingManager.h"
 #include "Animation/Animation.h"
 #include "Animation/AnimationController.h"
 #include "Animation/Skeleton.h"
 #include "Import/GlTFGeometryExtractor.h"
+#include "Import/Ktx2Transcoder.h"
 #include "Materials/Material.h"
 #include "Mesh/Mesh.h"
 #include "Mesh/MeshInstance.h"
@@ -106,11 +109,33 @@ struct GlbBinaryChunkSpan {
 
 struct GlTFMaterialCache {
     std::unordered_map<std::string, std::shared_ptr<TextureAsset>> textureCache;
+    // Decodes queued ahead of material construction, keyed like textureCache.
+    std::unordered_map<std::string, std::shared_ptr<TextureDecodeJobHandle>> textureDecodes;
+    std::vector<std::shared_ptr<TextureDecodeJobHandle>> issuedTextureDecodes;
     std::vector<std::shared_ptr<Material>> materialCache;
     std::vector<BufferSource> bufferSources;
     std::string sourceKey;
 };
 
+struct GlTFImageByteRange {
+    BufferSource source;
+    uint64_t offset = 0;
+    uint64_t size = 0;
+};
+
+struct GlTFTextureRequest {
+    size_t textureIndex = 0;
+    bool preferSRGB = false;
+    TextureSemantic semantic = TextureSemantic::Unknown;
+    bool preservePackedChannels = false;
+    NormalMapConvention normalConvention = NormalMapConvention::DirectX;
+};
+
+struct GlTFTextureCacheProbe {
+    TextureFileMeta meta;
+    std::string detail;
+};
+
 struct SharedTextureCacheEntry {
     std::weak_ptr<TextureAsset> texture;
 };
@@ -204,10 +229,15 @@ std::string BuildGlTFImageIdentity(
 }
 
 size_t ResolveTextureImageIndex(const json& textureNode) {
+    const bool hasBasisSource = textureNode.contains("extensions") && textureNode["extensions"].contains("KHR_texture_basisu");
+    // The KTX2 image is preferred; "source" is only a fallback for loaders that cannot transcode it.
+    if (hasBasisSource && Ktx2Transcoder::IsTranscoderAvailable()) {
+        return textureNode["extensions"]["KHR_texture_basisu"].at("source").get<size_t>();
+    }
     if (textureNode.contains("source")) {
         return textureNode["source"].get<size_t>();
     }
-    if (textureNode.contains("extensions") && textureNode["extensions"].contains("KHR_texture_basisu")) {
+    if (hasBasisSource) {
         return textureNode["extensions"]["KHR_texture_basisu"].at("source").get<size_t>();
     }
 
@@ -799,7 +829,8 @@ std::vector<std::string> BuildNodeAnimationKeys(const json& gltf) {
     return keys;
 }
 
-std::vector<uint8_t> ReadImageBytes(
+// Resolves an image to a self-contained byte range so it can be read off the loader thread.
+GlTFImageByteRange ResolveImageByteRange(
     const json& gltf,
     const std::filesystem::path& sourcePath,
     const std::vector<BufferSource>& bufferSources,
@@ -810,15 +841,23 @@ std::vector<uint8_t> ReadImageBytes(
         throw std::runtime_error("glTF image index out of range");
     }
 
+    GlTFImageByteRange range;
     const auto& image = images[imageIndex];
     if (image.contains("uri")) {
         const std::string uri = image["uri"].get<std::string>();
         if (uri.rfind("data:", 0) == 0) {
-            return DecodeDataUri(uri);
+            range.source.backing = BufferBacking::DataUri;
+            range.source.inlineBytes = DecodeDataUri(uri);
+            range.size = range.source.inlineBytes.size();
+            return range;
         }
 
         const auto imagePath = sourcePath.parent_path() / std::filesystem::path(uri);
-        return ReadFileRange(imagePath, 0, GetFileSize(imagePath));
+        range.source.backing = BufferBacking::FileSpan;
+        range.source.filePath = imagePath;
+        range.source.fileLength = GetFileSize(imagePath);
+        range.size = range.source.fileLength;
+        return range;
     }
 
     if (image.contains("bufferView")) {
@@ -836,12 +875,28 @@ std::vector<uint8_t> ReadImageBytes(
 
         const uint64_t byteOffset = bufferView.value<uint64_t>("byteOffset", 0);
         const uint64_t byteLength = bufferView.at("byteLength").get<uint64_t>();
-        return ReadBufferSlice(bufferSources[bufferIndex], byteOffset, byteLength);
+        const auto& source = bufferSources[bufferIndex];
+        if (source.backing == BufferBacking::FileSpan) {
+            range.source = source;
+            range.offset = byteOffset;
+            range.size = byteLength;
+            return range;
+        }
+
+        // Copy only the image slice out of an inline buffer rather than the whole buffer.
+        range.source.backing = BufferBacking::DataUri;
+        range.source.inlineBytes = ReadBufferSlice(source, byteOffset, byteLength);
+        range.size = range.source.inlineBytes.size();
+        return range;
     }
 
     throw std::runtime_error("glTF image has neither uri nor bufferView");
 }
 
+std::vector<uint8_t> ReadImageBytes(const GlTFImageByteRange& range) {
+    return ReadBufferSlice(range.source, range.offset, range.size);
+}
+
 rhi::AddressMode ConvertWrapMode(int wrapMode) {
     switch (wrapMode) {
     case 33071:
@@ -920,6 +975,66 @@ std::shared_ptr<Sampler> CreateTextureSampler(const json& gltf, const json& text
     return Sampler::CreateSampler(samplerDesc);
 }
 
+GlTFTextureCacheProbe BuildTextureCacheProbe(
+    const json& gltf,
+    const std::filesystem::path& sourcePath,
+    const GlTFMaterialCache& cache,
+    size_t imageIndex,
+    const std::string& cacheKey,
+    bool preferSRGB,
+    TextureSemantic semantic,
+    bool preservePackedChannels,
+    NormalMapConvention normalConvention)
+{
+    const auto& imageNode = gltf.at("images").at(imageIndex);
+    std::filesystem::path cacheProbePath = sourcePath;
+    GlTFTextureCacheProbe probe;
+    probe.detail = sourcePath.string();
+    if (imageNode.contains("uri")) {
+        const std::string uri = imageNode["uri"].get<std::string>();
+        if (uri.rfind("data:", 0) != 0) {
+            cacheProbePath = sourcePath.parent_path() / std::filesystem::path(uri);
+            probe.detail = cacheProbePath.string();
+        }
+        else {
+            probe.detail = cache.sourceKey + "#image-data-uri:" + std::to_string(imageIndex);
+        }
+    }
+    else if (imageNode.contains("bufferView")) {
+        probe.detail = BuildGlTFImageIdentity(gltf, sourcePath, cache.sourceKey, imageIndex);
+    }
+
+    probe.meta.filePath = cacheProbePath.string();
+    probe.meta.preferSRGB = preferSRGB;
+    probe.meta.processing = MakeMaterialTextureProcessingSettings(semantic, preferSRGB, cacheKey, preservePackedChannels, normalConvention);
+    return probe;
+}
+
+// KTX2 (KHR_texture_basisu) images transcode straight to the BC format of their
+// semantic and seed the conditioned texture cache, so later imports skip decoding.
+std::shared_ptr<TextureAsset> DecodeImageBytes(
+    const std::vector<uint8_t>& textureBytes,
+    const std::shared_ptr<Sampler>& sampler,
+    const GlTFTextureRequest& request,
+    const TextureFileMeta& cacheProbeMeta)
+{
+    if (!Ktx2Transcoder::IsKtx2Container(textureBytes.data(), textureBytes.size())) {
+        return LoadTextureFromMemory(textureBytes.data(), textureBytes.size(), sampler, {}, request.preferSRGB);
+    }
+
+    Ktx2Transcoder::TranscodeRequest transcodeRequest;
+    transcodeRequest.semantic = request.semantic;
+    transcodeRequest.preferSRGB = request.preferSRGB;
+    transcodeRequest.preservePackedChannels = request.preservePackedChannels;
+    const auto transcoded = Ktx2Transcoder::Transcode(textureBytes.data(), textureBytes.size(), transcodeRequest);
+
+    const std::wstring cachePath = TextureProcessingManager::GetInstance().StoreConditionedSourceData(*transcoded.sourceData, cacheProbeMeta);
+    if (!cachePath.empty()) {
+        spdlog::debug("GlTFLoader: KTX2 texture '{}' stored to conditioned cache '{}'", cacheProbeMeta.filePath, ws2s(cachePath));
+    }
+    return Ktx2Transcoder::CreateTextureAsset(transcoded, sampler);
+}
+
 std::shared_ptr<TextureAsset> LoadTexture(
     const json& gltf,
     const std::filesystem::path& sourcePath,
@@ -946,27 +1061,10 @@ std::shared_ptr<TextureAsset> LoadTexture(
 
     auto sampler = CreateTextureSampler(gltf, textureNode);
 
-    const auto& imageNode = gltf.at("images").at(imageIndex);
-    std::filesystem::path cacheProbePath = sourcePath;
-    std::string cacheProbeDetail = sourcePath.string();
-    if (imageNode.contains("uri")) {
-        const std::string uri = imageNode["uri"].get<std::string>();
-        if (uri.rfind("data:", 0) != 0) {
-            cacheProbePath = sourcePath.parent_path() / std::filesystem::path(uri);
-            cacheProbeDetail = cacheProbePath.string();
-        }
-        else {
-            cacheProbeDetail = cache.sourceKey + "#image-data-uri:" + std::to_string(imageIndex);
-        }
-    }
-    else if (imageNode.contains("bufferView")) {
-        cacheProbeDetail = BuildGlTFImageIdentity(gltf, sourcePath, cache.sourceKey, imageIndex);
-    }
-
-    TextureFileMeta cacheProbeMeta{};
-    cacheProbeMeta.filePath = cacheProbePath.string();
-    cacheProbeMeta.preferSRGB = preferSRGB;
-    cacheProbeMeta.processing = MakeMaterialTextureProcessingSettings(semantic, preferSRGB, cacheKey, preservePackedChannels, normalConvention);
+    const GlTFTextureCacheProbe cacheProbe = BuildTextureCacheProbe(
+        gltf, sourcePath, cache, imageIndex, cacheKey, preferSRGB, semantic, preservePackedChannels, normalConvention);
+    const TextureFileMeta& cacheProbeMeta = cacheProbe.meta;
+    const std::string& cacheProbeDetail = cacheProbe.detail;
 
     const std::string sharedCacheKey = cacheKey;
 
@@ -1001,8 +1099,30 @@ std::shared_ptr<TextureAsset> LoadTexture(
         }
     }
 
-    auto textureBytes = ReadImageBytes(gltf, sourcePath, cache.bufferSources, imageIndex);
-    auto texture = LoadTextureFromMemory(textureBytes.data(), textureBytes.size(), sampler, {}, preferSRGB);
+    std::shared_ptr<TextureAsset> texture;
+    auto pendingDecode = cache.textureDecodes.find(cacheKey);
+    if (pendingDecode != cache.textureDecodes.end()) {
+        auto decodeHandle = std::move(pendingDecode->second);
+        cache.textureDecodes.erase(pendingDecode);
+        if (semantic == TextureSemantic::BaseColor) {
+            // Base color alpha coverage picks the material technique, so it must be known now.
+            std::string decodeError;
+            texture = WaitForTextureDecode(decodeHandle, &decodeError);
+            if (!texture) {
+                throw std::runtime_error("Failed to decode glTF texture '" + cacheProbeDetail + "': " + decodeError);
+            }
+        }
+        else {
+            TextureFileMeta pendingMeta{};
+            pendingMeta.preferSRGB = preferSRGB;
+            texture = TextureAsset::CreatePendingDecode(std::move(decodeHandle), sampler, std::move(pendingMeta));
+        }
+    }
+    else {
+        const GlTFTextureRequest request{ textureIndex, preferSRGB, semantic, preservePackedChannels, normalConvention };
+        const auto textureBytes = ReadImageBytes(ResolveImageByteRange(gltf, sourcePath, cache.bufferSources, imageIndex));
+        texture = DecodeImageBytes(textureBytes, sampler, request, cacheProbeMeta);
+    }
     texture->Meta().filePath = cacheProbeMeta.filePath;
     texture->SetProcessingSettings(MakeMaterialTextureProcessingSettings(semantic, preferSRGB, cacheKey, preservePackedChannels, normalConvention));
     texture->SetGenerateMipmaps(true);
@@ -1171,6 +1291,167 @@ std::shared_ptr<Material> LoadMaterial(
     return cache.materialCache[materialIndex];
 }
 
+bool IsParallelImportTextureDecodeEnabled() {
+    static const SettingHandle<bool> parallelDecodeSetting = []() {
+        try {
+            return SettingsManager::GetInstance().getSettingHandle<bool>("parallelImportTextureDecode");
+        }
+        catch (...) {
+            return SettingHandle<bool>();
+        }
+    }();
+    return !parallelDecodeSetting.IsValid() || SettingsManager::GetInstance().getSnapshotOrLive(parallelDecodeSetting);
+}
+
+// Mirrors the LoadTexture arguments LoadMaterial passes for each texture slot.
+std::vector<GlTFTextureRequest> CollectMaterialTextureRequests(const json& materialNode) {
+    std::vector<GlTFTextureRequest> requests;
+    auto addRequest = [&](const json& parent, const char* slot, bool preferSRGB, TextureSemantic semantic, bool preservePackedChannels = false, NormalMapConvention normalConvention = NormalMapConvention::DirectX) {
+        if (!parent.contains(slot)) {
+            return;
+        }
+
+        GlTFTextureRequest request;
+        request.textureIndex = parent[slot].at("index").get<size_t>();
+        request.preferSRGB = preferSRGB;
+        request.semantic = semantic;
+        request.preservePackedChannels = preservePackedChannels;
+        request.normalConvention = normalConvention;
+        requests.push_back(request);
+    };
+
+    if (materialNode.contains("pbrMetallicRoughness")) {
+        const auto& pbr = materialNode["pbrMetallicRoughness"];
+        addRequest(pbr, "baseColorTexture", true, TextureSemantic::BaseColor);
+        addRequest(pbr, "metallicRoughnessTexture", false, TextureSemantic::MetallicRoughness, true);
+    }
+    addRequest(materialNode, "normalTexture", false, TextureSemantic::Normal, false, NormalMapConvention::OpenGL);
+    addRequest(materialNode, "occlusionTexture", false, TextureSemantic::AO);
+    addRequest(materialNode, "emissiveTexture", true, TextureSemantic::Emissive);
+    return requests;
+}
+
+void QueueTextureDecode(
+    const json& gltf,
+    const std::filesystem::path& sourcePath,
+    GlTFMaterialCache& cache,
+    const GlTFTextureRequest& request)
+{
+    const std::string cacheKey = BuildTextureResourceKey(
+        gltf, sourcePath, cache, request.textureIndex, request.preferSRGB, request.semantic, request.preservePackedChannels, request.normalConvention);
+    if (cache.textureCache.contains(cacheKey) || cache.textureDecodes.contains(cacheKey)) {
+        return;
+    }
+
+    const auto& textureNode = gltf.at("textures").at(request.textureIndex);
+    const size_t imageIndex = ResolveTextureImageIndex(textureNode);
+
+    // Processing-cache hits and live shared textures never decode, so leave them to LoadTexture.
+    const GlTFTextureCacheProbe cacheProbe = BuildTextureCacheProbe(
+        gltf, sourcePath, cache, imageIndex, cacheKey, request.preferSRGB, request.semantic, request.preservePackedChannels, request.normalConvention);
+    if (!TextureProcessingManager::GetInstance().GetExistingCachePathForFile(cacheProbe.meta).empty()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(g_gltfMaterialCacheMutex);
+        auto sharedIt = g_sharedTextureCache.find(cacheKey);
+        if (sharedIt != g_sharedTextureCache.end() && !sharedIt->second.texture.expired()) {
+            return;
+        }
+    }
+
+    auto sampler = CreateTextureSampler(gltf, textureNode);
+    auto byteRange = ResolveImageByteRange(gltf, sourcePath, cache.bufferSources, imageIndex);
+    auto decodeHandle = RequestTextureDecodeAsync(
+        cacheProbe.detail,
+        [byteRange = std::move(byteRange), sampler = std::move(sampler), request, cacheProbeMeta = cacheProbe.meta]() {
+            const auto textureBytes = ReadImageBytes(byteRange);
+            return DecodeImageBytes(textureBytes, sampler, request, cacheProbeMeta);
+        });
+    cache.textureDecodes.emplace(cacheKey, decodeHandle);
+    cache.issuedTextureDecodes.push_back(std::move(decodeHandle));
+}
+
+// Queues one decode per unique texture referenced by the primitives' materials so
+// the scheduler decodes them while the loader thread builds meshes and materials.
+void QueueMaterialTextureDecodes(
+    const json& gltf,
+    const std::filesystem::path& sourcePath,
+    GlTFMaterialCache& cache)
+{
+    if (!gltf.contains("materials") || !gltf["materials"].is_array() || !gltf.contains("meshes")) {
+        return;
+    }
+
+    const auto& materials = gltf["materials"];
+    std::vector<uint8_t> referencedMaterials(materials.size(), 0u);
+    for (const auto& meshNode : gltf["meshes"]) {
+        if (!meshNode.contains("primitives")) {
+            continue;
+        }
+        for (const auto& primitiveNode : meshNode["primitives"]) {
+            if (!primitiveNode.contains("material")) {
+                continue;
+            }
+            const size_t materialIndex = primitiveNode["material"].get<size_t>();
+            if (materialIndex < referencedMaterials.size()) {
+                referencedMaterials[materialIndex] = 1u;
+            }
+        }
+    }
+
+    for (size_t materialIndex = 0; materialIndex < materials.size(); ++materialIndex) {
+        if (referencedMaterials[materialIndex] == 0u || cache.materialCache[materialIndex] != nullptr) {
+            continue;
+        }
+        {
+            std::lock_guard<std::mutex> lock(g_gltfMaterialCacheMutex);
+            auto sharedIt = g_sharedMaterialCache.find(MakeMaterialCacheKey(cache.sourceKey, materialIndex));
+            if (sharedIt != g_sharedMaterialCache.end() && !sharedIt->second.material.expired()) {
+                continue;
+            }
+        }
+
+        for (const auto& request : CollectMaterialTextureRequests(materials[materialIndex])) {
+            try {
+                QueueTextureDecode(gltf, sourcePath, cache, request);
+            }
+            catch (const std::exception& e) {
+                // LoadTexture takes the synchronous path for this texture and reports the error there.
+                spdlog::warn("GlTFLoader: could not queue texture {} for parallel decode: {}", request.textureIndex, e.what());
+            }
+        }
+    }
+}
+
+void LogTextureDecodeSummary(const std::string& filePath, const GlTFMaterialCache& cache, double importMilliseconds) {
+    if (cache.issuedTextureDecodes.empty()) {
+        spdlog::info("GlTFLoader: imported '{}' in {:.1f} ms", filePath, importMilliseconds);
+        return;
+    }
+
+    size_t finishedCount = 0;
+    double decodeMilliseconds = 0.0;
+    for (const auto& decodeHandle : cache.issuedTextureDecodes) {
+        const TextureDecodeJobState state = decodeHandle->state.load(std::memory_order_acquire);
+        if (state != TextureDecodeJobState::Ready && state != TextureDecodeJobState::Failed) {
+            continue;
+        }
+        std::scoped_lock lock(decodeHandle->mutex);
+        decodeMilliseconds += decodeHandle->decodeMilliseconds;
+        ++finishedCount;
+    }
+
+    // Summed decode time approximates what the serial path would have spent decoding.
+    spdlog::info(
+        "GlTFLoader: imported '{}' in {:.1f} ms; {} textures queued for parallel decode, {} finished during import ({:.1f} ms summed decode time)",
+        filePath,
+        importMilliseconds,
+        cache.issuedTextureDecodes.size(),
+        finishedCount,
+        decodeMilliseconds);
+}
+
 std::shared_ptr<Material> ResolvePrimitiveMaterial(
     const json& gltf,
     const std::filesystem::path& sourcePath,
@@ -1565,6 +1846,7 @@ namespace GlTFLoader {
 
 std::shared_ptr<Scene> LoadModel(std::string filePath) {
     try {
+        const auto importStart = std::chrono::steady_clock::now();
         auto extraction = GlTFGeometryExtractor::ExtractAll(filePath);
         const std::filesystem::path sourcePath(filePath);
 
@@ -1576,6 +1858,9 @@ std::shared_ptr<Scene> LoadModel(std::string filePath) {
         if (extraction.gltf.contains("materials") && extraction.gltf["materials"].is_array()) {
             materialCache.materialCache.resize(extraction.gltf["materials"].size());
         }
+        if (IsParallelImportTextureDecodeEnabled()) {
+            QueueMaterialTextureDecodes(extraction.gltf, sourcePath, materialCache);
+        }
 
         // Build mesh/primitive structure from glTF JSON
         const size_t meshCount = extraction.gltf.contains("meshes") ? extraction.gltf["meshes"].size() : 0;
@@ -1711,6 +1996,10 @@ std::shared_ptr<Scene> LoadModel(std::string filePath) {
             scene->ProcessEntitySkins(true);
         }
 
+        LogTextureDecodeSummary(
+            filePath,
+            materialCache,
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - importStart).count());
         return scene;
     }
     catch (const std::exception& e) {
@@ -0,0 +1,251 @@
+#include "Import/Ktx2Transcoder.h"
+
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <DirectXTex.h>
+#include <spdlog/spdlog.h>
+
+#include <rhi_helpers.h>
+
+#if BASICRENDERER_HAS_BASISU
+#if __has_include(<basisu/transcoder/basisu_transcoder.h>)
+#include <basisu/transcoder/basisu_transcoder.h>
+#else
+#include <transcoder/basisu_transcoder.h>
+#endif
+#endif
+
+#include "Managers/Singletons/TaskSchedulerManager.h"
+#include "Resources/Sampler.h"
+
+namespace Ktx2Transcoder {
+
+namespace {
+
+constexpr uint8_t kKtx2Identifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n' };
+
+uint32_t CalcFullMipCount(uint32_t width, uint32_t height) {
+	uint32_t levels = 1u;
+	while (width > 1u || height > 1u) {
+		width = (std::max)(1u, width >> 1);
+		height = (std::max)(1u, height >> 1);
+		++levels;
+	}
+	return levels;
+}
+
+#if BASICRENDERER_HAS_BASISU
+
+struct TranscodeTarget {
+	basist::transcoder_texture_format basisFormat = basist::transcoder_texture_format::cTFBC7_RGBA;
+	DXGI_FORMAT dxgiFormat = DXGI_FORMAT_BC7_UNORM;
+	int channel0 = -1;
+	int channel1 = -1;
+};
+
+// Mirrors the formats TextureProcessingManager compresses each semantic to. ETC1S
+// colour maps go to BC1/BC3 because BC7 would not recover any quality ETC1S lost.
+TranscodeTarget ChooseTranscodeTarget(const TranscodeRequest& request, bool isUastc, bool hasAlpha) {
+	TranscodeTarget target;
+	switch (request.semantic) {
+	case TextureSemantic::Normal:
+		// toktx --normal_mode stores X in RGB and Y in A; plain RGB normal maps keep Y in G.
+		target.basisFormat = basist::transcoder_texture_format::cTFBC5_RG;
+		target.dxgiFormat = DXGI_FORMAT_BC5_UNORM;
+		target.channel0 = 0;
+		target.channel1 = hasAlpha ? 3 : 1;
+		return target;
+	case TextureSemantic::AO:
+	case TextureSemantic::Opacity:
+	case TextureSemantic::Metallic:
+	case TextureSemantic::Roughness:
+	case TextureSemantic::Height:
+	case TextureSemantic::OpenPBRScalar:
+		if (!request.preservePackedChannels) {
+			target.basisFormat = basist::transcoder_texture_format::cTFBC4_R;
+			target.dxgiFormat = DXGI_FORMAT_BC4_UNORM;
+			return target;
+		}
+		target.basisFormat = basist::transcoder_texture_format::cTFBC7_RGBA;
+		target.dxgiFormat = DXGI_FORMAT_BC7_UNORM;
+		return target;
+	case TextureSemantic::MetallicRoughness:
+		target.basisFormat = basist::transcoder_texture_format::cTFBC7_RGBA;
+		target.dxgiFormat = DXGI_FORMAT_BC7_UNORM;
+		return target;
+	default:
+		break;
+	}
+
+	if (isUastc) {
+		target.basisFormat = basist::transcoder_texture_format::cTFBC7_RGBA;
+		target.dxgiFormat = request.preferSRGB ? DXGI_FORMAT_BC7_UNORM_SRGB : DXGI_FORMAT_BC7_UNORM;
+	}
+	else if (hasAlpha) {
+		target.basisFormat = basist::transcoder_texture_format::cTFBC3_RGBA;
+		target.dxgiFormat = request.preferSRGB ? DXGI_FORMAT_BC3_UNORM_SRGB : DXGI_FORMAT_BC3_UNORM;
+	}
+	else {
+		target.basisFormat = basist::transcoder_texture_format::cTFBC1_RGB;
+		target.dxgiFormat = request.preferSRGB ? DXGI_FORMAT_BC1_UNORM_SRGB : DXGI_FORMAT_BC1_UNORM;
+	}
+	return target;
+}
+
+void EnsureTranscoderInitialized() {
+	static std::once_flag initOnce;
+	std::call_once(initOnce, []() {
+		basist::basisu_transcoder_init();
+	});
+}
+
+#endif
+
+}
+
+bool IsKtx2Container(const void* bytes, size_t byteCount) {
+	return bytes != nullptr &&
+		byteCount >= sizeof(kKtx2Identifier) &&
+		std::memcmp(bytes, kKtx2Identifier, sizeof(kKtx2Identifier)) == 0;
+}
+
+bool IsTranscoderAvailable() {
+#if BASICRENDERER_HAS_BASISU
+	return true;
+#else
+	return false;
+#endif
+}
+
+TranscodeResult Transcode(const void* bytes, size_t byteCount, const TranscodeRequest& request) {
+	if (!IsKtx2Container(bytes, byteCount)) {
+		throw std::runtime_error("Ktx2Transcoder: buffer is not a KTX2 container");
+	}
+
+#if BASICRENDERER_HAS_BASISU
+	EnsureTranscoderInitialized();
+
+	basist::ktx2_transcoder transcoder;
+	if (!transcoder.init(bytes, static_cast<uint32_t>(byteCount))) {
+		throw std::runtime_error("Ktx2Transcoder: failed to parse KTX2 header");
+	}
+	if (!transcoder.is_etc1s() && !transcoder.is_uastc()) {
+		throw std::runtime_error("Ktx2Transcoder: KTX2 payload is not Basis Universal ETC1S or UASTC");
+	}
+	if (!transcoder.start_transcoding()) {
+		throw std::runtime_error("Ktx2Transcoder: failed to start transcoding");
+	}
+
+	const uint32_t levels = (std::max)(1u, transcoder.get_levels());
+	const uint32_t layers = (std::max)(1u, transcoder.get_layers());
+	const uint32_t faces = (std::max)(1u, transcoder.get_faces());
+	const uint32_t slices = layers * faces;
+	const size_t subresourceCount = static_cast<size_t>(slices) * levels;
+
+	TranscodeResult result;
+	result.hasAlpha = transcoder.get_has_alpha();
+	result.isUastc = transcoder.is_uastc();
+
+	const TranscodeTarget target = ChooseTranscodeTarget(request, result.isUastc, result.hasAlpha);
+	const uint32_t bytesPerBlock = basist::basis_get_bytes_per_block_or_pixel(target.basisFormat);
+
+	auto sourceData = std::make_shared<TextureSourceData>();
+	sourceData->desc.format = rhi::helpers::ToRHI(target.dxgiFormat);
+	sourceData->desc.channels = static_cast<unsigned short>(rhi::helpers::FormatChannelCount(sourceData->desc.format));
+	sourceData->desc.isCubemap = faces == 6u;
+	sourceData->desc.isArray = layers > 1u && !sourceData->desc.isCubemap;
+	sourceData->desc.arraySize = layers;
+	sourceData->desc.generateMipMaps = false;
+	sourceData->desc.imageDimensions.resize(subresourceCount);
+	sourceData->subresources.resize(subresourceCount);
+
+	// Subresources are slice-major (every level of slice 0, then slice 1, ...), matching DirectXTex.
+	std::vector<basist::ktx2_image_level_info> levelInfos(subresourceCount);
+	for (uint32_t slice = 0; slice < slices; ++slice) {
+		for (uint32_t level = 0; level < levels; ++level) {
+			const size_t index = static_cast<size_t>(slice) * levels + level;
+			if (!transcoder.get_image_level_info(levelInfos[index], level, slice / faces, slice % faces)) {
+				throw std::runtime_error("Ktx2Transcoder: failed to query level " + std::to_string(level));
+			}
+
+			const auto& info = levelInfos[index];
+			ImageDimensions& dims = sourceData->desc.imageDimensions[index];
+			dims.width = info.m_orig_width;
+			dims.height = info.m_orig_height;
+			dims.rowPitch = static_cast<size_t>(info.m_num_blocks_x) * bytesPerBlock;
+			dims.slicePitch = dims.rowPitch * info.m_num_blocks_y;
+		}
+	}
+
+	std::vector<uint8_t> failed(subresourceCount, 0u);
+	TaskSchedulerManager::GetInstance().ParallelFor("Ktx2Transcoder::TranscodeLevels", subresourceCount, [&](size_t index) {
+		const auto& info = levelInfos[index];
+		auto blocks = std::make_shared<std::vector<uint8_t>>(static_cast<size_t>(info.m_total_blocks) * bytesPerBlock);
+
+		// Each task needs its own state; the transcoder itself is shared read-only.
+		basist::ktx2_transcoder_state state;
+		if (!transcoder.transcode_image_level(
+				info.m_level_index,
+				info.m_layer_index,
+				info.m_face_index,
+				blocks->data(),
+				info.m_total_blocks,
+				target.basisFormat,
+				0,
+				0,
+				0,
+				target.channel0,
+				target.channel1,
+				&state)) {
+			failed[index] = 1u;
+			return;
+		}
+		sourceData->subresources[index] = std::move(blocks);
+	});
+
+	const auto failedIt = std::find(failed.begin(), failed.end(), uint8_t{ 1u });
+	if (failedIt != failed.end()) {
+		const size_t index = static_cast<size_t>(failedIt - failed.begin());
+		throw std::runtime_error("Ktx2Transcoder: failed to transcode level " + std::to_string(levelInfos[index].m_level_index));
+	}
+
+	sourceData->isBlockCompressed = true;
+	sourceData->hasFullMipChain = levels == CalcFullMipCount(transcoder.get_width(), transcoder.get_height());
+	result.sourceData = std::move(sourceData);
+	return result;
+#else
+	(void)request;
+	throw std::runtime_error("Ktx2Transcoder: built without Basis Universal support (BASICRENDERER_ENABLE_BASISU)");
+#endif
+}
+
+std::shared_ptr<TextureAsset> CreateTextureAsset(const TranscodeResult& result, std::shared_ptr<Sampler> sampler) {
+	if (!result.sourceData) {
+		throw std::runtime_error("Ktx2Transcoder: no transcoded data");
+	}
+
+	if (!sampler) {
+		sampler = Sampler::GetDefaultSampler();
+	}
+
+	TextureFileMeta meta{};
+	meta.fileType = ImageFiletype::KTX2;
+	meta.loader = ImageLoader::BasisUniversal;
+	meta.alphaIsAllOpaque = !result.hasAlpha;
+	meta.preferSRGB = rhi::helpers::IsSRGB(result.sourceData->desc.format);
+
+	auto texture = TextureAsset::CreateShared(result.sourceData->desc, result.sourceData->subresources, std::move(sampler), std::move(meta));
+	texture->RecordLoadPath(
+		TextureLoadPathTelemetry::InMemoryContainer,
+		result.isUastc
+			? "texture transcoded from in-memory KTX2 UASTC container"
+			: "texture transcoded from in-memory KTX2 ETC1S container");
+	return texture;
+}
+
+}
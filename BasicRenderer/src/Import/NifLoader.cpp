@@ -11,8 +11,11 @@ namespace NifLoader {
 
 std::shared_ptr<Scene> LoadModel(std::string filePath, const USDLoader::ImportSettings& settings)
 {
+    BRNiflyClient::ClientOptions clientOptions{};
+    clientOptions.preferredPayload = BRNiflyClient::PayloadFormat::UsdcFile;
+
     std::string errorMessage;
-    auto package = BRNiflyClient::ConvertNifToUsd(filePath, {}, &errorMessage);
+    auto package = BRNiflyClient::ConvertNifToUsd(filePath, clientOptions, &errorMessage);
     if (!package) {
         spdlog::error("NIF import failed for '{}': {}", filePath, errorMessage);
         return nullptr;
@@ -33,8 +36,14 @@ std::shared_ptr<Scene> LoadModel(std::string filePath, const USDLoader::ImportSe
     USDLoader::InMemoryStageOptions options{};
     options.sourceIdentifier = package->sourceIdentifier;
     options.sourceDirectory = std::filesystem::path(filePath).parent_path().string();
-    options.layerIdentifierHint = "brnifly_" + package->contentHash + ".usda";
+    if (package->payloadFormat == BRNiflyClient::PayloadFormat::UsdcFile) {
+        options.layerIdentifierHint = "brnifly_" + package->contentHash + ".usdc";
+        auto scene = USDLoader::LoadModelFromUsdFile(package->rootLayerFile, options, settings);
+        BRNiflyClient::ReleasePayload(*package);
+        return scene;
+    }
 
+    options.layerIdentifierHint = "brnifly_" + package->contentHash + ".usda";
     return USDLoader::LoadModelFromUsdBytes(package->rootLayerText, options, settings);
 }
 
@@ -0,0 +1,74 @@
+#include "Import/SkinInfluencePacker.h"
+
+#include <algorithm>
+#include <cstring>
+
+void SkinInfluencePacker::Reset(uint32_t vertexCount)
+{
+	m_vertexCount = vertexCount;
+	m_scattering = false;
+	m_maxInfluenceCount = 0;
+	m_truncatedVertexCount = 0;
+	m_offsets.assign(static_cast<size_t>(vertexCount) + 1u, 0u);
+	m_cursor.clear();
+	m_influences.clear();
+}
+
+void SkinInfluencePacker::BeginScatter()
+{
+	for (uint32_t vertex = 0; vertex < m_vertexCount; ++vertex) {
+		m_offsets[vertex + 1u] += m_offsets[vertex];
+	}
+	m_cursor.assign(m_offsets.begin(), m_offsets.end() - 1);
+	m_influences.resize(m_offsets[m_vertexCount]);
+	m_scattering = true;
+}
+
+void SkinInfluencePacker::Pack(std::byte* dst, size_t strideBytes)
+{
+	if (!m_scattering) {
+		BeginScatter();
+	}
+
+	m_maxInfluenceCount = 0;
+	m_truncatedVertexCount = 0;
+	for (uint32_t vertex = 0; vertex < m_vertexCount; ++vertex) {
+		Influence* first = m_influences.data() + m_offsets[vertex];
+		// The cursor, not the next offset, so an uncounted or missed weight leaves no stale slot.
+		const uint32_t count = m_cursor[vertex] - m_offsets[vertex];
+		m_maxInfluenceCount = (std::max)(m_maxInfluenceCount, count);
+
+		// Runs are a few entries long; insertion sort keeps joint order on ties.
+		for (uint32_t i = 1; i < count; ++i) {
+			const Influence value = first[i];
+			uint32_t j = i;
+			while (j > 0 && first[j - 1].weight < value.weight) {
+				first[j] = first[j - 1];
+				--j;
+			}
+			first[j] = value;
+		}
+
+		const uint32_t kept = (std::min)(count, kMaxInfluences);
+		if (count > kMaxInfluences) {
+			++m_truncatedVertexCount;
+		}
+
+		float weightSum = 0.0f;
+		for (uint32_t i = 0; i < kept; ++i) {
+			weightSum += first[i].weight;
+		}
+		const float invWeightSum = weightSum > 0.0f ? (1.0f / weightSum) : 0.0f;
+
+		uint32_t joints[kMaxInfluences] = {};
+		float weights[kMaxInfluences] = {};
+		for (uint32_t i = 0; i < kept; ++i) {
+			joints[i] = first[i].joint;
+			weights[i] = first[i].weight * invWeightSum;
+		}
+
+		std::byte* out = dst + static_cast<size_t>(vertex) * strideBytes;
+		std::memcpy(out, joints, sizeof(joints));
+		std::memcpy(out + sizeof(joints), weights, sizeof(weights));
+	}
+}
@@ -58,6 +58,7 @@
 #include "Resources/Sampler.h"
 #include "Import/Filetypes.h"
 #include "Scene/Scene.h"
+#include "Scene/InstanceClusters.h"
 #include "Mesh/Mesh.h"
 #include "Mesh/ClusterLODUtilities.h"
 #include "Animation/Skeleton.h"
@@ -199,23 +200,16 @@ namespace USDLoader {
 
 	LoadingCaches loadingCache;
 
-	static uint32_t GetUsdPointInstancerMaxInstances() {
-		static std::function<uint32_t(void)> getMaxInstances;
-		if (!getMaxInstances) {
+	static bool IsParallelImportTextureDecodeEnabled() {
+		static const SettingHandle<bool> parallelDecodeSetting = []() {
 			try {
-				getMaxInstances = SettingsManager::GetInstance().getSettingGetter<uint32_t>("usdPointInstancerMaxInstances");
+				return SettingsManager::GetInstance().getSettingHandle<bool>("parallelImportTextureDecode");
 			}
 			catch (...) {
-				return 0u;
+				return SettingHandle<bool>();
 			}
-		}
-
-		try {
-			return getMaxInstances();
-		}
-		catch (...) {
-			return 0u;
-		}
+		}();
+		return !parallelDecodeSetting.IsValid() || SettingsManager::GetInstance().getSnapshotOrLive(parallelDecodeSetting);
 	}
 
 	static UsdTimeCode GetUsdGeometrySampleTime(const UsdStageRefPtr& stage) {
@@ -226,14 +220,7 @@ namespace USDLoader {
 		return UsdTimeCode::Default();
 	}
 
-	struct PointInstancerPrototypeRenderable {
-		std::vector<std::shared_ptr<Mesh>> meshes;
-		GfMatrix4d localTransform = GfMatrix4d(1.0);
-		std::string name;
-	};
-
-	static void SetEntityTransformFromUsdMatrix(
-		flecs::entity entity,
+	static InstanceClusterSet::Transform DecomposeUsdMatrix(
 		const GfMatrix4d& matrix,
 		double metersPerUnit)
 	{
@@ -242,25 +229,55 @@ namespace USDLoader {
 		const GfQuaternion rotation = transform.GetRotation().GetQuaternion();
 		const GfVec3d scale = transform.GetScale();
 
-		entity.set<Components::Position>({
-			DirectX::XMFLOAT3(
-				static_cast<float>(translation[0] * metersPerUnit),
-				static_cast<float>(translation[1] * metersPerUnit),
-				static_cast<float>(translation[2] * metersPerUnit))
-			});
-		entity.set<Components::Rotation>({
-			DirectX::XMFLOAT4(
-				static_cast<float>(rotation.GetImaginary()[0]),
-				static_cast<float>(rotation.GetImaginary()[1]),
-				static_cast<float>(rotation.GetImaginary()[2]),
-				static_cast<float>(rotation.GetReal()))
-			});
-		entity.set<Components::Scale>({
-			DirectX::XMFLOAT3(
-				static_cast<float>(scale[0]),
-				static_cast<float>(scale[1]),
-				static_cast<float>(scale[2]))
-			});
+		InstanceClusterSet::Transform result;
+		result.position = DirectX::XMFLOAT3(
+			static_cast<float>(translation[0] * metersPerUnit),
+			static_cast<float>(translation[1] * metersPerUnit),
+			static_cast<float>(translation[2] * metersPerUnit));
+		result.rotation = DirectX::XMFLOAT4(
+			static_cast<float>(rotation.GetImaginary()[0]),
+			static_cast<float>(rotation.GetImaginary()[1]),
+			static_cast<float>(rotation.GetImaginary()[2]),
+			static_cast<float>(rotation.GetReal()));
+		result.scale = DirectX::XMFLOAT3(
+			static_cast<float>(scale[0]),
+			static_cast<float>(scale[1]),
+			static_cast<float>(scale[2]));
+		return result;
+	}
+
+	static void SetEntityTransformFromUsdMatrix(
+		flecs::entity entity,
+		const GfMatrix4d& matrix,
+		double metersPerUnit)
+	{
+		const InstanceClusterSet::Transform transform = DecomposeUsdMatrix(matrix, metersPerUnit);
+		entity.set<Components::Position>({ transform.position });
+		entity.set<Components::Rotation>({ transform.rotation });
+		entity.set<Components::Scale>({ transform.scale });
+	}
+
+	static float MaxAbsScale(const DirectX::XMFLOAT3& scale) {
+		return (std::max)({ std::abs(scale.x), std::abs(scale.y), std::abs(scale.z) });
+	}
+
+	// Radius about the instance pivot that holds every mesh of the prototype.
+	static float ComputePrototypeRadius(const std::vector<InstanceClusterSet::PrototypeRenderable>& renderables) {
+		float radius = 0.0f;
+		for (const auto& renderable : renderables) {
+			const InstanceClusterSet::Transform& local = renderable.localTransform;
+			const DirectX::XMMATRIX localMatrix = DirectX::XMMatrixAffineTransformation(
+				DirectX::XMLoadFloat3(&local.scale),
+				DirectX::XMVectorZero(),
+				DirectX::XMLoadFloat4(&local.rotation),
+				DirectX::XMLoadFloat3(&local.position));
+			for (const auto& mesh : renderable.meshes) {
+				const DirectX::XMFLOAT4& sphere = mesh->GetPerMeshCBData().boundingSphere.sphere;
+				const DirectX::XMVECTOR center = DirectX::XMVector3Transform(DirectX::XMVectorSet(sphere.x, sphere.y, sphere.z, 1.0f), localMatrix);
+				radius = (std::max)(radius, DirectX::XMVectorGetX(DirectX::XMVector3Length(center)) + sphere.w * MaxAbsScale(local.scale));
+			}
+		}
+		return radius;
 	}
 
 	static void ApplyPointInstancerPScaleFallback(
@@ -876,12 +893,36 @@ namespace USDLoader {
 								"Unable to open asset at " + logicalPath);
 						}
 
-						auto tex = LoadTextureFromMemory(
-							static_cast<const void*>(arAsset->GetBuffer().get()),
-							arAsset->GetSize(),
-							nullptr,
-							{},              // default flags; loader will force WIC sRGB/linear as needed
-							preferSRGB);
+						std::shared_ptr<TextureAsset> tex;
+						// Base color alpha picks the material technique and normal negation reads the
+						// container type, so only the remaining slots decode behind a placeholder.
+						if (IsParallelImportTextureDecodeEnabled() &&
+							semantic != TextureSemantic::BaseColor &&
+							semantic != TextureSemantic::Normal) {
+							auto sampler = Sampler::GetDefaultSampler();
+							auto decodeHandle = RequestTextureDecodeAsync(
+								resolved.GetPathString(),
+								[arAsset, sampler, preferSRGB]() {
+									return LoadTextureFromMemory(
+										static_cast<const void*>(arAsset->GetBuffer().get()),
+										arAsset->GetSize(),
+										sampler,
+										{},
+										preferSRGB);
+								});
+							TextureFileMeta pendingMeta{};
+							pendingMeta.filePath = resolved.GetPathString();
+							pendingMeta.preferSRGB = preferSRGB;
+							tex = TextureAsset::CreatePendingDecode(std::move(decodeHandle), std::move(sampler), std::move(pendingMeta));
+						}
+						else {
+							tex = LoadTextureFromMemory(
+								static_cast<const void*>(arAsset->GetBuffer().get()),
+								arAsset->GetSize(),
+								nullptr,
+								{},              // default flags; loader will force WIC sRGB/linear as needed
+								preferSRGB);
+						}
 						tex->SetProcessingSettings(MakeMaterialTextureProcessingSettings(semantic, preferSRGB, cacheKey, false, normalConvention));
 
 						tex->SetGenerateMipmaps(true); // TODO: There will be textures where we don't want this
@@ -1790,18 +1831,9 @@ namespace USDLoader {
 				emittedCount);
 		}
 
-		const uint32_t maxInstances = GetUsdPointInstancerMaxInstances();
-		if (maxInstances > 0u && emittedCount > static_cast<size_t>(maxInstances)) {
-			spdlog::warn(
-				"Skipping PointInstancer '{}' because it would emit {} instances (limit {}).",
-				pointInstancer.GetPrim().GetPath().GetString(),
-				emittedCount,
-				maxInstances);
-			return;
-		}
-
 		UsdGeomXformCache xformCache(timeCode);
-		std::vector<std::vector<PointInstancerPrototypeRenderable>> renderablesByPrototype;
+		auto clusterSet = std::make_shared<InstanceClusterSet>();
+		auto& renderablesByPrototype = clusterSet->prototypes;
 		renderablesByPrototype.resize(prototypeTargets.size());
 
 		for (size_t prototypeIndex = 0; prototypeIndex < prototypeTargets.size(); ++prototypeIndex) {
@@ -1826,10 +1858,10 @@ namespace USDLoader {
 				std::vector<std::shared_ptr<Mesh>> prototypePrimMeshes;
 				ProcessMeshAndAnimations(prototypePrim, prototypePrimMeshes, skelCache, stage, scene, metersPerUnit, upRot, directory, isUSDZ);
 				if (!prototypePrimMeshes.empty()) {
-					PointInstancerPrototypeRenderable renderable;
+					InstanceClusterSet::PrototypeRenderable renderable;
 					renderable.meshes = std::move(prototypePrimMeshes);
-					renderable.localTransform = xformCache.GetLocalToWorldTransform(prototypePrim) * prototypeRootWorldInverse;
-					renderable.name = prototypePrim.GetName().GetString();
+					renderable.localTransform = DecomposeUsdMatrix(xformCache.GetLocalToWorldTransform(prototypePrim) * prototypeRootWorldInverse, metersPerUnit);
+					renderable.name = s2ws(prototypePrim.GetName().GetString());
 					renderablesByPrototype[prototypeIndex].push_back(std::move(renderable));
 				}
 
@@ -1847,35 +1879,56 @@ namespace USDLoader {
 			}
 		}
 
-		const std::string baseName = pointInstancer.GetPrim().GetName().GetString();
+		const std::wstring baseName = s2ws(pointInstancer.GetPrim().GetName().GetString());
+		clusterSet->name = baseName;
+		clusterSet->drawablePrototypes.resize(renderablesByPrototype.size());
+		std::vector<float> prototypeRadii(renderablesByPrototype.size());
+		for (size_t prototypeIndex = 0; prototypeIndex < renderablesByPrototype.size(); ++prototypeIndex) {
+			auto& prototypeRenderables = renderablesByPrototype[prototypeIndex];
+			for (auto& prototypeRenderable : prototypeRenderables) {
+				if (prototypeRenderable.name.empty()) {
+					prototypeRenderable.name = baseName;
+				}
+			}
+			clusterSet->drawablePrototypes[prototypeIndex] = prototypeRenderables.empty() ? 0u : 1u;
+			prototypeRadii[prototypeIndex] = ComputePrototypeRadius(prototypeRenderables);
+		}
 
+		// Group instances into spatial clusters of one prototype in the
+		// instancer entity's space. Out-of-range proto indices get their own
+		// bucket, which is never drawn.
+		clusterSet->instances.resize(emittedCount);
+		std::vector<InstanceClusterBVH::Float3> instancePivots(emittedCount);
+		std::vector<float> instanceRadii(emittedCount);
+		std::vector<uint32_t> instancePrototypes(emittedCount);
+		const uint32_t invalidPrototype = static_cast<uint32_t>(renderablesByPrototype.size());
+		size_t drawableCount = 0;
 		for (size_t instanceIndex = 0; instanceIndex < emittedCount; ++instanceIndex) {
+			const InstanceClusterSet::Transform& transform = clusterSet->instances[instanceIndex] = DecomposeUsdMatrix(instanceTransforms[instanceIndex], metersPerUnit);
+			instancePivots[instanceIndex] = { transform.position.x, transform.position.y, transform.position.z };
 			const int prototypeIndex = protoIndices[instanceIndex];
 			if (prototypeIndex < 0 || static_cast<size_t>(prototypeIndex) >= renderablesByPrototype.size()) {
 				spdlog::warn("PointInstancer '{}' has out-of-range proto index {} at instance {}.",
 					pointInstancer.GetPrim().GetPath().GetString(),
 					prototypeIndex,
 					instanceIndex);
+				instancePrototypes[instanceIndex] = invalidPrototype;
 				continue;
 			}
-
-			auto& prototypeRenderables = renderablesByPrototype[prototypeIndex];
-			if (prototypeRenderables.empty()) {
-				continue;
-			}
-
-			auto instanceEntity = scene->CreateNodeECS(s2ws(baseName + "_instance_" + std::to_string(instanceIndex)));
-			SetEntityTransformFromUsdMatrix(instanceEntity, instanceTransforms[instanceIndex], metersPerUnit);
-			instanceEntity.child_of(instancerEntity);
-
-			for (const auto& prototypeRenderable : prototypeRenderables) {
-				auto renderableEntity = scene->CreateRenderableEntityECS(
-					prototypeRenderable.meshes,
-					s2ws(prototypeRenderable.name.empty() ? baseName : prototypeRenderable.name));
-				SetEntityTransformFromUsdMatrix(renderableEntity, prototypeRenderable.localTransform, metersPerUnit);
-				renderableEntity.child_of(instanceEntity);
-			}
+			instancePrototypes[instanceIndex] = static_cast<uint32_t>(prototypeIndex);
+			instanceRadii[instanceIndex] = prototypeRadii[prototypeIndex] * MaxAbsScale(transform.scale);
+			drawableCount += clusterSet->drawablePrototypes[prototypeIndex];
 		}
+		clusterSet->bvh.Build(instancePivots, instanceRadii, instancePrototypes);
+
+		// No instance entities are created here. Once the scene is active, it
+		// materializes the clusters the camera sees, up to
+		// usdPointInstancerMaxInstances per instancer.
+		spdlog::info("PointInstancer '{}' streams {} drawable instances from {} clusters.",
+			pointInstancer.GetPrim().GetPath().GetString(),
+			drawableCount,
+			clusterSet->bvh.GetClusters().size());
+		instancerEntity.set<Components::InstanceClusters>({ std::move(clusterSet) });
 	}
 
 	void ParseNodeHierarchy(std::shared_ptr<Scene> scene,
@@ -2099,6 +2152,26 @@ namespace USDLoader {
 		return LoadModelFromStage(stage, options, importSettings);
 	}
 
+	std::shared_ptr<Scene> LoadModelFromUsdFile(
+		const std::string& layerPath,
+		const InMemoryStageOptions& options,
+		const ImportSettings& importSettings) {
+		const std::string identifierHint = options.layerIdentifierHint.empty() ? std::filesystem::path(layerPath).filename().string() : options.layerIdentifierHint;
+		SdfLayerRefPtr rootLayer = SdfLayer::OpenAsAnonymous(layerPath, false, identifierHint);
+		if (!rootLayer) {
+			spdlog::error("Failed to open USD layer file '{}'.", layerPath);
+			return nullptr;
+		}
+
+		UsdStageRefPtr stage = UsdStage::Open(rootLayer);
+		if (!stage) {
+			spdlog::error("Failed to open USD stage for layer file '{}'.", layerPath);
+			return nullptr;
+		}
+
+		return LoadModelFromStage(stage, options, importSettings);
+	}
+
 	std::shared_ptr<Scene> LoadModel(std::string filePath) {
 		return LoadModel(std::move(filePath), ImportSettings{});
 	}
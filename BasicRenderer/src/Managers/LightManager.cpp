@@ -7,6 +7,7 @@
 #include "Managers/Singletons/DeletionManager.h"
 #include "Managers/Singletons/RendererECSManager.h"
 #include "Managers/ViewManager.h"
+#include "Managers/Singletons/TaskSchedulerManager.h"
 #include "Resources/Buffers/SortedUnsignedIntBuffer.h"
 #include "Render/GraphExtensions/CLodTelemetry.h"
 #include "Render/GraphExtensions/ClusterLOD/CLodCommon.h"
@@ -35,6 +36,7 @@ LightManager::LightManager() {
 	getShadowResolution = SettingsManager::GetInstance().getSettingGetter<uint16_t>("shadowResolution");
 	getDirectionalVirtualShadowSourceAngleDegrees = SettingsManager::GetInstance().getSettingGetter<float>(
 		CLodDirectionalVirtualShadowSourceAngleDegreesSettingName);
+	getDirectionalShadowVerticalExtent = SettingsManager::GetInstance().getSettingGetter<float>("directionalShadowVerticalExtent");
 
 	m_pLightViewInfoResourceGroup = std::make_shared<ResourceGroup>("LightViewInfo");
 	m_pLightViewInfoResourceGroup->AddResource(m_spotViewInfo);
@@ -253,9 +255,7 @@ LightManager::CreateDirectionalLightViewInfo(const LightInfo& info, uint64_t ent
 		camera.zFar);
 
 	// Virtual shadow clip levels are nested around the primary camera.
-	const float clipVerticalExtent = std::max(
-		SettingsManager::GetInstance().getSettingGetter<float>("directionalShadowVerticalExtent")(),
-		1.0f);
+	const float clipVerticalExtent = std::max(getDirectionalShadowVerticalExtent(), 1.0f);
 	auto cascades = setupDirectionalClipmaps(numCascades, info.dirWorldSpace,
 		DirectX::XMLoadFloat3(&posFloats), 
 		GetForwardFromMatrix(matrix),
@@ -319,10 +319,8 @@ LightManager::CreateDirectionalLightViewInfo(const LightInfo& info, uint64_t ent
 }
 
 void LightManager::RebuildDirectionalLightViewInfoBuffer(std::optional<uint64_t> excludedLightEntityId) {
-	while (m_directionalViewInfo->Size() > 0) {
-		m_directionalViewInfo->RemoveAt(m_directionalViewInfo->Size() - 1);
-	}
-
+	// Rewrite only the entries that moved; removing a light shifts the ones after it.
+	uint32_t writeIndex = 0;
 	auto& world = RendererECSManager::GetInstance().GetWorld();
 	auto query = world.query_builder<Components::Light, Components::LightViewInfo>().build();
 	query.each([&](flecs::entity entity, Components::Light& light, Components::LightViewInfo& viewInfo) {
@@ -334,171 +332,213 @@ void LightManager::RebuildDirectionalLightViewInfoBuffer(std::optional<uint64_t>
 			return;
 		}
 
-		viewInfo.viewInfoBufferIndex = m_directionalViewInfo->Size();
+		const uint32_t firstIndex = writeIndex;
 		for (uint64_t viewId : viewInfo.viewIDs) {
 			const View* view = m_pViewManager->Get(viewId);
 			if (!view) {
 				continue;
 			}
 
-			m_directionalViewInfo->Add(view->gpu.cameraBufferIndex);
+			const unsigned int cameraBufferIndex = view->gpu.cameraBufferIndex;
+			if (writeIndex >= m_directionalViewInfo->Size() || (*m_directionalViewInfo)[writeIndex] != cameraBufferIndex) {
+				m_directionalViewInfo->UpdateAt(writeIndex, cameraBufferIndex);
+			}
+			++writeIndex;
 		}
 
-		light.lightInfo.shadowViewInfoIndex = static_cast<int>(viewInfo.viewInfoBufferIndex);
-		UpdateLightBufferView(viewInfo.lightBufferView.get(), light.lightInfo);
+		if (viewInfo.viewInfoBufferIndex != firstIndex || light.lightInfo.shadowViewInfoIndex != static_cast<int>(firstIndex)) {
+			viewInfo.viewInfoBufferIndex = firstIndex;
+			light.lightInfo.shadowViewInfoIndex = static_cast<int>(firstIndex);
+			UpdateLightBufferView(viewInfo.lightBufferView.get(), light.lightInfo);
+		}
 	});
+
+	while (m_directionalViewInfo->Size() > writeIndex) {
+		m_directionalViewInfo->RemoveAt(m_directionalViewInfo->Size() - 1);
+	}
 }
 
 
-void LightManager::UpdateLightViewInfo(flecs::entity light) {
-	//auto projectionMatrix = light.get<Components::ProjectionMatrix>();
-	auto viewInfo = light.get<Components::LightViewInfo>();
-	auto& renderViewIds = viewInfo.viewIDs;
-	bool lightViewInfoChanged = false;
-	auto& lightInfo = light.get_mut<Components::Light>();
-	auto& lightMatrix = light.get<Components::Matrix>();
-	auto& planes = light.get<Components::FrustumPlanes>().frustumPlanes;
-	auto globalPos = GetGlobalPositionFromMatrix(lightMatrix.matrix);
-	if (lightInfo.type == Components::LightType::Directional) {
-		lightInfo.lightInfo.shadowSourceAngleDegrees = getDirectionalVirtualShadowSourceAngleDegrees();
-	}
-	switch (lightInfo.type) {
-	case Components::LightType::Point: {
-		auto cubemapMatrices = GetCubemapViewMatrices(globalPos);
-		for (int i = 0; i < 6; i++) {
-			//const CameraInfo* oldInfo = light.get<CameraInfo>();
-			CameraInfo info = {};
-			info.positionWorldSpace = { globalPos.x, globalPos.y, globalPos.z, 1.0 };
-			info.view = cubemapMatrices[i];
-			info.unjitteredProjection = viewInfo.projectionMatrix.matrix;
-			info.jitteredProjection = info.unjitteredProjection; // lights don't use jittering.
-			info.prevView = info.view;
-			info.prevJitteredProjection = info.jitteredProjection;
-			info.prevUnjitteredProjection = info.unjitteredProjection;
-			info.viewProjection = XMMatrixMultiply(cubemapMatrices[i], viewInfo.projectionMatrix.matrix);
-			info.clippingPlanes[0] = planes[i][0];
-			info.clippingPlanes[1] = planes[i][1];
-			info.clippingPlanes[2] = planes[i][2];
-			info.clippingPlanes[3] = planes[i][3];
-			info.clippingPlanes[4] = planes[i][4];
-			info.clippingPlanes[5] = planes[i][5];
-			info.depthBufferArrayIndex = i;
-			info.depthResX = viewInfo.depthResX;
-			info.depthResY = viewInfo.depthResY;
-			info.uvScaleToNextPowerOfTwo = {
-				static_cast<float>(viewInfo.depthResX) / static_cast<float>(GetNextPowerOfTwo(viewInfo.depthResX)),
-				static_cast<float>(viewInfo.depthResY) / static_cast<float>(GetNextPowerOfTwo(viewInfo.depthResY))
-			};
-			info.numDepthMips = CalculateMipLevels(static_cast<uint16_t>(info.depthResX), static_cast<uint16_t>(info.depthResY));
-			m_pViewManager->UpdateCamera(renderViewIds[i], info);
-		}
-		break;
+LightViewSignature LightManager::BuildLightViewSignature(flecs::entity light) {
+	const auto& lightComponent = light.get<Components::Light>();
+	const auto& viewInfo = light.get<Components::LightViewInfo>();
+
+	LightViewSignature signature{};
+	DirectX::XMStoreFloat4x4(&signature.lightMatrix, light.get<Components::Matrix>().matrix);
+	DirectX::XMStoreFloat4x4(&signature.projection, viewInfo.projectionMatrix.matrix);
+	signature.firstViewId = viewInfo.viewIDs.empty() ? 0 : viewInfo.viewIDs.front();
+	signature.viewCount = static_cast<uint32_t>(viewInfo.viewIDs.size());
+	signature.depthResX = viewInfo.depthResX;
+	signature.depthResY = viewInfo.depthResY;
+	if (const auto* planes = light.try_get<Components::FrustumPlanes>()) {
+		signature.planesHash = HashFrustumPlanes(planes->frustumPlanes);
 	}
-	case Components::LightType::Spot: {
-		CameraInfo camera = {};
-		camera.positionWorldSpace = { globalPos.x, globalPos.y, globalPos.z, 1.0 };
-		auto up = DirectX::XMFLOAT3(0, 1, 0);
-		camera.view = DirectX::XMMatrixLookToRH(DirectX::XMLoadFloat3(&globalPos), DirectX::XMVector3Normalize(lightMatrix.matrix.r[2]), XMLoadFloat3(&up));
-		camera.unjitteredProjection = viewInfo.projectionMatrix.matrix;
-		camera.jitteredProjection = camera.unjitteredProjection; // lights don't use jittering.
-		camera.prevView = camera.view;
-		camera.prevJitteredProjection = camera.jitteredProjection;
-		camera.prevUnjitteredProjection = camera.unjitteredProjection;
-		camera.viewProjection = DirectX::XMMatrixMultiply(camera.view, viewInfo.projectionMatrix.matrix);
-		camera.clippingPlanes[0] = planes[0][0];
-		camera.clippingPlanes[1] = planes[0][1];
-		camera.clippingPlanes[2] = planes[0][2];
-		camera.clippingPlanes[3] = planes[0][3];
-		camera.clippingPlanes[4] = planes[0][4];
-		camera.clippingPlanes[5] = planes[0][5];
-		camera.depthBufferArrayIndex = 0;
-		camera.depthResX = viewInfo.depthResX;
-		camera.depthResY = viewInfo.depthResY;
-		camera.uvScaleToNextPowerOfTwo = {
-			static_cast<float>(viewInfo.depthResX) / static_cast<float>(GetNextPowerOfTwo(viewInfo.depthResX)),
-			static_cast<float>(viewInfo.depthResY) / static_cast<float>(GetNextPowerOfTwo(viewInfo.depthResY))
-		};
-		camera.numDepthMips = CalculateMipLevels(static_cast<uint16_t>(camera.depthResX), static_cast<uint16_t>(camera.depthResY));
 
-		m_pViewManager->UpdateCamera(renderViewIds[0], camera);
-		break;
+	if (lightComponent.type == Components::LightType::Directional && m_currentCamera.is_valid()) {
+		const auto& camera = m_currentCamera.get<Components::Camera>();
+		DirectX::XMStoreFloat4x4(&signature.cameraMatrix, m_currentCamera.get<Components::Matrix>().matrix);
+		signature.cameraZNear = camera.zNear;
+		signature.cameraZFar = camera.zFar;
+		signature.cameraFov = camera.fov;
+		signature.cameraAspect = camera.aspect;
+		signature.clipVerticalExtent = getDirectionalShadowVerticalExtent();
+		signature.sourceAngleDegrees = getDirectionalVirtualShadowSourceAngleDegrees();
+		signature.numCascades = getNumDirectionalLightCascades();
 	}
-	case Components::LightType::Directional: {
-		if (!m_currentCamera.is_valid()) {
+	return signature;
+}
+
+void LightManager::UpdateLightViewInfo(flecs::entity light) {
+	UpdateLightViewInfos({ light });
+}
+
+void LightManager::UpdateLightViewInfos(const std::vector<flecs::entity>& lights) {
+	m_localLightViewBatch.Clear();
+	m_localLightViewIds.clear();
+
+	for (flecs::entity light : lights) {
+		const auto& lightComponent = light.get<Components::Light>();
+		if (lightComponent.type == Components::LightType::Directional && !m_currentCamera.is_valid()) {
 			spdlog::warn("Camera must be provided for directional light shadow mapping");
-			return;
+			continue;
+		}
+
+		// Skip lights whose views would come out identical to last time.
+		const LightViewSignature signature = BuildLightViewSignature(light);
+		auto [cached, inserted] = m_lightViewSignatures.try_emplace(light.id(), signature);
+		if (!inserted) {
+			if (cached->second == signature) {
+				continue;
+			}
+			cached->second = signature;
 		}
-		auto numCascades = getNumDirectionalLightCascades();
-		if (renderViewIds.size() != static_cast<size_t>(numCascades)) {
-			numCascades = static_cast<uint8_t>((std::min)(renderViewIds.size(), static_cast<size_t>(numCascades)));
-			viewInfo.virtualShadowUnwrappedPageOffsetX.resize(numCascades);
-			viewInfo.virtualShadowUnwrappedPageOffsetY.resize(numCascades);
-			lightViewInfoChanged = true;
+
+		const auto& viewInfo = light.get<Components::LightViewInfo>();
+		const auto& lightMatrix = light.get<Components::Matrix>().matrix;
+		const auto* planes = light.try_get<Components::FrustumPlanes>();
+		const DirectX::XMUINT2 depthResolution = { viewInfo.depthResX, viewInfo.depthResY };
+		switch (lightComponent.type) {
+		case Components::LightType::Point: {
+			if (viewInfo.viewIDs.size() < 6) {
+				break;
+			}
+			const bool hasFacePlanes = planes && planes->frustumPlanes.size() >= 6;
+			m_localLightViewBatch.AddPoint(
+				GetGlobalPositionFromMatrix(lightMatrix),
+				viewInfo.projectionMatrix.matrix,
+				depthResolution,
+				hasFacePlanes ? planes->frustumPlanes.data() : nullptr);
+			m_localLightViewIds.insert(m_localLightViewIds.end(), viewInfo.viewIDs.begin(), viewInfo.viewIDs.begin() + 6);
+			break;
 		}
-		auto& camera = m_currentCamera.get<Components::Camera>();
-		auto& matrix = m_currentCamera.get<Components::Matrix>().matrix;
-		auto posFloats = GetGlobalPositionFromMatrix(matrix);
-		const std::vector<float> directionalClipFarPlanes = calculateCascadeSplits(
-			numCascades,
-			camera.zNear,
-			camera.zFar,
-			camera.zFar);
-		const float clipVerticalExtent = std::max(
-			SettingsManager::GetInstance().getSettingGetter<float>("directionalShadowVerticalExtent")(),
-			1.0f);
-		auto cascades = setupDirectionalClipmaps(numCascades, lightInfo.lightInfo.dirWorldSpace, DirectX::XMLoadFloat3(&posFloats), GetForwardFromMatrix(matrix), GetUpFromMatrix(matrix), camera.zNear, camera.fov, camera.aspect, directionalClipFarPlanes, clipVerticalExtent);
-		PublishDirectionalShadowDebug(cascades);
-		viewInfo.virtualShadowUnwrappedPageOffsetX.resize(numCascades);
-		viewInfo.virtualShadowUnwrappedPageOffsetY.resize(numCascades);
-		for (int i = 0; i < numCascades; i++) {
-			viewInfo.virtualShadowUnwrappedPageOffsetX[i] = cascades[i].pageOffsetX;
-			viewInfo.virtualShadowUnwrappedPageOffsetY[i] = cascades[i].pageOffsetY;
-			CameraInfo info = {};
-			// Match Timberdoodle's model: the shadow camera is derived from a page-aligned
-			// projection of the primary camera into a fixed light-space basis.
-			info.positionWorldSpace = cascades[i].worldCenter;
-			info.view = cascades[i].viewMatrix;
-			info.viewInverse = DirectX::XMMatrixInverse(nullptr, info.view);
-			info.unjitteredProjection = cascades[i].orthoMatrix;
-			info.jitteredProjection = info.unjitteredProjection; // lights don't use jittering.
-			info.projectionInverse = DirectX::XMMatrixInverse(nullptr, info.unjitteredProjection);
-			info.prevView = info.view;
-			info.prevJitteredProjection = info.jitteredProjection;
-			info.prevUnjitteredProjection = info.unjitteredProjection;
-			info.viewProjection = DirectX::XMMatrixMultiply(cascades[i].viewMatrix, cascades[i].orthoMatrix);
-			info.aspectRatio = camera.aspect;
-			info.zNear = cascades[i].nearPlane;
-			info.zFar = cascades[i].farPlane;
-			info.clippingPlanes[0] = cascades[i].frustumPlanes[0];
-			info.clippingPlanes[1] = cascades[i].frustumPlanes[1];
-			info.clippingPlanes[2] = cascades[i].frustumPlanes[2];
-			info.clippingPlanes[3] = cascades[i].frustumPlanes[3];
-			info.clippingPlanes[4] = cascades[i].frustumPlanes[4];
-			info.clippingPlanes[5] = cascades[i].frustumPlanes[5];
-			info.depthBufferArrayIndex = i;
-			info.depthResX = viewInfo.depthResX;
-			info.depthResY = viewInfo.depthResY;
-			unsigned int nextPowerOfTwoX = GetNextPowerOfTwo(viewInfo.depthResX);
-			unsigned int nextPowerOfTwoY = GetNextPowerOfTwo(viewInfo.depthResY);
-			info.uvScaleToNextPowerOfTwo = {
-				static_cast<float>(viewInfo.depthResX) / static_cast<float>(nextPowerOfTwoX),
-				static_cast<float>(viewInfo.depthResY) / static_cast<float>(nextPowerOfTwoY)
-			};
-			info.numDepthMips = CalculateMipLevels(static_cast<uint16_t>(info.depthResX), static_cast<uint16_t>(info.depthResY));
-			info.isOrtho = true; // Directional lights use orthographic projection for shadows.
-			m_pViewManager->UpdateCamera(renderViewIds[i], info);
+		case Components::LightType::Spot: {
+			if (viewInfo.viewIDs.empty()) {
+				break;
+			}
+			DirectX::XMFLOAT3 direction;
+			DirectX::XMStoreFloat3(&direction, DirectX::XMVector3Normalize(lightMatrix.r[2]));
+			m_localLightViewBatch.AddSpot(
+				GetGlobalPositionFromMatrix(lightMatrix),
+				direction,
+				viewInfo.projectionMatrix.matrix,
+				depthResolution,
+				planes && !planes->frustumPlanes.empty() ? planes->frustumPlanes.data() : nullptr);
+			m_localLightViewIds.push_back(viewInfo.viewIDs[0]);
+			break;
+		}
+		case Components::LightType::Directional:
+			UpdateDirectionalLightViewInfo(light);
+			break;
+		default:
+			spdlog::warn("Light type not recognized");
 		}
-		lightViewInfoChanged = true;
-		UpdateLightBufferView(viewInfo.lightBufferView.get(), lightInfo.lightInfo);
-		break;
 	}
-	default:
-		spdlog::warn("Light type not recognized");
+
+	const size_t lightCount = m_localLightViewBatch.Size();
+	if (lightCount == 0) {
+		return;
 	}
 
-	if (lightViewInfoChanged) {
-		light.set<Components::LightViewInfo>(viewInfo);
+	static constexpr size_t kLightsPerTask = 64;
+	const size_t taskCount = (lightCount + kLightsPerTask - 1) / kLightsPerTask;
+	if (taskCount > 1) {
+		TaskSchedulerManager::GetInstance().ParallelFor("LightManager::BuildLocalLightViews", taskCount, [this, lightCount](size_t task) {
+			const size_t begin = task * kLightsPerTask;
+			BuildLocalLightViews(m_localLightViewBatch, begin, (std::min)(begin + kLightsPerTask, lightCount));
+		});
+	}
+	else {
+		BuildLocalLightViews(m_localLightViewBatch, 0, lightCount);
+	}
+
+	for (size_t i = 0; i < m_localLightViewIds.size(); ++i) {
+		m_pViewManager->UpdateCamera(m_localLightViewIds[i], m_localLightViewBatch.cameras[i]);
+	}
+}
+
+void LightManager::UpdateDirectionalLightViewInfo(flecs::entity light) {
+	auto viewInfo = light.get<Components::LightViewInfo>();
+	auto& renderViewIds = viewInfo.viewIDs;
+	auto& lightInfo = light.get_mut<Components::Light>();
+	lightInfo.lightInfo.shadowSourceAngleDegrees = getDirectionalVirtualShadowSourceAngleDegrees();
+
+	auto numCascades = getNumDirectionalLightCascades();
+	if (renderViewIds.size() != static_cast<size_t>(numCascades)) {
+		numCascades = static_cast<uint8_t>((std::min)(renderViewIds.size(), static_cast<size_t>(numCascades)));
 	}
+	auto& camera = m_currentCamera.get<Components::Camera>();
+	auto& matrix = m_currentCamera.get<Components::Matrix>().matrix;
+	auto posFloats = GetGlobalPositionFromMatrix(matrix);
+	const std::vector<float> directionalClipFarPlanes = calculateCascadeSplits(
+		numCascades,
+		camera.zNear,
+		camera.zFar,
+		camera.zFar);
+	const float clipVerticalExtent = std::max(getDirectionalShadowVerticalExtent(), 1.0f);
+	auto cascades = setupDirectionalClipmaps(numCascades, lightInfo.lightInfo.dirWorldSpace, DirectX::XMLoadFloat3(&posFloats), GetForwardFromMatrix(matrix), GetUpFromMatrix(matrix), camera.zNear, camera.fov, camera.aspect, directionalClipFarPlanes, clipVerticalExtent);
+	PublishDirectionalShadowDebug(cascades);
+	viewInfo.virtualShadowUnwrappedPageOffsetX.resize(numCascades);
+	viewInfo.virtualShadowUnwrappedPageOffsetY.resize(numCascades);
+	for (int i = 0; i < numCascades; i++) {
+		viewInfo.virtualShadowUnwrappedPageOffsetX[i] = cascades[i].pageOffsetX;
+		viewInfo.virtualShadowUnwrappedPageOffsetY[i] = cascades[i].pageOffsetY;
+		CameraInfo info = {};
+		// Match Timberdoodle's model: the shadow camera is derived from a page-aligned
+		// projection of the primary camera into a fixed light-space basis.
+		info.positionWorldSpace = cascades[i].worldCenter;
+		info.view = cascades[i].viewMatrix;
+		info.viewInverse = DirectX::XMMatrixInverse(nullptr, info.view);
+		info.unjitteredProjection = cascades[i].orthoMatrix;
+		info.jitteredProjection = info.unjitteredProjection; // lights don't use jittering.
+		info.projectionInverse = DirectX::XMMatrixInverse(nullptr, info.unjitteredProjection);
+		info.prevView = info.view;
+		info.prevJitteredProjection = info.jitteredProjection;
+		info.prevUnjitteredProjection = info.unjitteredProjection;
+		info.viewProjection = DirectX::XMMatrixMultiply(cascades[i].viewMatrix, cascades[i].orthoMatrix);
+		info.aspectRatio = camera.aspect;
+		info.zNear = cascades[i].nearPlane;
+		info.zFar = cascades[i].farPlane;
+		info.clippingPlanes[0] = cascades[i].frustumPlanes[0];
+		info.clippingPlanes[1] = cascades[i].frustumPlanes[1];
+		info.clippingPlanes[2] = cascades[i].frustumPlanes[2];
+		info.clippingPlanes[3] = cascades[i].frustumPlanes[3];
+		info.clippingPlanes[4] = cascades[i].frustumPlanes[4];
+		info.clippingPlanes[5] = cascades[i].frustumPlanes[5];
+		info.depthBufferArrayIndex = i;
+		info.depthResX = viewInfo.depthResX;
+		info.depthResY = viewInfo.depthResY;
+		unsigned int nextPowerOfTwoX = GetNextPowerOfTwo(viewInfo.depthResX);
+		unsigned int nextPowerOfTwoY = GetNextPowerOfTwo(viewInfo.depthResY);
+		info.uvScaleToNextPowerOfTwo = {
+			static_cast<float>(viewInfo.depthResX) / static_cast<float>(nextPowerOfTwoX),
+			static_cast<float>(viewInfo.depthResY) / static_cast<float>(nextPowerOfTwoY)
+		};
+		info.numDepthMips = CalculateMipLevels(static_cast<uint16_t>(info.depthResX), static_cast<uint16_t>(info.depthResY));
+		info.isOrtho = true; // Directional lights use orthographic projection for shadows.
+		m_pViewManager->UpdateCamera(renderViewIds[i], info);
+	}
+	UpdateLightBufferView(viewInfo.lightBufferView.get(), lightInfo.lightInfo);
+	light.set<Components::LightViewInfo>(viewInfo);
 }
 
 void LightManager::RemoveLightViewInfo(flecs::entity light) {
@@ -529,6 +569,7 @@ void LightManager::RemoveLightViewInfo(flecs::entity light) {
 	default:
 		spdlog::warn("Light type not recognized");
 	}
+	m_lightViewSignatures.erase(light.id());
 }
 
 void LightManager::SetCurrentCamera(flecs::entity camera) {
@@ -540,6 +581,10 @@ void LightManager::SetViewManager(ViewManager* viewManager) {
 	m_pViewManager = viewManager;
 }
 
+void LightManager::InvalidateLightView(uint64_t lightEntityId) {
+	m_lightViewSignatures.erase(lightEntityId);
+}
+
 void LightManager::UpdateLightBufferView(BufferView* view, const LightInfo& data) {
 	std::lock_guard<std::mutex> lock(m_lightUpdateMutex);
 	m_lightBuffer->UpdateView(view, &data);
@@ -0,0 +1,157 @@
+#include "Managers/LightViewBuilder.h"
+
+#include <algorithm>
+#include <bit>
+
+#include "Utilities/HashMix.h"
+
+using namespace DirectX;
+
+namespace {
+// Same face order and up vectors as GetCubemapViewMatrices, evaluated at the origin.
+struct CubeFaceRotations {
+	XMMATRIX faces[6];
+
+	CubeFaceRotations() {
+		const XMVECTOR targets[6] = {
+			XMVectorSet(1.0f,  0.0f,  0.0f, 0.0f),
+			XMVectorSet(-1.0f, 0.0f,  0.0f, 0.0f),
+			XMVectorSet(0.0f,  1.0f,  0.0f, 0.0f),
+			XMVectorSet(0.0f, -1.0f,  0.0f, 0.0f),
+			XMVectorSet(0.0f,  0.0f, -1.0f, 0.0f),
+			XMVectorSet(0.0f,  0.0f,  1.0f, 0.0f),
+		};
+		const XMVECTOR ups[6] = {
+			XMVectorSet(0.0f, 1.0f,  0.0f, 0.0f),
+			XMVectorSet(0.0f, 1.0f,  0.0f, 0.0f),
+			XMVectorSet(0.0f, 0.0f,  1.0f, 0.0f),
+			XMVectorSet(0.0f, 0.0f, -1.0f, 0.0f),
+			XMVectorSet(0.0f, 1.0f,  0.0f, 0.0f),
+			XMVectorSet(0.0f, 1.0f,  0.0f, 0.0f),
+		};
+		for (int i = 0; i < 6; ++i) {
+			faces[i] = XMMatrixLookToRH(XMVectorZero(), targets[i], ups[i]);
+		}
+	}
+};
+
+const CubeFaceRotations& GetCubeFaceRotations() {
+	static const CubeFaceRotations rotations;
+	return rotations;
+}
+
+void FillShadowCamera(CameraInfo& camera, const XMFLOAT3& position, FXMMATRIX view, CXMMATRIX projection, XMUINT2 depthResolution, const std::array<ClippingPlane, 6>* planes, int depthBufferArrayIndex) {
+	camera = {};
+	camera.positionWorldSpace = { position.x, position.y, position.z, 1.0f };
+	camera.view = view;
+	camera.unjitteredProjection = projection;
+	camera.jitteredProjection = projection; // lights don't use jittering.
+	camera.prevView = view;
+	camera.prevJitteredProjection = projection;
+	camera.prevUnjitteredProjection = projection;
+	camera.viewProjection = XMMatrixMultiply(view, projection);
+	if (planes) {
+		for (int i = 0; i < 6; ++i) {
+			camera.clippingPlanes[i] = (*planes)[i];
+		}
+	}
+	camera.depthBufferArrayIndex = depthBufferArrayIndex;
+	camera.depthResX = depthResolution.x;
+	camera.depthResY = depthResolution.y;
+	camera.uvScaleToNextPowerOfTwo = {
+		static_cast<float>(depthResolution.x) / static_cast<float>(std::bit_ceil((std::max)(depthResolution.x, 1u))),
+		static_cast<float>(depthResolution.y) / static_cast<float>(std::bit_ceil((std::max)(depthResolution.y, 1u)))
+	};
+	// floor(log2(max)) + 1, as CalculateMipLevels.
+	camera.numDepthMips = static_cast<uint32_t>(std::bit_width(static_cast<uint16_t>((std::max)(depthResolution.x, depthResolution.y))));
+}
+}
+
+uint64_t HashFrustumPlanes(const std::vector<std::array<ClippingPlane, 6>>& planes) {
+	uint64_t seed = planes.size();
+	for (const auto& frustum : planes) {
+		for (const ClippingPlane& plane : frustum) {
+			util::hash_combine_u64(seed, std::bit_cast<uint32_t>(plane.plane.x));
+			util::hash_combine_u64(seed, std::bit_cast<uint32_t>(plane.plane.y));
+			util::hash_combine_u64(seed, std::bit_cast<uint32_t>(plane.plane.z));
+			util::hash_combine_u64(seed, std::bit_cast<uint32_t>(plane.plane.w));
+		}
+	}
+	return seed;
+}
+
+void LocalLightViewBatch::Clear() {
+	positions.clear();
+	directions.clear();
+	projections.clear();
+	depthResolutions.clear();
+	planes.clear();
+	firstCamera.clear();
+	isPoint.clear();
+	cameras.clear();
+}
+
+void LocalLightViewBatch::Reserve(size_t lightCount) {
+	positions.reserve(lightCount);
+	directions.reserve(lightCount);
+	projections.reserve(lightCount);
+	depthResolutions.reserve(lightCount);
+	planes.reserve(lightCount);
+	firstCamera.reserve(lightCount);
+	isPoint.reserve(lightCount);
+}
+
+uint32_t LocalLightViewBatch::AddPoint(const XMFLOAT3& position, FXMMATRIX projection, XMUINT2 depthResolution, const std::array<ClippingPlane, 6>* firstFacePlanes) {
+	const uint32_t first = static_cast<uint32_t>(cameras.size());
+	positions.push_back(position);
+	directions.push_back({ 0.0f, 0.0f, 0.0f });
+	projections.emplace_back();
+	XMStoreFloat4x4(&projections.back(), projection);
+	depthResolutions.push_back(depthResolution);
+	planes.push_back(firstFacePlanes);
+	firstCamera.push_back(first);
+	isPoint.push_back(1u);
+	cameras.resize(cameras.size() + 6u);
+	return first;
+}
+
+uint32_t LocalLightViewBatch::AddSpot(const XMFLOAT3& position, const XMFLOAT3& direction, FXMMATRIX projection, XMUINT2 depthResolution, const std::array<ClippingPlane, 6>* lightPlanes) {
+	const uint32_t first = static_cast<uint32_t>(cameras.size());
+	positions.push_back(position);
+	directions.push_back(direction);
+	projections.emplace_back();
+	XMStoreFloat4x4(&projections.back(), projection);
+	depthResolutions.push_back(depthResolution);
+	planes.push_back(lightPlanes);
+	firstCamera.push_back(first);
+	isPoint.push_back(0u);
+	cameras.resize(cameras.size() + 1u);
+	return first;
+}
+
+void BuildLocalLightViews(LocalLightViewBatch& batch, size_t beginLight, size_t endLight) {
+	const CubeFaceRotations& cube = GetCubeFaceRotations();
+	const XMVECTOR up = XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f);
+
+	for (size_t light = beginLight; light < endLight; ++light) {
+		const XMFLOAT3& position = batch.positions[light];
+		const XMVECTOR eye = XMLoadFloat3(&position);
+		const XMMATRIX projection = XMLoadFloat4x4(&batch.projections[light]);
+		const XMUINT2 depthResolution = batch.depthResolutions[light];
+		const std::array<ClippingPlane, 6>* planes = batch.planes[light];
+		CameraInfo* cameras = batch.cameras.data() + batch.firstCamera[light];
+
+		if (batch.isPoint[light] != 0u) {
+			for (int face = 0; face < 6; ++face) {
+				// LookToRH at 'eye' is the origin rotation with translation -eye * R.
+				XMMATRIX view = cube.faces[face];
+				view.r[3] = XMVectorSelect(g_XMIdentityR3, XMVectorNegate(XMVector3TransformNormal(eye, view)), g_XMSelect1110);
+				FillShadowCamera(cameras[face], position, view, projection, depthResolution, planes ? planes + face : nullptr, face);
+			}
+		}
+		else {
+			const XMMATRIX view = XMMatrixLookToRH(eye, XMLoadFloat3(&batch.directions[light]), up);
+			FillShadowCamera(cameras[0], position, view, projection, depthResolution, planes, 0);
+		}
+	}
+}
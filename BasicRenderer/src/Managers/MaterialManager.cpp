@@ -8,6 +8,7 @@
 
 #include <cstring>
 #include <limits>
+#include <queue>
 #include <unordered_set>
 
 namespace {
@@ -16,6 +17,8 @@ namespace {
 	constexpr uint32_t kTextureStreamingFeedbackUnused = 0xffffffffu;
 	constexpr uint64_t kTextureStreamingIdleFramesBeforeCoarsen = 180u;
 	constexpr std::string_view kTextureStreamingFeedbackReadbackAnchorPass = "MenuRenderPass";
+	constexpr uint64_t kTextureStreamingBudgetQuantumBytes = 64u * 1024u;
+	constexpr size_t kTextureStreamingDemandMaxSegments = 64u;
 
 	uint64_t ComputeTextureResidentBytes(const TextureDescription& desc) {
 		uint64_t totalBytes = 0;
@@ -25,6 +28,49 @@ namespace {
 		return totalBytes;
 	}
 
+	uint64_t CountTextureChainTexels(uint32_t width, uint32_t height, uint32_t topMip, uint32_t endMip) {
+		uint64_t texels = 0;
+		for (uint32_t mip = topMip; mip < endMip; ++mip) {
+			texels += static_cast<uint64_t>((std::max)(width >> mip, 1u)) * (std::max)(height >> mip, 1u);
+		}
+		return texels;
+	}
+
+	// Size of a texture's mip chain at any top mip. Only the resident image's
+	// size is known, so other top mips are scaled from it by texel count.
+	struct TextureChainEstimate {
+		uint32_t width = 0;
+		uint32_t height = 0;
+		uint32_t totalMipCount = 0;
+		double bytesPerTexel = 0.0;
+
+		uint64_t BytesForTopMip(uint32_t topMip) const {
+			return static_cast<uint64_t>(bytesPerTexel * static_cast<double>(CountTextureChainTexels(width, height, topMip, totalMipCount)));
+		}
+	};
+
+	bool EstimateTextureChain(const TextureAsset& texture, TextureChainEstimate& estimate) {
+		const TextureStreamingState& state = texture.GetStreamingState();
+		if (!texture.HasUsableImage() || state.residency.totalMipCount == 0u) {
+			return false;
+		}
+
+		estimate.width = texture.GetFullMip0Width();
+		estimate.height = texture.GetFullMip0Height();
+		estimate.totalMipCount = state.residency.totalMipCount;
+		const uint32_t residentEndMip = (std::min)(
+			state.residency.residentTopMip + state.residency.residentMipCount,
+			state.residency.totalMipCount);
+		const uint64_t residentTexels = CountTextureChainTexels(
+			estimate.width, estimate.height, state.residency.residentTopMip, residentEndMip);
+		if (residentTexels == 0u) {
+			return false;
+		}
+		estimate.bytesPerTexel = static_cast<double>(ComputeTextureResidentBytes(texture.Image().GetDescription())) /
+			static_cast<double>(residentTexels);
+		return true;
+	}
+
 	TextureStreamingGPUInfo BuildTextureStreamingGPUInfo(const TextureAsset& texture) {
 		const TextureStreamingState& state = texture.GetStreamingState();
 		TextureStreamingGPUInfo info = {};
@@ -357,8 +403,14 @@ void MaterialManager::BeginTextureStreamingFeedbackFrame(uint64_t frameIndex) {
 			continue;
 		}
 
+		m_textureStreamingDesiredTopMips[streamingTextureID] = requestedTopMip;
+		auto budgetIt = m_textureStreamingBudgetTopMips.find(streamingTextureID);
+		const uint32_t topMip = budgetIt != m_textureStreamingBudgetTopMips.end()
+			? (std::max)(requestedTopMip, budgetIt->second)
+			: requestedTopMip;
+
 		const uint64_t previousRevision = texture->GetStreamingStateRevision();
-		texture->ApplyStreamingSystemRequest(requestedTopMip, frameIndex);
+		texture->ApplyStreamingSystemRequest(topMip, frameIndex);
 		if (texture->GetStreamingStateRevision() != previousRevision) {
 			MarkTextureStreamingMetadataDirty(texture, true);
 		}
@@ -366,11 +418,15 @@ void MaterialManager::BeginTextureStreamingFeedbackFrame(uint64_t frameIndex) {
 
 	for (uint32_t streamingTextureID : expiredTextureIDs) {
 		m_streamingTexturesByID.erase(streamingTextureID);
+		m_textureStreamingDesiredTopMips.erase(streamingTextureID);
+		m_textureStreamingBudgetTopMips.erase(streamingTextureID);
 	}
 
 	for (auto it = m_streamingTexturesByID.begin(); it != m_streamingTexturesByID.end();) {
 		auto texture = it->second.lock();
 		if (!texture) {
+			m_textureStreamingDesiredTopMips.erase(it->first);
+			m_textureStreamingBudgetTopMips.erase(it->first);
 			it = m_streamingTexturesByID.erase(it);
 			continue;
 		}
@@ -386,12 +442,18 @@ void MaterialManager::BeginTextureStreamingFeedbackFrame(uint64_t frameIndex) {
 			continue;
 		}
 
+		auto desiredIt = m_textureStreamingDesiredTopMips.try_emplace(it->first, state.requestedTopMip).first;
 		const uint32_t coarsenedTopMip = (std::min)(
 			state.residency.totalMipCount - 1u,
-			(std::max)(state.requestedTopMip, state.residency.residentTopMip + 1u));
-		if (coarsenedTopMip != state.requestedTopMip) {
+			(std::max)(desiredIt->second, state.residency.residentTopMip + 1u));
+		desiredIt->second = coarsenedTopMip;
+		auto budgetIt = m_textureStreamingBudgetTopMips.find(it->first);
+		const uint32_t topMip = budgetIt != m_textureStreamingBudgetTopMips.end()
+			? (std::max)(coarsenedTopMip, budgetIt->second)
+			: coarsenedTopMip;
+		if (topMip != state.requestedTopMip) {
 			const uint64_t previousRevision = texture->GetStreamingStateRevision();
-			texture->ApplyStreamingSystemRequest(coarsenedTopMip, frameIndex);
+			texture->ApplyStreamingSystemRequest(topMip, frameIndex);
 			if (texture->GetStreamingStateRevision() != previousRevision) {
 				MarkTextureStreamingMetadataDirty(texture, true);
 			}
@@ -400,6 +462,8 @@ void MaterialManager::BeginTextureStreamingFeedbackFrame(uint64_t frameIndex) {
 		++it;
 	}
 
+	ApplyTextureStreamingBudget();
+
 	for (const uint32_t streamingTextureID : m_activeTextureStreamingFeedbackIDs) {
 		if (streamingTextureID < m_textureStreamingMetadataCapacity) {
 			m_textureStreamingFeedbackBuffer->UpdateAt(streamingTextureID, kTextureStreamingFeedbackUnused);
@@ -460,6 +524,124 @@ void MaterialManager::RequestTextureStreamingFeedbackReadback(rg::runtime::IRead
 		QueueKind::Copy);
 }
 
+void MaterialManager::ApplyTextureStreamingBudget() {
+	if (m_textureStreamingBudgetBytes == 0u && m_textureStreamingBudgetTopMips.empty()) {
+		return;
+	}
+
+	struct BudgetedTexture {
+		std::shared_ptr<TextureAsset> texture;
+		uint32_t streamingTextureID = 0;
+		TextureChainEstimate estimate;
+		uint32_t desiredTopMip = 0;
+		uint32_t topMip = 0;
+	};
+	std::vector<BudgetedTexture> textures;
+	uint64_t totalBytes = 0;
+	for (const auto& [streamingTextureID, weakTexture] : m_streamingTexturesByID) {
+		auto texture = weakTexture.lock();
+		if (!texture || !texture->IsMipStreamingEnabled()) {
+			continue;
+		}
+
+		BudgetedTexture entry;
+		if (!EstimateTextureChain(*texture, entry.estimate)) {
+			continue;
+		}
+		const TextureStreamingState& state = texture->GetStreamingState();
+		entry.desiredTopMip = (std::min)(
+			m_textureStreamingDesiredTopMips.try_emplace(streamingTextureID, state.requestedTopMip).first->second,
+			entry.estimate.totalMipCount - 1u);
+		entry.topMip = entry.desiredTopMip;
+		entry.streamingTextureID = streamingTextureID;
+		entry.texture = std::move(texture);
+		totalBytes += entry.estimate.BytesForTopMip(entry.topMip);
+		textures.push_back(std::move(entry));
+	}
+
+	// Over the cap, drop a mip from whichever texture frees the most bytes for
+	// it: every level is worth the same, so that is the least quality per MiB.
+	if (m_textureStreamingBudgetBytes != 0u && totalBytes > m_textureStreamingBudgetBytes) {
+		const auto stepBytes = [&textures](uint32_t index) -> uint64_t {
+			const BudgetedTexture& entry = textures[index];
+			if (entry.topMip + 1u >= entry.estimate.totalMipCount) {
+				return 0u;
+			}
+			return entry.estimate.BytesForTopMip(entry.topMip) - entry.estimate.BytesForTopMip(entry.topMip + 1u);
+		};
+
+		std::priority_queue<std::pair<uint64_t, uint32_t>> steps;
+		for (uint32_t index = 0; index < static_cast<uint32_t>(textures.size()); ++index) {
+			if (const uint64_t bytes = stepBytes(index); bytes != 0u) {
+				steps.emplace(bytes, index);
+			}
+		}
+		while (totalBytes > m_textureStreamingBudgetBytes && !steps.empty()) {
+			const auto [bytes, index] = steps.top();
+			steps.pop();
+			textures[index].topMip++;
+			totalBytes -= bytes;
+			if (const uint64_t next = stepBytes(index); next != 0u) {
+				steps.emplace(next, index);
+			}
+		}
+	}
+
+	m_textureStreamingBudgetTopMips.clear();
+	for (const BudgetedTexture& entry : textures) {
+		if (entry.topMip != entry.desiredTopMip) {
+			m_textureStreamingBudgetTopMips[entry.streamingTextureID] = entry.topMip;
+		}
+		if (entry.topMip == entry.texture->GetStreamingState().requestedTopMip) {
+			continue;
+		}
+
+		const uint64_t previousRevision = entry.texture->GetStreamingStateRevision();
+		entry.texture->ApplyStreamingSystemRequest(entry.topMip);
+		if (entry.texture->GetStreamingStateRevision() != previousRevision) {
+			MarkTextureStreamingMetadataDirty(entry.texture, true);
+		}
+	}
+}
+
+void MaterialManager::GatherTextureStreamingMemoryDemand(budget::MemoryDemand& demand) const {
+	demand.quantumBytes = kTextureStreamingBudgetQuantumBytes;
+	for (const auto& [streamingTextureID, weakTexture] : m_streamingTexturesByID) {
+		auto texture = weakTexture.lock();
+		if (!texture || !texture->IsMipStreamingEnabled()) {
+			continue;
+		}
+
+		TextureChainEstimate estimate;
+		if (!EstimateTextureChain(*texture, estimate)) {
+			continue;
+		}
+
+		const uint32_t coarsestMip = estimate.totalMipCount - 1u;
+		auto desiredIt = m_textureStreamingDesiredTopMips.find(streamingTextureID);
+		const uint32_t desiredTopMip = (std::min)(
+			desiredIt != m_textureStreamingDesiredTopMips.end() ? desiredIt->second : texture->GetStreamingState().requestedTopMip,
+			coarsestMip);
+
+		// The coarsest mip is always kept; each finer level the feedback asked
+		// for is worth one unit of quality.
+		uint64_t bytes = estimate.BytesForTopMip(coarsestMip);
+		demand.minBytes += bytes;
+		for (uint32_t mip = coarsestMip; mip > desiredTopMip; --mip) {
+			const uint64_t finerBytes = estimate.BytesForTopMip(mip - 1u);
+			if (finerBytes > bytes) {
+				demand.segments.push_back({ finerBytes - bytes, budget::kBytesPerMiB / static_cast<double>(finerBytes - bytes) });
+			}
+			bytes = finerBytes;
+		}
+	}
+
+	std::sort(demand.segments.begin(), demand.segments.end(), [](const budget::MemoryDemandSegment& lhs, const budget::MemoryDemandSegment& rhs) {
+		return lhs.qualityPerMiB > rhs.qualityPerMiB;
+	});
+	budget::CoarsenMemoryDemand(demand, kTextureStreamingDemandMaxSegments);
+}
+
 MaterialTextureStreamingStats MaterialManager::GetMaterialTextureStreamingStats() const {
 	MaterialTextureStreamingStats stats{};
 	std::unordered_set<uint64_t> seenImageResourceIDs;
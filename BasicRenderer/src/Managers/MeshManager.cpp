@@ -3,6 +3,7 @@
 #include "Managers/Singletons/ResourceManager.h"
 #include "Managers/Singletons/TaskSchedulerManager.h"
 #include "Managers/Singletons/DirectStorageManager.h"
+#include "Managers/Singletons/AsyncFileIoManager.h"
 #include "Managers/Singletons/DeviceManager.h"
 #include "Managers/Singletons/SettingsManager.h"
 #include "Mesh/Mesh.h"
@@ -16,6 +17,7 @@
 #include "Render/GraphExtensions/ClusterLOD/CLodCommon.h"
 #include <algorithm>
 #include <bit>
+#include <cmath>
 #include <cstring>
 #include <iterator>
 #include <limits>
@@ -44,6 +46,29 @@ MeshManager::MeshManager() {
 		m_clodStreamingDirectStorageEnabled.store(true, std::memory_order_release);
 	}
 
+	try {
+		auto& settingsManager = SettingsManager::GetInstance();
+		m_clodReadCoalesceGapBytes.store(
+			settingsManager.getSettingGetter<uint32_t>(CLodStreamingReadCoalesceGapBytesSettingName)(),
+			std::memory_order_release);
+		m_clodReadCoalesceMaxBytes.store(
+			settingsManager.getSettingGetter<uint32_t>(CLodStreamingReadCoalesceMaxBytesSettingName)(),
+			std::memory_order_release);
+		m_clodReadCoalesceGapSubscription = settingsManager.addObserver<uint32_t>(
+			CLodStreamingReadCoalesceGapBytesSettingName,
+			[this](const uint32_t& bytes) {
+				m_clodReadCoalesceGapBytes.store(bytes, std::memory_order_release);
+			});
+		m_clodReadCoalesceMaxSubscription = settingsManager.addObserver<uint32_t>(
+			CLodStreamingReadCoalesceMaxBytesSettingName,
+			[this](const uint32_t& bytes) {
+				m_clodReadCoalesceMaxBytes.store(bytes, std::memory_order_release);
+			});
+	}
+	catch (const std::exception&) {
+		// Keep the ReadCoalescingOptions defaults.
+	}
+
 	{
 		auto result = DeviceManager::GetInstance().GetDevice().CreateTimeline(
 			m_clodDirectStorageCompletionFencePtr,
@@ -137,6 +162,8 @@ void MeshManager::InvalidateCLodDiskStreamingPipeline() {
 
 	{
 		std::lock_guard<std::mutex> lock(m_clodDiskStreamingMutex);
+		m_clodDiskStreamingCancellation.Cancel();
+		m_clodDiskStreamingCancellation = TaskCancellationToken::Create();
 		m_clodDiskStreamingRequests.clear();
 		m_clodDiskStreamingQueuedGroups.clear();
 	}
@@ -150,11 +177,14 @@ void MeshManager::InvalidateCLodDiskStreamingPipeline() {
 void MeshManager::DispatchCLodDiskStreamingBatch() {
 	// Drain up to kMaxIoBatchSize highest-priority requests from the pending queue.
 	std::vector<CLodDiskStreamingRequest> batch;
+	TaskOptions ioTaskOptions;
+	ioTaskOptions.priority = TaskPriority::High;
 	{
 		std::lock_guard<std::mutex> lock(m_clodDiskStreamingMutex);
 		if (m_clodDiskStreamingRequests.empty()) {
 			return;
 		}
+		ioTaskOptions.cancellationToken = m_clodDiskStreamingCancellation;
 
 		// Sort so highest-priority requests are at the back.
 		std::sort(m_clodDiskStreamingRequests.begin(), m_clodDiskStreamingRequests.end(),
@@ -171,139 +201,431 @@ void MeshManager::DispatchCLodDiskStreamingBatch() {
 		m_clodDiskStreamingRequests.resize(m_clodDiskStreamingRequests.size() - toDrain);
 	}
 
-	// Dispatch each request as a fire-and-forget IO task on the dedicated IO
-	// thread pool. Each task captures its request by move, performs the disk
-	// read, and pushes the result directly into the shared results vector.
+	CLodCache::ReadCoalescingOptions coalescing{};
+	coalescing.maxGapBytes = m_clodReadCoalesceGapBytes.load(std::memory_order_acquire);
+	coalescing.maxReadBytes = m_clodReadCoalesceMaxBytes.load(std::memory_order_acquire);
+
 	auto& scheduler = TaskSchedulerManager::GetInstance();
-	for (auto& request : batch) {
+	auto queueSingle = [&](CLodDiskStreamingRequest&& request) {
 		scheduler.QueueIoTask("CLodDiskStreaming",
 			[this, request = std::move(request)]() mutable {
-			CLodDiskStreamingResult result{};
-			result.groupGlobalIndex = request.groupGlobalIndex;
-			result.cacheSource = request.cacheSource;
-			result.segmentNeedsFetch = request.segmentNeedsFetch;
-			result.meshPageIndices = request.meshPageIndices;
-			result.generation = request.generation;
-
-			struct TLContainerState {
-				std::wstring containerFileName;
-				std::string sourceIdentifier;
-				std::ifstream file;
-				uint32_t pageCount = 0;
-				bool valid = false;
-			};
-			thread_local TLContainerState tls;
-
-			if (!tls.valid
-				|| tls.containerFileName != request.cacheSource.containerFileName
-				|| tls.sourceIdentifier != request.cacheSource.sourceIdentifier) {
-				tls.file.close();
-				tls.valid = false;
-				tls.containerFileName = request.cacheSource.containerFileName;
-				tls.sourceIdentifier = request.cacheSource.sourceIdentifier;
-				tls.pageCount = 0;
-				if (CLodCache::OpenContainerFile(request.cacheSource, tls.file, tls.pageCount)) {
-					tls.valid = true;
-				}
+			ExecuteCLodDiskStreamingRequest(request);
+		}, ioTaskOptions);
+	};
+
+	// Dispatch each request as a fire-and-forget, high-priority IO task on the
+	// dedicated IO thread pool. Each task performs the disk read and pushes the
+	// result directly into the shared results vector. Tasks still queued when
+	// streaming is invalidated are dropped.
+	if (coalescing.maxReadBytes == 0u) {
+		for (auto& request : batch) {
+			queueSingle(std::move(request));
+		}
+		return;
+	}
+
+	// Requests from the same container are planned together: their page blobs
+	// are sorted by file offset and near-adjacent ones are read as one extent.
+	// Requests joined by a shared extent form one IO task; unrelated ones keep
+	// their own task so they still proceed in parallel.
+	// Containers keep the order of their highest-priority request.
+	std::vector<uint32_t> containerRank(batch.size());
+	std::vector<uint32_t> order(batch.size());
+	for (uint32_t i = 0; i < static_cast<uint32_t>(batch.size()); ++i) {
+		order[i] = i;
+		containerRank[i] = i;
+		for (uint32_t j = 0; j < i; ++j) {
+			if (batch[j].cacheSource.containerFileName == batch[i].cacheSource.containerFileName
+				&& batch[j].cacheSource.sourceIdentifier == batch[i].cacheSource.sourceIdentifier) {
+				containerRank[i] = containerRank[j];
+				break;
 			}
+		}
+	}
+	std::stable_sort(order.begin(), order.end(), [&containerRank](uint32_t a, uint32_t b) {
+		return containerRank[a] < containerRank[b];
+	});
 
-			if (!tls.valid ||
-				request.pageDiskLocators.size() != tls.pageCount ||
-				std::any_of(request.meshPageIndices.begin(), request.meshPageIndices.end(), [&](uint32_t pageIndex) { return pageIndex >= tls.pageCount; })) {
-				result.success = false;
-				std::lock_guard<std::mutex> resultsLock(m_clodDiskStreamingResultsMutex);
-				m_clodDiskStreamingResults.push_back(std::move(result));
-				return;
+	CLodCache::ReadScheduleStats batchStats{};
+	uint64_t fetchedGroupCount = 0;
+	CLodCache::ReadScheduler containerPlan(coalescing);
+	std::vector<uint32_t> containerRequests;
+	std::vector<uint32_t> componentParent;
+	std::vector<uint32_t> componentRequests;
+	size_t runBegin = 0;
+	while (runBegin < order.size()) {
+		size_t runEnd = runBegin + 1;
+		while (runEnd < order.size() && containerRank[order[runEnd]] == containerRank[order[runBegin]]) {
+			++runEnd;
+		}
+
+		// Plan the container. Requests with nothing to fetch or bad page
+		// indices keep the per-request path, which reports them as before.
+		containerPlan.Clear();
+		containerRequests.clear();
+		for (size_t runIndex = runBegin; runIndex < runEnd; ++runIndex) {
+			CLodDiskStreamingRequest& request = batch[order[runIndex]];
+			bool plannable = !request.meshPageIndices.empty();
+			for (uint32_t meshPageIndex : request.meshPageIndices) {
+				plannable = plannable && meshPageIndex < request.pageDiskLocators.size();
+			}
+			if (!plannable) {
+				queueSingle(std::move(request));
+				continue;
 			}
 
-			CLodCache::LoadedGroupPayload payload{};
-			bool loaded = false;
-			const std::wstring containerPath = CLodCache::ResolveContainerPath(request.cacheSource);
-			const bool clodDirectStorageEnabled = m_clodStreamingDirectStorageEnabled.load(std::memory_order_acquire);
-			const bool clodGpuDirectStorageEnabled = false;
-			if (clodGpuDirectStorageEnabled && !containerPath.empty()) {
-				if (request.prefetchedLayout.has_value() && request.prefetchedLayout->IsValid()) {
-					result.groupChunkMetadata = request.prefetchedLayout->groupChunkMetadata;
-					result.directStoragePageBlobSizes = request.prefetchedLayout->pageBlobSizes;
-					result.directStoragePageBlobOffsets = request.prefetchedLayout->pageBlobOffsets;
-					loaded = true;
+			const uint32_t localIndex = static_cast<uint32_t>(containerRequests.size());
+			bool fetchesAny = false;
+			for (uint32_t pageOffset = 0; pageOffset < static_cast<uint32_t>(request.meshPageIndices.size()); ++pageOffset) {
+				if (pageOffset < request.segmentNeedsFetch.size() && !request.segmentNeedsFetch[pageOffset]) {
+					continue;
 				}
+				const ClusterLODGroupDiskLocator& locator = request.pageDiskLocators[request.meshPageIndices[pageOffset]];
+				containerPlan.AddRead(localIndex, pageOffset, locator.blobOffset, locator.blobSizeBytes);
+				fetchesAny = true;
+			}
+			if (!fetchesAny) {
+				queueSingle(std::move(request));
+				continue;
+			}
+			containerRequests.push_back(order[runIndex]);
+		}
+		containerPlan.Build();
+
+		const CLodCache::ReadScheduleStats& planStats = containerPlan.GetStats();
+		batchStats.pageReads += planStats.pageReads;
+		batchStats.issuedReads += planStats.issuedReads;
+		batchStats.requestedBytes += planStats.requestedBytes;
+		batchStats.bytesRead += planStats.bytesRead;
+		fetchedGroupCount += containerRequests.size();
+
+		// Union requests that share an extent.
+		componentParent.resize(containerRequests.size());
+		for (uint32_t i = 0; i < static_cast<uint32_t>(componentParent.size()); ++i) {
+			componentParent[i] = i;
+		}
+		auto findRoot = [&componentParent](uint32_t index) {
+			while (componentParent[index] != index) {
+				componentParent[index] = componentParent[componentParent[index]];
+				index = componentParent[index];
+			}
+			return index;
+		};
+		for (uint32_t extentIndex = 0; extentIndex < static_cast<uint32_t>(containerPlan.Extents().size()); ++extentIndex) {
+			const auto reads = containerPlan.ExtentReads(extentIndex);
+			const uint32_t root = findRoot(reads.front().requestIndex);
+			for (const CLodCache::PageRead& read : reads.subspan(1)) {
+				componentParent[findRoot(read.requestIndex)] = root;
+			}
+		}
 
-				if (!loaded) {
-					CLodCache::GroupPayloadLayoutMetadata layout;
-					loaded = CLodCache::GetMeshPagePayloadLayout(
-						std::span<const ClusterLODGroupDiskLocator>(request.pageDiskLocators.data(), request.pageDiskLocators.size()),
-						std::span<const uint32_t>(request.meshPageIndices.data(), request.meshPageIndices.size()),
-						layout);
-					if (loaded) {
-						result.directStoragePageBlobSizes = std::move(layout.pageBlobSizes);
-						result.directStoragePageBlobOffsets = std::move(layout.pageBlobOffsets);
-					}
-				}
-				if (loaded) {
-					result.uploadPathLabel = "DirectStorageGpuDirect";
-					result.directStorageGpuUploadPending = true;
-				}
-				else {
-					tls.file.clear();
-					spdlog::debug(
-						"CLod streaming: DirectStorage GPU upload prep fallback for group {}",
-						request.groupGlobalIndex);
+		for (uint32_t rootIndex = 0; rootIndex < static_cast<uint32_t>(containerRequests.size()); ++rootIndex) {
+			if (findRoot(rootIndex) != rootIndex) {
+				continue;
+			}
+			componentRequests.clear();
+			for (uint32_t localIndex = 0; localIndex < static_cast<uint32_t>(containerRequests.size()); ++localIndex) {
+				if (findRoot(localIndex) == rootIndex) {
+					componentRequests.push_back(localIndex);
 				}
 			}
 
-			if (!loaded && clodDirectStorageEnabled && DirectStorageManager::GetInstance().CanServiceQueue(DirectStorageQueueKind::SystemMemory)) {
-				const std::wstring containerPath = CLodCache::ResolveContainerPath(request.cacheSource);
-				if (!containerPath.empty()) {
-					std::string directStorageMessage;
-					loaded = CLodCache::LoadMeshPagesSelectiveDirectStorage(
-						containerPath,
-						std::span<const ClusterLODGroupDiskLocator>(request.pageDiskLocators.data(), request.pageDiskLocators.size()),
-						std::span<const uint32_t>(request.meshPageIndices.data(), request.meshPageIndices.size()),
-						request.segmentNeedsFetch,
-						payload,
-						&directStorageMessage);
-					if (loaded) {
-						result.uploadPathLabel = "DirectStorageSystemMemoryThenCpuUpload";
-					}
-					if (!loaded) {
-						tls.file.clear();
-						spdlog::debug(
-							"CLod streaming: DirectStorage page read fallback for group {}: {}",
-							request.groupGlobalIndex,
-							directStorageMessage);
+			// Re-plan the component so its task carries only its own reads.
+			std::vector<CLodDiskStreamingRequest> requests;
+			requests.reserve(componentRequests.size());
+			CLodCache::ReadScheduler plan(coalescing);
+			for (uint32_t localIndex : componentRequests) {
+				CLodDiskStreamingRequest& request = batch[containerRequests[localIndex]];
+				const uint32_t requestIndex = static_cast<uint32_t>(requests.size());
+				for (uint32_t pageOffset = 0; pageOffset < static_cast<uint32_t>(request.meshPageIndices.size()); ++pageOffset) {
+					if (pageOffset < request.segmentNeedsFetch.size() && !request.segmentNeedsFetch[pageOffset]) {
+						continue;
 					}
+					const ClusterLODGroupDiskLocator& locator = request.pageDiskLocators[request.meshPageIndices[pageOffset]];
+					plan.AddRead(requestIndex, pageOffset, locator.blobOffset, locator.blobSizeBytes);
 				}
+				requests.push_back(std::move(request));
 			}
+			plan.Build();
 
-			if (!loaded) {
-				loaded = CLodCache::LoadMeshPagesSelective(
-					tls.file,
-					std::span<const ClusterLODGroupDiskLocator>(request.pageDiskLocators.data(), request.pageDiskLocators.size()),
-					std::span<const uint32_t>(request.meshPageIndices.data(), request.meshPageIndices.size()),
-					request.segmentNeedsFetch,
-					payload);
-			}
+			scheduler.QueueIoTask("CLodDiskStreamingCoalesced",
+				[this, requests = std::move(requests), plan = std::move(plan)]() mutable {
+				ExecuteCLodCoalescedDiskStreamingRequests(requests, plan);
+			}, ioTaskOptions);
+		}
+
+		runBegin = runEnd;
+	}
+
+	m_debugDiskPageReads.fetch_add(batchStats.pageReads, std::memory_order_relaxed);
+	m_debugDiskIssuedReads.fetch_add(batchStats.issuedReads, std::memory_order_relaxed);
+	m_debugDiskBytesRead.fetch_add(batchStats.bytesRead, std::memory_order_relaxed);
+	TracyPlot("CLod Streaming/Pages Per Group Request", fetchedGroupCount != 0u ? static_cast<double>(batchStats.pageReads) / static_cast<double>(fetchedGroupCount) : 0.0);
+	TracyPlot("CLod Streaming/Page Reads", static_cast<int64_t>(batchStats.pageReads));
+	TracyPlot("CLod Streaming/Issued Reads", static_cast<int64_t>(batchStats.issuedReads));
+	TracyPlot("CLod Streaming/Bytes Read", static_cast<int64_t>(batchStats.bytesRead));
+	TracyPlot("CLod Streaming/Gap Bytes Read", static_cast<int64_t>(batchStats.bytesRead - (std::min)(batchStats.bytesRead, batchStats.requestedBytes)));
+}
+
+MeshManager::ThreadContainerFile& MeshManager::AcquireThreadContainerFile(const ClusterLODCacheSource& cacheSource) {
+	thread_local ThreadContainerFile tls;
+	if (!tls.valid
+		|| tls.containerFileName != cacheSource.containerFileName
+		|| tls.sourceIdentifier != cacheSource.sourceIdentifier) {
+		tls.file.close();
+		tls.file.clear();
+		tls.valid = false;
+		tls.containerFileName = cacheSource.containerFileName;
+		tls.sourceIdentifier = cacheSource.sourceIdentifier;
+		tls.pageCount = 0;
+		if (CLodCache::OpenContainerFile(cacheSource, tls.file, tls.pageCount)) {
+			tls.valid = true;
+		}
+	}
+	return tls;
+}
+
+void MeshManager::ExecuteCLodDiskStreamingRequest(CLodDiskStreamingRequest& request) {
+	CLodDiskStreamingResult result{};
+	result.groupGlobalIndex = request.groupGlobalIndex;
+	result.cacheSource = request.cacheSource;
+	result.segmentNeedsFetch = request.segmentNeedsFetch;
+	result.meshPageIndices = request.meshPageIndices;
+	result.generation = request.generation;
+
+	ThreadContainerFile& tls = AcquireThreadContainerFile(request.cacheSource);
 
+	if (!tls.valid ||
+		request.pageDiskLocators.size() != tls.pageCount ||
+		std::any_of(request.meshPageIndices.begin(), request.meshPageIndices.end(), [&](uint32_t pageIndex) { return pageIndex >= tls.pageCount; })) {
+		result.success = false;
+		std::lock_guard<std::mutex> resultsLock(m_clodDiskStreamingResultsMutex);
+		m_clodDiskStreamingResults.push_back(std::move(result));
+		return;
+	}
+
+	CLodCache::LoadedGroupPayload payload{};
+	bool loaded = false;
+	const std::wstring containerPath = CLodCache::ResolveContainerPath(request.cacheSource);
+	const bool clodDirectStorageEnabled = m_clodStreamingDirectStorageEnabled.load(std::memory_order_acquire);
+	const bool clodGpuDirectStorageEnabled = false;
+	if (clodGpuDirectStorageEnabled && !containerPath.empty()) {
+		if (request.prefetchedLayout.has_value() && request.prefetchedLayout->IsValid()) {
+			result.groupChunkMetadata = request.prefetchedLayout->groupChunkMetadata;
+			result.directStoragePageBlobSizes = request.prefetchedLayout->pageBlobSizes;
+			result.directStoragePageBlobOffsets = request.prefetchedLayout->pageBlobOffsets;
+			loaded = true;
+		}
+
+		if (!loaded) {
+			CLodCache::GroupPayloadLayoutMetadata layout;
+			loaded = CLodCache::GetMeshPagePayloadLayout(
+				std::span<const ClusterLODGroupDiskLocator>(request.pageDiskLocators.data(), request.pageDiskLocators.size()),
+				std::span<const uint32_t>(request.meshPageIndices.data(), request.meshPageIndices.size()),
+				layout);
 			if (loaded) {
-				if (!result.directStorageGpuUploadPending) {
-					result.groupChunkMetadata = payload.groupChunkMetadata;
-					result.pageBlobs = std::move(payload.pageBlobs);
-				}
-				result.preAllocatedPages = std::move(request.preAllocatedPages);
-				result.success = true;
+				result.directStoragePageBlobSizes = std::move(layout.pageBlobSizes);
+				result.directStoragePageBlobOffsets = std::move(layout.pageBlobOffsets);
+			}
+		}
+		if (loaded) {
+			result.uploadPathLabel = "DirectStorageGpuDirect";
+			result.directStorageGpuUploadPending = true;
+		}
+		else {
+			tls.file.clear();
+			spdlog::debug(
+				"CLod streaming: DirectStorage GPU upload prep fallback for group {}",
+				request.groupGlobalIndex);
+		}
+	}
 
-				// Child layout prefetch is now handled on the main thread where
-				// group -> mesh-page intervals are available.
+	if (!loaded && clodDirectStorageEnabled && DirectStorageManager::GetInstance().CanServiceQueue(DirectStorageQueueKind::SystemMemory)) {
+		const std::wstring containerPath = CLodCache::ResolveContainerPath(request.cacheSource);
+		if (!containerPath.empty()) {
+			std::string directStorageMessage;
+			loaded = CLodCache::LoadMeshPagesSelectiveDirectStorage(
+				containerPath,
+				std::span<const ClusterLODGroupDiskLocator>(request.pageDiskLocators.data(), request.pageDiskLocators.size()),
+				std::span<const uint32_t>(request.meshPageIndices.data(), request.meshPageIndices.size()),
+				request.segmentNeedsFetch,
+				payload,
+				&directStorageMessage);
+			if (loaded) {
+				result.uploadPathLabel = "DirectStorageSystemMemoryThenCpuUpload";
 			}
-			else {
-				result.success = false;
+			if (!loaded) {
 				tls.file.clear();
+				spdlog::debug(
+					"CLod streaming: DirectStorage page read fallback for group {}: {}",
+					request.groupGlobalIndex,
+					directStorageMessage);
 			}
+		}
+	}
 
-			std::lock_guard<std::mutex> resultsLock(m_clodDiskStreamingResultsMutex);
-			m_clodDiskStreamingResults.push_back(std::move(result));
-		});
+	if (!loaded && !containerPath.empty() && AsyncFileIoManager::GetInstance().IsInitialized()) {
+		std::string asyncFileIoMessage;
+		loaded = CLodCache::LoadMeshPagesSelectiveAsyncFileIo(
+			containerPath,
+			std::span<const ClusterLODGroupDiskLocator>(request.pageDiskLocators.data(), request.pageDiskLocators.size()),
+			std::span<const uint32_t>(request.meshPageIndices.data(), request.meshPageIndices.size()),
+			request.segmentNeedsFetch,
+			payload,
+			&asyncFileIoMessage);
+		if (loaded) {
+			result.uploadPathLabel = "AsyncFileIoThenCpuUpload";
+		}
+		else {
+			spdlog::debug(
+				"CLod streaming: async file IO page read fallback for group {}: {}",
+				request.groupGlobalIndex,
+				asyncFileIoMessage);
+		}
+	}
+
+	if (!loaded) {
+		loaded = CLodCache::LoadMeshPagesSelective(
+			tls.file,
+			std::span<const ClusterLODGroupDiskLocator>(request.pageDiskLocators.data(), request.pageDiskLocators.size()),
+			std::span<const uint32_t>(request.meshPageIndices.data(), request.meshPageIndices.size()),
+			request.segmentNeedsFetch,
+			payload);
+	}
+
+	if (loaded) {
+		if (!result.directStorageGpuUploadPending) {
+			result.groupChunkMetadata = payload.groupChunkMetadata;
+			result.pageBlobs = std::move(payload.pageBlobs);
+		}
+		result.preAllocatedPages = std::move(request.preAllocatedPages);
+		result.success = true;
+
+		// Child layout prefetch is now handled on the main thread where
+		// group -> mesh-page intervals are available.
+	}
+	else {
+		result.success = false;
+		tls.file.clear();
+	}
+
+	std::lock_guard<std::mutex> resultsLock(m_clodDiskStreamingResultsMutex);
+	m_clodDiskStreamingResults.push_back(std::move(result));
+}
+
+void MeshManager::ExecuteCLodCoalescedDiskStreamingRequests(std::vector<CLodDiskStreamingRequest>& requests, const CLodCache::ReadScheduler& plan) {
+	if (requests.empty()) {
+		return;
+	}
+
+	// Any problem falls back to the per-request path, which validates and
+	// reports each group on its own.
+	auto fallBack = [&]() {
+		for (auto& request : requests) {
+			ExecuteCLodDiskStreamingRequest(request);
+		}
+	};
+
+	const ClusterLODCacheSource& cacheSource = requests.front().cacheSource;
+	ThreadContainerFile& tls = AcquireThreadContainerFile(cacheSource);
+	const bool valid = tls.valid && std::all_of(requests.begin(), requests.end(), [&](const CLodDiskStreamingRequest& request) {
+		return request.pageDiskLocators.size() == tls.pageCount;
+	});
+	if (!valid) {
+		fallBack();
+		return;
+	}
+
+	const auto extents = plan.Extents();
+	std::vector<std::vector<std::byte>> extentData;
+	std::string uploadPathLabel;
+	bool loaded = false;
+	const std::wstring containerPath = CLodCache::ResolveContainerPath(cacheSource);
+	if (!containerPath.empty()
+		&& m_clodStreamingDirectStorageEnabled.load(std::memory_order_acquire)
+		&& DirectStorageManager::GetInstance().CanServiceQueue(DirectStorageQueueKind::SystemMemory)) {
+		extentData.assign(extents.size(), {});
+		loaded = true;
+		for (size_t i = 0; i < extents.size() && loaded; ++i) {
+			std::string message;
+			loaded = DirectStorageManager::GetInstance().ReadFileRegionToMemory(
+				containerPath,
+				extents[i].offset,
+				extents[i].sizeBytes,
+				extentData[i],
+				&message);
+			if (!loaded) {
+				spdlog::debug("CLod streaming: DirectStorage coalesced read fallback: {}", message);
+			}
+		}
+		uploadPathLabel = "DirectStorageSystemMemoryThenCpuUpload";
+	}
+
+	if (!loaded && !containerPath.empty() && AsyncFileIoManager::GetInstance().IsInitialized()) {
+		std::vector<AsyncFileReadRegion> regions;
+		regions.reserve(extents.size());
+		for (const CLodCache::ReadExtent& extent : extents) {
+			regions.push_back({ extent.offset, extent.sizeBytes });
+		}
+		std::string message;
+		extentData.clear();
+		loaded = AsyncFileIoManager::GetInstance().ReadFileRegionsToMemory(containerPath, regions, extentData, &message)
+			&& extentData.size() == extents.size();
+		if (!loaded) {
+			spdlog::debug("CLod streaming: async file IO coalesced read fallback: {}", message);
+		}
+		uploadPathLabel = "AsyncFileIoThenCpuUpload";
+	}
+
+	if (!loaded) {
+		extentData.assign(extents.size(), {});
+		loaded = true;
+		for (size_t i = 0; i < extents.size() && loaded; ++i) {
+			loaded = CLodCache::ReadExtentFromStream(tls.file, extents[i], extentData[i]);
+		}
+		if (!loaded) {
+			tls.file.clear();
+		}
+		uploadPathLabel = "CpuReadThenCpuUpload";
+	}
+
+	if (!loaded) {
+		fallBack();
+		return;
+	}
+
+	std::vector<std::vector<std::vector<std::byte>>> pageBlobs(requests.size());
+	for (size_t i = 0; i < requests.size(); ++i) {
+		pageBlobs[i].assign(requests[i].meshPageIndices.size(), {});
+	}
+	const auto sink = [&pageBlobs](uint32_t requestIndex, uint32_t pageSlot, std::span<const std::byte> data) {
+		pageBlobs[requestIndex][pageSlot].assign(data.begin(), data.end());
+	};
+	for (uint32_t extentIndex = 0; extentIndex < static_cast<uint32_t>(extents.size()); ++extentIndex) {
+		if (!plan.Scatter(extentIndex, extentData[extentIndex], sink)) {
+			fallBack();
+			return;
+		}
+	}
+
+	std::vector<CLodDiskStreamingResult> results(requests.size());
+	for (size_t i = 0; i < requests.size(); ++i) {
+		CLodDiskStreamingRequest& request = requests[i];
+		CLodDiskStreamingResult& result = results[i];
+		result.groupGlobalIndex = request.groupGlobalIndex;
+		result.cacheSource = request.cacheSource;
+		result.segmentNeedsFetch = request.segmentNeedsFetch;
+		result.meshPageIndices = request.meshPageIndices;
+		result.generation = request.generation;
+		result.uploadPathLabel = uploadPathLabel;
+		result.pageBlobs = std::move(pageBlobs[i]);
+		result.preAllocatedPages = std::move(request.preAllocatedPages);
+		result.success = true;
+	}
+
+	std::lock_guard<std::mutex> resultsLock(m_clodDiskStreamingResultsMutex);
+	for (auto& result : results) {
+		m_clodDiskStreamingResults.push_back(std::move(result));
 	}
 }
 
@@ -487,6 +809,7 @@ void MeshManager::AddMesh(std::shared_ptr<Mesh>& mesh, bool useMeshletReorderedV
 		m_clodSharedStreamingStateByMesh[mesh.get()] = sharedState;
 		m_clodSharedStreamingRangesDirty = true;
 		m_clodStreamingStructureDirty = true;
+		m_clodResidencyJournalEpoch.fetch_add(1, std::memory_order_acq_rel);
 
 	}
 
@@ -613,6 +936,7 @@ void MeshManager::RemoveMeshInstance(MeshInstance* mesh) {
 					m_clodSharedStreamingStateByMesh.erase(mesh->GetMesh().get());
 					m_clodSharedStreamingRangesDirty = true;
 					m_clodStreamingStructureDirty = true;
+					m_clodResidencyJournalEpoch.fetch_add(1, std::memory_order_acq_rel);
 					if (removedTraversalDepth >= m_clodActiveMaxTraversalDepth.load(std::memory_order_acquire)) {
 						RecomputeCLodActiveMaxTraversalDepth();
 					}
@@ -1161,6 +1485,9 @@ bool MeshManager::CommitCLodGroupResidency(
 
 	sharedState->baselineGroupChunks[localIndex] = chunk;
 	sharedState->groupResidentFlags[localIndex] = 1u;
+	RecordCLodResidencyChange(
+		groupGlobalIndex,
+		wasResident ? CLodResidencyChange::PagesRemapped : CLodResidencyChange::BecameResident);
 
 	if (!wasResident) {
 		m_debugResidentGroups.fetch_add(1u, std::memory_order_relaxed);
@@ -1742,6 +2069,7 @@ bool MeshManager::ApplyCLodGroupEviction(CLodSharedStreamingState& state, uint32
 	}
 
 	state.groupResidentFlags[groupLocalIndex] = 0u;
+	RecordCLodResidencyChange(state.groupsBase + groupLocalIndex, CLodResidencyChange::Evicted);
 	{
 		uint32_t prev = m_debugResidentGroups.load(std::memory_order_relaxed);
 		if (prev > 0u) m_debugResidentGroups.store(prev - 1u, std::memory_order_relaxed);
@@ -1976,6 +2304,92 @@ bool MeshManager::ConsumeCLodStreamingStructureDirty() {
 	return m_clodStreamingStructureDirty.exchange(false);
 }
 
+void MeshManager::SetCLodInstanceWorldTransform(const MeshInstance* instance, const DirectX::XMMATRIX& world) {
+	auto itLookup = m_clodStreamingInstanceIndexByPtr.find(instance);
+	if (itLookup == m_clodStreamingInstanceIndexByPtr.end()) {
+		return;
+	}
+	auto itState = m_clodStreamingStateByInstanceIndex.find(itLookup->second);
+	if (itState == m_clodStreamingStateByInstanceIndex.end()) {
+		return;
+	}
+
+	CLodStreamingInstanceState& state = itState->second;
+	DirectX::XMFLOAT4X4 stored;
+	DirectX::XMStoreFloat4x4(&stored, world);
+	float maxAxisScaleSq = 0.0f;
+	for (int row = 0; row < 4; ++row) {
+		for (int column = 0; column < 3; ++column) {
+			state.prefetch.rows[row][column] = stored.m[row][column];
+		}
+		if (row < 3) {
+			// Same max axis scale the GPU uses for lodUniformScale.
+			const float* axis = stored.m[row];
+			maxAxisScaleSq = std::max(maxAxisScaleSq, axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2]);
+		}
+	}
+	state.prefetch.groupsBase = state.groupsBase;
+	state.prefetch.uniformScale = std::sqrt(maxAxisScaleSq);
+	state.hasWorldTransform = true;
+}
+
+void MeshManager::GetCLodPrefetchMeshes(std::vector<CLodPrefetchGroup>& outGroups, std::vector<CLodPrefetchMesh>& outMeshes) const {
+	outGroups.clear();
+	outMeshes.clear();
+
+	struct MeshGroupRange {
+		uint32_t groupsBase = 0;
+		size_t firstGroup = 0;
+		size_t groupCount = 0;
+	};
+	std::vector<MeshGroupRange> ranges;
+	ranges.reserve(m_clodSharedStreamingStateByMesh.size());
+	for (const auto& [_, sharedState] : m_clodSharedStreamingStateByMesh) {
+		if (sharedState == nullptr || sharedState->activeInstanceCount == 0u || sharedState->groups.empty()) {
+			continue;
+		}
+
+		MeshGroupRange range{};
+		range.groupsBase = sharedState->groupsBase;
+		range.firstGroup = outGroups.size();
+		range.groupCount = std::min<size_t>(sharedState->groups.size(), sharedState->groupCount);
+		for (size_t local = 0; local < range.groupCount; ++local) {
+			const ClusterLODGroup& group = sharedState->groups[local];
+			CLodPrefetchGroup prefetchGroup{};
+			prefetchGroup.center[0] = group.bounds.center[0];
+			prefetchGroup.center[1] = group.bounds.center[1];
+			prefetchGroup.center[2] = group.bounds.center[2];
+			prefetchGroup.radius = group.bounds.radius;
+			// The GPU copy of the error may be overridden for residency
+			// transitions; predict with the original.
+			prefetchGroup.error = local < sharedState->groupErrorByLocal.size()
+				? sharedState->groupErrorByLocal[local]
+				: group.bounds.error;
+			prefetchGroup.parentLocal = local < sharedState->parentGroupByLocal.size()
+				? sharedState->parentGroupByLocal[local]
+				: group.parentGroupId;
+			outGroups.push_back(prefetchGroup);
+		}
+		ranges.push_back(range);
+	}
+
+	// Spans are built after outGroups stops growing.
+	outMeshes.reserve(ranges.size());
+	for (const MeshGroupRange& range : ranges) {
+		outMeshes.push_back({ range.groupsBase, std::span<const CLodPrefetchGroup>(outGroups.data() + range.firstGroup, range.groupCount) });
+	}
+}
+
+void MeshManager::GetCLodPrefetchInstances(std::vector<CLodPrefetchInstance>& outInstances) const {
+	outInstances.clear();
+	outInstances.reserve(m_clodStreamingStateByInstanceIndex.size());
+	for (const auto& [_, state] : m_clodStreamingStateByInstanceIndex) {
+		if (state.hasWorldTransform && state.groupCount != 0u) {
+			outInstances.push_back(state.prefetch);
+		}
+	}
+}
+
 void MeshManager::PatchCLodGroupError(uint32_t groupGlobalIndex, float error) {
 	// bounds.error is at byte offset 16 within ClusterLODGroup:
 	// clodBounds { float center[3]; float radius; float error; }, so error is at offset 16
@@ -1996,6 +2410,9 @@ MeshManager::CLodStreamingDebugStats MeshManager::GetCLodStreamingDebugStats() c
 		? static_cast<uint64_t>(stats.residentAllocations) * m_clodPagePool->GetPageSize()
 		: 0ull;
 	stats.totalStreamedBytes = m_debugTotalStreamedBytes.load(std::memory_order_relaxed);
+	stats.diskPageReads = m_debugDiskPageReads.load(std::memory_order_relaxed);
+	stats.diskIssuedReads = m_debugDiskIssuedReads.load(std::memory_order_relaxed);
+	stats.diskBytesRead = m_debugDiskBytesRead.load(std::memory_order_relaxed);
 	{
 		std::lock_guard<std::mutex> lock(m_clodDiskStreamingMutex);
 		stats.queuedRequests = static_cast<uint32_t>(m_clodDiskStreamingRequests.size());
@@ -2031,6 +2448,57 @@ MeshManager::CLodStreamingDebugStats MeshManager::GetCLodStreamingDebugStats() c
 	return stats;
 }
 
+void MeshManager::RecordCLodResidencyChange(uint32_t groupGlobalIndex, CLodResidencyChange change) {
+	// Caller holds m_clodResidencyMutex. A consumer that falls further behind than
+	// the cap resyncs from the full resident set instead.
+	if (m_clodResidencyJournal.size() >= kMaxResidencyJournalEntries) {
+		m_clodResidencyJournalFirstSequence += m_clodResidencyJournal.size();
+		m_clodResidencyJournal.clear();
+	}
+	m_clodResidencyJournal.push_back({ groupGlobalIndex, change });
+}
+
+bool MeshManager::BuildCLodRayTracingResidentGroup(
+	const CLodSharedStreamingState& state,
+	uint32_t groupGlobalIndex,
+	uint32_t groupLocalIndex,
+	CLodRayTracingResidentGroup& outGroup) const {
+	if (!IsCLodGroupResident(state, groupLocalIndex)) {
+		return false;
+	}
+
+	if (groupLocalIndex >= state.residentGroupAllocations.size() ||
+		groupLocalIndex >= state.baselineGroupChunks.size()) {
+		return false;
+	}
+
+	const ClusterLODGroup& group = state.groups[groupLocalIndex];
+	std::vector<uint32_t> meshPageIndices = GetCLodGroupMeshPageIndices(state, groupLocalIndex);
+	if (meshPageIndices.size() != state.residentGroupAllocations[groupLocalIndex].pageAllocations.size()) {
+		return false;
+	}
+
+	outGroup.groupGlobalIndex = groupGlobalIndex;
+	outGroup.groupLocalIndex = groupLocalIndex;
+	outGroup.group = group;
+	outGroup.chunk = state.baselineGroupChunks[groupLocalIndex];
+	outGroup.meshPageIndices = std::move(meshPageIndices);
+	outGroup.pageAllocations = state.residentGroupAllocations[groupLocalIndex].pageAllocations;
+	outGroup.segments.clear();
+
+	const uint32_t firstSegment = group.firstSegment;
+	const uint32_t segmentCount = group.segmentCount;
+	if (firstSegment < state.segments.size()) {
+		const uint32_t clampedSegmentCount = std::min<uint32_t>(
+			segmentCount,
+			static_cast<uint32_t>(state.segments.size() - firstSegment));
+		outGroup.segments.assign(
+			state.segments.begin() + firstSegment,
+			state.segments.begin() + firstSegment + clampedSegmentCount);
+	}
+	return true;
+}
+
 void MeshManager::GetCLodRayTracingResidencySnapshot(CLodRayTracingResidencySnapshot& outSnapshot) const {
 	outSnapshot.residentGroups.clear();
 	outSnapshot.pagePool = m_clodPagePool.get();
@@ -2049,41 +2517,105 @@ void MeshManager::GetCLodRayTracingResidencySnapshot(CLodRayTracingResidencySnap
 			state->groupCount,
 			static_cast<uint32_t>(state->groups.size()));
 		for (uint32_t localGroupIndex = 0; localGroupIndex < groupCount; ++localGroupIndex) {
-			if (!IsCLodGroupResident(*state, localGroupIndex)) {
-				continue;
+			CLodRayTracingResidentGroup rtGroup{};
+			if (BuildCLodRayTracingResidentGroup(*state, range.begin + localGroupIndex, localGroupIndex, rtGroup)) {
+				outSnapshot.residentGroups.push_back(std::move(rtGroup));
 			}
+		}
+	}
+}
 
-			if (localGroupIndex >= state->residentGroupAllocations.size() ||
-				localGroupIndex >= state->baselineGroupChunks.size()) {
-				continue;
-			}
+void MeshManager::GetCLodRayTracingResidencyDelta(
+	uint64_t journalEpoch,
+	uint64_t sinceSequence,
+	uint64_t pagePoolGeneration,
+	CLodRayTracingResidencyDelta& outDelta) const {
+	outDelta.residentGroups.clear();
+	outDelta.evictedGroups.clear();
+	outDelta.becameResidentEvents = 0u;
+	outDelta.evictedEvents = 0u;
+	outDelta.remappedEvents = 0u;
+	outDelta.fullResync = false;
+
+	// Read the epoch before taking the snapshot so a structural change that
+	// races with this call forces another resync next time.
+	const uint64_t currentEpoch = m_clodResidencyJournalEpoch.load(std::memory_order_acquire);
+	const uint64_t currentGeneration = m_clodDiskStreamingGeneration.load(std::memory_order_acquire);
 
-			const ClusterLODGroup& group = state->groups[localGroupIndex];
-			std::vector<uint32_t> meshPageIndices = GetCLodGroupMeshPageIndices(*state, localGroupIndex);
-			if (meshPageIndices.size() != state->residentGroupAllocations[localGroupIndex].pageAllocations.size()) {
-				continue;
-			}
+	bool fullResync = journalEpoch != currentEpoch || pagePoolGeneration != currentGeneration;
+	if (!fullResync) {
+		std::lock_guard<std::mutex> residencyLock(m_clodResidencyMutex);
+		fullResync = sinceSequence < m_clodResidencyJournalFirstSequence;
+	}
 
-			CLodRayTracingResidentGroup rtGroup{};
-			rtGroup.groupGlobalIndex = range.begin + localGroupIndex;
-			rtGroup.groupLocalIndex = localGroupIndex;
-			rtGroup.group = group;
-			rtGroup.chunk = state->baselineGroupChunks[localGroupIndex];
-			rtGroup.meshPageIndices = std::move(meshPageIndices);
-			rtGroup.pageAllocations = state->residentGroupAllocations[localGroupIndex].pageAllocations;
-
-			const uint32_t firstSegment = group.firstSegment;
-			const uint32_t segmentCount = group.segmentCount;
-			if (firstSegment < state->segments.size()) {
-				const uint32_t clampedSegmentCount = std::min<uint32_t>(
-					segmentCount,
-					static_cast<uint32_t>(state->segments.size() - firstSegment));
-				rtGroup.segments.assign(
-					state->segments.begin() + firstSegment,
-					state->segments.begin() + firstSegment + clampedSegmentCount);
+	if (fullResync) {
+		CLodRayTracingResidencySnapshot snapshot;
+		{
+			std::lock_guard<std::mutex> residencyLock(m_clodResidencyMutex);
+			outDelta.journalSequence = m_clodResidencyJournalFirstSequence + m_clodResidencyJournal.size();
+		}
+		GetCLodRayTracingResidencySnapshot(snapshot);
+		outDelta.residentGroups = std::move(snapshot.residentGroups);
+		outDelta.pagePool = snapshot.pagePool;
+		outDelta.pagePoolGeneration = currentGeneration;
+		outDelta.journalEpoch = currentEpoch;
+		outDelta.fullResync = true;
+		return;
+	}
+
+	outDelta.pagePool = m_clodPagePool.get();
+	outDelta.pagePoolGeneration = currentGeneration;
+	outDelta.journalEpoch = currentEpoch;
+
+	const_cast<MeshManager*>(this)->RebuildCLodSharedStreamingRangeIndex();
+
+	std::lock_guard<std::mutex> residencyLock(m_clodResidencyMutex);
+	const uint64_t endSequence = m_clodResidencyJournalFirstSequence + m_clodResidencyJournal.size();
+	outDelta.journalSequence = endSequence;
+	if (sinceSequence >= endSequence) {
+		return;
+	}
+
+	// A group may appear several times (streamed in, evicted, streamed in again);
+	// only its state now matters.
+	std::vector<uint32_t> touchedGroups;
+	touchedGroups.reserve(static_cast<size_t>(endSequence - sinceSequence));
+	for (size_t i = static_cast<size_t>(sinceSequence - m_clodResidencyJournalFirstSequence); i < m_clodResidencyJournal.size(); ++i) {
+		const CLodResidencyJournalEntry& entry = m_clodResidencyJournal[i];
+		switch (entry.change) {
+		case CLodResidencyChange::BecameResident: ++outDelta.becameResidentEvents; break;
+		case CLodResidencyChange::Evicted: ++outDelta.evictedEvents; break;
+		case CLodResidencyChange::PagesRemapped: ++outDelta.remappedEvents; break;
+		}
+		touchedGroups.push_back(entry.groupGlobalIndex);
+	}
+	std::sort(touchedGroups.begin(), touchedGroups.end());
+	touchedGroups.erase(std::unique(touchedGroups.begin(), touchedGroups.end()), touchedGroups.end());
+
+	for (uint32_t groupGlobalIndex : touchedGroups) {
+		auto it = std::upper_bound(
+			m_clodSharedStreamingRanges.begin(),
+			m_clodSharedStreamingRanges.end(),
+			groupGlobalIndex,
+			[](uint32_t value, const CLodSharedStreamingRange& range) {
+				return value < range.begin;
+			});
+
+		CLodRayTracingResidentGroup rtGroup{};
+		bool resident = false;
+		if (it != m_clodSharedStreamingRanges.begin()) {
+			--it;
+			if (groupGlobalIndex < it->end && it->state &&
+				groupGlobalIndex - it->begin < std::min<uint32_t>(it->state->groupCount, static_cast<uint32_t>(it->state->groups.size()))) {
+				resident = BuildCLodRayTracingResidentGroup(*it->state, groupGlobalIndex, groupGlobalIndex - it->begin, rtGroup);
 			}
+		}
 
-			outSnapshot.residentGroups.push_back(std::move(rtGroup));
+		if (resident) {
+			outDelta.residentGroups.push_back(std::move(rtGroup));
+		}
+		else {
+			outDelta.evictedGroups.push_back(groupGlobalIndex);
 		}
 	}
 }
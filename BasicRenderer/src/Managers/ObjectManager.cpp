@@ -6,7 +6,7 @@
 #include "Managers/Singletons/ResourceManager.h"
 #include "Resources/Buffers/LazyDynamicStructuredBuffer.h"
 #include "Resources/Buffers/DynamicBuffer.h"
-#include "Resources/Buffers/SortedUnsignedIntBuffer.h"
+#include "Resources/Buffers/DrawSetIndexBuffer.h"
 #include "Mesh/MeshInstance.h"
 #include "Utilities/MathUtils.h"
 #include "../shaders/Common/defines.h"
@@ -74,7 +74,7 @@ Components::ObjectDrawInfo ObjectManager::AddObject(const PerObjectCB& perObject
                         "activeDrawSetIndices(flags=" + std::to_string(static_cast<uint64_t>(workloadKey.compileFlags))
                         + ", phase=" + std::to_string(workloadKey.renderPhase.hash)
                         + ", clodOnly=" + std::to_string(workloadKey.clodOnly ? 1 : 0) + ")";
-                    m_activeDrawSetIndices[workloadKey] = SortedUnsignedIntBuffer::CreateShared(1, debugName);
+                    m_activeDrawSetIndices[workloadKey] = DrawSetIndexBuffer::CreateShared(1, debugName);
                     rg::memory::SetResourceUsageHint(*m_activeDrawSetIndices[workloadKey], "PerMesh, PerMeshInstance, PerObject");
                     auto& buf = m_activeDrawSetIndices[workloadKey];
                     buf->GetECSEntity().add<Components::IsActiveDrawSetIndices>();
@@ -135,6 +135,12 @@ void ObjectManager::RemoveObject(const Components::ObjectDrawInfo* drawInfo) {
 	m_normalMatrixBuffer->Remove(drawInfo->normalMatrixView.get());
 }
 
+void ObjectManager::CommitDrawSetChanges() {
+	for (auto& [_, drawSetIndices] : m_activeDrawSetIndices) {
+		drawSetIndices->Commit();
+	}
+}
+
 void ObjectManager::UpdatePerObjectBuffer(BufferView* view, PerObjectCB& data) {
 	std::lock_guard<std::mutex> lock(m_objectUpdateMutex);
 	m_perObjectBuffers->UpdateView(view, &data);
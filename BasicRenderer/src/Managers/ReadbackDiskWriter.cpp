@@ -0,0 +1,251 @@
+#include "Managers/ReadbackDiskWriter.h"
+
+#include <fstream>
+#include <memory>
+
+namespace br {
+
+namespace {
+
+constexpr uint32_t kDdsMagic = 0x20534444; // "DDS "
+constexpr uint32_t kDdsFourCCDx10 = 0x30315844; // "DX10"
+
+constexpr uint32_t kDdsdCaps = 0x1;
+constexpr uint32_t kDdsdHeight = 0x2;
+constexpr uint32_t kDdsdWidth = 0x4;
+constexpr uint32_t kDdsdPitch = 0x8;
+constexpr uint32_t kDdsdPixelFormat = 0x1000;
+constexpr uint32_t kDdsdMipMapCount = 0x20000;
+constexpr uint32_t kDdsdLinearSize = 0x80000;
+constexpr uint32_t kDdpfFourCC = 0x4;
+constexpr uint32_t kDdsCapsComplex = 0x8;
+constexpr uint32_t kDdsCapsTexture = 0x1000;
+constexpr uint32_t kDdsCapsMipMap = 0x400000;
+constexpr uint32_t kDdsCaps2CubemapAllFaces = 0xFE00;
+constexpr uint32_t kDdsDimensionTexture2D = 3;
+constexpr uint32_t kDdsResourceMiscTextureCube = 0x4;
+
+struct DdsPixelFormat {
+    uint32_t size;
+    uint32_t flags;
+    uint32_t fourCC;
+    uint32_t rgbBitCount;
+    uint32_t rBitMask;
+    uint32_t gBitMask;
+    uint32_t bBitMask;
+    uint32_t aBitMask;
+};
+
+struct DdsHeader {
+    uint32_t size;
+    uint32_t flags;
+    uint32_t height;
+    uint32_t width;
+    uint32_t pitchOrLinearSize;
+    uint32_t depth;
+    uint32_t mipMapCount;
+    uint32_t reserved1[11];
+    DdsPixelFormat pixelFormat;
+    uint32_t caps;
+    uint32_t caps2;
+    uint32_t caps3;
+    uint32_t caps4;
+    uint32_t reserved2;
+};
+
+struct DdsHeaderDx10 {
+    uint32_t dxgiFormat;
+    uint32_t resourceDimension;
+    uint32_t miscFlag;
+    uint32_t arraySize;
+    uint32_t miscFlags2;
+};
+
+static_assert(sizeof(DdsHeader) == 124);
+static_assert(sizeof(DdsHeaderDx10) == 20);
+
+// DXGI_FORMAT_BC1_TYPELESS..BC5_SNORM and BC6H_TYPELESS..BC7_UNORM_SRGB.
+bool IsBlockCompressed(uint32_t dxgiFormat) {
+    return (dxgiFormat >= 70 && dxgiFormat <= 84) || (dxgiFormat >= 94 && dxgiFormat <= 99);
+}
+
+// One large buffered stream per file; rows are appended without staging the image.
+constexpr size_t kStreamBufferBytes = 1u << 20;
+
+template<typename T>
+void WritePod(std::ostream& out, const T& value) {
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+bool OpenOutput(std::ofstream& stream, std::vector<char>& buffer, const std::filesystem::path& path) {
+    buffer.resize(kStreamBufferBytes);
+    stream.rdbuf()->pubsetbuf(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    stream.open(path, std::ios::binary | std::ios::trunc);
+    return static_cast<bool>(stream);
+}
+
+}
+
+bool WriteReadbackRaw(
+    std::ostream& out,
+    const std::vector<ReadbackSubresourceLayout>& subresources,
+    const std::byte* mapped)
+{
+    for (const ReadbackSubresourceLayout& layout : subresources) {
+        const char* source = reinterpret_cast<const char*>(mapped + layout.offset);
+        if (layout.rowPitch == layout.rowBytes) {
+            out.write(source, static_cast<std::streamsize>(static_cast<uint64_t>(layout.rowBytes) * layout.rowCount));
+            continue;
+        }
+        for (uint32_t row = 0; row < layout.rowCount; ++row) {
+            out.write(source + static_cast<uint64_t>(row) * layout.rowPitch, layout.rowBytes);
+        }
+    }
+    return static_cast<bool>(out);
+}
+
+bool WriteReadbackDds(
+    std::ostream& out,
+    const ReadbackImageDesc& image,
+    const std::vector<ReadbackSubresourceLayout>& subresources,
+    const std::byte* mapped)
+{
+    const uint32_t expectedSubresources = image.mipLevels * image.arraySize;
+    if (subresources.empty() || subresources.size() != expectedSubresources || (image.cubemap && image.arraySize % 6 != 0)) {
+        return false;
+    }
+
+    DdsHeader header{};
+    header.size = sizeof(DdsHeader);
+    header.flags = kDdsdCaps | kDdsdHeight | kDdsdWidth | kDdsdPixelFormat;
+    header.height = image.height;
+    header.width = image.width;
+    if (IsBlockCompressed(image.dxgiFormat)) {
+        // Compressed surfaces record the byte size of the top mip, not a row pitch.
+        const ReadbackSubresourceLayout& top = subresources.front();
+        header.flags |= kDdsdLinearSize;
+        header.pitchOrLinearSize = top.rowBytes * top.rowCount;
+    }
+    else {
+        header.flags |= kDdsdPitch;
+        header.pitchOrLinearSize = subresources.front().rowBytes;
+    }
+    header.mipMapCount = image.mipLevels;
+    header.pixelFormat.size = sizeof(DdsPixelFormat);
+    header.pixelFormat.flags = kDdpfFourCC;
+    header.pixelFormat.fourCC = kDdsFourCCDx10;
+    header.caps = kDdsCapsTexture;
+    if (image.mipLevels > 1) {
+        header.flags |= kDdsdMipMapCount;
+        header.caps |= kDdsCapsComplex | kDdsCapsMipMap;
+    }
+    if (image.cubemap) {
+        header.caps |= kDdsCapsComplex;
+        header.caps2 = kDdsCaps2CubemapAllFaces;
+    }
+
+    DdsHeaderDx10 dx10{};
+    dx10.dxgiFormat = image.dxgiFormat;
+    dx10.resourceDimension = kDdsDimensionTexture2D;
+    dx10.miscFlag = image.cubemap ? kDdsResourceMiscTextureCube : 0u;
+    dx10.arraySize = image.cubemap ? image.arraySize / 6 : image.arraySize;
+
+    WritePod(out, kDdsMagic);
+    WritePod(out, header);
+    WritePod(out, dx10);
+    return WriteReadbackRaw(out, subresources, mapped);
+}
+
+ReadbackDiskWriter::ReadbackDiskWriter(uint64_t maxInFlightBytes, TaskRunner runTask)
+    : m_maxInFlightBytes(maxInFlightBytes)
+    , m_runTask(std::move(runTask)) {
+}
+
+ReadbackDiskWriter::~ReadbackDiskWriter() {
+    WaitIdle();
+}
+
+bool ReadbackDiskWriter::FitsLocked(uint64_t bytes) const {
+    return m_inFlightJobs == 0 || m_inFlightBytes + bytes <= m_maxInFlightBytes;
+}
+
+bool ReadbackDiskWriter::TrySubmit(ReadbackWriteJob& job) {
+    {
+        std::scoped_lock lock(m_mutex);
+        if (!FitsLocked(job.footprintBytes)) {
+            return false;
+        }
+        m_inFlightBytes += job.footprintBytes;
+        ++m_inFlightJobs;
+    }
+    Launch(std::move(job));
+    return true;
+}
+
+void ReadbackDiskWriter::Submit(ReadbackWriteJob job) {
+    {
+        std::unique_lock lock(m_mutex);
+        m_changed.wait(lock, [&]() { return FitsLocked(job.footprintBytes); });
+        m_inFlightBytes += job.footprintBytes;
+        ++m_inFlightJobs;
+    }
+    Launch(std::move(job));
+}
+
+void ReadbackDiskWriter::WaitIdle() {
+    std::unique_lock lock(m_mutex);
+    m_changed.wait(lock, [&]() { return m_inFlightJobs == 0; });
+}
+
+uint64_t ReadbackDiskWriter::GetInFlightBytes() const {
+    std::scoped_lock lock(m_mutex);
+    return m_inFlightBytes;
+}
+
+void ReadbackDiskWriter::Launch(ReadbackWriteJob job) {
+    // std::function needs a copyable callable; the job itself only moves.
+    auto shared = std::make_shared<ReadbackWriteJob>(std::move(job));
+    m_runTask([this, shared]() {
+        Run(*shared);
+    });
+}
+
+void ReadbackDiskWriter::Run(ReadbackWriteJob& job) {
+    bool succeeded = false;
+    const std::byte* mapped = job.map ? job.map() : nullptr;
+    if (mapped) {
+        succeeded = true;
+        std::vector<char> buffer;
+        if (!job.ddsPath.empty()) {
+            std::ofstream stream;
+            succeeded = OpenOutput(stream, buffer, job.ddsPath)
+                && WriteReadbackDds(stream, job.image, job.subresources, mapped);
+            stream.close();
+            succeeded = succeeded && !stream.fail();
+        }
+        if (succeeded && !job.rawPath.empty()) {
+            std::ofstream stream;
+            succeeded = OpenOutput(stream, buffer, job.rawPath)
+                && WriteReadbackRaw(stream, job.subresources, mapped);
+            stream.close();
+            succeeded = succeeded && !stream.fail();
+        }
+    }
+    if (job.unmap) {
+        job.unmap();
+    }
+    if (job.onComplete) {
+        job.onComplete(succeeded);
+    }
+
+    // Drop the job (and whatever readback buffer it holds) before releasing its budget.
+    const uint64_t bytes = job.footprintBytes;
+    job = {};
+    // Notify under the lock: WaitIdle may return and destroy the writer as soon as it is released.
+    std::scoped_lock lock(m_mutex);
+    m_inFlightBytes -= bytes;
+    --m_inFlightJobs;
+    m_changed.notify_all();
+}
+
+} // namespace br
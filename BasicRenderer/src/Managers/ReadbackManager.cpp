@@ -17,128 +17,73 @@ namespace br {
 
 namespace {
 
-void SaveCubemapReadbackToDds(
+// 256 MiB of readback footprints may wait on disk at once; further readbacks
+// stay queued (and their GPU copies unrecorded) until writes drain.
+constexpr uint64_t kMaxInFlightReadbackBytes = 256ull << 20;
+
+ReadbackWriteJob BuildReadbackWriteJob(
     const std::shared_ptr<Resource>& readbackBuffer,
     const std::vector<rhi::CopyableFootprint>& fps,
+    uint64_t totalBytes,
     uint32_t width,
     uint32_t height,
     DXGI_FORMAT format,
     uint32_t numMipLevels,
-    const std::wstring& outputFile)
+    uint32_t arraySize,
+    bool cubemap,
+    const std::wstring& outputFile,
+    std::function<void()> callback)
 {
-    void* mappedData = nullptr;
-    readbackBuffer->GetAPIResource().Map(&mappedData);
-
-    DirectX::ScratchImage scratchImage;
-    scratchImage.InitializeCube(format, width, height, 1, numMipLevels);
-
-    constexpr uint32_t faces = 6;
-    for (uint32_t mipLevel = 0; mipLevel < numMipLevels; ++mipLevel) {
-        for (uint32_t faceIndex = 0; faceIndex < faces; ++faceIndex) {
-            const uint32_t subresourceIndex = CalcSubresource(mipLevel, faceIndex, 0, numMipLevels, faces);
-
-            DirectX::Image image;
-            image.width = fps[subresourceIndex].width;
-            image.height = fps[subresourceIndex].height;
-            image.format = format;
-            image.rowPitch = static_cast<size_t>(fps[subresourceIndex].rowPitch);
-            image.slicePitch = image.rowPitch * image.height;
-            image.pixels = static_cast<uint8_t*>(mappedData) + fps[subresourceIndex].offset;
-
-            const DirectX::Image* destImage = scratchImage.GetImage(mipLevel, faceIndex, 0);
-
-            const size_t destRowPitch = destImage->rowPitch;
-            const size_t srcRowPitch = image.rowPitch;
-            const size_t rowCount = image.height;
-
-            uint8_t* destPixels = destImage->pixels;
-            uint8_t* srcPixels = image.pixels;
-
-            for (size_t row = 0; row < rowCount; ++row) {
-                std::memcpy(destPixels + row * destRowPitch, srcPixels + row * srcRowPitch, (std::min)(destRowPitch, srcRowPitch));
-            }
-        }
-    }
-
-    readbackBuffer->GetAPIResource().Unmap(0, 0);
-
-    auto hr = DirectX::SaveToDDSFile(
-        scratchImage.GetImages(),
-        scratchImage.GetImageCount(),
-        scratchImage.GetMetadata(),
-        DirectX::DDS_FLAGS_NONE,
-        outputFile.c_str());
-    if (FAILED(hr)) {
-        spdlog::error("Failed to save the cubemap to a .dds file!");
+    ReadbackWriteJob job;
+    job.image.width = width;
+    job.image.height = height;
+    job.image.mipLevels = numMipLevels;
+    job.image.arraySize = arraySize;
+    job.image.cubemap = cubemap;
+    job.image.dxgiFormat = static_cast<uint32_t>(format);
+    job.footprintBytes = totalBytes;
+    job.ddsPath = outputFile;
+
+    // CalcSubresource order (mip-major within each slice) is also DDS order.
+    job.subresources.resize(fps.size());
+    for (size_t i = 0; i < fps.size(); ++i) {
+        size_t rowPitch = 0;
+        size_t slicePitch = 0;
+        DirectX::ComputePitch(format, fps[i].width, fps[i].height, rowPitch, slicePitch);
+
+        ReadbackSubresourceLayout& layout = job.subresources[i];
+        layout.offset = fps[i].offset;
+        layout.rowPitch = static_cast<uint32_t>(fps[i].rowPitch);
+        layout.rowBytes = static_cast<uint32_t>(rowPitch);
+        layout.rowCount = rowPitch > 0 ? static_cast<uint32_t>(slicePitch / rowPitch) : 0u;
     }
-}
-
-void SaveTextureReadbackToDds(
-    const std::shared_ptr<Resource>& readbackBuffer,
-    const std::vector<rhi::CopyableFootprint>& fps,
-    uint32_t width,
-    uint32_t height,
-    DXGI_FORMAT dxgiFmt,
-    uint32_t numMipLevels,
-    const std::wstring& outputFile)
-{
-    void* mappedData = nullptr;
-    readbackBuffer->GetAPIResource().Map(&mappedData);
-
-    DirectX::ScratchImage scratchImage;
-    scratchImage.Initialize2D(
-        dxgiFmt,
-        width,
-        height,
-        1,
-        numMipLevels);
 
-    for (uint32_t mipLevel = 0; mipLevel < numMipLevels; ++mipLevel) {
-        const uint32_t subresourceIndex = CalcSubresource(mipLevel, 0, 0, numMipLevels, 1);
-
-        DirectX::Image src{};
-        src.width = fps[subresourceIndex].width;
-        src.height = fps[subresourceIndex].height;
-        src.format = dxgiFmt;
-        src.rowPitch = static_cast<size_t>(fps[subresourceIndex].rowPitch);
-        src.slicePitch = src.rowPitch * src.height;
-        src.pixels = static_cast<uint8_t*>(mappedData) + fps[subresourceIndex].offset;
-
-        const DirectX::Image* dst = scratchImage.GetImage(mipLevel, 0, 0);
-
-        const size_t dstRowPitch = dst->rowPitch;
-        const size_t srcRowPitch = src.rowPitch;
-        const size_t rows = src.height;
-
-        uint8_t* dstPixels = dst->pixels;
-        const uint8_t* srcPixels = src.pixels;
-
-        for (size_t row = 0; row < rows; ++row) {
-            std::memcpy(
-                dstPixels + row * dstRowPitch,
-                srcPixels + row * srcRowPitch,
-                (std::min)(dstRowPitch, srcRowPitch));
+    job.map = [readbackBuffer]() -> const std::byte* {
+        void* mappedData = nullptr;
+        readbackBuffer->GetAPIResource().Map(&mappedData);
+        return static_cast<const std::byte*>(mappedData);
+    };
+    job.unmap = [readbackBuffer]() {
+        readbackBuffer->GetAPIResource().Unmap(0, 0);
+    };
+    job.onComplete = [outputFile, callback = std::move(callback)](bool succeeded) {
+        if (!succeeded) {
+            spdlog::error("Failed to save readback to {}", ws2s(outputFile));
         }
-    }
-
-    readbackBuffer->GetAPIResource().Unmap(0, 0);
-
-    const auto hr = DirectX::SaveToDDSFile(
-        scratchImage.GetImages(),
-        scratchImage.GetImageCount(),
-        scratchImage.GetMetadata(),
-        DirectX::DDS_FLAGS_NONE,
-        outputFile.c_str());
-
-    if (FAILED(hr)) {
-        spdlog::error("Failed to save the texture to a .dds file!");
-    }
+        if (callback) {
+            callback();
+        }
+    };
+    return job;
 }
 
 }
 
 ReadbackManager::ReadbackManager() {
     m_readbackPass = std::make_shared<ReadbackPass>(*this);
+    m_diskWriter = std::make_unique<ReadbackDiskWriter>(kMaxInFlightReadbackBytes, [](std::function<void()> task) {
+        TaskSchedulerManager::GetInstance().RunIoTask("ReadbackManager::WriteReadback", std::move(task));
+    });
 }
 
 void ReadbackManager::Initialize(rhi::Timeline readbackFence) {
@@ -159,16 +104,22 @@ void ReadbackManager::RequestReadback(std::shared_ptr<PixelBuffer> texture, std:
         });
 }
 
-void ReadbackManager::ClearReadbacks() {
+void ReadbackManager::ClearReadbacks(size_t count) {
     std::scoped_lock lock(m_mutex);
-    m_queuedReadbacks.clear();
+    m_queuedReadbacks.erase(m_queuedReadbacks.begin(), m_queuedReadbacks.begin() + (std::min)(count, m_queuedReadbacks.size()));
 }
 
 void ReadbackManager::Cleanup() {
-    std::scoped_lock lock(m_mutex);
-    m_queuedReadbacks.clear();
-    m_readbackRequests.clear();
-    m_readbackPass.reset();
+    {
+        std::scoped_lock lock(m_mutex);
+        m_queuedReadbacks.clear();
+        m_readbackRequests.clear();
+        m_readbackPass.reset();
+    }
+    // Writes in flight still hold mapped readback buffers.
+    if (m_diskWriter) {
+        m_diskWriter->WaitIdle();
+    }
 }
 
 void ReadbackManager::ReadbackPass::RecordImmediateCommands(ImmediateExecutionContext& context) {
@@ -176,7 +127,12 @@ void ReadbackManager::ReadbackPass::RecordImmediateCommands(ImmediateExecutionCo
     uint64_t fenceValue = 0;
     {
         std::scoped_lock lock(m_owner.m_mutex);
-        if (m_owner.m_queuedReadbacks.empty()) {
+        m_recordedCount = 0;
+        // Backpressure: leave readbacks queued while earlier ones are still
+        // waiting on the GPU or the disk writer.
+        const uint64_t outstandingBytes = m_owner.m_diskWriter->GetInFlightBytes() + m_owner.GetPendingReadbackBytesLocked();
+        const bool budgetAvailable = outstandingBytes < m_owner.m_diskWriter->GetMaxInFlightBytes();
+        if (m_owner.m_queuedReadbacks.empty() || !budgetAvailable) {
             m_hasWork = false;
             m_pendingFenceValue = 0;
             return;
@@ -186,6 +142,7 @@ void ReadbackManager::ReadbackPass::RecordImmediateCommands(ImmediateExecutionCo
         m_hasWork = true;
         m_pendingFenceValue = fenceValue;
         readbacks = m_owner.m_queuedReadbacks;
+        m_recordedCount = readbacks.size();
     }
 
     auto& commandList = context.list;
@@ -195,10 +152,10 @@ void ReadbackManager::ReadbackPass::RecordImmediateCommands(ImmediateExecutionCo
         }
 
         if (readback.cubemap) {
-            m_owner.SaveCubemapToDDS(context.device, commandList, readback.texture, readback.outputFile, fenceValue);
+            m_owner.SaveCubemapToDDS(context.device, commandList, readback.texture, readback.outputFile, std::move(readback.callback), fenceValue);
         }
         else {
-            m_owner.SaveTextureToDDS(context.device, commandList, readback.texture.get(), readback.outputFile, fenceValue);
+            m_owner.SaveTextureToDDS(context.device, commandList, readback.texture.get(), readback.outputFile, std::move(readback.callback), fenceValue);
         }
     }
 }
@@ -210,7 +167,9 @@ PassReturn ReadbackManager::ReadbackPass::Execute(PassExecutionContext& context)
         return { {} };
     }
 
-    m_owner.ClearReadbacks();
+    // Only drop what was recorded; requests made since then wait for the next frame.
+    m_owner.ClearReadbacks(m_recordedCount);
+    m_recordedCount = 0;
     m_hasWork = false;
     const uint64_t fenceValue = m_pendingFenceValue;
     m_pendingFenceValue = 0;
@@ -227,6 +186,7 @@ void ReadbackManager::SaveCubemapToDDS(
     rg::imm::ImmediateCommandList& commandList,
     std::shared_ptr<PixelBuffer> cubemap,
     const std::wstring& outputFile,
+    std::function<void()> callback,
     uint64_t fenceValue)
 {
     const uint32_t numMipLevels = cubemap->GetMipLevels();
@@ -285,11 +245,8 @@ void ReadbackManager::SaveCubemapToDDS(
     readbackRequest.totalSize = info.totalBytes;
     readbackRequest.outputFile = outputFile;
     readbackRequest.fenceValue = fenceValue;
-    readbackRequest.callback = [=]() {
-        TaskSchedulerManager::GetInstance().RunBackgroundTask("ReadbackManager::SaveCubemapToDDS", [=]() {
-            SaveCubemapReadbackToDds(readbackBuffer, fps, width, height, format, numMipLevels, outputFile);
-        });
-        };
+    readbackRequest.writeJob = BuildReadbackWriteJob(
+        readbackBuffer, fps, info.totalBytes, width, height, format, numMipLevels, faces, true, outputFile, std::move(callback));
 
     std::scoped_lock lock(m_mutex);
     m_readbackRequests.push_back(std::move(readbackRequest));
@@ -300,6 +257,7 @@ void ReadbackManager::SaveTextureToDDS(
     rg::imm::ImmediateCommandList& commandList,
     PixelBuffer* texture,
     const std::wstring& outputFile,
+    std::function<void()> callback,
     uint64_t fenceValue)
 {
     const uint32_t numMipLevels = texture->GetMipLevels();
@@ -355,11 +313,8 @@ void ReadbackManager::SaveTextureToDDS(
     readbackRequest.totalSize = info.totalBytes;
     readbackRequest.outputFile = outputFile;
     readbackRequest.fenceValue = fenceValue;
-    readbackRequest.callback = [=]() {
-        TaskSchedulerManager::GetInstance().RunBackgroundTask("ReadbackManager::SaveTextureToDDS", [=]() {
-            SaveTextureReadbackToDds(readbackBuffer, fps, width, height, dxgiFmt, numMipLevels, outputFile);
-        });
-        };
+    readbackRequest.writeJob = BuildReadbackWriteJob(
+        readbackBuffer, fps, info.totalBytes, width, height, dxgiFmt, numMipLevels, faces, false, outputFile, std::move(callback));
 
     std::scoped_lock lock(m_mutex);
     m_readbackRequests.push_back(std::move(readbackRequest));
@@ -370,20 +325,28 @@ void ReadbackManager::ProcessReadbackRequests() {
 
     const auto completedValue = m_readbackFence.GetCompletedValue();
 
+    // Completed copies go to the disk writer in order; once it is full the
+    // rest keep their readback buffers and retry next frame.
     std::vector<ReadbackRequest> remainingRequests;
     remainingRequests.reserve(m_readbackRequests.size());
+    bool writerFull = false;
     for (auto& request : m_readbackRequests) {
-        if (completedValue >= request.fenceValue) {
-            if (request.callback) {
-                request.callback();
-            }
-        }
-        else {
-            remainingRequests.push_back(std::move(request));
+        if (!writerFull && completedValue >= request.fenceValue && m_diskWriter->TrySubmit(request.writeJob)) {
+            continue;
         }
+        writerFull = writerFull || completedValue >= request.fenceValue;
+        remainingRequests.push_back(std::move(request));
     }
 
     m_readbackRequests = std::move(remainingRequests);
 }
 
+uint64_t ReadbackManager::GetPendingReadbackBytesLocked() const {
+    uint64_t bytes = 0;
+    for (const auto& request : m_readbackRequests) {
+        bytes += request.totalSize;
+    }
+    return bytes;
+}
+
 } // namespace br
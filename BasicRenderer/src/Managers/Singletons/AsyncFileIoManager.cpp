@@ -0,0 +1,710 @@
+#include "Managers/Singletons/AsyncFileIoManager.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <filesystem>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+#include <spdlog/spdlog.h>
+#include <tracy/TracyC.h>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#if BASICRENDERER_HAS_IO_URING
+#include <liburing.h>
+#endif
+
+namespace br {
+
+namespace {
+
+#if defined(_WIN32)
+using NativeFileHandle = HANDLE;
+const NativeFileHandle kInvalidNativeFileHandle = INVALID_HANDLE_VALUE;
+#else
+using NativeFileHandle = int;
+constexpr NativeFileHandle kInvalidNativeFileHandle = -1;
+#endif
+
+// O_DIRECT requires sector-aligned offsets, sizes and buffers. 4 KiB covers
+// every device we care about, and registered slots are sized so that any
+// chunk plus its alignment slack fits in one slot.
+constexpr uint32_t kDirectIoAlignment = 4096u;
+constexpr uint32_t kRegisteredSlotSizeBytes = 1u << 20u;
+constexpr uint32_t kMaxReadChunkBytes = kRegisteredSlotSizeBytes - 2u * kDirectIoAlignment;
+constexpr uint32_t kMaxThreadPoolWorkers = 8u;
+
+#if BASICRENDERER_HAS_IO_URING
+bool IsIoUringDisabledByEnvironment() {
+    const char* value = std::getenv("BASICRENDERER_DISABLE_IO_URING");
+    if (value == nullptr) {
+        return false;
+    }
+    return value[0] == '1' || value[0] == 't' || value[0] == 'T' || value[0] == 'y' || value[0] == 'Y';
+}
+#endif
+
+uint64_t AlignDown(uint64_t value, uint64_t alignment) {
+    return value & ~(alignment - 1u);
+}
+
+uint64_t AlignUp(uint64_t value, uint64_t alignment) {
+    return (value + alignment - 1u) & ~(alignment - 1u);
+}
+
+const char* BackendName(AsyncFileIoBackend backend) {
+    switch (backend) {
+    case AsyncFileIoBackend::IoUring: return "io_uring";
+    case AsyncFileIoBackend::ThreadPool: return "thread pool";
+    default: return "none";
+    }
+}
+
+struct OpenFile {
+    NativeFileHandle handle = kInvalidNativeFileHandle;
+    uint64_t sizeBytes = 0;
+    bool directIo = false;
+
+    OpenFile() = default;
+    OpenFile(const OpenFile&) = delete;
+    OpenFile& operator=(const OpenFile&) = delete;
+
+    ~OpenFile() {
+        if (handle == kInvalidNativeFileHandle) {
+            return;
+        }
+#if defined(_WIN32)
+        CloseHandle(handle);
+#else
+        close(handle);
+#endif
+    }
+};
+
+std::shared_ptr<OpenFile> OpenNativeFile(const std::wstring& path, bool tryDirectIo, std::string* outMessage) {
+    auto file = std::make_shared<OpenFile>();
+#if defined(_WIN32)
+    (void)tryDirectIo;
+    file->handle = CreateFileW(
+        path.c_str(),
+        GENERIC_READ,
+        FILE_SHARE_READ,
+        nullptr,
+        OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS,
+        nullptr);
+    if (file->handle == kInvalidNativeFileHandle) {
+        if (outMessage) {
+            *outMessage = "failed to open file";
+        }
+        return nullptr;
+    }
+    LARGE_INTEGER size{};
+    if (!GetFileSizeEx(file->handle, &size)) {
+        if (outMessage) {
+            *outMessage = "failed to query file size";
+        }
+        return nullptr;
+    }
+    file->sizeBytes = static_cast<uint64_t>(size.QuadPart);
+#else
+    const std::string nativePath = std::filesystem::path(path).string();
+#if defined(O_DIRECT)
+    if (tryDirectIo) {
+        file->handle = open(nativePath.c_str(), O_RDONLY | O_DIRECT | O_CLOEXEC);
+        file->directIo = file->handle != kInvalidNativeFileHandle;
+    }
+#else
+    (void)tryDirectIo;
+#endif
+    if (file->handle == kInvalidNativeFileHandle) {
+        // Filesystems such as tmpfs reject O_DIRECT; fall back to buffered reads.
+        file->handle = open(nativePath.c_str(), O_RDONLY | O_CLOEXEC);
+    }
+    if (file->handle == kInvalidNativeFileHandle) {
+        if (outMessage) {
+            *outMessage = "failed to open file";
+        }
+        return nullptr;
+    }
+    struct stat fileStat{};
+    if (fstat(file->handle, &fileStat) != 0) {
+        if (outMessage) {
+            *outMessage = "failed to query file size";
+        }
+        return nullptr;
+    }
+    file->sizeBytes = static_cast<uint64_t>(fileStat.st_size);
+#endif
+    return file;
+}
+
+bool PositionalRead(NativeFileHandle handle, uint64_t offset, uint32_t sizeBytes, std::byte* destination) {
+    uint32_t bytesDone = 0;
+    while (bytesDone < sizeBytes) {
+#if defined(_WIN32)
+        OVERLAPPED overlapped{};
+        const uint64_t readOffset = offset + bytesDone;
+        overlapped.Offset = static_cast<DWORD>(readOffset & 0xFFFFFFFFull);
+        overlapped.OffsetHigh = static_cast<DWORD>(readOffset >> 32u);
+        DWORD bytesRead = 0;
+        if (!ReadFile(handle, destination + bytesDone, sizeBytes - bytesDone, &bytesRead, &overlapped) || bytesRead == 0) {
+            return false;
+        }
+#else
+        const ssize_t bytesRead = pread(handle, destination + bytesDone, sizeBytes - bytesDone, static_cast<off_t>(offset + bytesDone));
+        if (bytesRead <= 0) {
+            return false;
+        }
+#endif
+        bytesDone += static_cast<uint32_t>(bytesRead);
+    }
+    return true;
+}
+
+}
+
+struct AsyncFileReadRequestHandle::State {
+    std::atomic<AsyncFileReadRequestState> state = AsyncFileReadRequestState::Pending;
+    std::atomic<uint32_t> outstandingReads = 0;
+    std::atomic<bool> failed = false;
+    mutable std::mutex mutex;
+    mutable std::condition_variable completedCv;
+    std::string failureMessage;
+    std::vector<std::vector<std::byte>> blobs;
+
+    void Fail(std::string message) {
+        bool expected = false;
+        if (failed.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+            std::scoped_lock lock(mutex);
+            failureMessage = std::move(message);
+        }
+    }
+
+    void CompleteRead() {
+        if (outstandingReads.fetch_sub(1, std::memory_order_acq_rel) != 1u) {
+            return;
+        }
+        {
+            std::scoped_lock lock(mutex);
+            state.store(
+                failed.load(std::memory_order_acquire) ? AsyncFileReadRequestState::Failed : AsyncFileReadRequestState::Ready,
+                std::memory_order_release);
+        }
+        completedCv.notify_all();
+    }
+};
+
+struct AsyncFileIoManager::Impl {
+    struct ReadOp {
+        std::shared_ptr<AsyncFileReadRequestHandle::State> request;
+        std::shared_ptr<OpenFile> file;
+        uint32_t blobIndex = 0;
+        uint32_t blobOffset = 0;
+        uint64_t fileOffset = 0;
+        uint32_t sizeBytes = 0;
+    };
+
+#if BASICRENDERER_HAS_IO_URING
+    struct InflightRead {
+        ReadOp op;
+        uint64_t alignedOffset = 0;
+        bool active = false;
+    };
+#endif
+
+    std::mutex fileCacheMutex;
+    std::unordered_map<std::wstring, std::shared_ptr<OpenFile>> fileCache;
+
+    std::mutex queueMutex;
+    std::condition_variable queueCv;
+    std::deque<ReadOp> pendingOps;
+    bool shutdownRequested = false;
+    std::vector<std::thread> threads;
+
+#if BASICRENDERER_HAS_IO_URING
+    io_uring ring{};
+    bool ringInitialized = false;
+    bool buffersRegistered = false;
+    std::vector<std::byte*> slotMemory;
+    std::vector<uint32_t> freeSlots;
+    std::vector<InflightRead> inflight;
+    uint32_t inflightCount = 0;
+
+    bool InitializeRing(uint32_t queueDepth, std::string& outMessage);
+    void ShutdownRing();
+    void RingServiceLoop();
+#endif
+
+    void ThreadPoolWorkerLoop();
+};
+
+void AsyncFileIoManager::Impl::ThreadPoolWorkerLoop() {
+    TracyCSetThreadName("Async File IO Worker");
+
+    while (true) {
+        ReadOp op;
+        {
+            std::unique_lock lock(queueMutex);
+            queueCv.wait(lock, [this]() {
+                return shutdownRequested || !pendingOps.empty();
+            });
+            if (pendingOps.empty()) {
+                break;
+            }
+            op = std::move(pendingOps.front());
+            pendingOps.pop_front();
+            TracyCPlotI("AsyncFileIo/Pending Reads", static_cast<int64_t>(pendingOps.size()));
+        }
+
+        if (!op.request->failed.load(std::memory_order_acquire)) {
+            std::byte* destination = op.request->blobs[op.blobIndex].data() + op.blobOffset;
+            if (!PositionalRead(op.file->handle, op.fileOffset, op.sizeBytes, destination)) {
+                op.request->Fail("positional read failed");
+            }
+        }
+        op.request->CompleteRead();
+    }
+}
+
+#if BASICRENDERER_HAS_IO_URING
+bool AsyncFileIoManager::Impl::InitializeRing(uint32_t queueDepth, std::string& outMessage) {
+    const int initResult = io_uring_queue_init(queueDepth, &ring, 0);
+    if (initResult < 0) {
+        outMessage = std::string("io_uring_queue_init failed: ") + std::strerror(-initResult);
+        return false;
+    }
+    ringInitialized = true;
+
+    slotMemory.assign(queueDepth, nullptr);
+    std::vector<iovec> iovecs(queueDepth);
+    for (uint32_t slot = 0; slot < queueDepth; ++slot) {
+        void* memory = std::aligned_alloc(kDirectIoAlignment, kRegisteredSlotSizeBytes);
+        if (memory == nullptr) {
+            outMessage = "failed to allocate registered io_uring buffers";
+            return false;
+        }
+        slotMemory[slot] = static_cast<std::byte*>(memory);
+        iovecs[slot].iov_base = memory;
+        iovecs[slot].iov_len = kRegisteredSlotSizeBytes;
+    }
+
+    const int registerResult = io_uring_register_buffers(&ring, iovecs.data(), queueDepth);
+    if (registerResult < 0) {
+        outMessage = std::string("io_uring_register_buffers failed: ") + std::strerror(-registerResult);
+        return false;
+    }
+    buffersRegistered = true;
+
+    inflight.assign(queueDepth, {});
+    freeSlots.clear();
+    freeSlots.reserve(queueDepth);
+    for (uint32_t slot = queueDepth; slot > 0; --slot) {
+        freeSlots.push_back(slot - 1u);
+    }
+    return true;
+}
+
+void AsyncFileIoManager::Impl::ShutdownRing() {
+    if (buffersRegistered) {
+        io_uring_unregister_buffers(&ring);
+        buffersRegistered = false;
+    }
+    if (ringInitialized) {
+        io_uring_queue_exit(&ring);
+        ringInitialized = false;
+    }
+    for (std::byte* memory : slotMemory) {
+        std::free(memory);
+    }
+    slotMemory.clear();
+    freeSlots.clear();
+    inflight.clear();
+    inflightCount = 0;
+}
+
+void AsyncFileIoManager::Impl::RingServiceLoop() {
+    TracyCSetThreadName("Async File IO Ring");
+
+    while (true) {
+        // Fill every free registered slot from the pending queue, then block on
+        // the completion queue. With nothing in flight, sleep on the condition
+        // variable instead so enqueues wake us immediately.
+        uint32_t submitted = 0;
+        {
+            std::unique_lock lock(queueMutex);
+            if (inflightCount == 0u) {
+                queueCv.wait(lock, [this]() {
+                    return shutdownRequested || !pendingOps.empty();
+                });
+                if (pendingOps.empty()) {
+                    break;
+                }
+            }
+
+            while (!pendingOps.empty() && !freeSlots.empty()) {
+                // Chunks of a request that already failed are retired without
+                // touching the ring.
+                if (pendingOps.front().request->failed.load(std::memory_order_acquire)) {
+                    pendingOps.front().request->CompleteRead();
+                    pendingOps.pop_front();
+                    continue;
+                }
+
+                io_uring_sqe* sqe = io_uring_get_sqe(&ring);
+                if (sqe == nullptr) {
+                    break;
+                }
+
+                ReadOp op = std::move(pendingOps.front());
+                pendingOps.pop_front();
+
+                const uint32_t slot = freeSlots.back();
+                freeSlots.pop_back();
+
+                InflightRead& read = inflight[slot];
+                read.alignedOffset = op.file->directIo ? AlignDown(op.fileOffset, kDirectIoAlignment) : op.fileOffset;
+                const uint64_t readEnd = op.fileOffset + op.sizeBytes;
+                const uint64_t alignedSize = op.file->directIo
+                    ? AlignUp(readEnd, kDirectIoAlignment) - read.alignedOffset
+                    : readEnd - read.alignedOffset;
+                io_uring_prep_read_fixed(
+                    sqe,
+                    op.file->handle,
+                    slotMemory[slot],
+                    static_cast<unsigned>(alignedSize),
+                    read.alignedOffset,
+                    static_cast<int>(slot));
+                io_uring_sqe_set_data64(sqe, slot);
+                read.op = std::move(op);
+                read.active = true;
+                ++inflightCount;
+                ++submitted;
+            }
+            TracyCPlotI("AsyncFileIo/Pending Reads", static_cast<int64_t>(pendingOps.size()));
+            TracyCPlotI("AsyncFileIo/Inflight Reads", static_cast<int64_t>(inflightCount));
+        }
+
+        if (submitted > 0u) {
+            io_uring_submit(&ring);
+        }
+        if (inflightCount == 0u) {
+            continue;
+        }
+
+        io_uring_cqe* cqe = nullptr;
+        if (io_uring_wait_cqe(&ring, &cqe) < 0) {
+            continue;
+        }
+
+        unsigned head = 0;
+        unsigned reaped = 0;
+        io_uring_for_each_cqe(&ring, head, cqe) {
+            ++reaped;
+            const uint64_t slot = io_uring_cqe_get_data64(cqe);
+            if (slot >= inflight.size()) {
+                continue;
+            }
+
+            InflightRead& read = inflight[slot];
+            const uint64_t leadingBytes = read.op.fileOffset - read.alignedOffset;
+            if (cqe->res < 0) {
+                read.op.request->Fail(std::string("io_uring read failed: ") + std::strerror(-cqe->res));
+            }
+            else if (static_cast<uint64_t>(cqe->res) < leadingBytes + read.op.sizeBytes) {
+                read.op.request->Fail("io_uring short read");
+            }
+            else {
+                std::byte* destination = read.op.request->blobs[read.op.blobIndex].data() + read.op.blobOffset;
+                std::memcpy(destination, slotMemory[slot] + leadingBytes, read.op.sizeBytes);
+            }
+
+            read.op.request->CompleteRead();
+            read.op = {};
+            read.active = false;
+
+            std::scoped_lock lock(queueMutex);
+            freeSlots.push_back(static_cast<uint32_t>(slot));
+            --inflightCount;
+        }
+        io_uring_cq_advance(&ring, reaped);
+    }
+}
+#endif
+
+AsyncFileReadRequestHandle::AsyncFileReadRequestHandle(std::shared_ptr<State> state)
+    : m_state(std::move(state)) {
+}
+
+bool AsyncFileReadRequestHandle::IsValid() const noexcept {
+    return static_cast<bool>(m_state);
+}
+
+AsyncFileIoManager& AsyncFileIoManager::GetInstance() {
+    static AsyncFileIoManager instance;
+    return instance;
+}
+
+void AsyncFileIoManager::Initialize(uint32_t queueDepth) {
+    Initialize(AsyncFileIoBackend::IoUring, queueDepth);
+}
+
+void AsyncFileIoManager::Initialize(AsyncFileIoBackend preferredBackend, uint32_t queueDepth) {
+    if (m_initialized) {
+        return;
+    }
+
+    m_queueDepth = (std::max)(queueDepth, 1u);
+    m_impl = std::make_unique<Impl>();
+    m_backend = AsyncFileIoBackend::None;
+    m_statusMessage.clear();
+
+#if BASICRENDERER_HAS_IO_URING
+    if (preferredBackend == AsyncFileIoBackend::IoUring && !IsIoUringDisabledByEnvironment()) {
+        std::string ringMessage;
+        if (m_impl->InitializeRing(m_queueDepth, ringMessage)) {
+            m_backend = AsyncFileIoBackend::IoUring;
+            m_impl->threads.emplace_back([impl = m_impl.get()]() {
+                impl->RingServiceLoop();
+            });
+        }
+        else {
+            m_impl->ShutdownRing();
+            spdlog::warn("AsyncFileIoManager: {}; using thread-pool fallback", ringMessage);
+        }
+    }
+#else
+    (void)preferredBackend;
+#endif
+
+    if (m_backend == AsyncFileIoBackend::None) {
+        m_backend = AsyncFileIoBackend::ThreadPool;
+        const uint32_t workerCount = (std::min)(m_queueDepth, kMaxThreadPoolWorkers);
+        for (uint32_t workerIndex = 0; workerIndex < workerCount; ++workerIndex) {
+            m_impl->threads.emplace_back([impl = m_impl.get()]() {
+                impl->ThreadPoolWorkerLoop();
+            });
+        }
+    }
+
+    m_initialized = true;
+    m_statusMessage = std::string("initialized ") + BackendName(m_backend) + " backend";
+    spdlog::info("AsyncFileIoManager: {} queueDepth={}", m_statusMessage, m_queueDepth);
+}
+
+void AsyncFileIoManager::Cleanup() {
+    if (m_impl != nullptr) {
+        {
+            std::scoped_lock lock(m_impl->queueMutex);
+            m_impl->shutdownRequested = true;
+        }
+        m_impl->queueCv.notify_all();
+        for (std::thread& thread : m_impl->threads) {
+            if (thread.joinable()) {
+                thread.join();
+            }
+        }
+        m_impl->threads.clear();
+#if BASICRENDERER_HAS_IO_URING
+        m_impl->ShutdownRing();
+#endif
+    }
+
+    m_impl.reset();
+    m_backend = AsyncFileIoBackend::None;
+    m_queueDepth = 0;
+    m_initialized = false;
+    m_statusMessage.clear();
+}
+
+void AsyncFileIoManager::ReleaseFileHandle(const std::wstring& path) {
+    if (m_impl == nullptr) {
+        return;
+    }
+    std::scoped_lock lock(m_impl->fileCacheMutex);
+    m_impl->fileCache.erase(path);
+}
+
+AsyncFileReadRequestHandle AsyncFileIoManager::EnqueueReadFileRegions(
+    const std::wstring& path,
+    const std::vector<AsyncFileReadRegion>& regions,
+    std::string* outMessage) {
+    if (outMessage) {
+        outMessage->clear();
+    }
+
+    if (!m_initialized || m_impl == nullptr) {
+        if (outMessage) {
+            *outMessage = "AsyncFileIoManager is not initialized";
+        }
+        return {};
+    }
+
+    if (path.empty()) {
+        if (outMessage) {
+            *outMessage = "path is empty";
+        }
+        return {};
+    }
+
+    std::shared_ptr<OpenFile> file;
+    {
+        std::scoped_lock lock(m_impl->fileCacheMutex);
+        auto it = m_impl->fileCache.find(path);
+        if (it != m_impl->fileCache.end()) {
+            file = it->second;
+        }
+        else {
+            file = OpenNativeFile(path, m_backend == AsyncFileIoBackend::IoUring, outMessage);
+            if (file == nullptr) {
+                return {};
+            }
+            m_impl->fileCache.emplace(path, file);
+        }
+    }
+
+    auto state = std::make_shared<AsyncFileReadRequestHandle::State>();
+    state->blobs.resize(regions.size());
+
+    std::vector<Impl::ReadOp> ops;
+    ops.reserve(regions.size());
+    for (uint32_t regionIndex = 0; regionIndex < static_cast<uint32_t>(regions.size()); ++regionIndex) {
+        const AsyncFileReadRegion& region = regions[regionIndex];
+        if (region.sourceOffset > file->sizeBytes ||
+            static_cast<uint64_t>(region.sourceSizeBytes) > file->sizeBytes - region.sourceOffset) {
+            if (outMessage) {
+                *outMessage = "requested file range is out of bounds";
+            }
+            return {};
+        }
+
+        state->blobs[regionIndex].resize(region.sourceSizeBytes);
+        for (uint32_t chunkOffset = 0; chunkOffset < region.sourceSizeBytes; chunkOffset += kMaxReadChunkBytes) {
+            Impl::ReadOp op;
+            op.request = state;
+            op.file = file;
+            op.blobIndex = regionIndex;
+            op.blobOffset = chunkOffset;
+            op.fileOffset = region.sourceOffset + chunkOffset;
+            op.sizeBytes = (std::min)(kMaxReadChunkBytes, region.sourceSizeBytes - chunkOffset);
+            ops.push_back(std::move(op));
+        }
+    }
+
+    if (ops.empty()) {
+        state->state.store(AsyncFileReadRequestState::Ready, std::memory_order_release);
+        return AsyncFileReadRequestHandle(std::move(state));
+    }
+
+    state->outstandingReads.store(static_cast<uint32_t>(ops.size()), std::memory_order_release);
+    {
+        std::scoped_lock lock(m_impl->queueMutex);
+        for (Impl::ReadOp& op : ops) {
+            m_impl->pendingOps.push_back(std::move(op));
+        }
+        TracyCPlotI("AsyncFileIo/Pending Reads", static_cast<int64_t>(m_impl->pendingOps.size()));
+    }
+    m_impl->queueCv.notify_all();
+
+    return AsyncFileReadRequestHandle(std::move(state));
+}
+
+bool AsyncFileIoManager::ReadFileRegionsToMemory(
+    const std::wstring& path,
+    const std::vector<AsyncFileReadRegion>& regions,
+    std::vector<std::vector<std::byte>>& outBlobs,
+    std::string* outMessage) {
+    outBlobs.clear();
+    const AsyncFileReadRequestHandle handle = EnqueueReadFileRegions(path, regions, outMessage);
+    if (!handle.IsValid()) {
+        return false;
+    }
+    if (!WaitForRequest(handle, outMessage)) {
+        return false;
+    }
+    return TakeRequestData(handle, outBlobs);
+}
+
+AsyncFileReadRequestStatus AsyncFileIoManager::PollRequest(const AsyncFileReadRequestHandle& handle) const {
+    AsyncFileReadRequestStatus status{};
+    if (!handle.IsValid()) {
+        status.message = "invalid async file read request";
+        return status;
+    }
+
+    status.state = handle.m_state->state.load(std::memory_order_acquire);
+    if (status.state == AsyncFileReadRequestState::Failed) {
+        std::scoped_lock lock(handle.m_state->mutex);
+        status.message = handle.m_state->failureMessage;
+    }
+    return status;
+}
+
+bool AsyncFileIoManager::WaitForRequest(const AsyncFileReadRequestHandle& handle, std::string* outMessage) const {
+    if (!handle.IsValid()) {
+        if (outMessage) {
+            *outMessage = "invalid async file read request";
+        }
+        return false;
+    }
+
+    auto& state = *handle.m_state;
+    {
+        std::unique_lock lock(state.mutex);
+        state.completedCv.wait(lock, [&state]() {
+            return state.state.load(std::memory_order_acquire) != AsyncFileReadRequestState::Pending;
+        });
+        if (state.state.load(std::memory_order_acquire) == AsyncFileReadRequestState::Failed) {
+            if (outMessage) {
+                *outMessage = state.failureMessage;
+            }
+            return false;
+        }
+    }
+    return true;
+}
+
+bool AsyncFileIoManager::WaitForRequests(const std::vector<AsyncFileReadRequestHandle>& handles, std::string* outMessage) const {
+    bool allSucceeded = true;
+    for (const AsyncFileReadRequestHandle& handle : handles) {
+        std::string message;
+        if (!WaitForRequest(handle, &message)) {
+            allSucceeded = false;
+            if (outMessage && outMessage->empty()) {
+                *outMessage = message;
+            }
+        }
+    }
+    return allSucceeded;
+}
+
+bool AsyncFileIoManager::TakeRequestData(const AsyncFileReadRequestHandle& handle, std::vector<std::vector<std::byte>>& outBlobs) const {
+    if (!handle.IsValid() ||
+        handle.m_state->state.load(std::memory_order_acquire) != AsyncFileReadRequestState::Ready) {
+        return false;
+    }
+
+    std::scoped_lock lock(handle.m_state->mutex);
+    outBlobs = std::move(handle.m_state->blobs);
+    handle.m_state->blobs.clear();
+    return true;
+}
+
+}
@@ -1,5 +1,8 @@
 #include "Managers/Singletons/PSOManager.h"
 
+#include <array>
+#include <cwchar>
+#include <exception>
 #include <fstream>
 #include <filesystem>
 #include <spdlog/spdlog.h>
@@ -11,6 +14,8 @@
 #include "Managers/Singletons/DeviceManager.h"
 #include "Materials/TechniqueDescriptor.h"
 #include "brslHelpers.h"
+#include "ShaderPreprocessCache.h"
+#include "Managers/Singletons/TaskSchedulerManager.h"
 #include "Render/ShaderAPI.h"
 
 #pragma comment(lib, "dxcompiler.lib")
@@ -97,6 +102,26 @@ std::string NormalizePathUtf8(const std::filesystem::path& path)
     return NormalizeCacheSourcePath(ws2s(path.wstring()));
 }
 
+// Shared across every PSO family; permutations of the same shader file hit
+// the same DXC -P output and tree-sitter analysis.
+ShaderPreprocessCache& GetShaderPreprocessCache()
+{
+    static ShaderPreprocessCache cache;
+    return cache;
+}
+
+// Everything that feeds DXC -P: the root file plus the full argument list
+// (defines, target, entry point, API selection, include directory).
+uint64_t BuildPreprocessPermutationKey(const std::filesystem::path& rootFile, const std::vector<LPCWSTR>& args)
+{
+    uint64_t seed = 0;
+    util::hash_combine_u64(seed, HashStringStable(NormalizePathUtf8(rootFile)));
+    for (LPCWSTR arg : args) {
+        util::hash_combine_u64(seed, HashBytesStable(arg, std::wcslen(arg) * sizeof(wchar_t)));
+    }
+    return seed;
+}
+
 uint64_t BuildBundleIdentityHash(
     const ShaderInfoBundle& info,
     const DxcBuffer& amplificationBuffer,
@@ -1926,10 +1951,6 @@ void PSOManager::GetPreprocessedBlob(
     auto fullPath = exePath / filename;
     auto shaderDir = exePath / L"shaders";
 
-    PSOManager::SourceData srcBuf;
-    LoadSource(fullPath, srcBuf);
-    auto includeHandler = CreateIncludeHandler();
-
     ShaderCompileOptions opts;
     opts.entryPoint = entryPoint;
     opts.target = target;
@@ -1944,11 +1965,31 @@ void PSOManager::GetPreprocessedBlob(
     auto args = BuildArguments(opts, shaderDir, ownedArgs);
 
     args.push_back(L"-P"); // Preprocess only
+
+    ShaderPreprocessCache& preprocessCache = GetShaderPreprocessCache();
+    const uint64_t permutationKey = BuildPreprocessPermutationKey(fullPath, args);
+    if (std::optional<std::string> cached = preprocessCache.FindPreprocessed(permutationKey); cached.has_value()) {
+        const std::byte* begin = reinterpret_cast<const std::byte*>(cached->data());
+        if (CreateBlobFromBytes(pUtils.Get(), std::vector<std::byte>(begin, begin + cached->size()), outBlob)) {
+            return;
+        }
+    }
+
+    PSOManager::SourceData srcBuf;
+    LoadSource(fullPath, srcBuf);
+    auto includeHandler = CreateIncludeHandler();
     auto preProcessedResult = InvokeCompile(
         srcBuf.buffer, args, includeHandler.Get(), filename, entryPoint, target
     );
 
     preProcessedResult->GetOutput(DXC_OUT_HLSL, IID_PPV_ARGS(&outBlob), nullptr);
+    if (outBlob) {
+        preprocessCache.SetSearchDirectories({ shaderDir, exePath });
+        preprocessCache.StorePreprocessed(
+            permutationKey,
+            std::string_view(static_cast<const char*>(outBlob->GetBufferPointer()), outBlob->GetBufferSize()),
+            fullPath);
+    }
 }
 
 void pruneUnusedCodeForSlot(
@@ -2133,21 +2174,45 @@ ShaderBundle PSOManager::CompileShaders(const ShaderInfoBundle& info) {
         return *cachedBundle;
     }
 
-    auto prepareSlot = [&](const std::optional<ShaderInfo>& slot, const DxcBuffer& buffer)
-        -> std::optional<PreparedShaderSource>
-        {
-            if (!slot) {
-                return std::nullopt;
-            }
-
-            return PrepareShaderSourceForEntryPoint(buffer, ws2s(slot->entryPoint));
-        };
+    // Stages are independent until descriptor slots are assigned, so their
+    // tree-sitter passes run side by side. DXC itself stays on this thread.
+    struct PrepareSlotTask {
+        const std::optional<ShaderInfo>* slot;
+        const DxcBuffer* buffer;
+        std::optional<PreparedShaderSource> prepared;
+        std::exception_ptr error;
+    };
+    std::array<PrepareSlotTask, 5> prepareTasks = { {
+        { &info.amplificationShader, &amplificationBuffer },
+        { &info.meshShader, &meshBuffer },
+        { &info.pixelShader, &pixelBuffer },
+        { &info.vertexShader, &vertexBuffer },
+        { &info.computeShader, &computeBuffer },
+    } };
+    TaskSchedulerManager::GetInstance().ParallelFor("PSOManager::PrepareShaderSlots", prepareTasks.size(), [&prepareTasks](size_t index) {
+        PrepareSlotTask& task = prepareTasks[index];
+        if (!task.slot->has_value()) {
+            return;
+        }
+        try {
+            // Finalizing records diagnostics on the prepared source, so take a private copy.
+            task.prepared = *GetShaderPreprocessCache().Prepare(*task.buffer, { ws2s((*task.slot)->entryPoint) });
+        }
+        catch (...) {
+            task.error = std::current_exception();
+        }
+    });
+    for (const PrepareSlotTask& task : prepareTasks) {
+        if (task.error) {
+            std::rethrow_exception(task.error);
+        }
+    }
 
-    std::optional<PreparedShaderSource> preparedAmplification = prepareSlot(info.amplificationShader, amplificationBuffer);
-    std::optional<PreparedShaderSource> preparedMesh = prepareSlot(info.meshShader, meshBuffer);
-    std::optional<PreparedShaderSource> preparedPixel = prepareSlot(info.pixelShader, pixelBuffer);
-    std::optional<PreparedShaderSource> preparedVertex = prepareSlot(info.vertexShader, vertexBuffer);
-    std::optional<PreparedShaderSource> preparedCompute = prepareSlot(info.computeShader, computeBuffer);
+    std::optional<PreparedShaderSource> preparedAmplification = std::move(prepareTasks[0].prepared);
+    std::optional<PreparedShaderSource> preparedMesh = std::move(prepareTasks[1].prepared);
+    std::optional<PreparedShaderSource> preparedPixel = std::move(prepareTasks[2].prepared);
+    std::optional<PreparedShaderSource> preparedVertex = std::move(prepareTasks[3].prepared);
+    std::optional<PreparedShaderSource> preparedCompute = std::move(prepareTasks[4].prepared);
 
     std::unordered_set<std::string> usedMandatoryIDs;
     std::unordered_set<std::string> usedOptionalIDs;
@@ -2645,6 +2710,9 @@ void PSOManager::ReloadShaders() {
     m_clusterLODAVBOITRasterPSOCache.clear();
     m_clusterLODAVBOITShadePSOCache.clear();
     m_clusterLODDeepVisibilityResolvePSOCache.clear();
+    // Preprocessed sources revalidate their include closure on use; the parsed
+    // analyses of the old text are just dead weight after a reload.
+    GetShaderPreprocessCache().ClearPreparedSources();
 }
 
 rhi::BlendState PSOManager::GetBlendDesc(MaterialCompileFlags materialCompileFlags) {
@@ -15,6 +15,7 @@ void RendererECSManager::Initialize() {
     world.component<Components::GlobalMeshLibrary>().add(flecs::Exclusive);
     world.component<Components::DrawStats>("DrawStats").add(flecs::Exclusive);
     world.set<Components::DrawStats>({ 0, {} });
+    world.set<Components::RenderTransformSyncWindow>({});
 }
 
 void RendererECSManager::Cleanup() {
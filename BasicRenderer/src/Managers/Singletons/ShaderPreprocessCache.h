@@ -0,0 +1,346 @@
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "brslHelpers.h"
+
+// Caches the two expensive halves of shader preprocessing across PSO
+// permutations:
+//  - DXC -P output per permutation key, valid while every file in its include
+//    closure still hashes the same. The closure is read back from the #line
+//    directives DXC leaves in its output, so nested includes are covered
+//    without a custom include handler.
+//  - The tree-sitter analysis/pruning (PrepareShaderSourceForRoots) per exact
+//    preprocessed text and root set. Bundles that share a stage permutation
+//    reuse one parse.
+// File hashes are memoized by (size, write time), so a header shared by
+// hundreds of shaders is read once per change rather than once per compile.
+// All methods are thread-safe.
+
+static inline uint64_t HashShaderPreprocessBytes(const void* data, size_t size)
+{
+    uint64_t hash = 14695981039346656037ull;
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+    }
+    hash ^= static_cast<uint64_t>(size);
+    hash *= 1099511628211ull;
+    return hash;
+}
+
+// Unique file names named by `#line N "file"` directives, in first-seen order.
+static inline std::vector<std::string> CollectPreprocessedSourceFiles(const char* source, size_t sourceSize)
+{
+    std::vector<std::string> files;
+    std::unordered_set<std::string_view> seen;
+    const std::string_view text(source, GetNormalizedShaderSourceSize(source, sourceSize));
+
+    size_t lineStart = 0;
+    while (lineStart < text.size()) {
+        size_t lineEnd = text.find('\n', lineStart);
+        if (lineEnd == std::string_view::npos) {
+            lineEnd = text.size();
+        }
+        const std::string_view line = text.substr(lineStart, lineEnd - lineStart);
+        lineStart = lineEnd + 1;
+
+        if (!IsPreprocessedLineDirective(line)) {
+            continue;
+        }
+        const size_t open = line.find('"');
+        const size_t close = open == std::string_view::npos ? std::string_view::npos : line.find('"', open + 1);
+        if (close == std::string_view::npos || close == open + 1) {
+            continue;
+        }
+        const std::string_view file = line.substr(open + 1, close - open - 1);
+        if (!seen.insert(file).second) {
+            continue;
+        }
+        // Backslashes in Windows paths are escaped in the directive.
+        std::string unescaped;
+        unescaped.reserve(file.size());
+        for (size_t i = 0; i < file.size(); ++i) {
+            if (file[i] == '\\' && i + 1 < file.size() && file[i + 1] == '\\') {
+                ++i;
+            }
+            unescaped.push_back(file[i]);
+        }
+        files.push_back(std::move(unescaped));
+    }
+    return files;
+}
+
+class ShaderPreprocessCache
+{
+public:
+    struct Stats
+    {
+        uint64_t preprocessHits = 0;
+        uint64_t preprocessMisses = 0;
+        uint64_t preprocessInvalidations = 0;
+        uint64_t uncacheablePreprocesses = 0;   // Some closure file could not be located
+        uint64_t prepareHits = 0;
+        uint64_t prepareMisses = 0;
+        uint64_t fileHashReads = 0;
+    };
+
+    // Relative #line names are resolved against these directories, in order.
+    explicit ShaderPreprocessCache(std::vector<std::filesystem::path> searchDirectories = {})
+        : m_searchDirectories(std::move(searchDirectories))
+    {
+    }
+
+    void SetSearchDirectories(std::vector<std::filesystem::path> searchDirectories)
+    {
+        std::scoped_lock lock(m_mutex);
+        m_searchDirectories = std::move(searchDirectories);
+    }
+
+    // Returns the stored DXC -P output if nothing in its include closure changed.
+    std::optional<std::string> FindPreprocessed(uint64_t permutationKey)
+    {
+        std::shared_ptr<const PreprocessedEntry> entry;
+        {
+            std::scoped_lock lock(m_mutex);
+            auto it = m_preprocessed.find(permutationKey);
+            if (it == m_preprocessed.end()) {
+                ++m_stats.preprocessMisses;
+                return std::nullopt;
+            }
+            entry = it->second;
+        }
+
+        for (const Dependency& dependency : entry->dependencies) {
+            const std::optional<uint64_t> currentHash = HashFile(dependency.path);
+            if (!currentHash.has_value() || *currentHash != dependency.contentHash) {
+                std::scoped_lock lock(m_mutex);
+                auto it = m_preprocessed.find(permutationKey);
+                if (it != m_preprocessed.end() && it->second == entry) {
+                    m_preprocessed.erase(it);
+                }
+                ++m_stats.preprocessInvalidations;
+                ++m_stats.preprocessMisses;
+                return std::nullopt;
+            }
+        }
+
+        std::scoped_lock lock(m_mutex);
+        ++m_stats.preprocessHits;
+        return entry->text;
+    }
+
+    // Records DXC -P output. When the root was compiled from an in-memory
+    // buffer, its first #line names the buffer rather than a file; pass the
+    // file it was loaded from as rootFile and that name is skipped.
+    void StorePreprocessed(
+        uint64_t permutationKey,
+        std::string_view preprocessed,
+        const std::filesystem::path& rootFile = {})
+    {
+        auto entry = std::make_shared<PreprocessedEntry>();
+        entry->text.assign(preprocessed);
+
+        std::vector<std::filesystem::path> paths;
+        std::vector<std::filesystem::path> searchDirectories;
+        {
+            std::scoped_lock lock(m_mutex);
+            searchDirectories = m_searchDirectories;
+        }
+        std::vector<std::string> files = CollectPreprocessedSourceFiles(preprocessed.data(), preprocessed.size());
+        if (!rootFile.empty()) {
+            paths.push_back(rootFile);
+            if (!files.empty()) {
+                files.erase(files.begin());
+            }
+        }
+        for (const std::string& file : files) {
+            std::optional<std::filesystem::path> resolved = ResolveFile(file, searchDirectories);
+            if (!resolved.has_value()) {
+                std::scoped_lock lock(m_mutex);
+                ++m_stats.uncacheablePreprocesses;
+                return;
+            }
+            paths.push_back(std::move(*resolved));
+        }
+
+        std::unordered_set<std::string> seen;
+        for (const std::filesystem::path& path : paths) {
+            const std::string key = path.lexically_normal().generic_string();
+            if (!seen.insert(key).second) {
+                continue;
+            }
+            const std::optional<uint64_t> hash = HashFile(key);
+            if (!hash.has_value()) {
+                std::scoped_lock lock(m_mutex);
+                ++m_stats.uncacheablePreprocesses;
+                return;
+            }
+            entry->dependencies.push_back({ key, *hash });
+        }
+
+        std::scoped_lock lock(m_mutex);
+        m_preprocessed[permutationKey] = std::move(entry);
+    }
+
+    // PrepareShaderSourceForRoots, memoized on the exact preprocessed bytes and
+    // roots. The result is shared and must be treated as read-only.
+    std::shared_ptr<const PreparedShaderSource> Prepare(
+        const DxcBuffer& preprocessedBuffer,
+        const std::vector<std::string>& rootFunctionNames)
+    {
+        const char* source = static_cast<const char*>(preprocessedBuffer.Ptr);
+        const size_t sourceSize = source ? GetNormalizedShaderSourceSize(source, preprocessedBuffer.Size) : 0;
+        const std::string_view text(source ? source : "", sourceSize);
+
+        uint64_t key = HashShaderPreprocessBytes(text.data(), text.size());
+        for (const std::string& root : rootFunctionNames) {
+            key ^= HashShaderPreprocessBytes(root.data(), root.size()) + 0x9e3779b97f4a7c15ull + (key << 6) + (key >> 2);
+        }
+
+        {
+            std::scoped_lock lock(m_mutex);
+            auto [begin, end] = m_prepared.equal_range(key);
+            for (auto it = begin; it != end; ++it) {
+                if (it->second->source == text && it->second->roots == rootFunctionNames) {
+                    ++m_stats.prepareHits;
+                    return it->second->prepared;
+                }
+            }
+            ++m_stats.prepareMisses;
+        }
+
+        auto entry = std::make_shared<PreparedEntry>();
+        entry->prepared = std::make_shared<const PreparedShaderSource>(
+            PrepareShaderSourceForRoots(preprocessedBuffer, rootFunctionNames));
+        entry->source.assign(text);
+        entry->roots = rootFunctionNames;
+
+        std::scoped_lock lock(m_mutex);
+        auto [begin, end] = m_prepared.equal_range(key);
+        for (auto it = begin; it != end; ++it) {
+            if (it->second->source == entry->source && it->second->roots == entry->roots) {
+                return it->second->prepared;   // Another thread finished the same parse first.
+            }
+        }
+        m_prepared.emplace(key, entry);
+        return entry->prepared;
+    }
+
+    void ClearPreparedSources()
+    {
+        std::scoped_lock lock(m_mutex);
+        m_prepared.clear();
+    }
+
+    void Clear()
+    {
+        std::scoped_lock lock(m_mutex);
+        m_preprocessed.clear();
+        m_prepared.clear();
+        m_fileHashes.clear();
+    }
+
+    Stats GetStats() const
+    {
+        std::scoped_lock lock(m_mutex);
+        return m_stats;
+    }
+
+private:
+    struct Dependency
+    {
+        std::string path;
+        uint64_t contentHash = 0;
+    };
+
+    struct PreprocessedEntry
+    {
+        std::string text;
+        std::vector<Dependency> dependencies;
+    };
+
+    struct PreparedEntry
+    {
+        std::string source;
+        std::vector<std::string> roots;
+        std::shared_ptr<const PreparedShaderSource> prepared;
+    };
+
+    struct FileHash
+    {
+        uintmax_t size = 0;
+        std::filesystem::file_time_type writeTime;
+        uint64_t contentHash = 0;
+    };
+
+    static std::optional<std::filesystem::path> ResolveFile(
+        const std::string& file,
+        const std::vector<std::filesystem::path>& searchDirectories)
+    {
+        std::error_code ec;
+        const std::filesystem::path path(file);
+        if (path.is_relative()) {
+            for (const std::filesystem::path& directory : searchDirectories) {
+                std::filesystem::path candidate = directory / path;
+                if (std::filesystem::is_regular_file(candidate, ec)) {
+                    return candidate;
+                }
+            }
+        }
+        if (std::filesystem::is_regular_file(path, ec)) {
+            return path;
+        }
+        return std::nullopt;
+    }
+
+    std::optional<uint64_t> HashFile(const std::string& path)
+    {
+        std::error_code ec;
+        const uintmax_t size = std::filesystem::file_size(path, ec);
+        if (ec) {
+            return std::nullopt;
+        }
+        const std::filesystem::file_time_type writeTime = std::filesystem::last_write_time(path, ec);
+        if (ec) {
+            return std::nullopt;
+        }
+
+        {
+            std::scoped_lock lock(m_mutex);
+            auto it = m_fileHashes.find(path);
+            if (it != m_fileHashes.end() && it->second.size == size && it->second.writeTime == writeTime) {
+                return it->second.contentHash;
+            }
+        }
+
+        std::ifstream stream(path, std::ios::binary);
+        if (!stream) {
+            return std::nullopt;
+        }
+        const std::string bytes((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+        const uint64_t contentHash = HashShaderPreprocessBytes(bytes.data(), bytes.size());
+
+        std::scoped_lock lock(m_mutex);
+        m_fileHashes[path] = { size, writeTime, contentHash };
+        ++m_stats.fileHashReads;
+        return contentHash;
+    }
+
+    mutable std::mutex m_mutex;
+    std::vector<std::filesystem::path> m_searchDirectories;
+    std::unordered_map<uint64_t, std::shared_ptr<const PreprocessedEntry>> m_preprocessed;
+    std::unordered_multimap<uint64_t, std::shared_ptr<PreparedEntry>> m_prepared;
+    std::unordered_map<std::string, FileHash> m_fileHashes;
+    Stats m_stats;
+};
@@ -1,6 +1,9 @@
 #include "Managers/Singletons/TaskSchedulerManager.h"
 
 #include <array>
+#include <bit>
+#include <condition_variable>
+#include <deque>
 
 #include <tbb/global_control.h>
 #include <tbb/task_arena.h>
@@ -21,20 +24,90 @@ struct TaskSchedulerManager::RuntimeState {
 namespace {
 constexpr bool kEnableFineGrainedSchedulerTracing = true;
 
-thread_local bool g_isIoWorkerThread = false;
-thread_local bool g_isBackgroundWorkerThread = false;
+// Tracy keeps plot names by pointer, so every series needs a static string.
+struct PoolPlotNames {
+    const char* queueDepth;
+    const char* cancelled;
+    std::array<std::array<const char*, 3>, kTaskPriorityCount> latencyPercentiles;
+};
 
-void PlotIoQueueDepth(size_t depth) {
-    if constexpr (kEnableFineGrainedSchedulerTracing) {
-        TracyCPlotI("TaskScheduler/IO Queue Depth", static_cast<int64_t>(depth));
+constexpr PoolPlotNames kIoPlotNames = {
+    "TaskScheduler/IO Queue Depth",
+    "TaskScheduler/IO Cancelled Tasks",
+    { {
+        { "TaskScheduler/IO Latency High p50 (us)", "TaskScheduler/IO Latency High p95 (us)", "TaskScheduler/IO Latency High p99 (us)" },
+        { "TaskScheduler/IO Latency Normal p50 (us)", "TaskScheduler/IO Latency Normal p95 (us)", "TaskScheduler/IO Latency Normal p99 (us)" },
+        { "TaskScheduler/IO Latency Low p50 (us)", "TaskScheduler/IO Latency Low p95 (us)", "TaskScheduler/IO Latency Low p99 (us)" },
+    } },
+};
+
+constexpr PoolPlotNames kBackgroundPlotNames = {
+    "TaskScheduler/Background Queue Depth",
+    "TaskScheduler/Background Cancelled Tasks",
+    { {
+        { "TaskScheduler/Background Latency High p50 (us)", "TaskScheduler/Background Latency High p95 (us)", "TaskScheduler/Background Latency High p99 (us)" },
+        { "TaskScheduler/Background Latency Normal p50 (us)", "TaskScheduler/Background Latency Normal p95 (us)", "TaskScheduler/Background Latency Normal p99 (us)" },
+        { "TaskScheduler/Background Latency Low p50 (us)", "TaskScheduler/Background Latency Low p95 (us)", "TaskScheduler/Background Latency Low p99 (us)" },
+    } },
+};
+
+// Log2 histogram of enqueue-to-dequeue latency in microseconds. Percentiles
+// are published to Tracy every kPublishInterval samples and the window reset.
+class QueueLatencyHistogram {
+public:
+    void Record(std::chrono::steady_clock::duration latency, const std::array<const char*, 3>& plotNames) {
+        const auto micros = std::chrono::duration_cast<std::chrono::microseconds>(latency).count();
+        const uint64_t clamped = micros > 0 ? static_cast<uint64_t>(micros) : 0u;
+        const size_t bucket = (std::min)(static_cast<size_t>(std::bit_width(clamped)), kBucketCount - 1);
+        m_buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+        if (m_samples.fetch_add(1, std::memory_order_relaxed) + 1 >= kPublishInterval) {
+            Publish(plotNames);
+        }
     }
-}
 
-void PlotBackgroundQueueDepth(size_t depth) {
-    if constexpr (kEnableFineGrainedSchedulerTracing) {
-        TracyCPlotI("TaskScheduler/Background Queue Depth", static_cast<int64_t>(depth));
+private:
+    static constexpr size_t kBucketCount = 32;
+    static constexpr uint32_t kPublishInterval = 64;
+
+    void Publish(const std::array<const char*, 3>& plotNames) {
+        std::scoped_lock lock(m_publishMutex);
+        if (m_samples.exchange(0, std::memory_order_relaxed) == 0) {
+            return;
+        }
+
+        std::array<uint32_t, kBucketCount> counts{};
+        uint64_t total = 0;
+        for (size_t bucket = 0; bucket < kBucketCount; ++bucket) {
+            counts[bucket] = m_buckets[bucket].exchange(0, std::memory_order_relaxed);
+            total += counts[bucket];
+        }
+        if (total == 0) {
+            return;
+        }
+
+        constexpr std::array<uint64_t, 3> kPercentiles = { 50, 95, 99 };
+        for (size_t percentileIndex = 0; percentileIndex < kPercentiles.size(); ++percentileIndex) {
+            const uint64_t threshold = (total * kPercentiles[percentileIndex] + 99u) / 100u;
+            uint64_t running = 0;
+            size_t bucket = 0;
+            for (; bucket + 1 < kBucketCount; ++bucket) {
+                running += counts[bucket];
+                if (running >= threshold) {
+                    break;
+                }
+            }
+            // Bucket b holds [2^(b-1), 2^b) us; report its upper bound.
+            const int64_t upperBoundMicros = int64_t{ 1 } << bucket;
+            if constexpr (kEnableFineGrainedSchedulerTracing) {
+                TracyCPlotI(plotNames[percentileIndex], upperBoundMicros);
+            }
+        }
     }
-}
+
+    std::array<std::atomic<uint32_t>, kBucketCount> m_buckets{};
+    std::atomic<uint32_t> m_samples = 0;
+    std::mutex m_publishMutex;
+};
 
 void RecordTaskNodeForTelemetry(
     std::string_view taskName,
@@ -52,8 +125,271 @@ void RecordTaskNodeForTelemetry(
     telemetry::RecordFrameTaskNode(telemetryName.data(), domain, -1, taskStart, taskEnd);
 }
 
+void RunTracedTask(const std::string& taskName, telemetry::CpuTaskDomain domain, const std::function<void()>& task) {
+    const auto taskStart = std::chrono::steady_clock::now();
+    if constexpr (kEnableFineGrainedSchedulerTracing) {
+        TracyCZone(ctx, 1);
+        TracyCZoneName(ctx, taskName.c_str(), taskName.size());
+        task();
+        TracyCZoneEnd(ctx);
+    }
+    else {
+        task();
+    }
+    RecordTaskNodeForTelemetry(taskName, domain, taskStart, std::chrono::steady_clock::now());
+}
+
+}
+
+struct TaskHandle::State {
+    std::atomic<bool> done = false;
+    std::mutex mutex;
+    std::condition_variable doneCv;
+    std::vector<std::function<void()>> continuations;
+
+    // Runs the continuation inline when the task has already finished.
+    void AddContinuation(std::function<void()> continuation) {
+        {
+            std::scoped_lock lock(mutex);
+            if (!done.load(std::memory_order_acquire)) {
+                continuations.push_back(std::move(continuation));
+                return;
+            }
+        }
+        continuation();
+    }
+
+    void MarkDone() {
+        std::vector<std::function<void()>> readyContinuations;
+        {
+            std::scoped_lock lock(mutex);
+            done.store(true, std::memory_order_release);
+            readyContinuations.swap(continuations);
+        }
+        doneCv.notify_all();
+        for (auto& continuation : readyContinuations) {
+            continuation();
+        }
+    }
+};
+
+bool TaskHandle::IsDone() const noexcept {
+    return !m_state || m_state->done.load(std::memory_order_acquire);
+}
+
+void TaskHandle::Wait() const {
+    if (!m_state) {
+        return;
+    }
+    std::unique_lock lock(m_state->mutex);
+    m_state->doneCv.wait(lock, [this]() {
+        return m_state->done.load(std::memory_order_acquire);
+    });
+}
+
+struct TaskSchedulerManager::WorkerPool {
+    struct ScheduledTask {
+        std::string name;
+        std::function<void()> body;
+        std::shared_ptr<TaskHandle::State> completion;
+        TaskCancellationToken cancellationToken;
+        TaskPriority priority = TaskPriority::Normal;
+        std::chrono::steady_clock::time_point enqueueTime;
+    };
+
+    // Per-thread deques, one per priority class. Owners pop from the front to
+    // keep FIFO order for their own work; thieves take from the back.
+    struct WorkerQueues {
+        std::mutex mutex;
+        std::array<std::deque<ScheduledTask>, kTaskPriorityCount> tasks;
+    };
+
+    WorkerPool(const char* threadNamePrefix, telemetry::CpuTaskDomain domain, const PoolPlotNames& plotNames)
+        : threadNamePrefix(threadNamePrefix)
+        , domain(domain)
+        , plotNames(plotNames) {
+    }
+
+    void Start(uint32_t threadCount);
+    void Stop();
+    void Push(ScheduledTask&& task);
+    bool TryPop(uint32_t workerIndex, ScheduledTask& outTask);
+    void Execute(ScheduledTask& task);
+    void WorkerLoop(uint32_t workerIndex);
+    bool IsCurrentThreadWorker() const;
+
+    uint32_t GetThreadCount() const {
+        return static_cast<uint32_t>(threads.size());
+    }
+
+    const char* threadNamePrefix;
+    telemetry::CpuTaskDomain domain;
+    const PoolPlotNames& plotNames;
+    std::vector<std::unique_ptr<WorkerQueues>> queues;
+    std::vector<std::thread> threads;
+    std::mutex sleepMutex;
+    std::condition_variable sleepCv;
+    std::atomic<size_t> pendingCount = 0;
+    std::atomic<int64_t> cancelledCount = 0;
+    std::atomic<uint32_t> roundRobin = 0;
+    std::atomic<bool> shutdownRequested = false;
+    std::array<QueueLatencyHistogram, kTaskPriorityCount> latency;
+};
+
+namespace {
+thread_local const void* g_currentWorkerPool = nullptr;
+thread_local uint32_t g_currentWorkerIndex = 0;
+}
+
+bool TaskSchedulerManager::WorkerPool::IsCurrentThreadWorker() const {
+    return g_currentWorkerPool == this;
+}
+
+void TaskSchedulerManager::WorkerPool::Start(uint32_t threadCount) {
+    shutdownRequested.store(false, std::memory_order_relaxed);
+    pendingCount.store(0, std::memory_order_relaxed);
+    roundRobin.store(0, std::memory_order_relaxed);
+    queues.clear();
+    queues.reserve(threadCount);
+    for (uint32_t workerIndex = 0; workerIndex < threadCount; ++workerIndex) {
+        queues.push_back(std::make_unique<WorkerQueues>());
+    }
+    threads.clear();
+    threads.reserve(threadCount);
+    for (uint32_t workerIndex = 0; workerIndex < threadCount; ++workerIndex) {
+        threads.emplace_back([this, workerIndex]() {
+            WorkerLoop(workerIndex);
+        });
+    }
+}
+
+void TaskSchedulerManager::WorkerPool::Stop() {
+    {
+        std::scoped_lock lock(sleepMutex);
+        shutdownRequested.store(true, std::memory_order_release);
+    }
+    sleepCv.notify_all();
+    for (std::thread& thread : threads) {
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+    threads.clear();
+}
+
+void TaskSchedulerManager::WorkerPool::Push(ScheduledTask&& task) {
+    // Workers keep follow-up work local; external submitters spread tasks
+    // round-robin and rely on stealing to rebalance.
+    const uint32_t queueIndex = IsCurrentThreadWorker()
+        ? g_currentWorkerIndex
+        : roundRobin.fetch_add(1, std::memory_order_relaxed) % static_cast<uint32_t>(queues.size());
+    const size_t priorityIndex = static_cast<size_t>(task.priority);
+    task.enqueueTime = std::chrono::steady_clock::now();
+    {
+        std::scoped_lock lock(queues[queueIndex]->mutex);
+        queues[queueIndex]->tasks[priorityIndex].push_back(std::move(task));
+    }
+
+    size_t depth = 0;
+    {
+        std::scoped_lock lock(sleepMutex);
+        depth = pendingCount.fetch_add(1, std::memory_order_acq_rel) + 1;
+    }
+    sleepCv.notify_one();
+    if constexpr (kEnableFineGrainedSchedulerTracing) {
+        TracyCPlotI(plotNames.queueDepth, static_cast<int64_t>(depth));
+    }
+}
+
+bool TaskSchedulerManager::WorkerPool::TryPop(uint32_t workerIndex, ScheduledTask& outTask) {
+    const uint32_t queueCount = static_cast<uint32_t>(queues.size());
+    for (size_t priorityIndex = 0; priorityIndex < kTaskPriorityCount; ++priorityIndex) {
+        {
+            WorkerQueues& own = *queues[workerIndex];
+            std::scoped_lock lock(own.mutex);
+            auto& tasks = own.tasks[priorityIndex];
+            if (!tasks.empty()) {
+                outTask = std::move(tasks.front());
+                tasks.pop_front();
+                return true;
+            }
+        }
+        for (uint32_t offset = 1; offset < queueCount; ++offset) {
+            WorkerQueues& victim = *queues[(workerIndex + offset) % queueCount];
+            std::scoped_lock lock(victim.mutex);
+            auto& tasks = victim.tasks[priorityIndex];
+            if (!tasks.empty()) {
+                outTask = std::move(tasks.back());
+                tasks.pop_back();
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void TaskSchedulerManager::WorkerPool::Execute(ScheduledTask& task) {
+    const size_t priorityIndex = static_cast<size_t>(task.priority);
+    latency[priorityIndex].Record(std::chrono::steady_clock::now() - task.enqueueTime, plotNames.latencyPercentiles[priorityIndex]);
+
+    if (task.cancellationToken.IsCancelled()) {
+        const int64_t cancelled = cancelledCount.fetch_add(1, std::memory_order_relaxed) + 1;
+        if constexpr (kEnableFineGrainedSchedulerTracing) {
+            TracyCPlotI(plotNames.cancelled, cancelled);
+        }
+    }
+    else {
+        RunTracedTask(task.name, domain, task.body);
+    }
+
+    if (task.completion) {
+        task.completion->MarkDone();
+    }
+}
+
+void TaskSchedulerManager::WorkerPool::WorkerLoop(uint32_t workerIndex) {
+    g_currentWorkerPool = this;
+    g_currentWorkerIndex = workerIndex;
+
+    std::array<char, 32> workerName{};
+    const int charsWritten = std::snprintf(workerName.data(), workerName.size(), "%s %u", threadNamePrefix, workerIndex);
+    if constexpr (kEnableFineGrainedSchedulerTracing) {
+        if (charsWritten > 0) {
+            TracyCSetThreadName(workerName.data());
+        }
+    }
+
+    while (true) {
+        ScheduledTask task;
+        if (TryPop(workerIndex, task)) {
+            const size_t depth = pendingCount.fetch_sub(1, std::memory_order_acq_rel) - 1;
+            if constexpr (kEnableFineGrainedSchedulerTracing) {
+                TracyCPlotI(plotNames.queueDepth, static_cast<int64_t>(depth));
+            }
+            Execute(task);
+            continue;
+        }
+
+        std::unique_lock lock(sleepMutex);
+        // Queued work is drained before shutdown completes.
+        if (shutdownRequested.load(std::memory_order_acquire) && pendingCount.load(std::memory_order_acquire) == 0) {
+            break;
+        }
+        sleepCv.wait(lock, [this]() {
+            return shutdownRequested.load(std::memory_order_acquire) || pendingCount.load(std::memory_order_acquire) != 0;
+        });
+    }
+
+    g_currentWorkerPool = nullptr;
+}
+
+TaskSchedulerManager::TaskSchedulerManager()
+    : m_ioPool(std::make_unique<WorkerPool>("IO Worker", telemetry::CpuTaskDomain::IOService, kIoPlotNames))
+    , m_backgroundPool(std::make_unique<WorkerPool>("Background Worker", telemetry::CpuTaskDomain::BackgroundService, kBackgroundPlotNames)) {
 }
 
+TaskSchedulerManager::~TaskSchedulerManager() = default;
+
 TaskSchedulerManager& TaskSchedulerManager::GetInstance() {
     static TaskSchedulerManager instance;
     return instance;
@@ -74,107 +410,114 @@ void TaskSchedulerManager::Initialize(uint32_t ioThreadCount, uint32_t backgroun
         static_cast<size_t>(m_workerThreadCount));
     m_runtimeState->workerArena = std::make_unique<tbb::task_arena>(static_cast<int>(m_workerThreadCount));
 
-    m_ioShutdownRequested.store(false, std::memory_order_relaxed);
-    m_backgroundShutdownRequested.store(false, std::memory_order_relaxed);
-    m_ioTasks.clear();
-    m_backgroundTasks.clear();
-    m_ioThreads.clear();
-    m_backgroundThreads.clear();
-    m_ioThreads.reserve(ioThreadCount);
-    m_backgroundThreads.reserve(resolvedBackgroundThreadCount);
-    for (uint32_t ioThreadIndex = 0; ioThreadIndex < ioThreadCount; ++ioThreadIndex) {
-        m_ioThreads.emplace_back([this]() {
-            IoWorkerLoop();
-        });
-    }
-    for (uint32_t backgroundThreadIndex = 0; backgroundThreadIndex < resolvedBackgroundThreadCount; ++backgroundThreadIndex) {
-        m_backgroundThreads.emplace_back([this]() {
-            BackgroundWorkerLoop();
-        });
-    }
+    m_ioPool->Start(ioThreadCount);
+    m_backgroundPool->Start(resolvedBackgroundThreadCount);
 
     m_initialized = true;
 
     spdlog::info(
         "TaskSchedulerManager initialized: workerThreads={}, ioThreads={}, backgroundThreads={}",
         m_workerThreadCount,
-        static_cast<uint32_t>(m_ioThreads.size()),
-        static_cast<uint32_t>(m_backgroundThreads.size()));
+        m_ioPool->GetThreadCount(),
+        m_backgroundPool->GetThreadCount());
 }
 
-void TaskSchedulerManager::RunIoTask(std::function<void()>&& task) {
-    RunIoTask({}, std::move(task));
+uint32_t TaskSchedulerManager::GetNumIoThreads() const {
+    return m_ioPool->GetThreadCount();
 }
 
-void TaskSchedulerManager::RunIoTask(std::string_view taskName, std::function<void()>&& task) {
-    const std::string taskNameStorage = taskName.empty()
-        ? std::string("TaskScheduler::RunIoTask")
-        : std::string(taskName);
+uint32_t TaskSchedulerManager::GetNumBackgroundThreads() const {
+    return m_backgroundPool->GetThreadCount();
+}
 
-    if (!m_initialized || m_ioThreads.empty()) {
-        const auto taskStart = std::chrono::steady_clock::now();
-        if constexpr (kEnableFineGrainedSchedulerTracing) {
-            TracyCZone(ctx, 1);
-            TracyCZoneName(ctx, taskNameStorage.c_str(), taskNameStorage.size());
-            task();
-            TracyCZoneEnd(ctx);
+TaskHandle TaskSchedulerManager::Submit(WorkerPool& pool, std::string_view taskName, std::function<void()>&& task, const TaskOptions& options) {
+    auto completion = std::make_shared<TaskHandle::State>();
+
+    WorkerPool::ScheduledTask scheduled;
+    scheduled.name = std::string(taskName);
+    scheduled.body = std::move(task);
+    scheduled.completion = completion;
+    scheduled.cancellationToken = options.cancellationToken;
+    scheduled.priority = options.priority;
+
+    if (!m_initialized || pool.GetThreadCount() == 0) {
+        for (const TaskHandle& dependency : options.dependencies) {
+            dependency.Wait();
         }
-        else {
-            task();
+        if (!scheduled.cancellationToken.IsCancelled()) {
+            RunTracedTask(scheduled.name, pool.domain, scheduled.body);
         }
-        RecordTaskNodeForTelemetry(taskNameStorage, telemetry::CpuTaskDomain::IOService, taskStart, std::chrono::steady_clock::now());
-        return;
+        completion->MarkDone();
+        return TaskHandle(std::move(completion));
     }
 
-    if (g_isIoWorkerThread) {
-        const auto taskStart = std::chrono::steady_clock::now();
-        if constexpr (kEnableFineGrainedSchedulerTracing) {
-            TracyCZone(ctx, 1);
-            TracyCZoneName(ctx, taskNameStorage.c_str(), taskNameStorage.size());
-            task();
-            TracyCZoneEnd(ctx);
+    const bool dependenciesDone = std::all_of(options.dependencies.begin(), options.dependencies.end(), [](const TaskHandle& dependency) {
+        return dependency.IsDone();
+    });
+    if (dependenciesDone) {
+        pool.Push(std::move(scheduled));
+        return TaskHandle(std::move(completion));
+    }
+
+    // The extra count keeps a dependency that finishes mid-registration from
+    // enqueueing early; whoever drops the count to zero pushes the task.
+    struct DeferredTask {
+        WorkerPool::ScheduledTask task;
+        std::atomic<size_t> remaining = 0;
+    };
+    auto deferred = std::make_shared<DeferredTask>();
+    deferred->task = std::move(scheduled);
+    deferred->remaining.store(options.dependencies.size() + 1, std::memory_order_relaxed);
+    auto release = [&pool, deferred]() {
+        if (deferred->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            pool.Push(std::move(deferred->task));
+        }
+    };
+    for (const TaskHandle& dependency : options.dependencies) {
+        if (dependency.m_state) {
+            dependency.m_state->AddContinuation(release);
         }
         else {
-            task();
+            release();
         }
-        RecordTaskNodeForTelemetry(taskNameStorage, telemetry::CpuTaskDomain::IOService, taskStart, std::chrono::steady_clock::now());
+    }
+    release();
+    return TaskHandle(std::move(completion));
+}
+
+void TaskSchedulerManager::RunIoTask(std::function<void()>&& task) {
+    RunIoTask({}, std::move(task));
+}
+
+void TaskSchedulerManager::RunIoTask(std::string_view taskName, std::function<void()>&& task) {
+    RunIoTask(taskName, std::move(task), TaskPriority::Normal);
+}
+
+void TaskSchedulerManager::RunIoTask(std::string_view taskName, std::function<void()>&& task, TaskPriority priority) {
+    const std::string taskNameStorage = taskName.empty()
+        ? std::string("TaskScheduler::RunIoTask")
+        : std::string(taskName);
+
+    if (!m_initialized || m_ioPool->GetThreadCount() == 0 || m_ioPool->IsCurrentThreadWorker()) {
+        RunTracedTask(taskNameStorage, telemetry::CpuTaskDomain::IOService, task);
         return;
     }
 
     auto completion = std::make_shared<std::promise<void>>();
     auto future = completion->get_future();
 
-    {
-        std::lock_guard<std::mutex> lock(m_ioMutex);
-        m_ioTasks.emplace_back([task = std::move(task), completion, taskNameStorage]() mutable {
-            const auto taskStart = std::chrono::steady_clock::now();
-            if constexpr (kEnableFineGrainedSchedulerTracing) {
-                TracyCZone(ctx, 1);
-                TracyCZoneName(ctx, taskNameStorage.c_str(), taskNameStorage.size());
-                try {
-                    task();
-                    completion->set_value();
-                }
-                catch (...) {
-                    completion->set_exception(std::current_exception());
-                }
-                TracyCZoneEnd(ctx);
-            }
-            else {
-                try {
-                    task();
-                    completion->set_value();
-                }
-                catch (...) {
-                    completion->set_exception(std::current_exception());
-                }
-            }
-            RecordTaskNodeForTelemetry(taskNameStorage, telemetry::CpuTaskDomain::IOService, taskStart, std::chrono::steady_clock::now());
-        });
-        PlotIoQueueDepth(m_ioTasks.size());
-    }
+    TaskOptions options;
+    options.priority = priority;
+    Submit(*m_ioPool, taskNameStorage, [task = std::move(task), completion]() mutable {
+        try {
+            task();
+            completion->set_value();
+        }
+        catch (...) {
+            completion->set_exception(std::current_exception());
+        }
+    }, options);
 
-    m_ioCv.notify_one();
     future.get();
 }
 
@@ -183,44 +526,15 @@ void TaskSchedulerManager::QueueIoTask(std::function<void()>&& task) {
 }
 
 void TaskSchedulerManager::QueueIoTask(std::string_view taskName, std::function<void()>&& task) {
-    const std::string taskNameStorage = taskName.empty()
-        ? std::string("TaskScheduler::QueueIoTask")
-        : std::string(taskName);
-
-    if (!m_initialized || m_ioThreads.empty()) {
-        const auto taskStart = std::chrono::steady_clock::now();
-        if constexpr (kEnableFineGrainedSchedulerTracing) {
-            TracyCZone(ctx, 1);
-            TracyCZoneName(ctx, taskNameStorage.c_str(), taskNameStorage.size());
-            task();
-            TracyCZoneEnd(ctx);
-        }
-        else {
-            task();
-        }
-        RecordTaskNodeForTelemetry(taskNameStorage, telemetry::CpuTaskDomain::IOService, taskStart, std::chrono::steady_clock::now());
-        return;
-    }
-
-    {
-        std::lock_guard<std::mutex> lock(m_ioMutex);
-        m_ioTasks.emplace_back([task = std::move(task), taskNameStorage]() mutable {
-            const auto taskStart = std::chrono::steady_clock::now();
-            if constexpr (kEnableFineGrainedSchedulerTracing) {
-                TracyCZone(ctx, 1);
-                TracyCZoneName(ctx, taskNameStorage.c_str(), taskNameStorage.size());
-                task();
-                TracyCZoneEnd(ctx);
-            }
-            else {
-                task();
-            }
-            RecordTaskNodeForTelemetry(taskNameStorage, telemetry::CpuTaskDomain::IOService, taskStart, std::chrono::steady_clock::now());
-        });
-        PlotIoQueueDepth(m_ioTasks.size());
-    }
+    QueueIoTask(taskName, std::move(task), TaskOptions{});
+}
 
-    m_ioCv.notify_one();
+TaskHandle TaskSchedulerManager::QueueIoTask(std::string_view taskName, std::function<void()>&& task, const TaskOptions& options) {
+    return Submit(
+        *m_ioPool,
+        taskName.empty() ? std::string_view("TaskScheduler::QueueIoTask") : taskName,
+        std::move(task),
+        options);
 }
 
 void TaskSchedulerManager::RunBackgroundTask(std::function<void()>&& task) {
@@ -228,63 +542,17 @@ void TaskSchedulerManager::RunBackgroundTask(std::function<void()>&& task) {
 }
 
 void TaskSchedulerManager::RunBackgroundTask(std::string_view taskName, std::function<void()>&& task) {
-    const std::string taskNameStorage = taskName.empty()
-        ? std::string("TaskScheduler::RunBackgroundTask")
-        : std::string(taskName);
-
-    if (!m_initialized || m_backgroundThreads.empty()) {
-        const auto taskStart = std::chrono::steady_clock::now();
-        if constexpr (kEnableFineGrainedSchedulerTracing) {
-            TracyCZone(ctx, 1);
-            TracyCZoneName(ctx, taskNameStorage.c_str(), taskNameStorage.size());
-            task();
-            TracyCZoneEnd(ctx);
-        }
-        else {
-            task();
-        }
-        RecordTaskNodeForTelemetry(taskNameStorage, telemetry::CpuTaskDomain::BackgroundService, taskStart, std::chrono::steady_clock::now());
-        return;
-    }
-
-    if (g_isBackgroundWorkerThread) {
-        const auto taskStart = std::chrono::steady_clock::now();
-        if constexpr (kEnableFineGrainedSchedulerTracing) {
-            TracyCZone(ctx, 1);
-            TracyCZoneName(ctx, taskNameStorage.c_str(), taskNameStorage.size());
-            task();
-            TracyCZoneEnd(ctx);
-        }
-        else {
-            task();
-        }
-        RecordTaskNodeForTelemetry(taskNameStorage, telemetry::CpuTaskDomain::BackgroundService, taskStart, std::chrono::steady_clock::now());
-        return;
-    }
+    RunBackgroundTask(taskName, std::move(task), TaskOptions{});
+}
 
-    if (m_backgroundShutdownRequested.load(std::memory_order_acquire)) {
-        return;
-    }
+TaskHandle TaskSchedulerManager::RunBackgroundTask(std::string_view taskName, std::function<void()>&& task, const TaskOptions& options) {
+    const std::string_view resolvedName = taskName.empty() ? std::string_view("TaskScheduler::RunBackgroundTask") : taskName;
 
-    {
-        std::lock_guard<std::mutex> lock(m_backgroundMutex);
-        m_backgroundTasks.emplace_back([task = std::move(task), taskNameStorage]() mutable {
-            const auto taskStart = std::chrono::steady_clock::now();
-            if constexpr (kEnableFineGrainedSchedulerTracing) {
-                TracyCZone(ctx, 1);
-                TracyCZoneName(ctx, taskNameStorage.c_str(), taskNameStorage.size());
-                task();
-                TracyCZoneEnd(ctx);
-            }
-            else {
-                task();
-            }
-            RecordTaskNodeForTelemetry(taskNameStorage, telemetry::CpuTaskDomain::BackgroundService, taskStart, std::chrono::steady_clock::now());
-        });
-        PlotBackgroundQueueDepth(m_backgroundTasks.size());
+    if (m_initialized && m_backgroundPool->shutdownRequested.load(std::memory_order_acquire)) {
+        return {};
     }
 
-    m_backgroundCv.notify_one();
+    return Submit(*m_backgroundPool, resolvedName, std::move(task), options);
 }
 
 void TaskSchedulerManager::Cleanup() {
@@ -292,34 +560,10 @@ void TaskSchedulerManager::Cleanup() {
         return;
     }
 
-    m_ioShutdownRequested.store(true, std::memory_order_release);
-    m_backgroundShutdownRequested.store(true, std::memory_order_release);
-    m_ioCv.notify_all();
-    m_backgroundCv.notify_all();
-    for (std::thread& ioThread : m_ioThreads) {
-        if (ioThread.joinable()) {
-            ioThread.join();
-        }
-    }
-    for (std::thread& backgroundThread : m_backgroundThreads) {
-        if (backgroundThread.joinable()) {
-            backgroundThread.join();
-        }
-    }
-
-    {
-        std::lock_guard<std::mutex> lock(m_ioMutex);
-        m_ioTasks.clear();
-    }
-    {
-        std::lock_guard<std::mutex> lock(m_backgroundMutex);
-        m_backgroundTasks.clear();
-    }
+    m_ioPool->Stop();
+    m_backgroundPool->Stop();
 
-    m_ioThreads.clear();
-    m_backgroundThreads.clear();
     m_runtimeState.reset();
-    m_ioRoundRobin.store(0, std::memory_order_relaxed);
     m_workerThreadCount = 0;
     m_initialized = false;
     spdlog::info("TaskSchedulerManager shutdown complete");
@@ -397,76 +641,4 @@ void TaskSchedulerManager::ParallelForImpl(std::string_view taskName, size_t ite
     });
 }
 
-void TaskSchedulerManager::IoWorkerLoop() {
-    g_isIoWorkerThread = true;
-
-    static std::atomic<uint32_t> s_workerIdCounter = 0;
-    const uint32_t workerId = s_workerIdCounter.fetch_add(1, std::memory_order_relaxed);
-    std::array<char, 32> workerName{};
-    const int charsWritten = std::snprintf(workerName.data(), workerName.size(), "IO Worker %u", workerId);
-    if constexpr (kEnableFineGrainedSchedulerTracing) {
-        if (charsWritten > 0) {
-            TracyCSetThreadName(workerName.data());
-        }
-    }
-
-    while (!m_ioShutdownRequested.load(std::memory_order_acquire)) {
-        std::function<void()> task;
-        {
-            std::unique_lock<std::mutex> lock(m_ioMutex);
-            m_ioCv.wait(lock, [this]() {
-                return m_ioShutdownRequested.load(std::memory_order_relaxed) || !m_ioTasks.empty();
-            });
-
-            if (m_ioShutdownRequested.load(std::memory_order_relaxed) && m_ioTasks.empty()) {
-                break;
-            }
-
-            task = std::move(m_ioTasks.front());
-            m_ioTasks.pop_front();
-            PlotIoQueueDepth(m_ioTasks.size());
-        }
-
-        task();
-    }
-
-    g_isIoWorkerThread = false;
-}
-
-void TaskSchedulerManager::BackgroundWorkerLoop() {
-    g_isBackgroundWorkerThread = true;
-
-    static std::atomic<uint32_t> s_workerIdCounter = 0;
-    const uint32_t workerId = s_workerIdCounter.fetch_add(1, std::memory_order_relaxed);
-    std::array<char, 32> workerName{};
-    const int charsWritten = std::snprintf(workerName.data(), workerName.size(), "Background Worker %u", workerId);
-    if constexpr (kEnableFineGrainedSchedulerTracing) {
-        if (charsWritten > 0) {
-            TracyCSetThreadName(workerName.data());
-        }
-    }
-
-    while (!m_backgroundShutdownRequested.load(std::memory_order_acquire)) {
-        std::function<void()> task;
-        {
-            std::unique_lock<std::mutex> lock(m_backgroundMutex);
-            m_backgroundCv.wait(lock, [this]() {
-                return m_backgroundShutdownRequested.load(std::memory_order_relaxed) || !m_backgroundTasks.empty();
-            });
-
-            if (m_backgroundShutdownRequested.load(std::memory_order_relaxed) && m_backgroundTasks.empty()) {
-                break;
-            }
-
-            task = std::move(m_backgroundTasks.front());
-            m_backgroundTasks.pop_front();
-            PlotBackgroundQueueDepth(m_backgroundTasks.size());
-        }
-
-        task();
-    }
-
-    g_isBackgroundWorkerThread = false;
-}
-
 }
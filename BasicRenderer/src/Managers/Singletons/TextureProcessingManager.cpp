@@ -746,6 +746,26 @@ std::wstring TextureProcessingManager::GetExistingCachePathForFile(const Texture
 	return {};
 }
 
+std::wstring TextureProcessingManager::StoreConditionedSourceData(const TextureSourceData& sourceData, const TextureFileMeta& meta) const {
+	if (!ShouldProcess(meta) || meta.filePath.empty() || NeedsProcessing(sourceData, meta)) {
+		return {};
+	}
+	if (meta.processing.requestMipChain && !sourceData.hasFullMipChain) {
+		return {};
+	}
+
+	const std::wstring conditionedCachePath = BuildProcessingConditionedCachePath(BuildProcessingCacheKey(meta));
+	std::error_code ec;
+	if (std::filesystem::exists(std::filesystem::path(conditionedCachePath), ec) && !ec) {
+		return conditionedCachePath;
+	}
+
+	if (!TryWriteConditionedTextureCache(conditionedCachePath, sourceData)) {
+		return {};
+	}
+	return conditionedCachePath;
+}
+
 std::string TextureProcessingManager::BuildProcessingCacheKey(
 	const TextureFileMeta& meta) const
 {
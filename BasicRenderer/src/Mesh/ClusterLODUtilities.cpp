@@ -27,7 +27,7 @@
 #include "Mesh/VertexLayout.h"
 #include "Mesh/VertexFlags.h"
 #include "Mesh/VoxelGroupBuilder.h"
-#include "Utilities/mikktspace.h"
+#include "Mesh/MikkTangentGenerator.h"
 
 #include "../shaders/Common/defines.h"
 
@@ -556,186 +556,6 @@ namespace
 		return value;
 	}
 
-	DirectX::XMFLOAT3 BuildFallbackTangentFromNormal(DirectX::XMFLOAT3 normal)
-	{
-		normal = NormalizeOrFallback(normal, DirectX::XMFLOAT3(0.0f, 0.0f, 1.0f));
-		DirectX::XMFLOAT3 axis = (std::abs(normal.z) < 0.999f)
-			? DirectX::XMFLOAT3(0.0f, 0.0f, 1.0f)
-			: DirectX::XMFLOAT3(0.0f, 1.0f, 0.0f);
-
-		DirectX::XMFLOAT3 tangent(
-			axis.y * normal.z - axis.z * normal.y,
-			axis.z * normal.x - axis.x * normal.z,
-			axis.x * normal.y - axis.y * normal.x);
-
-		const float tangentLenSq = tangent.x * tangent.x + tangent.y * tangent.y + tangent.z * tangent.z;
-		if (tangentLenSq <= 1e-20f)
-		{
-			return DirectX::XMFLOAT3(1.0f, 0.0f, 0.0f);
-		}
-
-		const float invTangentLen = 1.0f / std::sqrt(tangentLenSq);
-		return DirectX::XMFLOAT3(tangent.x * invTangentLen, tangent.y * invTangentLen, tangent.z * invTangentLen);
-	}
-
-	struct MikkTangentBuildData
-	{
-		const std::vector<std::byte>* vertices = nullptr;
-		size_t vertexStrideBytes = 0;
-		const std::vector<uint32_t>* indices = nullptr;
-		size_t positionByteOffset = 0;
-		size_t normalByteOffset = 0;
-		size_t texcoordByteOffset = 0;
-		std::vector<DirectX::XMFLOAT3> accumulatedTangents;
-		std::vector<float> accumulatedSigns;
-		std::vector<uint32_t> accumulatedContributions;
-	};
-
-	int MikkGetNumFaces(const SMikkTSpaceContext* context)
-	{
-		const MikkTangentBuildData* data = static_cast<const MikkTangentBuildData*>(context->m_pUserData);
-		return static_cast<int>(data->indices->size() / 3ull);
-	}
-
-	int MikkGetNumVerticesOfFace(const SMikkTSpaceContext*, const int)
-	{
-		return 3;
-	}
-
-	void MikkGetPosition(const SMikkTSpaceContext* context, float positionOut[], const int face, const int vertexInFace)
-	{
-		const MikkTangentBuildData* data = static_cast<const MikkTangentBuildData*>(context->m_pUserData);
-		const size_t index = static_cast<size_t>(face) * 3ull + static_cast<size_t>(vertexInFace);
-		const uint32_t vertexIndex = (*data->indices)[index];
-		const DirectX::XMFLOAT3 position = ReadVertexFloat3(*data->vertices, data->vertexStrideBytes, vertexIndex, data->positionByteOffset);
-		positionOut[0] = position.x;
-		positionOut[1] = position.y;
-		positionOut[2] = position.z;
-	}
-
-	void MikkGetNormal(const SMikkTSpaceContext* context, float normalOut[], const int face, const int vertexInFace)
-	{
-		const MikkTangentBuildData* data = static_cast<const MikkTangentBuildData*>(context->m_pUserData);
-		const size_t index = static_cast<size_t>(face) * 3ull + static_cast<size_t>(vertexInFace);
-		const uint32_t vertexIndex = (*data->indices)[index];
-		const DirectX::XMFLOAT3 normal = ReadVertexFloat3(*data->vertices, data->vertexStrideBytes, vertexIndex, data->normalByteOffset);
-		normalOut[0] = normal.x;
-		normalOut[1] = normal.y;
-		normalOut[2] = normal.z;
-	}
-
-	void MikkGetTexCoord(const SMikkTSpaceContext* context, float texcoordOut[], const int face, const int vertexInFace)
-	{
-		const MikkTangentBuildData* data = static_cast<const MikkTangentBuildData*>(context->m_pUserData);
-		const size_t index = static_cast<size_t>(face) * 3ull + static_cast<size_t>(vertexInFace);
-		const uint32_t vertexIndex = (*data->indices)[index];
-		const DirectX::XMFLOAT2 texcoord = ReadVertexFloat2(*data->vertices, data->vertexStrideBytes, vertexIndex, data->texcoordByteOffset);
-		texcoordOut[0] = texcoord.x;
-		texcoordOut[1] = texcoord.y;
-	}
-
-	void MikkSetTSpaceBasic(const SMikkTSpaceContext* context, const float tangent[], const float sign, const int face, const int vertexInFace)
-	{
-		MikkTangentBuildData* data = static_cast<MikkTangentBuildData*>(context->m_pUserData);
-		const size_t index = static_cast<size_t>(face) * 3ull + static_cast<size_t>(vertexInFace);
-		const uint32_t vertexIndex = (*data->indices)[index];
-		if (vertexIndex >= data->accumulatedTangents.size())
-		{
-			return;
-		}
-
-		DirectX::XMFLOAT3& accumulatedTangent = data->accumulatedTangents[vertexIndex];
-		accumulatedTangent.x += tangent[0];
-		accumulatedTangent.y += tangent[1];
-		accumulatedTangent.z += tangent[2];
-		data->accumulatedSigns[vertexIndex] += sign;
-		data->accumulatedContributions[vertexIndex] += 1u;
-	}
-
-	bool GenerateMikkTangents(
-		const std::vector<std::byte>& vertices,
-		size_t vertexStrideBytes,
-		const std::vector<uint32_t>& indices,
-		std::vector<DirectX::XMFLOAT4>& outTangents)
-	{
-		constexpr size_t PositionByteOffset = MeshVertexLayout::PositionOffset;
-		constexpr size_t NormalByteOffset = MeshVertexLayout::NormalOffset;
-		constexpr size_t TexcoordByteOffset = MeshVertexLayout::TexcoordOffset(VertexFlags::VERTEX_TEXCOORDS);
-
-		if (vertexStrideBytes < (TexcoordByteOffset + sizeof(float) * 2) || indices.empty() || (indices.size() % 3ull) != 0ull)
-		{
-			return false;
-		}
-
-		const size_t vertexCount = vertices.size() / vertexStrideBytes;
-		if (vertexCount == 0)
-		{
-			return false;
-		}
-
-		for (uint32_t index : indices)
-		{
-			if (static_cast<size_t>(index) >= vertexCount)
-			{
-				return false;
-			}
-		}
-
-		MikkTangentBuildData buildData{};
-		buildData.vertices = &vertices;
-		buildData.vertexStrideBytes = vertexStrideBytes;
-		buildData.indices = &indices;
-		buildData.positionByteOffset = PositionByteOffset;
-		buildData.normalByteOffset = NormalByteOffset;
-		buildData.texcoordByteOffset = TexcoordByteOffset;
-		buildData.accumulatedTangents.assign(vertexCount, DirectX::XMFLOAT3(0.0f, 0.0f, 0.0f));
-		buildData.accumulatedSigns.assign(vertexCount, 0.0f);
-		buildData.accumulatedContributions.assign(vertexCount, 0u);
-
-		SMikkTSpaceInterface mikkInterface{};
-		mikkInterface.m_getNumFaces = &MikkGetNumFaces;
-		mikkInterface.m_getNumVerticesOfFace = &MikkGetNumVerticesOfFace;
-		mikkInterface.m_getPosition = &MikkGetPosition;
-		mikkInterface.m_getNormal = &MikkGetNormal;
-		mikkInterface.m_getTexCoord = &MikkGetTexCoord;
-		mikkInterface.m_setTSpaceBasic = &MikkSetTSpaceBasic;
-
-		SMikkTSpaceContext mikkContext{};
-		mikkContext.m_pInterface = &mikkInterface;
-		mikkContext.m_pUserData = &buildData;
-
-		if (genTangSpaceDefault(&mikkContext) == 0)
-		{
-			return false;
-		}
-
-		outTangents.resize(vertexCount);
-		for (size_t vertexIndex = 0; vertexIndex < vertexCount; ++vertexIndex)
-		{
-			DirectX::XMFLOAT3 tangent = buildData.accumulatedTangents[vertexIndex];
-			const float tangentLenSq = tangent.x * tangent.x + tangent.y * tangent.y + tangent.z * tangent.z;
-
-			if (buildData.accumulatedContributions[vertexIndex] == 0u || tangentLenSq <= 1e-20f ||
-				!std::isfinite(tangent.x) || !std::isfinite(tangent.y) || !std::isfinite(tangent.z))
-			{
-				const DirectX::XMFLOAT3 normal = ReadVertexFloat3(vertices, vertexStrideBytes, static_cast<uint32_t>(vertexIndex), NormalByteOffset);
-				tangent = BuildFallbackTangentFromNormal(normal);
-			}
-			else
-			{
-				const float invLen = 1.0f / std::sqrt(tangentLenSq);
-				tangent.x *= invLen;
-				tangent.y *= invLen;
-				tangent.z *= invLen;
-			}
-
-			const float sign = buildData.accumulatedSigns[vertexIndex] < 0.0f ? -1.0f : 1.0f;
-			outTangents[vertexIndex] = DirectX::XMFLOAT4(tangent.x, tangent.y, tangent.z, sign);
-		}
-
-		return true;
-	}
-
 	std::vector<DirectX::XMFLOAT3> RecalculateGroupNormals(
 		const std::vector<uint32_t>& groupLocalToGlobal,
 		const std::vector<meshopt_Meshlet>& meshlets,
@@ -2310,8 +2130,147 @@ namespace
 		return blob;
 	}
 
+	struct PendingTriangleMeshPage
+	{
+		std::vector<TriangleMeshPageSegmentRef> segments;
+		uint32_t attributeMask = 0u;
+		uint32_t uvSetCount = 0u;
+	};
+
+	size_t ComputePendingTriangleMeshPageSize(
+		const ClusterLODBuildState& state,
+		std::span<const TriangleMeshPageSegmentRef> segments,
+		uint32_t attributeMask,
+		uint32_t uvSetCount)
+	{
+		const TriangleMeshPageBuildTotals totals = ComputeTriangleMeshPageTotals(state, segments, attributeMask, uvSetCount);
+		return ComputePageBlobSize(
+			attributeMask,
+			totals.meshletCount,
+			uvSetCount,
+			totals.totalPositionBytes,
+			totals.totalUvBitsPerSet,
+			totals.totalVertexCount,
+			totals.totalNormalWords,
+			totals.totalColorWords,
+			totals.totalBoneIndexCount,
+			totals.totalTriangleBytes);
+	}
+
+	// Legacy order: breadth-first by depth, siblings grouped by parent id.
+	std::vector<uint32_t> BuildDepthMajorGroupOrder(const ClusterLODBuildState& state)
+	{
+		std::vector<uint32_t> groupOrder(state.groups.size());
+		std::iota(groupOrder.begin(), groupOrder.end(), 0u);
+		std::stable_sort(groupOrder.begin(), groupOrder.end(), [&](uint32_t a, uint32_t b)
+		{
+			const ClusterLODGroup& groupA = state.groups[a];
+			const ClusterLODGroup& groupB = state.groups[b];
+			if (groupA.depth != groupB.depth) return groupA.depth < groupB.depth;
+			if (groupA.parentGroupId != groupB.parentGroupId) return groupA.parentGroupId < groupB.parentGroupId;
+			return a < b;
+		});
+		return groupOrder;
+	}
+
+	// Depth-first over the parent -> child hierarchy, emitting each parent's
+	// children as one contiguous block before descending into them. Groups the
+	// streamer requests together (a refining parent's children) end up adjacent,
+	// and each block follows its parent. Siblings are ordered along the longest
+	// axis of their bounds so neighbouring blocks are also spatially close.
+	std::vector<uint32_t> BuildHierarchyLocalityGroupOrder(const ClusterLODBuildState& state)
+	{
+		const uint32_t groupCount = static_cast<uint32_t>(state.groups.size());
+		std::vector<std::vector<uint32_t>> children(groupCount);
+		std::vector<uint32_t> roots;
+		for (uint32_t groupIndex = 0; groupIndex < groupCount; ++groupIndex)
+		{
+			const int32_t parent = state.groups[groupIndex].parentGroupId;
+			if (parent >= 0 && static_cast<uint32_t>(parent) < groupCount && static_cast<uint32_t>(parent) != groupIndex)
+			{
+				children[static_cast<uint32_t>(parent)].push_back(groupIndex);
+			}
+			else
+			{
+				roots.push_back(groupIndex);
+			}
+		}
+
+		auto sortSpatially = [&](std::vector<uint32_t>& siblings)
+		{
+			if (siblings.size() < 2u)
+			{
+				return;
+			}
+			float minCenter[3] = { std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max() };
+			float maxCenter[3] = { std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest() };
+			for (uint32_t groupIndex : siblings)
+			{
+				for (uint32_t axis = 0; axis < 3u; ++axis)
+				{
+					minCenter[axis] = std::min(minCenter[axis], state.groups[groupIndex].bounds.center[axis]);
+					maxCenter[axis] = std::max(maxCenter[axis], state.groups[groupIndex].bounds.center[axis]);
+				}
+			}
+			uint32_t sortAxis = 0u;
+			for (uint32_t axis = 1; axis < 3u; ++axis)
+			{
+				if (maxCenter[axis] - minCenter[axis] > maxCenter[sortAxis] - minCenter[sortAxis])
+				{
+					sortAxis = axis;
+				}
+			}
+			std::stable_sort(siblings.begin(), siblings.end(), [&](uint32_t a, uint32_t b)
+			{
+				return state.groups[a].bounds.center[sortAxis] < state.groups[b].bounds.center[sortAxis];
+			});
+		};
+
+		std::vector<uint32_t> groupOrder;
+		groupOrder.reserve(groupCount);
+		std::vector<uint8_t> emitted(groupCount, 0u);
+		std::vector<uint32_t> stack;
+		auto emitBlock = [&](std::vector<uint32_t>& block)
+		{
+			sortSpatially(block);
+			for (uint32_t groupIndex : block)
+			{
+				if (emitted[groupIndex] == 0u)
+				{
+					emitted[groupIndex] = 1u;
+					groupOrder.push_back(groupIndex);
+				}
+			}
+			for (auto it = block.rbegin(); it != block.rend(); ++it)
+			{
+				stack.push_back(*it);
+			}
+		};
+
+		emitBlock(roots);
+		while (!stack.empty())
+		{
+			const uint32_t groupIndex = stack.back();
+			stack.pop_back();
+			std::vector<uint32_t>& block = children[groupIndex];
+			block.erase(std::remove_if(block.begin(), block.end(), [&](uint32_t child) { return emitted[child] != 0u; }), block.end());
+			emitBlock(block);
+		}
+
+		// Anything unreachable from a root (malformed parent links) keeps index order.
+		for (uint32_t groupIndex = 0; groupIndex < groupCount; ++groupIndex)
+		{
+			if (emitted[groupIndex] == 0u)
+			{
+				groupOrder.push_back(groupIndex);
+			}
+		}
+		return groupOrder;
+	}
+
 	void FinalizeMeshWidePagePacking(
 		ClusterLODBuildState& state,
+		ClusterLODPagePackingMode packingMode,
 		std::vector<std::vector<std::byte>>& outMeshPageBlobs,
 		std::vector<uint32_t>& outGroupPageReferences,
 		std::vector<uint32_t>& outGroupPageReferenceOffsets,
@@ -2326,62 +2285,28 @@ namespace
 		outVoxelPageBase = 0u;
 		outVoxelPageCount = 0u;
 
-		std::vector<TriangleMeshPageSegmentRef> currentTrianglePage;
-		uint32_t currentAttributeMask = 0u;
-		uint32_t currentUvSetCount = 0u;
+		const bool hierarchyLocality = packingMode == ClusterLODPagePackingMode::HierarchyLocality;
+		const std::vector<uint32_t> groupOrder = hierarchyLocality
+			? BuildHierarchyLocalityGroupOrder(state)
+			: BuildDepthMajorGroupOrder(state);
+
+		// Pass 1: assign segments to pages. Only page sizes are computed here;
+		// the blobs themselves are built in parallel afterwards.
+		std::vector<PendingTriangleMeshPage> pendingPages;
+		PendingTriangleMeshPage currentPage;
 		std::vector<std::vector<uint32_t>> groupReferencedPages(state.groups.size());
 
 		auto flushTrianglePage = [&]()
 		{
-			if (currentTrianglePage.empty())
+			if (!currentPage.segments.empty())
 			{
-				return;
+				pendingPages.push_back(std::move(currentPage));
 			}
-
-			std::vector<std::byte> pageBlob = BuildPackedTriangleMeshPageBlob(
-				state,
-				std::span<const TriangleMeshPageSegmentRef>(currentTrianglePage.data(), currentTrianglePage.size()),
-				currentAttributeMask,
-				currentUvSetCount);
-			if (pageBlob.empty())
-			{
-				currentTrianglePage.clear();
-				currentAttributeMask = 0u;
-				currentUvSetCount = 0u;
-				return;
-			}
-
-			const uint32_t meshPageIndex = static_cast<uint32_t>(outMeshPageBlobs.size());
-			uint32_t pageLocalMeshlet = 0u;
-			for (const TriangleMeshPageSegmentRef& segment : currentTrianglePage)
-			{
-				if (segment.segmentIndex < state.segments.size())
-				{
-					ClusterLODGroupSegment& outSegment = state.segments[segment.segmentIndex];
-					outSegment.pageIndex = meshPageIndex;
-					outSegment.firstMeshletInPage = pageLocalMeshlet;
-					groupReferencedPages[segment.groupIndex].push_back(meshPageIndex);
-				}
-				pageLocalMeshlet += segment.meshletCount;
-			}
-
-			outMeshPageBlobs.push_back(std::move(pageBlob));
-			currentTrianglePage.clear();
-			currentAttributeMask = 0u;
-			currentUvSetCount = 0u;
+			currentPage = PendingTriangleMeshPage{};
 		};
 
-		std::vector<uint32_t> groupOrder(state.groups.size());
-		std::iota(groupOrder.begin(), groupOrder.end(), 0u);
-		std::stable_sort(groupOrder.begin(), groupOrder.end(), [&](uint32_t a, uint32_t b)
-		{
-			const ClusterLODGroup& groupA = state.groups[a];
-			const ClusterLODGroup& groupB = state.groups[b];
-			if (groupA.depth != groupB.depth) return groupA.depth < groupB.depth;
-			if (groupA.parentGroupId != groupB.parentGroupId) return groupA.parentGroupId < groupB.parentGroupId;
-			return a < b;
-		});
-
+		std::vector<TriangleMeshPageSegmentRef> groupCandidates;
+		std::vector<CLodPageHeader> groupCandidateHeaders;
 		for (uint32_t groupIndex : groupOrder)
 		{
 			if (groupIndex >= state.groups.size())
@@ -2394,6 +2319,8 @@ namespace
 				continue;
 			}
 
+			groupCandidates.clear();
+			groupCandidateHeaders.clear();
 			const uint32_t segEnd = std::min<uint32_t>(
 				group.firstSegment + group.segmentCount,
 				static_cast<uint32_t>(state.segments.size()));
@@ -2407,9 +2334,8 @@ namespace
 					continue;
 				}
 
-				const std::vector<std::byte>& sourceBlob = state.groupPageBlobs[groupIndex][segment.pageIndex];
 				CLodPageHeader sourceHeader{};
-				if (!ReadTrianglePageHeader(sourceBlob, sourceHeader))
+				if (!ReadTrianglePageHeader(state.groupPageBlobs[groupIndex][segment.pageIndex], sourceHeader))
 				{
 					continue;
 				}
@@ -2420,49 +2346,122 @@ namespace
 				candidate.sourcePageIndex = segment.pageIndex;
 				candidate.firstMeshletInPage = segment.firstMeshletInPage;
 				candidate.meshletCount = segment.meshletCount;
+				groupCandidates.push_back(candidate);
+				groupCandidateHeaders.push_back(sourceHeader);
+			}
 
-				const uint32_t candidateMask = currentTrianglePage.empty()
+			if (groupCandidates.empty())
+			{
+				continue;
+			}
+
+			// Keep a group on a single page when it fits on one: start a fresh
+			// page rather than splitting it across the tail of the current one.
+			if (hierarchyLocality && !currentPage.segments.empty())
+			{
+				PendingTriangleMeshPage merged = currentPage;
+				PendingTriangleMeshPage alone;
+				for (size_t i = 0; i < groupCandidates.size(); ++i)
+				{
+					merged.segments.push_back(groupCandidates[i]);
+					merged.attributeMask |= groupCandidateHeaders[i].attributeMask;
+					merged.uvSetCount = std::max(merged.uvSetCount, groupCandidateHeaders[i].uvSetCount);
+					alone.segments.push_back(groupCandidates[i]);
+					alone.attributeMask |= groupCandidateHeaders[i].attributeMask;
+					alone.uvSetCount = std::max(alone.uvSetCount, groupCandidateHeaders[i].uvSetCount);
+				}
+				const size_t mergedSize = ComputePendingTriangleMeshPageSize(
+					state,
+					std::span<const TriangleMeshPageSegmentRef>(merged.segments.data(), merged.segments.size()),
+					merged.attributeMask,
+					merged.uvSetCount);
+				if (mergedSize > CLOD_PAGE_SIZE)
+				{
+					const size_t aloneSize = ComputePendingTriangleMeshPageSize(
+						state,
+						std::span<const TriangleMeshPageSegmentRef>(alone.segments.data(), alone.segments.size()),
+						alone.attributeMask,
+						alone.uvSetCount);
+					if (aloneSize <= CLOD_PAGE_SIZE)
+					{
+						flushTrianglePage();
+					}
+				}
+			}
+
+			for (size_t i = 0; i < groupCandidates.size(); ++i)
+			{
+				const TriangleMeshPageSegmentRef& candidate = groupCandidates[i];
+				const CLodPageHeader& sourceHeader = groupCandidateHeaders[i];
+
+				const uint32_t candidateMask = currentPage.segments.empty()
 					? sourceHeader.attributeMask
-					: (currentAttributeMask | sourceHeader.attributeMask);
-				const uint32_t candidateUvSetCount = currentTrianglePage.empty()
+					: (currentPage.attributeMask | sourceHeader.attributeMask);
+				const uint32_t candidateUvSetCount = currentPage.segments.empty()
 					? sourceHeader.uvSetCount
-					: std::max(currentUvSetCount, sourceHeader.uvSetCount);
+					: std::max(currentPage.uvSetCount, sourceHeader.uvSetCount);
 
-				std::vector<TriangleMeshPageSegmentRef> candidatePage = currentTrianglePage;
+				std::vector<TriangleMeshPageSegmentRef> candidatePage = currentPage.segments;
 				candidatePage.push_back(candidate);
-				const TriangleMeshPageBuildTotals candidateTotals = ComputeTriangleMeshPageTotals(
+				const size_t candidateSize = ComputePendingTriangleMeshPageSize(
 					state,
 					std::span<const TriangleMeshPageSegmentRef>(candidatePage.data(), candidatePage.size()),
 					candidateMask,
 					candidateUvSetCount);
-				const size_t candidateSize = ComputePageBlobSize(
-					candidateMask,
-					candidateTotals.meshletCount,
-					candidateUvSetCount,
-					candidateTotals.totalPositionBytes,
-					candidateTotals.totalUvBitsPerSet,
-					candidateTotals.totalVertexCount,
-					candidateTotals.totalNormalWords,
-					candidateTotals.totalColorWords,
-					candidateTotals.totalBoneIndexCount,
-					candidateTotals.totalTriangleBytes);
 
-				if (candidateSize > CLOD_PAGE_SIZE && !currentTrianglePage.empty())
+				if (candidateSize > CLOD_PAGE_SIZE && !currentPage.segments.empty())
 				{
 					flushTrianglePage();
 				}
 
-				currentTrianglePage.push_back(candidate);
-				currentAttributeMask = currentTrianglePage.size() == 1u
+				currentPage.segments.push_back(candidate);
+				currentPage.attributeMask = currentPage.segments.size() == 1u
 					? sourceHeader.attributeMask
-					: (currentAttributeMask | sourceHeader.attributeMask);
-				currentUvSetCount = currentTrianglePage.size() == 1u
+					: (currentPage.attributeMask | sourceHeader.attributeMask);
+				currentPage.uvSetCount = currentPage.segments.size() == 1u
 					? sourceHeader.uvSetCount
-					: std::max(currentUvSetCount, sourceHeader.uvSetCount);
+					: std::max(currentPage.uvSetCount, sourceHeader.uvSetCount);
 			}
 		}
-
 		flushTrianglePage();
+
+		// Pass 2: build the page blobs in parallel.
+		std::vector<std::vector<std::byte>> builtPageBlobs(pendingPages.size());
+		TaskSchedulerManager::GetInstance().ParallelFor("ClusterLODUtilities::BuildMeshPages", pendingPages.size(), [&](size_t pageIndex)
+		{
+			const PendingTriangleMeshPage& page = pendingPages[pageIndex];
+			builtPageBlobs[pageIndex] = BuildPackedTriangleMeshPageBlob(
+				state,
+				std::span<const TriangleMeshPageSegmentRef>(page.segments.data(), page.segments.size()),
+				page.attributeMask,
+				page.uvSetCount);
+		});
+
+		// Pass 3: commit pages in assignment order, dropping any that failed to build.
+		for (size_t pendingIndex = 0; pendingIndex < pendingPages.size(); ++pendingIndex)
+		{
+			if (builtPageBlobs[pendingIndex].empty())
+			{
+				continue;
+			}
+
+			const uint32_t meshPageIndex = static_cast<uint32_t>(outMeshPageBlobs.size());
+			uint32_t pageLocalMeshlet = 0u;
+			for (const TriangleMeshPageSegmentRef& segment : pendingPages[pendingIndex].segments)
+			{
+				if (segment.segmentIndex < state.segments.size())
+				{
+					ClusterLODGroupSegment& outSegment = state.segments[segment.segmentIndex];
+					outSegment.pageIndex = meshPageIndex;
+					outSegment.firstMeshletInPage = pageLocalMeshlet;
+					groupReferencedPages[segment.groupIndex].push_back(meshPageIndex);
+				}
+				pageLocalMeshlet += segment.meshletCount;
+			}
+
+			outMeshPageBlobs.push_back(std::move(builtPageBlobs[pendingIndex]));
+		}
+
 		outTrianglePageCount = static_cast<uint32_t>(outMeshPageBlobs.size());
 		outVoxelPageBase = outTrianglePageCount;
 
@@ -2521,6 +2520,22 @@ namespace
 		}
 		outGroupPageReferenceOffsets.push_back(static_cast<uint32_t>(outGroupPageReferences.size()));
 
+		if (!state.groups.empty())
+		{
+			uint64_t totalPageIntervalSize = 0u;
+			for (const ClusterLODGroup& group : state.groups)
+			{
+				totalPageIntervalSize += group.pageCount;
+			}
+			const double groupCount = static_cast<double>(state.groups.size());
+			spdlog::debug(
+				"ClusterLOD: {} page packing: {} triangle pages, {:.2f} pages/group request, {:.2f} page interval/group",
+				hierarchyLocality ? "hierarchy-locality" : "depth-major",
+				outTrianglePageCount,
+				static_cast<double>(outGroupPageReferences.size()) / groupCount,
+				static_cast<double>(totalPageIntervalSize) / groupCount);
+		}
+
 		std::vector<std::vector<std::vector<std::byte>>> compatibilityGroupPageBlobs(state.groups.size());
 		for (uint32_t groupIndex = 0; groupIndex < static_cast<uint32_t>(state.groups.size()); ++groupIndex)
 		{
@@ -5329,6 +5344,7 @@ ClusterLODPrebuildArtifacts BuildClusterLODArtifactsFromGeometry(
 	unsigned int skinningVertexSize,
 	const std::vector<uint32_t>& indices,
 	const std::vector<MeshUvSetData>& uvSets,
+	const std::vector<DirectX::XMFLOAT4>* sourceTangents,
 	unsigned int flags,
 	const ClusterLODBuilderSettings& settings)
 {
@@ -5356,9 +5372,28 @@ ClusterLODPrebuildArtifacts BuildClusterLODArtifactsFromGeometry(
 	uint32_t simplifyProtectMask = 0;
 	std::vector<DirectX::XMFLOAT4> tangentAttributeStream;
 
-	if (enableNormalAttributeSimplification && hasNormalStreamInSource && hasTexcoordStreamInSource)
+	if (enableNormalAttributeSimplification && sourceTangents && HasValidSourceTangents(*sourceTangents, globalVertexCount))
 	{
-		if (!GenerateMikkTangents(vertices, vertexStrideBytes, indices, tangentAttributeStream))
+		// Imported tangents are authoritative; only their length is normalized.
+		tangentAttributeStream.resize(globalVertexCount);
+		for (size_t vertexIndex = 0; vertexIndex < globalVertexCount; ++vertexIndex)
+		{
+			const DirectX::XMFLOAT4& tangent = (*sourceTangents)[vertexIndex];
+			const float invLen = 1.0f / std::sqrt(tangent.x * tangent.x + tangent.y * tangent.y + tangent.z * tangent.z);
+			tangentAttributeStream[vertexIndex] = DirectX::XMFLOAT4(tangent.x * invLen, tangent.y * invLen, tangent.z * invLen, tangent.w < 0.0f ? -1.0f : 1.0f);
+		}
+	}
+	else if (enableNormalAttributeSimplification && hasNormalStreamInSource && hasTexcoordStreamInSource)
+	{
+		MikkTangentGeneratorOptions tangentOptions{};
+		if (TaskSchedulerManager::GetInstance().GetNumTaskThreads() > 1u)
+		{
+			tangentOptions.parallelFor = [](size_t count, const std::function<void(size_t)>& body)
+			{
+				TaskSchedulerManager::GetInstance().ParallelFor("ClusterLODUtilities::GenerateMikkTangents", count, body);
+			};
+		}
+		if (!GenerateMikkTangentsChunked(vertices, vertexStrideBytes, indices, tangentAttributeStream, tangentOptions))
 		{
 			spdlog::warn("ClusterLOD: failed to generate MikkTSpace tangents; continuing without tangent simplification attributes");
 			tangentAttributeStream.clear();
@@ -5735,6 +5770,7 @@ ClusterLODPrebuildArtifacts BuildClusterLODArtifactsFromGeometry(
 	uint32_t voxelPageCount = 0u;
 	FinalizeMeshWidePagePacking(
 		state,
+		settings.pagePackingMode,
 		meshPageBlobs,
 		groupPageReferences,
 		groupPageReferenceOffsets,
@@ -170,6 +170,116 @@ namespace
 		return sampleTimes;
 	}
 
+	// Whole-mesh fallback: the static sphere transformed by every bone, for
+	// skinning streams that could not be bounded per bone.
+	BoundingSphere SampleAnimationBoundsFromMeshSphere(
+		Skeleton& samplingSkeleton,
+		const Animation& animation,
+		std::span<const DirectX::XMMATRIX> inverseBindMatrices,
+		size_t boneCount,
+		const BoundingSphere& staticSphere)
+	{
+		const std::vector<float> sampleTimes = BuildAnimationSampleTimes(animation);
+		BoundingSphere animationSphere = staticSphere;
+		float previousSampleTime = 0.0f;
+		bool initialized = false;
+
+		for (float sampleTime : sampleTimes) {
+			const float deltaTime = sampleTime - previousSampleTime;
+			samplingSkeleton.UpdateTransforms(deltaTime, true);
+			previousSampleTime = sampleTime;
+
+			const auto boneMatrices = samplingSkeleton.GetBoneMatrices();
+			if (boneMatrices.size() < boneCount) {
+				continue;
+			}
+
+			BoundingSphere sampledSphere{};
+			for (size_t boneIndex = 0; boneIndex < boneCount; ++boneIndex) {
+				const DirectX::XMMATRIX skinMatrix = DirectX::XMMatrixMultiply(boneMatrices[boneIndex], inverseBindMatrices[boneIndex]);
+				const BoundingSphere transformedSphere = TransformBoundingSphere(staticSphere, skinMatrix);
+				if (!initialized && boneIndex == 0) {
+					sampledSphere = transformedSphere;
+				}
+				else {
+					sampledSphere = MergeBoundingSpheres(sampledSphere, transformedSphere);
+				}
+			}
+
+			if (!initialized) {
+				animationSphere = sampledSphere;
+				initialized = true;
+			}
+			else {
+				animationSphere = MergeBoundingSpheres(animationSphere, sampledSphere);
+			}
+		}
+
+		return initialized ? animationSphere : staticSphere;
+	}
+
+	// Each bone moves only the vertices it influences, so posing the per-bone
+	// spheres instead of the whole-mesh sphere keeps the bound close to the
+	// actual silhouette.
+	BoundingSphere SampleAnimationBoundsFromBoneSpheres(
+		Skeleton& samplingSkeleton,
+		const Animation& animation,
+		std::span<const BoneInfluenceSphere> boneSpheres,
+		std::span<const DirectX::XMMATRIX> inverseBindMatrices,
+		size_t boneCount,
+		const BoundingSphere& staticSphere)
+	{
+		const std::vector<float> sampleTimes = BuildAnimationSampleTimes(animation);
+		SkinnedBoundsBuilder builder(boneSpheres);
+		std::vector<DirectX::XMFLOAT4X4> skinMatrices(boneCount);
+		float previousSampleTime = 0.0f;
+
+		for (float sampleTime : sampleTimes) {
+			const float deltaTime = sampleTime - previousSampleTime;
+			samplingSkeleton.UpdateTransforms(deltaTime, true);
+			previousSampleTime = sampleTime;
+
+			const auto boneMatrices = samplingSkeleton.GetBoneMatrices();
+			if (boneMatrices.size() < boneCount) {
+				continue;
+			}
+
+			for (const BoneInfluenceSphere& bone : boneSpheres) {
+				DirectX::XMStoreFloat4x4(
+					&skinMatrices[bone.boneIndex],
+					DirectX::XMMatrixMultiply(boneMatrices[bone.boneIndex], inverseBindMatrices[bone.boneIndex]));
+			}
+			builder.AddPose(std::span<const float>(&skinMatrices[0]._11, skinMatrices.size() * 16u));
+		}
+
+		if (builder.Empty()) {
+			return staticSphere;
+		}
+
+		const SkinnedBoundsSphere bounds = builder.Build();
+		BoundingSphere animationSphere{};
+		animationSphere.sphere = DirectX::XMFLOAT4(bounds.center[0], bounds.center[1], bounds.center[2], bounds.radius);
+		return animationSphere;
+	}
+
+	// Voxel LOD cubes are placed inside cells of the source surface rather than
+	// on source vertices, up to a cell diagonal away from the vertices whose
+	// bones they inherit.
+	float ComputeVoxelSkinnedBoundsPadding(const std::optional<ClusterLODPrebuiltData>& prebuiltClusterLOD)
+	{
+		if (!prebuiltClusterLOD.has_value()) {
+			return 0.0f;
+		}
+
+		float maxVoxelError = 0.0f;
+		for (const ClusterLODGroup& group : prebuiltClusterLOD->groups) {
+			if ((group.flags & CLOD_GROUP_FLAG_IS_VOXEL) != 0u && std::isfinite(group.representationError)) {
+				maxVoxelError = std::max(maxVoxelError, group.representationError);
+			}
+		}
+		return maxVoxelError * std::sqrt(3.0f);
+	}
+
 	BoundingSphere BuildObjectBoundingSphereFromRootNode(const std::vector<ClusterLODNode>& nodes, uint32_t rootNodeIndex)
 	{
 		BoundingSphere sphere{};
@@ -357,6 +467,18 @@ Mesh::Mesh(std::unique_ptr<std::vector<std::byte>> vertices, unsigned int vertex
 	m_perMeshBufferData.clodNumMeshlets = 0;
 
 	m_skinningVertexSize = skinningVertexSize;
+	if (skinningVertices.has_value() && *skinningVertices) {
+		const std::vector<std::byte>& skinningData = **skinningVertices;
+		if (BuildBoneInfluenceSpheres(skinningData, skinningVertexSize, m_boneInfluenceSpheres)) {
+			const float voxelPadding = ComputeVoxelSkinnedBoundsPadding(m_prebuiltClusterLOD);
+			for (BoneInfluenceSphere& bone : m_boneInfluenceSpheres) {
+				bone.radius += voxelPadding;
+			}
+		}
+		else {
+			m_boneInfluenceSpheres.clear();
+		}
+	}
     this->material = material;
 
 	if (!deferResourceCreation) {
@@ -639,81 +761,50 @@ void Mesh::EnsureAnimatedBoundingSpheresBuilt_() const
 	}
 
 	m_animationBoundingSpheres.clear();
-	m_animationBoundingSpheres.reserve(animationCount);
 
 	if (animationCount == 0) {
 		return;
 	}
 
 	const BoundingSphere staticSphere = m_perMeshBufferData.boundingSphere;
+	m_animationBoundingSpheres.assign(animationCount, staticSphere);
 	if (staticSphere.sphere.w <= 0.0f) {
-		m_animationBoundingSpheres.assign(animationCount, staticSphere);
-		return;
-	}
-
-	auto samplingSkeleton = m_baseSkeleton->CopySkeleton();
-	if (!samplingSkeleton) {
-		m_animationBoundingSpheres.assign(animationCount, staticSphere);
 		return;
 	}
 
 	const auto inverseBindMatrices = m_baseSkeleton->GetInverseBindMatrices();
 	const size_t boneCount = m_baseSkeleton->GetBoneCount();
 	if (boneCount == 0 || inverseBindMatrices.size() < boneCount) {
-		m_animationBoundingSpheres.assign(animationCount, staticSphere);
 		return;
 	}
 
+	const bool usePerBoneBounds = !m_boneInfluenceSpheres.empty() &&
+		std::all_of(m_boneInfluenceSpheres.begin(), m_boneInfluenceSpheres.end(), [boneCount](const BoneInfluenceSphere& bone) {
+			return bone.boneIndex < boneCount;
+		});
+
+	// One sampling instance per animation so the clips can be evaluated in parallel.
+	std::vector<std::shared_ptr<Skeleton>> samplingSkeletons(animationCount);
 	for (size_t animationIndex = 0; animationIndex < animationCount; ++animationIndex) {
-		const auto& animation = m_baseSkeleton->animations[animationIndex];
-		if (!animation) {
-			m_animationBoundingSpheres.push_back(staticSphere);
-			continue;
+		if (m_baseSkeleton->animations[animationIndex]) {
+			samplingSkeletons[animationIndex] = m_baseSkeleton->CopySkeleton();
 		}
+	}
 
-		samplingSkeleton->SetAnimation(animationIndex);
-		const std::vector<float> sampleTimes = BuildAnimationSampleTimes(*animation);
-		BoundingSphere animationSphere = staticSphere;
-		float previousSampleTime = 0.0f;
-		bool initialized = false;
-
-		for (float sampleTime : sampleTimes) {
-			const float deltaTime = sampleTime - previousSampleTime;
-			samplingSkeleton->UpdateTransforms(deltaTime, true);
-			previousSampleTime = sampleTime;
-
-			const auto boneMatrices = samplingSkeleton->GetBoneMatrices();
-			if (boneMatrices.size() < boneCount) {
-				continue;
-			}
-
-			BoundingSphere sampledSphere{};
-			for (size_t boneIndex = 0; boneIndex < boneCount; ++boneIndex) {
-				const DirectX::XMMATRIX skinMatrix = DirectX::XMMatrixMultiply(boneMatrices[boneIndex], inverseBindMatrices[boneIndex]);
-				const BoundingSphere transformedSphere = TransformBoundingSphere(staticSphere, skinMatrix);
-				if (!initialized && boneIndex == 0) {
-					sampledSphere = transformedSphere;
-				}
-				else {
-					sampledSphere = MergeBoundingSpheres(sampledSphere, transformedSphere);
-				}
-			}
-
-			if (!initialized) {
-				animationSphere = sampledSphere;
-				initialized = true;
-			}
-			else {
-				animationSphere = MergeBoundingSpheres(animationSphere, sampledSphere);
-			}
+	TaskSchedulerManager::GetInstance().ParallelFor("Mesh::BuildAnimatedBoundingSpheres", animationCount, [&](size_t animationIndex) {
+		const auto& samplingSkeleton = samplingSkeletons[animationIndex];
+		if (!samplingSkeleton) {
+			return;
 		}
 
-		if (!initialized) {
-			animationSphere = staticSphere;
-		}
+		const auto& animation = *m_baseSkeleton->animations[animationIndex];
+		samplingSkeleton->SetAnimation(animationIndex);
+		BoundingSphere animationSphere = usePerBoneBounds
+			? SampleAnimationBoundsFromBoneSpheres(*samplingSkeleton, animation, m_boneInfluenceSpheres, inverseBindMatrices, boneCount, staticSphere)
+			: SampleAnimationBoundsFromMeshSphere(*samplingSkeleton, animation, inverseBindMatrices, boneCount, staticSphere);
 		animationSphere.sphere.w *= kAnimatedBoundsPaddingScale;
-		m_animationBoundingSpheres.push_back(animationSphere);
-	}
+		m_animationBoundingSpheres[animationIndex] = animationSphere;
+	});
 }
 
 void Mesh::SetMaterialDataIndex(unsigned int index) {
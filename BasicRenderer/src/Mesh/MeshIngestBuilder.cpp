@@ -13,6 +13,7 @@ ClusterLODPrebuildArtifacts MeshIngestBuilder::BuildClusterLODArtifacts() const
 		m_skinningVertexSize,
 		m_indices,
 		m_uvSets,
+		m_sourceTangents.empty() ? nullptr : &m_sourceTangents,
 		m_flags,
 		m_clusterLODBuilderSettings);
 }
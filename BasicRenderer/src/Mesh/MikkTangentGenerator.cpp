@@ -0,0 +1,482 @@
+#include "Mesh/MikkTangentGenerator.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#include "Mesh/VertexLayout.h"
+#include "Mesh/VertexFlags.h"
+#include "Utilities/mikktspace.h"
+
+namespace
+{
+	constexpr size_t PositionByteOffset = MeshVertexLayout::PositionOffset;
+	constexpr size_t NormalByteOffset = MeshVertexLayout::NormalOffset;
+	constexpr size_t TexcoordByteOffset = MeshVertexLayout::TexcoordOffset(VertexFlags::VERTEX_TEXCOORDS);
+	constexpr size_t VerticesPerBlock = 1u << 16;
+
+	DirectX::XMFLOAT3 ReadFloat3(const std::byte* source)
+	{
+		DirectX::XMFLOAT3 value{};
+		std::memcpy(&value, source, sizeof(float) * 3);
+		return value;
+	}
+
+	DirectX::XMFLOAT2 ReadFloat2(const std::byte* source)
+	{
+		DirectX::XMFLOAT2 value{};
+		std::memcpy(&value, source, sizeof(float) * 2);
+		return value;
+	}
+
+	DirectX::XMFLOAT3 BuildFallbackTangentFromNormal(DirectX::XMFLOAT3 normal)
+	{
+		const float normalLenSq = normal.x * normal.x + normal.y * normal.y + normal.z * normal.z;
+		if (normalLenSq <= 1e-20f)
+		{
+			normal = DirectX::XMFLOAT3(0.0f, 0.0f, 1.0f);
+		}
+		else
+		{
+			const float invNormalLen = 1.0f / std::sqrt(normalLenSq);
+			normal = DirectX::XMFLOAT3(normal.x * invNormalLen, normal.y * invNormalLen, normal.z * invNormalLen);
+		}
+
+		DirectX::XMFLOAT3 axis = (std::abs(normal.z) < 0.999f)
+			? DirectX::XMFLOAT3(0.0f, 0.0f, 1.0f)
+			: DirectX::XMFLOAT3(0.0f, 1.0f, 0.0f);
+
+		DirectX::XMFLOAT3 tangent(
+			axis.y * normal.z - axis.z * normal.y,
+			axis.z * normal.x - axis.x * normal.z,
+			axis.x * normal.y - axis.y * normal.x);
+
+		const float tangentLenSq = tangent.x * tangent.x + tangent.y * tangent.y + tangent.z * tangent.z;
+		if (tangentLenSq <= 1e-20f)
+		{
+			return DirectX::XMFLOAT3(1.0f, 0.0f, 0.0f);
+		}
+
+		const float invTangentLen = 1.0f / std::sqrt(tangentLenSq);
+		return DirectX::XMFLOAT3(tangent.x * invTangentLen, tangent.y * invTangentLen, tangent.z * invTangentLen);
+	}
+
+	bool ValidateInput(const std::vector<std::byte>& vertices, size_t vertexStrideBytes, const std::vector<uint32_t>& indices, size_t& outVertexCount)
+	{
+		if (vertexStrideBytes < (TexcoordByteOffset + sizeof(float) * 2) || indices.empty() || (indices.size() % 3ull) != 0ull)
+		{
+			return false;
+		}
+
+		outVertexCount = vertices.size() / vertexStrideBytes;
+		if (outVertexCount == 0)
+		{
+			return false;
+		}
+
+		for (uint32_t index : indices)
+		{
+			if (static_cast<size_t>(index) >= outVertexCount)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	// Normalizes accumulated per-vertex sums, falling back to a normal-derived
+	// tangent where MikkTSpace produced nothing usable.
+	DirectX::XMFLOAT4 ResolveVertexTangent(DirectX::XMFLOAT3 tangent, float signSum, uint32_t contributions, const DirectX::XMFLOAT3& normal)
+	{
+		const float tangentLenSq = tangent.x * tangent.x + tangent.y * tangent.y + tangent.z * tangent.z;
+		if (contributions == 0u || tangentLenSq <= 1e-20f ||
+			!std::isfinite(tangent.x) || !std::isfinite(tangent.y) || !std::isfinite(tangent.z))
+		{
+			tangent = BuildFallbackTangentFromNormal(normal);
+		}
+		else
+		{
+			const float invLen = 1.0f / std::sqrt(tangentLenSq);
+			tangent.x *= invLen;
+			tangent.y *= invLen;
+			tangent.z *= invLen;
+		}
+
+		const float sign = signSum < 0.0f ? -1.0f : 1.0f;
+		return DirectX::XMFLOAT4(tangent.x, tangent.y, tangent.z, sign);
+	}
+
+	void RunParallel(const MikkTangentGeneratorOptions& options, size_t count, const std::function<void(size_t)>& body)
+	{
+		if (options.parallelFor && count > 1u)
+		{
+			options.parallelFor(count, body);
+			return;
+		}
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			body(i);
+		}
+	}
+
+	// Serial path: MikkTSpace reads straight from the interleaved stream.
+
+	struct MikkTangentBuildData
+	{
+		const std::vector<std::byte>* vertices = nullptr;
+		size_t vertexStrideBytes = 0;
+		const std::vector<uint32_t>* indices = nullptr;
+		std::vector<DirectX::XMFLOAT3> accumulatedTangents;
+		std::vector<float> accumulatedSigns;
+		std::vector<uint32_t> accumulatedContributions;
+	};
+
+	const std::byte* SerialCornerAttribute(const MikkTangentBuildData* data, int face, int vertexInFace, size_t attributeByteOffset)
+	{
+		const size_t index = static_cast<size_t>(face) * 3ull + static_cast<size_t>(vertexInFace);
+		const uint32_t vertexIndex = (*data->indices)[index];
+		return data->vertices->data() + static_cast<size_t>(vertexIndex) * data->vertexStrideBytes + attributeByteOffset;
+	}
+
+	int MikkGetNumFaces(const SMikkTSpaceContext* context)
+	{
+		const MikkTangentBuildData* data = static_cast<const MikkTangentBuildData*>(context->m_pUserData);
+		return static_cast<int>(data->indices->size() / 3ull);
+	}
+
+	int MikkGetNumVerticesOfFace(const SMikkTSpaceContext*, const int)
+	{
+		return 3;
+	}
+
+	void MikkGetPosition(const SMikkTSpaceContext* context, float positionOut[], const int face, const int vertexInFace)
+	{
+		const MikkTangentBuildData* data = static_cast<const MikkTangentBuildData*>(context->m_pUserData);
+		std::memcpy(positionOut, SerialCornerAttribute(data, face, vertexInFace, PositionByteOffset), sizeof(float) * 3);
+	}
+
+	void MikkGetNormal(const SMikkTSpaceContext* context, float normalOut[], const int face, const int vertexInFace)
+	{
+		const MikkTangentBuildData* data = static_cast<const MikkTangentBuildData*>(context->m_pUserData);
+		std::memcpy(normalOut, SerialCornerAttribute(data, face, vertexInFace, NormalByteOffset), sizeof(float) * 3);
+	}
+
+	void MikkGetTexCoord(const SMikkTSpaceContext* context, float texcoordOut[], const int face, const int vertexInFace)
+	{
+		const MikkTangentBuildData* data = static_cast<const MikkTangentBuildData*>(context->m_pUserData);
+		std::memcpy(texcoordOut, SerialCornerAttribute(data, face, vertexInFace, TexcoordByteOffset), sizeof(float) * 2);
+	}
+
+	void MikkSetTSpaceBasic(const SMikkTSpaceContext* context, const float tangent[], const float sign, const int face, const int vertexInFace)
+	{
+		MikkTangentBuildData* data = static_cast<MikkTangentBuildData*>(context->m_pUserData);
+		const size_t index = static_cast<size_t>(face) * 3ull + static_cast<size_t>(vertexInFace);
+		const uint32_t vertexIndex = (*data->indices)[index];
+		if (vertexIndex >= data->accumulatedTangents.size())
+		{
+			return;
+		}
+
+		DirectX::XMFLOAT3& accumulatedTangent = data->accumulatedTangents[vertexIndex];
+		accumulatedTangent.x += tangent[0];
+		accumulatedTangent.y += tangent[1];
+		accumulatedTangent.z += tangent[2];
+		data->accumulatedSigns[vertexIndex] += sign;
+		data->accumulatedContributions[vertexIndex] += 1u;
+	}
+
+	// Chunked path: attributes are decoded once per vertex into flat arrays
+	// shared read-only by every chunk, and results land in per-corner slots.
+
+	struct DecodedVertices
+	{
+		std::vector<DirectX::XMFLOAT3> positions;
+		std::vector<DirectX::XMFLOAT3> normals;
+		std::vector<DirectX::XMFLOAT2> texcoords;
+	};
+
+	struct MikkChunkData
+	{
+		const DecodedVertices* decoded = nullptr;
+		const uint32_t* indices = nullptr;
+		const uint32_t* faces = nullptr;
+		uint32_t faceCount = 0;
+		// xyz = tangent, w = handedness; w == 0 marks a corner MikkTSpace did not write.
+		DirectX::XMFLOAT4* cornerTangents = nullptr;
+	};
+
+	uint32_t ChunkCornerVertex(const MikkChunkData* data, int face, int vertexInFace)
+	{
+		return data->indices[static_cast<size_t>(data->faces[face]) * 3ull + static_cast<size_t>(vertexInFace)];
+	}
+
+	int MikkChunkGetNumFaces(const SMikkTSpaceContext* context)
+	{
+		return static_cast<int>(static_cast<const MikkChunkData*>(context->m_pUserData)->faceCount);
+	}
+
+	void MikkChunkGetPosition(const SMikkTSpaceContext* context, float positionOut[], const int face, const int vertexInFace)
+	{
+		const MikkChunkData* data = static_cast<const MikkChunkData*>(context->m_pUserData);
+		std::memcpy(positionOut, &data->decoded->positions[ChunkCornerVertex(data, face, vertexInFace)], sizeof(float) * 3);
+	}
+
+	void MikkChunkGetNormal(const SMikkTSpaceContext* context, float normalOut[], const int face, const int vertexInFace)
+	{
+		const MikkChunkData* data = static_cast<const MikkChunkData*>(context->m_pUserData);
+		std::memcpy(normalOut, &data->decoded->normals[ChunkCornerVertex(data, face, vertexInFace)], sizeof(float) * 3);
+	}
+
+	void MikkChunkGetTexCoord(const SMikkTSpaceContext* context, float texcoordOut[], const int face, const int vertexInFace)
+	{
+		const MikkChunkData* data = static_cast<const MikkChunkData*>(context->m_pUserData);
+		std::memcpy(texcoordOut, &data->decoded->texcoords[ChunkCornerVertex(data, face, vertexInFace)], sizeof(float) * 2);
+	}
+
+	void MikkChunkSetTSpaceBasic(const SMikkTSpaceContext* context, const float tangent[], const float sign, const int face, const int vertexInFace)
+	{
+		const MikkChunkData* data = static_cast<const MikkChunkData*>(context->m_pUserData);
+		const size_t corner = static_cast<size_t>(data->faces[face]) * 3ull + static_cast<size_t>(vertexInFace);
+		data->cornerTangents[corner] = DirectX::XMFLOAT4(tangent[0], tangent[1], tangent[2], sign < 0.0f ? -1.0f : 1.0f);
+	}
+
+	uint32_t SpreadBits10(uint32_t value)
+	{
+		value &= 0x3FFu;
+		value = (value | (value << 16u)) & 0x030000FFu;
+		value = (value | (value << 8u)) & 0x0300F00Fu;
+		value = (value | (value << 4u)) & 0x030C30C3u;
+		value = (value | (value << 2u)) & 0x09249249u;
+		return value;
+	}
+
+	// Face indices ordered along a 30-bit Morton curve of their centroids; ties
+	// keep index order, so the ordering is a pure function of the mesh.
+	std::vector<uint32_t> BuildSpatialFaceOrder(const DecodedVertices& decoded, const std::vector<uint32_t>& indices)
+	{
+		const size_t faceCount = indices.size() / 3ull;
+		std::vector<DirectX::XMFLOAT3> centroids(faceCount);
+		DirectX::XMFLOAT3 boundsMin((std::numeric_limits<float>::max)(), (std::numeric_limits<float>::max)(), (std::numeric_limits<float>::max)());
+		DirectX::XMFLOAT3 boundsMax(-(std::numeric_limits<float>::max)(), -(std::numeric_limits<float>::max)(), -(std::numeric_limits<float>::max)());
+		for (size_t face = 0; face < faceCount; ++face)
+		{
+			const DirectX::XMFLOAT3& p0 = decoded.positions[indices[face * 3ull + 0ull]];
+			const DirectX::XMFLOAT3& p1 = decoded.positions[indices[face * 3ull + 1ull]];
+			const DirectX::XMFLOAT3& p2 = decoded.positions[indices[face * 3ull + 2ull]];
+			DirectX::XMFLOAT3 centroid(
+				(p0.x + p1.x + p2.x) * (1.0f / 3.0f),
+				(p0.y + p1.y + p2.y) * (1.0f / 3.0f),
+				(p0.z + p1.z + p2.z) * (1.0f / 3.0f));
+			if (!std::isfinite(centroid.x) || !std::isfinite(centroid.y) || !std::isfinite(centroid.z))
+			{
+				centroid = DirectX::XMFLOAT3(0.0f, 0.0f, 0.0f);
+			}
+			centroids[face] = centroid;
+			boundsMin = DirectX::XMFLOAT3((std::min)(boundsMin.x, centroid.x), (std::min)(boundsMin.y, centroid.y), (std::min)(boundsMin.z, centroid.z));
+			boundsMax = DirectX::XMFLOAT3((std::max)(boundsMax.x, centroid.x), (std::max)(boundsMax.y, centroid.y), (std::max)(boundsMax.z, centroid.z));
+		}
+
+		const float extent = (std::max)({ boundsMax.x - boundsMin.x, boundsMax.y - boundsMin.y, boundsMax.z - boundsMin.z, 1e-20f });
+		const float scale = 1023.0f / extent;
+		std::vector<uint64_t> keys(faceCount);
+		for (size_t face = 0; face < faceCount; ++face)
+		{
+			const DirectX::XMFLOAT3& centroid = centroids[face];
+			const uint32_t x = static_cast<uint32_t>((centroid.x - boundsMin.x) * scale);
+			const uint32_t y = static_cast<uint32_t>((centroid.y - boundsMin.y) * scale);
+			const uint32_t z = static_cast<uint32_t>((centroid.z - boundsMin.z) * scale);
+			const uint32_t morton = SpreadBits10(x) | (SpreadBits10(y) << 1u) | (SpreadBits10(z) << 2u);
+			keys[face] = (static_cast<uint64_t>(morton) << 32u) | static_cast<uint64_t>(face);
+		}
+		std::sort(keys.begin(), keys.end());
+
+		std::vector<uint32_t> order(faceCount);
+		for (size_t i = 0; i < faceCount; ++i)
+		{
+			order[i] = static_cast<uint32_t>(keys[i] & 0xFFFFFFFFull);
+		}
+		return order;
+	}
+}
+
+bool GenerateMikkTangentsSerial(
+	const std::vector<std::byte>& vertices,
+	size_t vertexStrideBytes,
+	const std::vector<uint32_t>& indices,
+	std::vector<DirectX::XMFLOAT4>& outTangents)
+{
+	size_t vertexCount = 0;
+	if (!ValidateInput(vertices, vertexStrideBytes, indices, vertexCount))
+	{
+		return false;
+	}
+
+	MikkTangentBuildData buildData{};
+	buildData.vertices = &vertices;
+	buildData.vertexStrideBytes = vertexStrideBytes;
+	buildData.indices = &indices;
+	buildData.accumulatedTangents.assign(vertexCount, DirectX::XMFLOAT3(0.0f, 0.0f, 0.0f));
+	buildData.accumulatedSigns.assign(vertexCount, 0.0f);
+	buildData.accumulatedContributions.assign(vertexCount, 0u);
+
+	SMikkTSpaceInterface mikkInterface{};
+	mikkInterface.m_getNumFaces = &MikkGetNumFaces;
+	mikkInterface.m_getNumVerticesOfFace = &MikkGetNumVerticesOfFace;
+	mikkInterface.m_getPosition = &MikkGetPosition;
+	mikkInterface.m_getNormal = &MikkGetNormal;
+	mikkInterface.m_getTexCoord = &MikkGetTexCoord;
+	mikkInterface.m_setTSpaceBasic = &MikkSetTSpaceBasic;
+
+	SMikkTSpaceContext mikkContext{};
+	mikkContext.m_pInterface = &mikkInterface;
+	mikkContext.m_pUserData = &buildData;
+
+	if (genTangSpaceDefault(&mikkContext) == 0)
+	{
+		return false;
+	}
+
+	outTangents.resize(vertexCount);
+	for (size_t vertexIndex = 0; vertexIndex < vertexCount; ++vertexIndex)
+	{
+		const DirectX::XMFLOAT3 normal = ReadFloat3(vertices.data() + vertexIndex * vertexStrideBytes + NormalByteOffset);
+		outTangents[vertexIndex] = ResolveVertexTangent(
+			buildData.accumulatedTangents[vertexIndex],
+			buildData.accumulatedSigns[vertexIndex],
+			buildData.accumulatedContributions[vertexIndex],
+			normal);
+	}
+
+	return true;
+}
+
+bool GenerateMikkTangentsChunked(
+	const std::vector<std::byte>& vertices,
+	size_t vertexStrideBytes,
+	const std::vector<uint32_t>& indices,
+	std::vector<DirectX::XMFLOAT4>& outTangents,
+	const MikkTangentGeneratorOptions& options)
+{
+	size_t vertexCount = 0;
+	if (!ValidateInput(vertices, vertexStrideBytes, indices, vertexCount))
+	{
+		return false;
+	}
+
+	const size_t vertexBlockCount = (vertexCount + VerticesPerBlock - 1u) / VerticesPerBlock;
+
+	DecodedVertices decoded;
+	decoded.positions.resize(vertexCount);
+	decoded.normals.resize(vertexCount);
+	decoded.texcoords.resize(vertexCount);
+	RunParallel(options, vertexBlockCount, [&](size_t block)
+	{
+		const size_t begin = block * VerticesPerBlock;
+		const size_t end = (std::min)(vertexCount, begin + VerticesPerBlock);
+		for (size_t vertexIndex = begin; vertexIndex < end; ++vertexIndex)
+		{
+			const std::byte* vertex = vertices.data() + vertexIndex * vertexStrideBytes;
+			decoded.positions[vertexIndex] = ReadFloat3(vertex + PositionByteOffset);
+			decoded.normals[vertexIndex] = ReadFloat3(vertex + NormalByteOffset);
+			decoded.texcoords[vertexIndex] = ReadFloat2(vertex + TexcoordByteOffset);
+		}
+	});
+
+	const std::vector<uint32_t> faceOrder = BuildSpatialFaceOrder(decoded, indices);
+	const size_t faceCount = faceOrder.size();
+	const size_t facesPerChunk = (std::max)(options.facesPerChunk, 1u);
+	const size_t chunkCount = (faceCount + facesPerChunk - 1u) / facesPerChunk;
+
+	std::vector<DirectX::XMFLOAT4> cornerTangents(indices.size(), DirectX::XMFLOAT4(0.0f, 0.0f, 0.0f, 0.0f));
+	std::atomic<bool> failed{ false };
+	RunParallel(options, chunkCount, [&](size_t chunk)
+	{
+		const size_t firstFace = chunk * facesPerChunk;
+		MikkChunkData chunkData{};
+		chunkData.decoded = &decoded;
+		chunkData.indices = indices.data();
+		chunkData.faces = faceOrder.data() + firstFace;
+		chunkData.faceCount = static_cast<uint32_t>((std::min)(facesPerChunk, faceCount - firstFace));
+		chunkData.cornerTangents = cornerTangents.data();
+
+		SMikkTSpaceInterface mikkInterface{};
+		mikkInterface.m_getNumFaces = &MikkChunkGetNumFaces;
+		mikkInterface.m_getNumVerticesOfFace = &MikkGetNumVerticesOfFace;
+		mikkInterface.m_getPosition = &MikkChunkGetPosition;
+		mikkInterface.m_getNormal = &MikkChunkGetNormal;
+		mikkInterface.m_getTexCoord = &MikkChunkGetTexCoord;
+		mikkInterface.m_setTSpaceBasic = &MikkChunkSetTSpaceBasic;
+
+		SMikkTSpaceContext mikkContext{};
+		mikkContext.m_pInterface = &mikkInterface;
+		mikkContext.m_pUserData = &chunkData;
+		if (genTangSpaceDefault(&mikkContext) == 0)
+		{
+			failed.store(true, std::memory_order_relaxed);
+		}
+	});
+	if (failed.load())
+	{
+		return false;
+	}
+
+	// Sum corners into their vertices in original corner order. This fixed
+	// order is what makes the result independent of chunk scheduling.
+	std::vector<DirectX::XMFLOAT3> accumulatedTangents(vertexCount, DirectX::XMFLOAT3(0.0f, 0.0f, 0.0f));
+	std::vector<float> accumulatedSigns(vertexCount, 0.0f);
+	std::vector<uint32_t> accumulatedContributions(vertexCount, 0u);
+	for (size_t corner = 0; corner < indices.size(); ++corner)
+	{
+		const DirectX::XMFLOAT4& cornerTangent = cornerTangents[corner];
+		if (cornerTangent.w == 0.0f)
+		{
+			continue;
+		}
+
+		const uint32_t vertexIndex = indices[corner];
+		DirectX::XMFLOAT3& accumulated = accumulatedTangents[vertexIndex];
+		accumulated.x += cornerTangent.x;
+		accumulated.y += cornerTangent.y;
+		accumulated.z += cornerTangent.z;
+		accumulatedSigns[vertexIndex] += cornerTangent.w;
+		accumulatedContributions[vertexIndex] += 1u;
+	}
+
+	outTangents.resize(vertexCount);
+	RunParallel(options, vertexBlockCount, [&](size_t block)
+	{
+		const size_t begin = block * VerticesPerBlock;
+		const size_t end = (std::min)(vertexCount, begin + VerticesPerBlock);
+		for (size_t vertexIndex = begin; vertexIndex < end; ++vertexIndex)
+		{
+			outTangents[vertexIndex] = ResolveVertexTangent(
+				accumulatedTangents[vertexIndex],
+				accumulatedSigns[vertexIndex],
+				accumulatedContributions[vertexIndex],
+				decoded.normals[vertexIndex]);
+		}
+	});
+
+	return true;
+}
+
+bool HasValidSourceTangents(const std::vector<DirectX::XMFLOAT4>& sourceTangents, size_t vertexCount)
+{
+	if (vertexCount == 0 || sourceTangents.size() != vertexCount)
+	{
+		return false;
+	}
+
+	for (const DirectX::XMFLOAT4& tangent : sourceTangents)
+	{
+		const float lenSq = tangent.x * tangent.x + tangent.y * tangent.y + tangent.z * tangent.z;
+		if (!std::isfinite(lenSq) || lenSq <= 1e-12f || std::abs(std::abs(tangent.w) - 1.0f) > 1e-3f)
+		{
+			return false;
+		}
+	}
+	return true;
+}
@@ -0,0 +1,180 @@
+#include "Mesh/SkinnedBounds.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace
+{
+	constexpr uint32_t kMaxSkinInfluences = 8u;
+	constexpr size_t kPositionOffset = 0;
+	constexpr size_t kJointsOffset = 6u * sizeof(float);
+	constexpr size_t kWeightsOffset = kJointsOffset + kMaxSkinInfluences * sizeof(uint32_t);
+	constexpr size_t kMinSkinningStride = kWeightsOffset + kMaxSkinInfluences * sizeof(float);
+	// Page weights are quantized, so the runtime sum is only close to one.
+	constexpr float kWeightSumTolerance = 1.0e-2f;
+	// Rejects garbage joint indices before they size the per-bone table.
+	constexpr uint32_t kMaxBoneIndex = 1u << 16;
+
+	float Distance(const float a[3], const float b[3])
+	{
+		const float dx = a[0] - b[0];
+		const float dy = a[1] - b[1];
+		const float dz = a[2] - b[2];
+		return std::sqrt(dx * dx + dy * dy + dz * dz);
+	}
+}
+
+bool BuildBoneInfluenceSpheres(
+	std::span<const std::byte> skinningVertices,
+	size_t skinningVertexStrideBytes,
+	std::vector<BoneInfluenceSphere>& outSpheres)
+{
+	outSpheres.clear();
+	if (skinningVertexStrideBytes < kMinSkinningStride) {
+		return false;
+	}
+	const size_t vertexCount = skinningVertices.size() / skinningVertexStrideBytes;
+	if (vertexCount == 0u) {
+		return false;
+	}
+
+	struct BoneExtent {
+		float min[3];
+		float max[3];
+		bool used = false;
+	};
+	std::vector<BoneExtent> extents;
+
+	auto readVertex = [&](size_t vertexIndex, float position[3], uint32_t joints[kMaxSkinInfluences], float weights[kMaxSkinInfluences]) {
+		const std::byte* vertex = skinningVertices.data() + vertexIndex * skinningVertexStrideBytes;
+		std::memcpy(position, vertex + kPositionOffset, 3u * sizeof(float));
+		std::memcpy(joints, vertex + kJointsOffset, kMaxSkinInfluences * sizeof(uint32_t));
+		std::memcpy(weights, vertex + kWeightsOffset, kMaxSkinInfluences * sizeof(float));
+	};
+
+	// Pass 1: validate weights and take the bind-space box of each bone's vertices.
+	for (size_t vertexIndex = 0; vertexIndex < vertexCount; ++vertexIndex) {
+		float position[3];
+		uint32_t joints[kMaxSkinInfluences];
+		float weights[kMaxSkinInfluences];
+		readVertex(vertexIndex, position, joints, weights);
+		if (!std::isfinite(position[0]) || !std::isfinite(position[1]) || !std::isfinite(position[2])) {
+			return false;
+		}
+
+		float weightSum = 0.0f;
+		for (uint32_t influence = 0; influence < kMaxSkinInfluences; ++influence) {
+			const float weight = weights[influence];
+			if (!(weight >= 0.0f)) {
+				return false;
+			}
+			if (weight == 0.0f) {
+				continue;
+			}
+			if (joints[influence] >= kMaxBoneIndex) {
+				return false;
+			}
+			if (joints[influence] >= extents.size()) {
+				extents.resize(static_cast<size_t>(joints[influence]) + 1u);
+			}
+			weightSum += weight;
+
+			BoneExtent& extent = extents[joints[influence]];
+			for (uint32_t axis = 0; axis < 3u; ++axis) {
+				extent.min[axis] = extent.used ? (std::min)(extent.min[axis], position[axis]) : position[axis];
+				extent.max[axis] = extent.used ? (std::max)(extent.max[axis], position[axis]) : position[axis];
+			}
+			extent.used = true;
+		}
+		if (std::abs(weightSum - 1.0f) > kWeightSumTolerance) {
+			return false;
+		}
+	}
+
+	const uint32_t boneCount = static_cast<uint32_t>(extents.size());
+	std::vector<uint32_t> sphereByBone(boneCount, (std::numeric_limits<uint32_t>::max)());
+	for (uint32_t boneIndex = 0; boneIndex < boneCount; ++boneIndex) {
+		const BoneExtent& extent = extents[boneIndex];
+		if (!extent.used) {
+			continue;
+		}
+		BoneInfluenceSphere sphere{};
+		for (uint32_t axis = 0; axis < 3u; ++axis) {
+			sphere.center[axis] = 0.5f * (extent.min[axis] + extent.max[axis]);
+		}
+		sphere.boneIndex = boneIndex;
+		sphereByBone[boneIndex] = static_cast<uint32_t>(outSpheres.size());
+		outSpheres.push_back(sphere);
+	}
+
+	// Pass 2: radius around the box center. Tighter than the box's half diagonal
+	// whenever the bone's vertices do not fill the box corners.
+	for (size_t vertexIndex = 0; vertexIndex < vertexCount; ++vertexIndex) {
+		float position[3];
+		uint32_t joints[kMaxSkinInfluences];
+		float weights[kMaxSkinInfluences];
+		readVertex(vertexIndex, position, joints, weights);
+		for (uint32_t influence = 0; influence < kMaxSkinInfluences; ++influence) {
+			if (weights[influence] == 0.0f) {
+				continue;
+			}
+			BoneInfluenceSphere& sphere = outSpheres[sphereByBone[joints[influence]]];
+			sphere.radius = (std::max)(sphere.radius, Distance(sphere.center, position));
+		}
+	}
+
+	return !outSpheres.empty();
+}
+
+void SkinnedBoundsBuilder::AddPose(std::span<const float> skinMatrices)
+{
+	for (const BoneInfluenceSphere& bone : m_boneSpheres) {
+		const size_t base = static_cast<size_t>(bone.boneIndex) * 16u;
+		if (base + 16u > skinMatrices.size()) {
+			continue;
+		}
+		const float* m = skinMatrices.data() + base;
+
+		SkinnedBoundsSphere posed{};
+		float maxAxisScaleSq = 0.0f;
+		for (uint32_t axis = 0; axis < 3u; ++axis) {
+			posed.center[axis] = bone.center[0] * m[0 + axis] + bone.center[1] * m[4 + axis] + bone.center[2] * m[8 + axis] + m[12 + axis];
+			const float* row = m + axis * 4u;
+			maxAxisScaleSq = (std::max)(maxAxisScaleSq, row[0] * row[0] + row[1] * row[1] + row[2] * row[2]);
+		}
+		posed.radius = bone.radius * std::sqrt(maxAxisScaleSq);
+
+		for (uint32_t axis = 0; axis < 3u; ++axis) {
+			const float lo = posed.center[axis] - posed.radius;
+			const float hi = posed.center[axis] + posed.radius;
+			m_min[axis] = m_posed.empty() ? lo : (std::min)(m_min[axis], lo);
+			m_max[axis] = m_posed.empty() ? hi : (std::max)(m_max[axis], hi);
+		}
+		m_posed.push_back(posed);
+	}
+}
+
+void SkinnedBoundsBuilder::Clear()
+{
+	m_posed.clear();
+}
+
+SkinnedBoundsSphere SkinnedBoundsBuilder::Build() const
+{
+	SkinnedBoundsSphere result{};
+	if (m_posed.empty()) {
+		return result;
+	}
+
+	// Center on the box of all posed spheres, then grow to cover each one.
+	// Unlike merging spheres pairwise, the result does not depend on order.
+	for (uint32_t axis = 0; axis < 3u; ++axis) {
+		result.center[axis] = 0.5f * (m_min[axis] + m_max[axis]);
+	}
+	for (const SkinnedBoundsSphere& posed : m_posed) {
+		result.radius = (std::max)(result.radius, Distance(result.center, posed.center) + posed.radius);
+	}
+	return result;
+}
@@ -0,0 +1,438 @@
+#include "Render/GraphExtensions/ClusterLOD/CLodMotionPrefetcher.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+    constexpr float kPi = 3.14159265358979f;
+    // A step this many times longer than the recent average is a cut or a
+    // teleport, not motion to extrapolate.
+    constexpr float kDiscontinuityStepRatio = 10.0f;
+
+    float Dot(const float a[3], const float b[3]) {
+        return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+    }
+
+    float Distance(const float a[3], const float b[3]) {
+        const float d[3] = { a[0] - b[0], a[1] - b[1], a[2] - b[2] };
+        return std::sqrt(Dot(d, d));
+    }
+
+    // Rotation vector (axis * angle) taking unit vector a onto unit vector b.
+    void RotationBetween(const float a[3], const float b[3], float out[3]) {
+        const float cross[3] = {
+            a[1] * b[2] - a[2] * b[1],
+            a[2] * b[0] - a[0] * b[2],
+            a[0] * b[1] - a[1] * b[0],
+        };
+        const float sinAngle = std::sqrt(Dot(cross, cross));
+        const float angle = std::atan2(sinAngle, Dot(a, b));
+        const float scale = sinAngle > 1e-6f ? angle / sinAngle : 0.0f;
+        out[0] = cross[0] * scale;
+        out[1] = cross[1] * scale;
+        out[2] = cross[2] * scale;
+    }
+
+    // Rodrigues rotation of v by the rotation vector w.
+    void Rotate(const float v[3], const float w[3], float out[3]) {
+        const float angle = std::sqrt(Dot(w, w));
+        if (angle < 1e-6f) {
+            out[0] = v[0];
+            out[1] = v[1];
+            out[2] = v[2];
+            return;
+        }
+        const float k[3] = { w[0] / angle, w[1] / angle, w[2] / angle };
+        const float c = std::cos(angle);
+        const float s = std::sin(angle);
+        const float kv = Dot(k, v);
+        const float kxv[3] = {
+            k[1] * v[2] - k[2] * v[1],
+            k[2] * v[0] - k[0] * v[2],
+            k[0] * v[1] - k[1] * v[0],
+        };
+        for (int axis = 0; axis < 3; ++axis) {
+            out[axis] = v[axis] * c + kxv[axis] * s + k[axis] * kv * (1.0f - c);
+        }
+    }
+}
+
+void CLodMotionPrefetcher::ObserveCamera(const CLodPrefetchCameraPose& pose) {
+    if (m_history.size() >= 2) {
+        float pathLength = 0.0f;
+        for (size_t i = 1; i < m_history.size(); ++i) {
+            pathLength += Distance(m_history[i].position, m_history[i - 1].position);
+        }
+        const float averageStep = pathLength / static_cast<float>(m_history.size() - 1);
+        const float step = Distance(pose.position, m_history.back().position);
+        if (step > 1e-4f && step > averageStep * kDiscontinuityStepRatio) {
+            m_history.clear();
+        }
+    }
+
+    m_history.push_back(pose);
+    const size_t capacity = (std::max)(m_options.historyFrames, 2u);
+    if (m_history.size() > capacity) {
+        m_history.erase(m_history.begin(), m_history.end() - capacity);
+    }
+}
+
+bool CLodMotionPrefetcher::PredictPose(float framesAhead, CLodPrefetchCameraPose& outPose) const {
+    if (m_history.size() < 2) {
+        return false;
+    }
+
+    const CLodPrefetchCameraPose& first = m_history.front();
+    const CLodPrefetchCameraPose& last = m_history.back();
+    const float steps = static_cast<float>(m_history.size() - 1);
+
+    // Average over the history rather than the last step to ride out frame
+    // time jitter.
+    float angularVelocity[3] = { 0.0f, 0.0f, 0.0f };
+    for (size_t i = 1; i < m_history.size(); ++i) {
+        float rotation[3];
+        RotationBetween(m_history[i - 1].forward, m_history[i].forward, rotation);
+        angularVelocity[0] += rotation[0] / steps;
+        angularVelocity[1] += rotation[1] / steps;
+        angularVelocity[2] += rotation[2] / steps;
+    }
+
+    outPose = last;
+    for (int axis = 0; axis < 3; ++axis) {
+        const float velocity = (last.position[axis] - first.position[axis]) / steps;
+        outPose.position[axis] = last.position[axis] + velocity * framesAhead;
+    }
+
+    float rotation[3] = {
+        angularVelocity[0] * framesAhead,
+        angularVelocity[1] * framesAhead,
+        angularVelocity[2] * framesAhead,
+    };
+    const float angle = std::sqrt(Dot(rotation, rotation));
+    if (angle > kPi) {
+        for (float& component : rotation) {
+            component *= kPi / angle;
+        }
+    }
+    Rotate(last.forward, rotation, outPose.forward);
+    const float length = std::sqrt(Dot(outPose.forward, outPose.forward));
+    if (length > 1e-6f) {
+        for (float& component : outPose.forward) {
+            component /= length;
+        }
+    }
+    return true;
+}
+
+void CLodMotionPrefetcher::SetMeshes(std::span<const CLodPrefetchMesh> meshes) {
+    m_meshes.clear();
+    m_groups.clear();
+    m_childOffsets.clear();
+    m_children.clear();
+    m_roots.clear();
+
+    for (const CLodPrefetchMesh& mesh : meshes) {
+        MeshRange range{};
+        range.groupsBase = mesh.groupsBase;
+        range.groupCount = static_cast<uint32_t>(mesh.groups.size());
+        range.firstGroup = static_cast<uint32_t>(m_groups.size());
+        range.firstRoot = static_cast<uint32_t>(m_roots.size());
+        m_groups.insert(m_groups.end(), mesh.groups.begin(), mesh.groups.end());
+        for (uint32_t local = 0; local < range.groupCount; ++local) {
+            const int32_t parent = mesh.groups[local].parentLocal;
+            if (parent < 0 || static_cast<uint32_t>(parent) >= range.groupCount || static_cast<uint32_t>(parent) == local) {
+                m_roots.push_back(local);
+            }
+        }
+        range.rootCount = static_cast<uint32_t>(m_roots.size()) - range.firstRoot;
+        m_meshes.push_back(range);
+    }
+
+    // Children as CSR over m_groups, holding mesh-local indices.
+    m_childOffsets.assign(m_groups.size() + 1u, 0u);
+    for (const MeshRange& range : m_meshes) {
+        for (uint32_t local = 0; local < range.groupCount; ++local) {
+            const int32_t parent = m_groups[range.firstGroup + local].parentLocal;
+            if (parent >= 0 && static_cast<uint32_t>(parent) < range.groupCount && static_cast<uint32_t>(parent) != local) {
+                ++m_childOffsets[range.firstGroup + static_cast<uint32_t>(parent) + 1u];
+            }
+        }
+    }
+    for (size_t i = 1; i < m_childOffsets.size(); ++i) {
+        m_childOffsets[i] += m_childOffsets[i - 1];
+    }
+    m_children.resize(m_childOffsets.back());
+    std::vector<uint32_t> cursor(m_childOffsets.begin(), m_childOffsets.end() - 1);
+    for (const MeshRange& range : m_meshes) {
+        for (uint32_t local = 0; local < range.groupCount; ++local) {
+            const int32_t parent = m_groups[range.firstGroup + local].parentLocal;
+            if (parent >= 0 && static_cast<uint32_t>(parent) < range.groupCount && static_cast<uint32_t>(parent) != local) {
+                m_children[cursor[range.firstGroup + static_cast<uint32_t>(parent)]++] = local;
+            }
+        }
+    }
+
+    std::sort(m_meshes.begin(), m_meshes.end(), [](const MeshRange& lhs, const MeshRange& rhs) {
+        return lhs.groupsBase < rhs.groupsBase;
+    });
+}
+
+const CLodMotionPrefetcher::MeshRange* CLodMotionPrefetcher::FindMesh(uint32_t groupsBase) const {
+    const auto it = std::lower_bound(m_meshes.begin(), m_meshes.end(), groupsBase, [](const MeshRange& range, uint32_t base) {
+        return range.groupsBase < base;
+    });
+    if (it == m_meshes.end() || it->groupsBase != groupsBase) {
+        return nullptr;
+    }
+    return &*it;
+}
+
+void CLodMotionPrefetcher::EvaluateView(const CLodPrefetchCameraPose& pose) {
+    const float tanHalfFovX = pose.tanHalfFovY * pose.aspectRatio;
+    const float halfAngle = std::atan(std::sqrt(pose.tanHalfFovY * pose.tanHalfFovY + tanHalfFovX * tanHalfFovX))
+        + m_options.coneMarginRadians;
+    const bool cullByCone = !pose.isOrtho && halfAngle < kPi;
+
+    // Nearest instances first so the visit budget goes where refinement is.
+    m_instanceOrder.resize(m_instances.size());
+    for (uint32_t i = 0; i < static_cast<uint32_t>(m_instances.size()); ++i) {
+        m_instanceOrder[i] = i;
+    }
+    auto distanceSq = [&](uint32_t index) {
+        const float* translation = m_instances[index].rows[3];
+        const float d[3] = {
+            translation[0] - pose.position[0],
+            translation[1] - pose.position[1],
+            translation[2] - pose.position[2],
+        };
+        return Dot(d, d);
+    };
+    std::sort(m_instanceOrder.begin(), m_instanceOrder.end(), [&](uint32_t lhs, uint32_t rhs) {
+        return distanceSq(lhs) < distanceSq(rhs);
+    });
+
+    uint32_t visits = 0;
+    for (uint32_t instanceIndex : m_instanceOrder) {
+        const CLodPrefetchInstance& instance = m_instances[instanceIndex];
+        const MeshRange* mesh = FindMesh(instance.groupsBase);
+        if (mesh == nullptr) {
+            continue;
+        }
+
+        m_stack.assign(m_roots.begin() + mesh->firstRoot, m_roots.begin() + mesh->firstRoot + mesh->rootCount);
+        while (!m_stack.empty()) {
+            if (visits >= m_options.maxGroupVisitsPerSample) {
+                return;
+            }
+            ++visits;
+
+            const uint32_t local = m_stack.back();
+            m_stack.pop_back();
+            const CLodPrefetchGroup& group = m_groups[mesh->firstGroup + local];
+
+            float center[3];
+            for (int axis = 0; axis < 3; ++axis) {
+                center[axis] = group.center[0] * instance.rows[0][axis]
+                    + group.center[1] * instance.rows[1][axis]
+                    + group.center[2] * instance.rows[2][axis]
+                    + instance.rows[3][axis];
+            }
+            const float radius = group.radius * instance.uniformScale;
+            const float toCenter[3] = {
+                center[0] - pose.position[0],
+                center[1] - pose.position[1],
+                center[2] - pose.position[2],
+            };
+            const float distance = std::sqrt(Dot(toCenter, toCenter));
+
+            if (cullByCone && distance > radius) {
+                const float cosAngle = std::clamp(Dot(toCenter, pose.forward) / distance, -1.0f, 1.0f);
+                const float angularRadius = std::asin((std::min)(radius / distance, 1.0f));
+                if (std::acos(cosAngle) - angularRadius > halfAngle) {
+                    continue;
+                }
+            }
+
+            const float scaledError = group.error * instance.uniformScale;
+            float errorOverDistance = pose.isOrtho
+                ? scaledError
+                : scaledError / (std::max)(distance - radius, pose.zNear);
+            if (!(errorOverDistance >= 0.0f)) {
+                errorOverDistance = 0.0f;
+            }
+            m_visited.push_back({ mesh->groupsBase + local, (std::min)(errorOverDistance, (std::numeric_limits<float>::max)()) });
+
+            if (errorOverDistance >= pose.errorOverDistanceThreshold) {
+                const uint32_t flat = mesh->firstGroup + local;
+                m_stack.insert(m_stack.end(), m_children.begin() + m_childOffsets[flat], m_children.begin() + m_childOffsets[flat + 1u]);
+            }
+        }
+    }
+}
+
+void CLodMotionPrefetcher::CollectCandidates(const std::function<bool(uint32_t)>& skip, std::vector<Candidate>& out) {
+    m_visited.clear();
+    if (m_history.size() < 2 || m_meshes.empty() || m_instances.empty() || m_options.maxCandidatesPerUpdate == 0) {
+        return;
+    }
+
+    const uint32_t samples = (std::max)(m_options.predictionSamples, 1u);
+    for (uint32_t sample = 1; sample <= samples; ++sample) {
+        const float framesAhead = static_cast<float>(m_options.lookaheadFrames) * static_cast<float>(sample) / static_cast<float>(samples);
+        CLodPrefetchCameraPose predicted{};
+        if (PredictPose(framesAhead, predicted)) {
+            EvaluateView(predicted);
+        }
+    }
+
+    // One entry per group, keeping the most urgent view.
+    std::sort(m_visited.begin(), m_visited.end(), [](const Candidate& lhs, const Candidate& rhs) {
+        if (lhs.groupIndex != rhs.groupIndex) {
+            return lhs.groupIndex < rhs.groupIndex;
+        }
+        return lhs.errorOverDistance > rhs.errorOverDistance;
+    });
+    m_visited.erase(std::unique(m_visited.begin(), m_visited.end(), [](const Candidate& lhs, const Candidate& rhs) {
+        return lhs.groupIndex == rhs.groupIndex;
+    }), m_visited.end());
+    std::sort(m_visited.begin(), m_visited.end(), [](const Candidate& lhs, const Candidate& rhs) {
+        if (lhs.errorOverDistance != rhs.errorOverDistance) {
+            return lhs.errorOverDistance > rhs.errorOverDistance;
+        }
+        return lhs.groupIndex < rhs.groupIndex;
+    });
+
+    uint32_t emitted = 0;
+    for (const Candidate& candidate : m_visited) {
+        if (emitted >= m_options.maxCandidatesPerUpdate) {
+            break;
+        }
+        if (IsTracked(candidate.groupIndex) || (skip && skip(candidate.groupIndex))) {
+            continue;
+        }
+        out.push_back(candidate);
+        ++emitted;
+    }
+}
+
+bool CLodMotionPrefetcher::IsTracked(uint32_t groupIndex) const {
+    const uint32_t word = groupIndex >> 5u;
+    return word < m_trackedBits.size() && (m_trackedBits[word] & (1u << (groupIndex & 31u))) != 0u;
+}
+
+void CLodMotionPrefetcher::Untrack(uint32_t groupIndex) {
+    m_tracked.erase(groupIndex);
+    const uint32_t word = groupIndex >> 5u;
+    if (word < m_trackedBits.size()) {
+        m_trackedBits[word] &= ~(1u << (groupIndex & 31u));
+    }
+}
+
+void CLodMotionPrefetcher::OnSpeculativeQueued(uint32_t groupIndex) {
+    if (IsTracked(groupIndex)) {
+        return;
+    }
+    const uint32_t word = groupIndex >> 5u;
+    if (word >= m_trackedBits.size()) {
+        m_trackedBits.resize(static_cast<size_t>(word) + 1u, 0u);
+    }
+    m_trackedBits[word] |= 1u << (groupIndex & 31u);
+    m_tracked[groupIndex] = TrackedGroup{ TrackState::Queued, m_frame, 0u };
+    ++m_stats.queued;
+}
+
+void CLodMotionPrefetcher::OnSpeculativeCancelled(uint32_t groupIndex) {
+    if (!IsTracked(groupIndex)) {
+        return;
+    }
+    ++m_stats.cancelled;
+    Untrack(groupIndex);
+}
+
+void CLodMotionPrefetcher::OnSpeculativeIssued(uint32_t groupIndex, uint64_t bytes) {
+    if (!IsTracked(groupIndex)) {
+        return;
+    }
+    TrackedGroup& tracked = m_tracked[groupIndex];
+    if (tracked.state != TrackState::Queued) {
+        return;
+    }
+    tracked.state = TrackState::InFlight;
+    tracked.frame = m_frame;
+    tracked.bytes = bytes;
+    ++m_stats.issued;
+    m_stats.issuedBytes += bytes;
+}
+
+void CLodMotionPrefetcher::OnGroupResidencyChanged(uint32_t groupIndex, bool resident) {
+    if (!IsTracked(groupIndex)) {
+        return;
+    }
+    TrackedGroup& tracked = m_tracked[groupIndex];
+    if (resident) {
+        if (tracked.state != TrackState::Resident) {
+            tracked.state = TrackState::Resident;
+            tracked.frame = m_frame;
+        }
+        return;
+    }
+    if (tracked.state == TrackState::Queued) {
+        return;
+    }
+    ++m_stats.wasted;
+    m_stats.wastedBytes += tracked.bytes;
+    Untrack(groupIndex);
+}
+
+void CLodMotionPrefetcher::OnGroupDemanded(uint32_t groupIndex) {
+    if (!IsTracked(groupIndex)) {
+        return;
+    }
+    // A still-queued request simply becomes the GPU's; it saved nothing and
+    // cost nothing, so it is neither a hit nor waste.
+    const TrackState state = m_tracked[groupIndex].state;
+    if (state == TrackState::Resident) {
+        ++m_stats.hits;
+    } else if (state == TrackState::InFlight) {
+        ++m_stats.lateHits;
+    }
+    Untrack(groupIndex);
+}
+
+bool CLodMotionPrefetcher::IsSpeculativeQueued(uint32_t groupIndex) const {
+    if (!IsTracked(groupIndex)) {
+        return false;
+    }
+    const auto it = m_tracked.find(groupIndex);
+    return it != m_tracked.end() && it->second.state == TrackState::Queued;
+}
+
+void CLodMotionPrefetcher::CollectQueued(std::vector<uint32_t>& out) const {
+    for (const auto& [groupIndex, tracked] : m_tracked) {
+        if (tracked.state == TrackState::Queued) {
+            out.push_back(groupIndex);
+        }
+    }
+}
+
+void CLodMotionPrefetcher::AdvanceFrame(std::vector<uint32_t>& expiredQueued) {
+    ++m_frame;
+    for (auto it = m_tracked.begin(); it != m_tracked.end();) {
+        const uint32_t groupIndex = it->first;
+        const TrackedGroup& tracked = it->second;
+        const bool expired = m_frame - tracked.frame > m_options.expiryFrames;
+        if (expired && tracked.state == TrackState::Queued) {
+            expiredQueued.push_back(groupIndex);
+        }
+        if (!expired || tracked.state != TrackState::Resident) {
+            ++it;
+            continue;
+        }
+
+        ++m_stats.wasted;
+        m_stats.wastedBytes += tracked.bytes;
+        it = m_tracked.erase(it);
+        m_trackedBits[groupIndex >> 5u] &= ~(1u << (groupIndex & 31u));
+    }
+}
@@ -0,0 +1,303 @@
+#include "Render/GraphExtensions/ClusterLOD/CLodPageOwnershipIndex.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace {
+    // Compact once garbage outweighs live segments, but not for small pools.
+    constexpr uint32_t kMinCompactionGarbage = 4096u;
+}
+
+void CLodPageOwnershipIndex::Reset(uint32_t pageCount) {
+    Clear();
+    m_pageHeads.assign(pageCount, kNoNode);
+    m_pageResidentCounts.assign(pageCount, 0u);
+}
+
+void CLodPageOwnershipIndex::ResizePages(uint32_t pageCount) {
+    if (pageCount <= m_pageHeads.size()) {
+        return;
+    }
+    m_pageHeads.resize(pageCount, kNoNode);
+    m_pageResidentCounts.resize(pageCount, 0u);
+}
+
+void CLodPageOwnershipIndex::Clear() {
+    m_groups.clear();
+    m_ownedGroups.clear();
+    m_segmentPages.clear();
+    m_segmentKeys.clear();
+    m_liveSegments = 0;
+    m_pageHeads.clear();
+    m_pageResidentCounts.clear();
+    m_nodes.clear();
+    m_freeNodes = kNoNode;
+}
+
+void CLodPageOwnershipIndex::AssignGroup(uint32_t groupIndex, std::span<const uint32_t> pages, std::span<const uint64_t> keys) {
+    if (groupIndex >= m_groups.size()) {
+        m_groups.resize(static_cast<size_t>(groupIndex) + 1u);
+    }
+
+    const uint32_t count = static_cast<uint32_t>(pages.size());
+    GroupRange& range = m_groups[groupIndex];
+    if (range.ownedListIndex == kInvalidGroup) {
+        range.ownedListIndex = static_cast<uint32_t>(m_ownedGroups.size());
+        m_ownedGroups.push_back(groupIndex);
+        range.count = 0;
+    }
+
+    if (range.count != count) {
+        m_liveSegments -= range.count;
+        const size_t garbage = m_segmentPages.size() - m_liveSegments;
+        if (garbage >= kMinCompactionGarbage && garbage > m_liveSegments) {
+            range.count = 0;
+            CompactSegments();
+        }
+        range.offset = static_cast<uint32_t>(m_segmentPages.size());
+        range.count = count;
+        m_segmentPages.resize(m_segmentPages.size() + count);
+        m_segmentKeys.resize(m_segmentKeys.size() + count);
+        m_liveSegments += count;
+    }
+
+    std::copy(pages.begin(), pages.end(), m_segmentPages.begin() + range.offset);
+    const uint32_t keyCount = (std::min)(count, static_cast<uint32_t>(keys.size()));
+    std::copy(keys.begin(), keys.begin() + keyCount, m_segmentKeys.begin() + range.offset);
+    std::fill(m_segmentKeys.begin() + range.offset + keyCount, m_segmentKeys.begin() + range.offset + count, kInvalidKey);
+}
+
+bool CLodPageOwnershipIndex::EraseGroup(uint32_t groupIndex) {
+    if (!OwnsGroup(groupIndex)) {
+        return false;
+    }
+
+    GroupRange& range = m_groups[groupIndex];
+    m_liveSegments -= range.count;
+
+    const uint32_t listIndex = range.ownedListIndex;
+    const uint32_t moved = m_ownedGroups.back();
+    m_ownedGroups[listIndex] = moved;
+    m_groups[moved].ownedListIndex = listIndex;
+    m_ownedGroups.pop_back();
+
+    range = GroupRange{};
+    return true;
+}
+
+std::span<const uint32_t> CLodPageOwnershipIndex::GroupPages(uint32_t groupIndex) const {
+    if (!OwnsGroup(groupIndex)) {
+        return {};
+    }
+    const GroupRange& range = m_groups[groupIndex];
+    return std::span<const uint32_t>(m_segmentPages.data() + range.offset, range.count);
+}
+
+std::span<const uint64_t> CLodPageOwnershipIndex::GroupKeys(uint32_t groupIndex) const {
+    if (!OwnsGroup(groupIndex)) {
+        return {};
+    }
+    const GroupRange& range = m_groups[groupIndex];
+    return std::span<const uint64_t>(m_segmentKeys.data() + range.offset, range.count);
+}
+
+uint64_t CLodPageOwnershipIndex::GroupKey(uint32_t groupIndex, uint32_t slot) const {
+    if (!OwnsGroup(groupIndex) || slot >= m_groups[groupIndex].count) {
+        return kInvalidKey;
+    }
+    return m_segmentKeys[m_groups[groupIndex].offset + slot];
+}
+
+bool CLodPageOwnershipIndex::GroupReferencesPage(uint32_t groupIndex, uint32_t page) const {
+    const std::span<const uint32_t> pages = GroupPages(groupIndex);
+    return std::find(pages.begin(), pages.end(), page) != pages.end();
+}
+
+bool CLodPageOwnershipIndex::GroupReferencesPageKey(uint32_t groupIndex, uint32_t page, uint64_t key) const {
+    return ResolveSlot(groupIndex, 0u, page, key) != ~0u;
+}
+
+uint32_t CLodPageOwnershipIndex::ResolveSlot(uint32_t groupIndex, uint32_t hintSlot, uint32_t page, uint64_t key) const {
+    if (!OwnsGroup(groupIndex)) {
+        return ~0u;
+    }
+
+    const GroupRange& range = m_groups[groupIndex];
+    const uint32_t* pages = m_segmentPages.data() + range.offset;
+    const uint64_t* keys = m_segmentKeys.data() + range.offset;
+    auto matches = [&](uint32_t slot) {
+        return pages[slot] == page && (key == kInvalidKey || keys[slot] == key);
+    };
+
+    if (hintSlot < range.count && matches(hintSlot)) {
+        return hintSlot;
+    }
+    // Slow path: only reached when a group was reassigned while resident.
+    for (uint32_t slot = 0; slot < range.count; ++slot) {
+        if (matches(slot)) {
+            return slot;
+        }
+    }
+    return ~0u;
+}
+
+uint32_t CLodPageOwnershipIndex::FindNode(uint32_t page, uint32_t groupIndex) const {
+    if (page >= m_pageHeads.size()) {
+        return kNoNode;
+    }
+    for (uint32_t node = m_pageHeads[page]; node != kNoNode; node = m_nodes[node].next) {
+        if (m_nodes[node].groupIndex == groupIndex) {
+            return node;
+        }
+    }
+    return kNoNode;
+}
+
+bool CLodPageOwnershipIndex::AddResident(uint32_t page, uint32_t groupIndex, uint32_t slot) {
+    if (page >= m_pageHeads.size()) {
+        return false;
+    }
+
+    const uint32_t existing = FindNode(page, groupIndex);
+    if (existing != kNoNode) {
+        m_nodes[existing].slot = slot;
+        return false;
+    }
+
+    uint32_t node = m_freeNodes;
+    if (node != kNoNode) {
+        m_freeNodes = m_nodes[node].next;
+    } else {
+        node = static_cast<uint32_t>(m_nodes.size());
+        m_nodes.emplace_back();
+    }
+
+    ResidentNode& entry = m_nodes[node];
+    entry.groupIndex = groupIndex;
+    entry.slot = slot;
+    entry.prev = kNoNode;
+    entry.next = m_pageHeads[page];
+    if (entry.next != kNoNode) {
+        m_nodes[entry.next].prev = node;
+    }
+    m_pageHeads[page] = node;
+    ++m_pageResidentCounts[page];
+    return true;
+}
+
+void CLodPageOwnershipIndex::UnlinkNode(uint32_t page, uint32_t node) {
+    ResidentNode& entry = m_nodes[node];
+    if (entry.prev != kNoNode) {
+        m_nodes[entry.prev].next = entry.next;
+    } else {
+        m_pageHeads[page] = entry.next;
+    }
+    if (entry.next != kNoNode) {
+        m_nodes[entry.next].prev = entry.prev;
+    }
+
+    entry.groupIndex = kInvalidGroup;
+    entry.prev = kNoNode;
+    entry.next = m_freeNodes;
+    m_freeNodes = node;
+    --m_pageResidentCounts[page];
+}
+
+bool CLodPageOwnershipIndex::RemoveResident(uint32_t page, uint32_t groupIndex) {
+    const uint32_t node = FindNode(page, groupIndex);
+    if (node == kNoNode) {
+        return false;
+    }
+    UnlinkNode(page, node);
+    return true;
+}
+
+void CLodPageOwnershipIndex::ClearResidents(uint32_t page) {
+    if (page >= m_pageHeads.size()) {
+        return;
+    }
+    while (m_pageHeads[page] != kNoNode) {
+        UnlinkNode(page, m_pageHeads[page]);
+    }
+}
+
+bool CLodPageOwnershipIndex::IsResident(uint32_t page, uint32_t groupIndex) const {
+    return FindNode(page, groupIndex) != kNoNode;
+}
+
+uint32_t CLodPageOwnershipIndex::CountResidentsForKey(uint32_t page, uint64_t key) const {
+    if (page >= m_pageHeads.size() || key == kInvalidKey) {
+        return 0u;
+    }
+
+    uint32_t count = 0u;
+    for (uint32_t node = m_pageHeads[page]; node != kNoNode; node = m_nodes[node].next) {
+        if (ResolveSlot(m_nodes[node].groupIndex, m_nodes[node].slot, page, key) != ~0u) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+uint32_t CLodPageOwnershipIndex::FindResidentForKey(uint32_t page, uint64_t key, uint32_t* outSlot) const {
+    if (page >= m_pageHeads.size() || key == kInvalidKey) {
+        return kInvalidGroup;
+    }
+
+    for (uint32_t node = m_pageHeads[page]; node != kNoNode; node = m_nodes[node].next) {
+        const uint32_t slot = ResolveSlot(m_nodes[node].groupIndex, m_nodes[node].slot, page, key);
+        if (slot != ~0u) {
+            if (outSlot != nullptr) {
+                *outSlot = slot;
+            }
+            return m_nodes[node].groupIndex;
+        }
+    }
+    return kInvalidGroup;
+}
+
+void CLodPageOwnershipIndex::CollectResidents(uint32_t page, std::vector<uint32_t>& out) const {
+    if (page >= m_pageHeads.size()) {
+        return;
+    }
+    for (uint32_t node = m_pageHeads[page]; node != kNoNode; node = m_nodes[node].next) {
+        out.push_back(m_nodes[node].groupIndex);
+    }
+}
+
+uint32_t CLodPageOwnershipIndex::ScrubStaleResidents(uint32_t page) {
+    if (page >= m_pageHeads.size()) {
+        return 0u;
+    }
+
+    uint32_t removed = 0u;
+    uint32_t node = m_pageHeads[page];
+    while (node != kNoNode) {
+        const uint32_t next = m_nodes[node].next;
+        const uint32_t slot = ResolveSlot(m_nodes[node].groupIndex, m_nodes[node].slot, page, kInvalidKey);
+        if (slot == ~0u) {
+            UnlinkNode(page, node);
+            ++removed;
+        } else {
+            m_nodes[node].slot = slot;
+        }
+        node = next;
+    }
+    return removed;
+}
+
+void CLodPageOwnershipIndex::CompactSegments() {
+    std::vector<uint32_t> pages;
+    std::vector<uint64_t> keys;
+    pages.reserve(m_liveSegments);
+    keys.reserve(m_liveSegments);
+    for (uint32_t groupIndex : m_ownedGroups) {
+        GroupRange& range = m_groups[groupIndex];
+        const uint32_t offset = static_cast<uint32_t>(pages.size());
+        pages.insert(pages.end(), m_segmentPages.begin() + range.offset, m_segmentPages.begin() + range.offset + range.count);
+        keys.insert(keys.end(), m_segmentKeys.begin() + range.offset, m_segmentKeys.begin() + range.offset + range.count);
+        range.offset = offset;
+    }
+    m_segmentPages = std::move(pages);
+    m_segmentKeys = std::move(keys);
+}
@@ -53,63 +53,156 @@ void SetBufferNameAndUsage(const std::shared_ptr<Buffer>& buffer, const char* na
 } // namespace
 
 void CLodRayTracingSystem::Refresh(const MeshManager& meshManager) {
-    meshManager.GetCLodRayTracingResidencySnapshot(m_snapshot);
-    m_pageSources.clear();
+    meshManager.GetCLodRayTracingResidencyDelta(
+        m_residencyJournalEpoch,
+        m_residencyJournalSequence,
+        m_pagePoolGeneration,
+        m_residencyDelta);
+    ApplyResidencyDelta(m_residencyDelta);
+
+    if (m_pageSourcesDirty) {
+        m_pageSources.clear();
+        m_pageSources.reserve(m_totals.pageSources);
+        for (const ResidentGroupRecord& record : m_groups) {
+            m_pageSources.insert(m_pageSources.end(), record.pageSources.begin(), record.pageSources.end());
+        }
+        m_pageSourcesDirty = false;
+    }
 
     Stats next{};
-    next.snapshotGeneration = m_snapshot.pagePoolGeneration;
-    next.hasPagePool = m_snapshot.pagePool != nullptr;
-    next.residentGroups = static_cast<uint32_t>(m_snapshot.residentGroups.size());
-
-    for (const auto& group : m_snapshot.residentGroups) {
-        next.residentPages += static_cast<uint32_t>(group.pageAllocations.size());
-        next.meshlets += group.chunk.meshletCount;
-
-        const bool groupHasBuildablePages = !group.pageAllocations.empty();
-        const bool groupUsesNativePositions = group.chunk.compressedPositionQuantExp == CLOD_POSITION_FORMAT_FLOAT3;
-        if (groupHasBuildablePages && groupUsesNativePositions) {
-            ++next.buildableGroups;
-        }
+    next.snapshotGeneration = m_pagePoolGeneration;
+    next.hasPagePool = m_pagePool != nullptr;
+    next.residentGroups = static_cast<uint32_t>(m_groups.size());
+    next.residentPages = m_totals.residentPages;
+    next.meshlets = m_totals.meshlets;
+    next.buildableGroups = m_totals.buildableGroups;
+    next.buildableClusters = m_totals.buildableClusters;
+    next.pageSources = static_cast<uint32_t>(m_pageSources.size());
+    next.residencyDeltaEvents = m_residencyDelta.becameResidentEvents + m_residencyDelta.evictedEvents + m_residencyDelta.remappedEvents;
+    next.residencyGroupsPatched = static_cast<uint32_t>(m_residencyDelta.residentGroups.size());
+    next.residencyGroupsRemoved = static_cast<uint32_t>(m_residencyDelta.evictedGroups.size());
+    next.residencyFullResync = m_residencyDelta.fullResync;
+    m_stats = next;
+}
+
+void CLodRayTracingSystem::ApplyResidencyDelta(const MeshManager::CLodRayTracingResidencyDelta& delta) {
+    m_residencyJournalEpoch = delta.journalEpoch;
+    m_residencyJournalSequence = delta.journalSequence;
+    m_pagePoolGeneration = delta.pagePoolGeneration;
+    if (m_pagePool != delta.pagePool) {
+        m_pagePool = delta.pagePool;
+        m_pageSourcesDirty = true;
+    }
 
-        (void)group.segments;
-
-        if (m_snapshot.pagePool && groupHasBuildablePages && groupUsesNativePositions) {
-            std::vector<uint32_t> pageMeshletCounts(group.pageAllocations.size(), 0u);
-            for (const ClusterLODGroupSegment& segment : group.segments) {
-                const auto pageIt = std::find(group.meshPageIndices.begin(), group.meshPageIndices.end(), segment.pageIndex);
-                if (pageIt == group.meshPageIndices.end()) {
-                    continue;
-                }
-                const uint32_t groupLocalPageIndex = static_cast<uint32_t>(std::distance(group.meshPageIndices.begin(), pageIt));
-                pageMeshletCounts[groupLocalPageIndex] = std::max(
-                    pageMeshletCounts[groupLocalPageIndex],
-                    segment.firstMeshletInPage + segment.meshletCount);
-            }
-
-            uint32_t localPageIndex = 0;
-            for (const PagePool::PageAllocation& allocation : group.pageAllocations) {
-                for (uint32_t pageOffset = 0; pageOffset < allocation.pageCount; ++pageOffset) {
-                    const uint32_t pageMeshletCount = localPageIndex < pageMeshletCounts.size()
-                        ? pageMeshletCounts[localPageIndex]
-                        : 0u;
-                    const uint32_t pageId = allocation.firstPageID + pageOffset;
-                    PageSource source{};
-                    source.groupGlobalIndex = group.groupGlobalIndex;
-                    source.groupLocalPageIndex = localPageIndex++;
-                    source.slabIndex = m_snapshot.pagePool->PageToSlabIndex(pageId);
-                    source.slabDescriptorIndex = m_snapshot.pagePool->GetSlabDescriptorIndex(allocation);
-                    source.slabByteOffset = m_snapshot.pagePool->PageToSlabByteOffset(pageId);
-                    source.firstMeshletInPage = 0u;
-                    source.meshletCount = pageMeshletCount;
-                    next.buildableClusters += pageMeshletCount;
-                    m_pageSources.push_back(source);
-                }
-            }
+    if (delta.fullResync) {
+        m_groups.clear();
+        m_groupSlotByGlobalIndex.clear();
+        m_totals = {};
+        m_pageSourcesDirty = true;
+    }
+
+    for (uint32_t groupGlobalIndex : delta.evictedGroups) {
+        RemoveGroup(groupGlobalIndex);
+    }
+    for (const auto& group : delta.residentGroups) {
+        UpsertGroup(group);
+    }
+}
+
+void CLodRayTracingSystem::BuildGroupRecord(const MeshManager::CLodRayTracingResidentGroup& group, ResidentGroupRecord& outRecord) const {
+    outRecord.groupGlobalIndex = group.groupGlobalIndex;
+    outRecord.residentPages = static_cast<uint32_t>(group.pageAllocations.size());
+    outRecord.meshlets = group.chunk.meshletCount;
+    outRecord.buildableClusters = 0u;
+    outRecord.pageSources.clear();
+
+    const bool groupHasBuildablePages = !group.pageAllocations.empty();
+    const bool groupUsesNativePositions = group.chunk.compressedPositionQuantExp == CLOD_POSITION_FORMAT_FLOAT3;
+    outRecord.buildable = groupHasBuildablePages && groupUsesNativePositions;
+    if (!m_pagePool || !outRecord.buildable) {
+        return;
+    }
+
+    std::vector<uint32_t> pageMeshletCounts(group.pageAllocations.size(), 0u);
+    for (const ClusterLODGroupSegment& segment : group.segments) {
+        const auto pageIt = std::find(group.meshPageIndices.begin(), group.meshPageIndices.end(), segment.pageIndex);
+        if (pageIt == group.meshPageIndices.end()) {
+            continue;
+        }
+        const uint32_t groupLocalPageIndex = static_cast<uint32_t>(std::distance(group.meshPageIndices.begin(), pageIt));
+        pageMeshletCounts[groupLocalPageIndex] = std::max(
+            pageMeshletCounts[groupLocalPageIndex],
+            segment.firstMeshletInPage + segment.meshletCount);
+    }
+
+    uint32_t localPageIndex = 0;
+    for (const PagePool::PageAllocation& allocation : group.pageAllocations) {
+        for (uint32_t pageOffset = 0; pageOffset < allocation.pageCount; ++pageOffset) {
+            const uint32_t pageMeshletCount = localPageIndex < pageMeshletCounts.size()
+                ? pageMeshletCounts[localPageIndex]
+                : 0u;
+            const uint32_t pageId = allocation.firstPageID + pageOffset;
+            PageSource source{};
+            source.groupGlobalIndex = group.groupGlobalIndex;
+            source.groupLocalPageIndex = localPageIndex++;
+            source.slabIndex = m_pagePool->PageToSlabIndex(pageId);
+            source.slabDescriptorIndex = m_pagePool->GetSlabDescriptorIndex(allocation);
+            source.slabByteOffset = m_pagePool->PageToSlabByteOffset(pageId);
+            source.firstMeshletInPage = 0u;
+            source.meshletCount = pageMeshletCount;
+            outRecord.buildableClusters += pageMeshletCount;
+            outRecord.pageSources.push_back(source);
         }
     }
+}
 
-    next.pageSources = static_cast<uint32_t>(m_pageSources.size());
-    m_stats = next;
+void CLodRayTracingSystem::UpsertGroup(const MeshManager::CLodRayTracingResidentGroup& group) {
+    auto [it, inserted] = m_groupSlotByGlobalIndex.try_emplace(group.groupGlobalIndex, static_cast<uint32_t>(m_groups.size()));
+    if (inserted) {
+        m_groups.emplace_back();
+    }
+    else {
+        // Remapped pages: retire the old contribution before rebuilding the record.
+        const ResidentGroupRecord& previous = m_groups[it->second];
+        m_totals.residentPages -= previous.residentPages;
+        m_totals.meshlets -= previous.meshlets;
+        m_totals.buildableClusters -= previous.buildableClusters;
+        m_totals.pageSources -= static_cast<uint32_t>(previous.pageSources.size());
+        m_totals.buildableGroups -= previous.buildable ? 1u : 0u;
+    }
+
+    ResidentGroupRecord& record = m_groups[it->second];
+    BuildGroupRecord(group, record);
+    m_totals.residentPages += record.residentPages;
+    m_totals.meshlets += record.meshlets;
+    m_totals.buildableClusters += record.buildableClusters;
+    m_totals.pageSources += static_cast<uint32_t>(record.pageSources.size());
+    m_totals.buildableGroups += record.buildable ? 1u : 0u;
+    m_pageSourcesDirty = true;
+}
+
+void CLodRayTracingSystem::RemoveGroup(uint32_t groupGlobalIndex) {
+    const auto it = m_groupSlotByGlobalIndex.find(groupGlobalIndex);
+    if (it == m_groupSlotByGlobalIndex.end()) {
+        return;
+    }
+
+    const uint32_t slot = it->second;
+    m_groupSlotByGlobalIndex.erase(it);
+
+    const ResidentGroupRecord& record = m_groups[slot];
+    m_totals.residentPages -= record.residentPages;
+    m_totals.meshlets -= record.meshlets;
+    m_totals.buildableClusters -= record.buildableClusters;
+    m_totals.pageSources -= static_cast<uint32_t>(record.pageSources.size());
+    m_totals.buildableGroups -= record.buildable ? 1u : 0u;
+
+    if (slot + 1u != m_groups.size()) {
+        m_groups[slot] = std::move(m_groups.back());
+        m_groupSlotByGlobalIndex[m_groups[slot].groupGlobalIndex] = slot;
+    }
+    m_groups.pop_back();
+    m_pageSourcesDirty = true;
 }
 
 void CLodRayTracingSystem::EnsureBuffers(
@@ -276,7 +369,7 @@ void CLodRayTracingSystem::UpdateGpuResources(rhi::Device device, const RayTraci
     m_tlasDataBytes = 0;
     m_tlasScratchBytes = 0;
 
-    if (!device || !m_snapshot.pagePool || m_stats.buildableClusters == 0u || !rayTracingFeatures.clusterAccelerationStructure) {
+    if (!device || !m_pagePool || m_stats.buildableClusters == 0u || !rayTracingFeatures.clusterAccelerationStructure) {
         return;
     }
 
@@ -341,7 +434,7 @@ void CLodRayTracingSystem::UpdateGpuResources(rhi::Device device, const RayTraci
             continue;
         }
 
-        std::shared_ptr<DynamicBuffer> slab = m_snapshot.pagePool->GetSlab(source.slabIndex);
+        std::shared_ptr<DynamicBuffer> slab = m_pagePool->GetSlab(source.slabIndex);
         if (!slab) {
             continue;
         }
@@ -753,9 +846,15 @@ void CLodRayTracingSystem::ExecuteTraceRays(rhi::Device device, rhi::CommandList
 }
 
 void CLodRayTracingSystem::Reset() {
-    m_snapshot.residentGroups.clear();
-    m_snapshot.pagePool = nullptr;
-    m_snapshot.pagePoolGeneration = 0;
+    m_residencyDelta = {};
+    m_residencyJournalEpoch = 0;
+    m_residencyJournalSequence = 0;
+    m_pagePoolGeneration = 0;
+    m_pagePool = nullptr;
+    m_groups.clear();
+    m_groupSlotByGlobalIndex.clear();
+    m_totals = {};
+    m_pageSourcesDirty = true;
     m_pageSources.clear();
     m_gpuPageSources.clear();
     m_tlas.Reset();
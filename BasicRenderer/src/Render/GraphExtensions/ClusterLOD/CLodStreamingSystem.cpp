@@ -41,6 +41,9 @@ struct CLodStreamingSystem::ParallelSortState {
 
 namespace {
     constexpr uint64_t kInvalidCLodMeshPageKey = (std::numeric_limits<uint64_t>::max)();
+    // Frames without new speculative loads after they were cancelled for lack
+    // of pages, so the same groups are not queued and dropped every frame.
+    constexpr uint32_t kPrefetchPressureBackoffFrames = 30u;
 
     struct CLodStreamingUploadSnapshotKey {
         uint64_t dstResourceId = 0;
@@ -677,6 +680,26 @@ CLodStreamingSystem::CLodStreamingSystem() {
         m_streamingCpuUploadBudgetRequests = 10000u;
     }
 
+    try {
+        m_getStreamingResidentBudgetBytes =
+            SettingsManager::GetInstance().getSettingGetter<uint64_t>(CLodStreamingResidentBudgetBytesSettingName);
+    }
+    catch (...) {
+        m_getStreamingResidentBudgetBytes = {};
+    }
+
+    try {
+        auto& settingsManager = SettingsManager::GetInstance();
+        m_getPrefetchEnabled = settingsManager.getSettingGetter<bool>(CLodStreamingPrefetchEnabledSettingName);
+        m_getPrefetchLookaheadFrames = settingsManager.getSettingGetter<uint32_t>(CLodStreamingPrefetchLookaheadFramesSettingName);
+        m_getPrefetchMaxRequests = settingsManager.getSettingGetter<uint32_t>(CLodStreamingPrefetchMaxRequestsSettingName);
+        m_getPrefetchCamera = settingsManager.getSettingGetter<std::function<bool(CLodPrefetchCameraPose&)>>(CLodStreamingPrefetchCameraGetterSettingName)();
+    }
+    catch (...) {
+        m_getPrefetchEnabled = {};
+        m_getPrefetchCamera = {};
+    }
+
     m_streamingNonResidentBits = CreateAliasedUnmaterializedStructuredBuffer(
         CLodBitsetWordCount(m_streamingStorageGroupCapacity),
         sizeof(uint32_t),
@@ -857,11 +880,7 @@ void CLodStreamingSystem::OnRegistryReset(ResourceRegistry* reg) {
     // Evict ALL resident groups so MeshManager clears groupResidentFlags,
     // zeroes GroupChunks counts, and wipes GroupPageMap entries. Without this,
     // the GPU reads stale chunk data with freed-page references after rebuild.
-    std::vector<uint32_t> ownedGroups;
-    ownedGroups.reserve(m_groupOwnedPages.size());
-    for (const auto& [groupIndex, _] : m_groupOwnedPages) {
-        ownedGroups.push_back(groupIndex);
-    }
+    const std::vector<uint32_t> ownedGroups = m_pageOwnership.OwnedGroups();
     for (uint32_t groupIndex : ownedGroups) {
         if (meshManager != nullptr && IsGroupResident(groupIndex)) {
             meshManager->EvictCLodGroupResidency(groupIndex, true);
@@ -882,13 +901,11 @@ void CLodStreamingSystem::OnRegistryReset(ResourceRegistry* reg) {
     m_pageOwnerMeshPageKey.clear();
     m_pageReuseRequiresNonResidentEpoch.clear();
     m_pageReuseNonResidentQueuedTick.clear();
-    m_pageResidentGroups.clear();
     m_pageProtectedThisUpdate.clear();
     m_pageRetireAfterTick.clear();
     m_pageRetirePinned.clear();
     m_pagePinnedStorage.clear();
-    m_groupOwnedPages.clear();
-    m_groupOwnedMeshPageKeys.clear();
+    m_pageOwnership.Clear();
     m_groupCommittedPageMaps.clear();
     m_pageMapWriteProvenance.clear();
     m_residentMeshPageToPhysicalPage.clear();
@@ -972,12 +989,14 @@ void CLodStreamingSystem::PrepareStreamingFrameWork() {
 
     if (meshManager != nullptr && meshManager->ConsumeCLodStreamingStructureDirty()) {
         m_streamingDomainDirty = true;
+        m_prefetchMeshesDirty = true;
     }
 
     RefreshStreamingActiveGroupDomain();
 
     if (meshManager != nullptr) {
         PollCompletedReadbackSlots();
+        UpdateMotionPrefetch(meshManager);
         ProcessStreamingRequestsBudgeted();
     }
     QueuePendingNonResidentBitsUpload();
@@ -1478,6 +1497,7 @@ bool CLodStreamingSystem::SetGroupResidentBit(uint32_t groupIndex, bool resident
         }
     }
     MarkStreamingNonResidentBitsDirtyWord(wordAddress);
+    m_motionPrefetcher.OnGroupResidencyChanged(groupIndex, resident);
     spdlog::debug(
         "CLod streaming invariant: residency bit cpu-change group={} resident={} epoch={} tick={} dirtyWords=[{}, {})",
         groupIndex,
@@ -1642,8 +1662,7 @@ void CLodStreamingSystem::InitializePageLru(MeshManager* meshManager) {
     m_pendingPageOwnerGroup.assign(totalPages, ~0u);
     m_pendingPageOwnerSegment.assign(totalPages, 0u);
     m_pageOwnerMeshPageKey.assign(totalPages, kInvalidCLodMeshPageKey);
-    m_pageResidentGroups.clear();
-    m_pageResidentGroups.resize(totalPages);
+    m_pageOwnership.Reset(totalPages);
     m_pageProtectedThisUpdate.assign(totalPages, 0u);
 
     {
@@ -1698,7 +1717,7 @@ void CLodStreamingSystem::EnsurePageTrackingCapacity(MeshManager* meshManager) {
         m_pendingPageOwnerGroup.resize(totalPages, ~0u);
         m_pendingPageOwnerSegment.resize(totalPages, 0u);
         m_pageOwnerMeshPageKey.resize(totalPages, kInvalidCLodMeshPageKey);
-        m_pageResidentGroups.resize(totalPages);
+        m_pageOwnership.ResizePages(totalPages);
         m_pageProtectedThisUpdate.resize(totalPages, 0u);
     }
 }
@@ -1777,8 +1796,7 @@ void CLodStreamingSystem::LogPageOverwriteInvariant(
         requiredEpoch != 0u && requiredEpoch > m_streamingNonResidentBitsQueuedEpoch;
     const bool pageMayStillBeVisibleToTraversal =
         queuedTick != 0u && m_streamingDiagnosticTick <= queuedTick + delayTicks;
-    const bool hasResidentGroups =
-        page < m_pageResidentGroups.size() && !m_pageResidentGroups[page].empty();
+    const bool hasResidentGroups = m_pageOwnership.HasResidents(page);
     const bool pendingOwnerConflict =
         page < m_pendingPageOwnerGroup.size() &&
         m_pendingPageOwnerGroup[page] != ~0u &&
@@ -1800,7 +1818,7 @@ void CLodStreamingSystem::LogPageOverwriteInvariant(
         meshPageKey,
         static_cast<uint32_t>(m_pageState[page]),
         page < m_pageOwnerGroup.size() ? m_pageOwnerGroup[page] : -1,
-        page < m_pageResidentGroups.size() ? static_cast<uint32_t>(m_pageResidentGroups[page].size()) : 0u,
+        m_pageOwnership.ResidentCount(page),
         page < m_pendingPageOwnerGroup.size() ? m_pendingPageOwnerGroup[page] : UINT32_MAX,
         requiredEpoch,
         m_streamingNonResidentBitsQueuedEpoch,
@@ -2065,74 +2083,27 @@ void CLodStreamingSystem::LogPageMapProvenanceForMismatch(const CLodSourceGroupM
 }
 
 bool CLodStreamingSystem::DoesGroupReferencePhysicalPage(uint32_t groupIndex, uint32_t page) const {
-    const auto pagesIt = m_groupOwnedPages.find(groupIndex);
-    if (pagesIt == m_groupOwnedPages.end()) {
-        return false;
-    }
-
-    const auto& pages = pagesIt->second;
-    return std::find(pages.begin(), pages.end(), page) != pages.end();
+    return m_pageOwnership.GroupReferencesPage(groupIndex, page);
 }
 
 bool CLodStreamingSystem::DoesGroupReferencePageKey(uint32_t groupIndex, uint32_t page, uint64_t key) const {
-    const auto pagesIt = m_groupOwnedPages.find(groupIndex);
-    const auto keysIt = m_groupOwnedMeshPageKeys.find(groupIndex);
-    if (pagesIt == m_groupOwnedPages.end() || keysIt == m_groupOwnedMeshPageKeys.end()) {
-        return false;
-    }
-
-    const auto& pages = pagesIt->second;
-    const auto& keys = keysIt->second;
-    const uint32_t count = std::min(static_cast<uint32_t>(pages.size()), static_cast<uint32_t>(keys.size()));
-    for (uint32_t seg = 0; seg < count; ++seg) {
-        if (pages[seg] == page && keys[seg] == key) {
-            return true;
-        }
-    }
-    return false;
+    return key != kInvalidCLodMeshPageKey && m_pageOwnership.GroupReferencesPageKey(groupIndex, page, key);
 }
 
 uint32_t CLodStreamingSystem::CountResidentGroupsForPageKey(uint32_t page, uint64_t key) const {
-    if (page >= m_pageResidentGroups.size() || key == kInvalidCLodMeshPageKey) {
-        return 0u;
-    }
-
-    uint32_t count = 0u;
-    for (uint32_t groupIndex : m_pageResidentGroups[page]) {
-        if (DoesGroupReferencePageKey(groupIndex, page, key)) {
-            ++count;
-        }
-    }
-    return count;
+    return m_pageOwnership.CountResidentsForKey(page, key);
 }
 
-uint32_t CLodStreamingSystem::FindResidentGroupForPageKey(uint32_t page, uint64_t key) const {
-    if (page >= m_pageResidentGroups.size() || key == kInvalidCLodMeshPageKey) {
-        return ~0u;
-    }
-
-    for (uint32_t groupIndex : m_pageResidentGroups[page]) {
-        if (DoesGroupReferencePageKey(groupIndex, page, key)) {
-            return groupIndex;
-        }
-    }
-    return ~0u;
+uint32_t CLodStreamingSystem::FindResidentGroupForPageKey(uint32_t page, uint64_t key, uint32_t* outSegment) const {
+    return m_pageOwnership.FindResidentForKey(page, key, outSegment);
 }
 
 uint32_t CLodStreamingSystem::ScrubStaleResidentGroups(uint32_t page) {
-    if (page >= m_pageResidentGroups.size() || m_pageResidentGroups[page].empty()) {
+    if (!m_pageOwnership.HasResidents(page)) {
         return 0u;
     }
 
-    uint32_t removed = 0u;
-    for (auto it = m_pageResidentGroups[page].begin(); it != m_pageResidentGroups[page].end();) {
-        if (!DoesGroupReferencePhysicalPage(*it, page)) {
-            it = m_pageResidentGroups[page].erase(it);
-            ++removed;
-        } else {
-            ++it;
-        }
-    }
+    const uint32_t removed = m_pageOwnership.ScrubStaleResidents(page);
 
     if (removed != 0u) {
         spdlog::warn(
@@ -2203,9 +2174,7 @@ void CLodStreamingSystem::RetirePhysicalPage(uint32_t page, MeshManager* meshMan
     if (page < m_pageOwnerMeshPageKey.size()) {
         m_pageOwnerMeshPageKey[page] = kInvalidCLodMeshPageKey;
     }
-    if (page < m_pageResidentGroups.size()) {
-        m_pageResidentGroups[page].clear();
-    }
+    m_pageOwnership.ClearResidents(page);
 
     m_pageState[page] = CLodPhysicalPageState::Retiring;
     if (page < m_pageRetireAfterTick.size()) {
@@ -2289,31 +2258,26 @@ void CLodStreamingSystem::ReleaseGroupResidency(uint32_t groupIndex, MeshManager
     m_pendingResidencyCommitGroups.erase(groupIndex);
     m_groupCommittedPageMaps.erase(groupIndex);
 
-    auto pagesIt = m_groupOwnedPages.find(groupIndex);
-    auto keysIt = m_groupOwnedMeshPageKeys.find(groupIndex);
-    if (pagesIt == m_groupOwnedPages.end()) {
+    if (!m_pageOwnership.OwnsGroup(groupIndex)) {
         SetGroupUsesPinnedStorage(groupIndex, false);
         return;
     }
 
-    for (uint32_t slot = 0; slot < static_cast<uint32_t>(pagesIt->second.size()); ++slot) {
-        const uint32_t page = pagesIt->second[slot];
+    // Nothing below reassigns group pages, so the spans stay valid.
+    const std::span<const uint32_t> ownedPages = m_pageOwnership.GroupPages(groupIndex);
+    const std::span<const uint64_t> ownedKeys = m_pageOwnership.GroupKeys(groupIndex);
+    for (uint32_t slot = 0; slot < static_cast<uint32_t>(ownedPages.size()); ++slot) {
+        const uint32_t page = ownedPages[slot];
         if (page == ~0u) {
             continue;
         }
 
-        const uint64_t key = keysIt != m_groupOwnedMeshPageKeys.end() && slot < keysIt->second.size()
-            ? keysIt->second[slot]
-            : kInvalidCLodMeshPageKey;
-        const bool wasResidentGroup = page < m_pageResidentGroups.size() &&
-            m_pageResidentGroups[page].find(groupIndex) != m_pageResidentGroups[page].end();
+        const uint64_t key = ownedKeys[slot];
+        const bool wasResidentGroup = m_pageOwnership.RemoveResident(page, groupIndex);
         const bool hadPendingReference = !wasResidentGroup && GetPendingMeshPageRefCount(page, key) != 0u;
         if (hadPendingReference) {
             ReleasePendingMeshPageReference(page, key);
         }
-        if (page < m_pageResidentGroups.size()) {
-            m_pageResidentGroups[page].erase(groupIndex);
-        }
 
         if (key != kInvalidCLodMeshPageKey) {
             auto refIt = m_residentMeshPageRefCounts.find(key);
@@ -2334,22 +2298,11 @@ void CLodStreamingSystem::ReleaseGroupResidency(uint32_t groupIndex, MeshManager
         const bool pageStillResident = key != kInvalidCLodMeshPageKey && CountResidentGroupsForPageKey(page, key) != 0u;
         if (pageStillResident) {
             if (page < m_pageOwnerGroup.size()) {
-                const uint32_t nextOwner = FindResidentGroupForPageKey(page, key);
+                uint32_t nextSegment = 0u;
+                const uint32_t nextOwner = FindResidentGroupForPageKey(page, key, &nextSegment);
                 if (nextOwner != ~0u) {
                     m_pageOwnerGroup[page] = static_cast<int32_t>(nextOwner);
-                    auto nextPagesIt = m_groupOwnedPages.find(nextOwner);
-                    auto nextKeysIt = m_groupOwnedMeshPageKeys.find(nextOwner);
-                    if (nextPagesIt != m_groupOwnedPages.end() && nextKeysIt != m_groupOwnedMeshPageKeys.end()) {
-                        const uint32_t count = std::min(
-                            static_cast<uint32_t>(nextPagesIt->second.size()),
-                            static_cast<uint32_t>(nextKeysIt->second.size()));
-                        for (uint32_t nextSeg = 0; nextSeg < count; ++nextSeg) {
-                            if (nextPagesIt->second[nextSeg] == page && nextKeysIt->second[nextSeg] == key) {
-                                m_pageOwnerSegment[page] = nextSeg;
-                                break;
-                            }
-                        }
-                    }
+                    m_pageOwnerSegment[page] = nextSegment;
                 }
             }
             continue;
@@ -2366,8 +2319,7 @@ void CLodStreamingSystem::ReleaseGroupResidency(uint32_t groupIndex, MeshManager
         RetirePhysicalPage(page, meshManager, IsPhysicalPagePinnedStorage(page));
     }
 
-    m_groupOwnedPages.erase(pagesIt);
-    m_groupOwnedMeshPageKeys.erase(groupIndex);
+    m_pageOwnership.EraseGroup(groupIndex);
     SetGroupUsesPinnedStorage(groupIndex, false);
 
     if (meshManager != nullptr) {
@@ -2410,11 +2362,7 @@ void CLodStreamingSystem::ProtectGroupAndAncestors(uint32_t groupIndex) {
             return;
         }
 
-        auto pagesIt = m_groupOwnedPages.find(g);
-        if (pagesIt == m_groupOwnedPages.end()) {
-            return;
-        }
-        for (uint32_t page : pagesIt->second) {
+        for (uint32_t page : m_pageOwnership.GroupPages(g)) {
             if (page != ~0u && page < m_pageProtectedThisUpdate.size()) {
                 m_pageProtectedThisUpdate[page] = 1u;
                 m_pageLru.Touch(page);
@@ -2444,7 +2392,7 @@ bool CLodStreamingSystem::IsPhysicalPageCleanForFreshAllocation(uint32_t page) c
     if (m_pageState[page] != CLodPhysicalPageState::Free) {
         return false;
     }
-    if (page < m_pageResidentGroups.size() && !m_pageResidentGroups[page].empty()) {
+    if (m_pageOwnership.HasResidents(page)) {
         return false;
     }
     if (page < m_pageOwnerMeshPageKey.size() && m_pageOwnerMeshPageKey[page] != kInvalidCLodMeshPageKey) {
@@ -2478,8 +2426,8 @@ bool CLodStreamingSystem::EvictPhysicalPage(uint32_t page, MeshManager* meshMana
     }
 
     std::vector<uint32_t> groupsToEvict;
-    if (page < m_pageResidentGroups.size()) {
-        groupsToEvict.assign(m_pageResidentGroups[page].begin(), m_pageResidentGroups[page].end());
+    if (page < m_pageOwnership.PageCount()) {
+        m_pageOwnership.CollectResidents(page, groupsToEvict);
     } else if (page < m_pageOwnerGroup.size() && m_pageOwnerGroup[page] >= 0) {
         groupsToEvict.push_back(static_cast<uint32_t>(m_pageOwnerGroup[page]));
     }
@@ -2495,6 +2443,35 @@ bool CLodStreamingSystem::EvictPhysicalPage(uint32_t page, MeshManager* meshMana
     return true;
 }
 
+// Evicts least-recently-used resident pages until at most maxResidentPages
+// remain, sharing the per-update eviction budget with PopFreePages. Stops at
+// the first protected page, since everything after it was used more recently.
+uint32_t CLodStreamingSystem::TrimResidentPagesToBudget(uint64_t residentPages, uint64_t maxResidentPages, MeshManager* meshManager) {
+    ZoneScopedN("CLodStreamingSystem::TrimResidentPagesToBudget");
+
+    uint32_t evicted = 0u;
+    uint32_t attemptsRemaining = m_pageLru.Size();
+    while (residentPages > maxResidentPages &&
+        attemptsRemaining-- > 0u &&
+        m_pagePopEvictionsThisUpdate < m_pagePopEvictionBudgetThisUpdate) {
+        const uint32_t page = m_pageLru.PopOldest();
+        if (page == ~0u) {
+            break;
+        }
+        if (page < m_pageProtectedThisUpdate.size() && m_pageProtectedThisUpdate[page] != 0u) {
+            break;
+        }
+        ScrubStaleResidentGroups(page);
+        if (!EvictPhysicalPage(page, meshManager)) {
+            continue;
+        }
+        ++evicted;
+        ++m_pagePopEvictionsThisUpdate;
+        --residentPages;
+    }
+    return evicted;
+}
+
 std::vector<uint32_t> CLodStreamingSystem::PopFreePages(uint32_t count, MeshManager* meshManager) {
     return PopFreePages(count, meshManager, nullptr);
 }
@@ -2560,7 +2537,7 @@ std::vector<uint32_t> CLodStreamingSystem::PopFreePages(uint32_t count, MeshMana
                 page < m_pageState.size() ? static_cast<uint32_t>(m_pageState[page]) : UINT32_MAX,
                 page < m_pageOwnerGroup.size() ? m_pageOwnerGroup[page] : -1,
                 ownerKey,
-                page < m_pageResidentGroups.size() ? static_cast<uint32_t>(m_pageResidentGroups[page].size()) : 0u,
+                m_pageOwnership.ResidentCount(page),
                 page < m_pendingPageOwnerGroup.size() ? m_pendingPageOwnerGroup[page] : UINT32_MAX,
                 0u);
             return false;
@@ -2626,11 +2603,9 @@ std::vector<uint32_t> CLodStreamingSystem::PopFreePages(uint32_t count, MeshMana
                 recordPendingWrite();
                 continue;
             }
-            if (page < m_pageResidentGroups.size() && !m_pageResidentGroups[page].empty()) {
-                ScrubStaleResidentGroups(page);
-            }
+            ScrubStaleResidentGroups(page);
 
-            if (page < m_pageResidentGroups.size() && !m_pageResidentGroups[page].empty()) {
+            if (m_pageOwnership.HasResidents(page)) {
                 if (m_pagePopEvictionsThisUpdate >= m_pagePopEvictionBudgetThisUpdate) {
                     if (outStats != nullptr) {
                         ++outStats->rejectedEvictionBudget;
@@ -2952,12 +2927,11 @@ bool CLodStreamingSystem::AssignPagesToGroup(uint32_t groupIndex, const PreAlloc
         }
     }
 
-    if (m_groupOwnedPages.find(groupIndex) != m_groupOwnedPages.end()) {
+    if (m_pageOwnership.OwnsGroup(groupIndex)) {
         ReleaseGroupResidency(groupIndex, meshManager, true);
     }
 
-    m_groupOwnedPages[groupIndex] = pages.pagesBySegment;
-    m_groupOwnedMeshPageKeys[groupIndex] = pages.meshPageKeys;
+    m_pageOwnership.AssignGroup(groupIndex, pages.pagesBySegment, pages.meshPageKeys);
     SetGroupUsesPinnedStorage(groupIndex, pages.usesPinnedStorage);
 
     for (uint32_t seg = 0; seg < pages.segmentCount; ++seg) {
@@ -2982,9 +2956,7 @@ bool CLodStreamingSystem::AssignPagesToGroup(uint32_t groupIndex, const PreAlloc
                 m_pendingPageOwnerSegment[page] = 0u;
                 m_residentMeshPageToPhysicalPage[meshPageKey] = page;
                 m_residentMeshPageRefCounts[meshPageKey]++;
-                if (page < m_pageResidentGroups.size()) {
-                    m_pageResidentGroups[page].insert(groupIndex);
-                }
+                m_pageOwnership.AddResident(page, groupIndex, seg);
                 m_pageOwnerGroup[page] = static_cast<int32_t>(groupIndex);
                 m_pageOwnerSegment[page] = seg;
             } else {
@@ -3195,7 +3167,7 @@ void CLodStreamingSystem::CommitPendingResidencyPromotions() {
                 ClearPendingLoadPriority(groupIndex);
                 continue;
             }
-            if (m_groupOwnedPages.find(groupIndex) == m_groupOwnedPages.end()) {
+            if (!m_pageOwnership.OwnsGroup(groupIndex)) {
                 ClearStreamingRequestInProgress(groupIndex);
                 ClearPendingLoadPriority(groupIndex);
                 continue;
@@ -3269,28 +3241,23 @@ void CLodStreamingSystem::ReconcileStaleDiskIoRequests(MeshManager* meshManager)
 }
 
 bool CLodStreamingSystem::PromoteGroupPagesAfterUploadDrain(uint32_t groupIndex) {
-    const auto pagesIt = m_groupOwnedPages.find(groupIndex);
-    if (pagesIt == m_groupOwnedPages.end()) {
+    if (!m_pageOwnership.OwnsGroup(groupIndex)) {
         return true;
     }
 
+    const std::span<const uint32_t> ownedPages = m_pageOwnership.GroupPages(groupIndex);
+    const std::span<const uint64_t> ownedKeys = m_pageOwnership.GroupKeys(groupIndex);
     bool waitingForSharedPendingPage = false;
-    for (uint32_t seg = 0; seg < static_cast<uint32_t>(pagesIt->second.size()); ++seg) {
-        const uint32_t page = pagesIt->second[seg];
+    for (uint32_t seg = 0; seg < static_cast<uint32_t>(ownedPages.size()); ++seg) {
+        const uint32_t page = ownedPages[seg];
         if (page == ~0u || page >= m_pageState.size()) {
             continue;
         }
 
-        const auto keysIt = m_groupOwnedMeshPageKeys.find(groupIndex);
-        const uint64_t key = keysIt != m_groupOwnedMeshPageKeys.end() && seg < static_cast<uint32_t>(keysIt->second.size())
-            ? keysIt->second[seg]
-            : kInvalidCLodMeshPageKey;
+        const uint64_t key = ownedKeys[seg];
 
         if (IsPhysicalPageResidentForKey(page, key)) {
-            bool insertedGroup = false;
-            if (page < m_pageResidentGroups.size()) {
-                insertedGroup = m_pageResidentGroups[page].insert(groupIndex).second;
-            }
+            const bool insertedGroup = m_pageOwnership.AddResident(page, groupIndex, seg);
             if (insertedGroup && key != kInvalidCLodMeshPageKey) {
                 m_residentMeshPageRefCounts[key]++;
             }
@@ -3331,9 +3298,7 @@ bool CLodStreamingSystem::PromoteGroupPagesAfterUploadDrain(uint32_t groupIndex)
             m_residentMeshPageRefCounts[key]++;
             ReleasePendingMeshPageReference(page, key);
         }
-        if (page < m_pageResidentGroups.size()) {
-            m_pageResidentGroups[page].insert(groupIndex);
-        }
+        m_pageOwnership.AddResident(page, groupIndex, seg);
         if (!IsPhysicalPagePinnedStorage(page)) {
             m_pageLru.Insert(page);
         }
@@ -3351,12 +3316,9 @@ void CLodStreamingSystem::ForceGroupNonResident(uint32_t groupIndex, MeshManager
 void CLodStreamingSystem::TouchGroupPages(uint32_t groupIndex) {
     ZoneScopedN("CLodStreamingSystem::TouchGroupPages");
 
-    auto it = m_groupOwnedPages.find(groupIndex);
-    if (it != m_groupOwnedPages.end()) {
-        for (uint32_t page : it->second) {
-            if (page != ~0u) {
-                m_pageLru.Touch(page);
-            }
+    for (uint32_t page : m_pageOwnership.GroupPages(groupIndex)) {
+        if (page != ~0u) {
+            m_pageLru.Touch(page);
         }
     }
 
@@ -3367,12 +3329,9 @@ void CLodStreamingSystem::TouchGroupPages(uint32_t groupIndex) {
         int32_t parent = m_streamingParentGroupByGlobal[static_cast<uint32_t>(current)];
         if (parent < 0 || parent == current) break;
 
-        auto pit = m_groupOwnedPages.find(static_cast<uint32_t>(parent));
-        if (pit != m_groupOwnedPages.end()) {
-            for (uint32_t page : pit->second) {
-                if (page != ~0u) {
-                    m_pageLru.Touch(page);
-                }
+        for (uint32_t page : m_pageOwnership.GroupPages(static_cast<uint32_t>(parent))) {
+            if (page != ~0u) {
+                m_pageLru.Touch(page);
             }
         }
         current = parent;
@@ -3480,8 +3439,8 @@ void CLodStreamingSystem::RefreshStreamingActiveGroupDomain() {
         }
 
         std::vector<uint32_t> groupsToRelease;
-        groupsToRelease.reserve(m_groupOwnedPages.size());
-        for (const auto& [groupIndex, _] : m_groupOwnedPages) {
+        groupsToRelease.reserve(m_pageOwnership.OwnedGroupCount());
+        for (uint32_t groupIndex : m_pageOwnership.OwnedGroups()) {
             if (!UsesPinnedStorage(groupIndex)) {
                 continue;
             }
@@ -3642,8 +3601,14 @@ void CLodStreamingSystem::ClearStreamingRequestInProgress(uint32_t groupIndex) {
         return;
     }
 
+    // The only place the prefetcher hears about cancellations; callers that
+    // drop speculative requests must not notify it again.
     auto& state = m_streamingRequestStateByGroup[groupIndex];
     if (state == StreamingRequestState::None) {
+        // The request is already gone; release tracking a cancel loop still holds.
+        if (m_motionPrefetcher.IsSpeculativeQueued(groupIndex)) {
+            m_motionPrefetcher.OnSpeculativeCancelled(groupIndex);
+        }
         return;
     }
 
@@ -3713,8 +3678,12 @@ void CLodStreamingSystem::ClearStreamingRequestInProgress(uint32_t groupIndex) {
         }
     }
 
-    if (state == StreamingRequestState::PendingCpu && m_pendingStreamingRequestCount > 0u) {
-        --m_pendingStreamingRequestCount;
+    if (state == StreamingRequestState::PendingCpu) {
+        if (m_pendingStreamingRequestCount > 0u) {
+            --m_pendingStreamingRequestCount;
+        }
+        // Dropped before any IO was issued.
+        m_motionPrefetcher.OnSpeculativeCancelled(groupIndex);
     }
     if (m_streamingRequestsInProgressCount > 0u) {
         --m_streamingRequestsInProgressCount;
@@ -4122,11 +4091,10 @@ void CLodStreamingSystem::ApplyDiskStreamingCompletions(MeshManager* meshManager
                     }
                 }
                 else {
-                    if (m_groupOwnedPages.find(groupIndex) != m_groupOwnedPages.end()) {
+                    if (m_pageOwnership.OwnsGroup(groupIndex)) {
                         ReleaseGroupResidency(groupIndex, meshManager, true);
                     }
-                    m_groupOwnedPages[groupIndex] = {};
-                    m_groupOwnedMeshPageKeys[groupIndex] = {};
+                    m_pageOwnership.AssignGroup(groupIndex, {}, {});
                     m_groupCommittedPageMaps.erase(groupIndex);
                     SetGroupUsesPinnedStorage(groupIndex, IsGroupPinned(groupIndex));
                 }
@@ -4233,12 +4201,7 @@ void CLodStreamingSystem::PollCompletedReadbackSlots() {
             }
             touchedWord |= bitMask;
 
-            auto pagesIt = m_groupOwnedPages.find(touchedGroup);
-            if (pagesIt == m_groupOwnedPages.end()) {
-                return;
-            }
-
-            for (uint32_t page : pagesIt->second) {
+            for (uint32_t page : m_pageOwnership.GroupPages(touchedGroup)) {
                 if (page != ~0u) {
                     m_pageLru.Touch(page);
                 }
@@ -4247,6 +4210,7 @@ void CLodStreamingSystem::PollCompletedReadbackSlots() {
 
         for (const uint32_t groupIndex : m_usedGroupsBatchScratch) {
             touchGroupPagesOnce(groupIndex);
+            m_motionPrefetcher.OnGroupDemanded(groupIndex);
 
             int32_t current = static_cast<int32_t>(groupIndex);
             for (size_t hop = 0; hop < m_streamingParentGroupByGlobal.size(); ++hop) {
@@ -4275,7 +4239,9 @@ void CLodStreamingSystem::PollCompletedReadbackSlots() {
         for (const auto& [groupIndex, priority] : m_readbackBatchScratch) {
             CLodStreamingRequest req{};
             req.groupGlobalIndex = groupIndex;
-            queuedCount += QueueLoadRequestWithParents(req, priority);
+            m_motionPrefetcher.OnGroupDemanded(groupIndex);
+            // Priority 0 is reserved for speculative prefetch.
+            queuedCount += QueueLoadRequestWithParents(req, (std::max)(priority, 1u));
         }
     }
 
@@ -4469,6 +4435,82 @@ void CLodStreamingSystem::StreamingWorkerMain() {
     }
 }
 
+void CLodStreamingSystem::UpdateMotionPrefetch(MeshManager* meshManager) {
+    ZoneScopedN("CLodStreamingSystem::UpdateMotionPrefetch");
+
+    m_prefetchCancelScratch.clear();
+    m_motionPrefetcher.AdvanceFrame(m_prefetchCancelScratch);
+    for (uint32_t groupIndex : m_prefetchCancelScratch) {
+        ClearStreamingRequestInProgress(groupIndex);
+        ClearPendingLoadPriority(groupIndex);
+    }
+
+    CLodPrefetchCameraPose pose{};
+    const bool enabled = meshManager != nullptr && m_getPrefetchEnabled && m_getPrefetchEnabled();
+    if (!enabled || !m_getPrefetchCamera || !m_getPrefetchCamera(pose)) {
+        m_motionPrefetcher.ResetCameraHistory();
+        CancelQueuedSpeculativeRequests();
+        return;
+    }
+
+    m_motionPrefetcher.ObserveCamera(pose);
+    if (m_prefetchBackoffFrames > 0u) {
+        --m_prefetchBackoffFrames;
+        return;
+    }
+
+    CLodMotionPrefetcher::Options options = m_motionPrefetcher.GetOptions();
+    if (m_getPrefetchLookaheadFrames) {
+        options.lookaheadFrames = std::max(m_getPrefetchLookaheadFrames(), 1u);
+    }
+    if (m_getPrefetchMaxRequests) {
+        options.maxCandidatesPerUpdate = m_getPrefetchMaxRequests();
+    }
+    m_motionPrefetcher.SetOptions(options);
+    if (options.maxCandidatesPerUpdate == 0u) {
+        return;
+    }
+
+    if (m_prefetchMeshesDirty) {
+        meshManager->GetCLodPrefetchMeshes(m_prefetchGroups, m_prefetchMeshes);
+        m_motionPrefetcher.SetMeshes(m_prefetchMeshes);
+        m_prefetchMeshesDirty = false;
+    }
+    meshManager->GetCLodPrefetchInstances(m_prefetchInstances);
+    m_motionPrefetcher.SetInstances(m_prefetchInstances);
+
+    m_prefetchCandidatesScratch.clear();
+    m_motionPrefetcher.CollectCandidates(
+        [this](uint32_t groupIndex) {
+            return !IsGroupActive(groupIndex) || IsGroupResident(groupIndex) || IsStreamingRequestInProgress(groupIndex);
+        },
+        m_prefetchCandidatesScratch);
+
+    // Priority 0 sorts below every GPU request, so speculative loads only
+    // use upload budget the current view leaves over.
+    for (const auto& candidate : m_prefetchCandidatesScratch) {
+        CLodStreamingRequest request{};
+        request.groupGlobalIndex = candidate.groupIndex;
+        if (TryQueuePendingLoadRequest(request, 0u)) {
+            m_motionPrefetcher.OnSpeculativeQueued(candidate.groupIndex);
+        }
+    }
+
+    const auto& stats = m_motionPrefetcher.GetStats();
+    TracyPlot("CLod prefetch tracked", static_cast<int64_t>(m_motionPrefetcher.TrackedCount()));
+    TracyPlot("CLod prefetch hit rate", stats.HitRate());
+    TracyPlot("CLod prefetch wasted MiB", static_cast<int64_t>(stats.wastedBytes >> 20));
+}
+
+void CLodStreamingSystem::CancelQueuedSpeculativeRequests() {
+    m_prefetchCancelScratch.clear();
+    m_motionPrefetcher.CollectQueued(m_prefetchCancelScratch);
+    for (uint32_t groupIndex : m_prefetchCancelScratch) {
+        ClearStreamingRequestInProgress(groupIndex);
+        ClearPendingLoadPriority(groupIndex);
+    }
+}
+
 void CLodStreamingSystem::ProcessStreamingRequestsBudgeted() {
     ZoneScopedN("CLodStreamingSystem::ProcessStreamingRequestsBudgeted");
 
@@ -4528,7 +4570,7 @@ void CLodStreamingSystem::ProcessStreamingRequestsBudgeted() {
             }
         }
         const uint64_t protectedUsedWindow = static_cast<uint64_t>(std::max<uint32_t>(m_streamingReadbackRingSize, 1u) + 1u);
-        for (const auto& [groupIndex, _] : m_groupOwnedPages) {
+        for (uint32_t groupIndex : m_pageOwnership.OwnedGroups()) {
             if (groupIndex < m_groupLastUsedTick.size() &&
                 m_groupLastUsedTick[groupIndex] != 0u &&
                 m_streamingDiagnosticTick <= m_groupLastUsedTick[groupIndex] + protectedUsedWindow) {
@@ -4546,6 +4588,42 @@ void CLodStreamingSystem::ProcessStreamingRequestsBudgeted() {
     auto* pool = meshManager ? meshManager->GetCLodPagePool() : nullptr;
     const uint64_t pageSize = pool ? pool->GetPageSize() : 0u;
 
+    // Under a resident byte cap, old pages are trimmed first and new loads
+    // wait until there is room. Every group needs at least one page, so the
+    // free page count bounds how many loads may start.
+    uint32_t loadBudget = budget;
+    const uint64_t residentBudgetBytes = m_getStreamingResidentBudgetBytes ? m_getStreamingResidentBudgetBytes() : 0u;
+    if (meshManager != nullptr && pageSize != 0u && residentBudgetBytes != 0u) {
+        ZoneScopedN("CLodStreamingSystem::ProcessStreamingRequestsBudgeted::ApplyResidentBudget");
+        const uint64_t maxResidentPages = residentBudgetBytes / pageSize;
+        uint64_t residentPages = meshManager->GetCLodStreamingDebugStats().residentAllocations;
+        if (residentPages > maxResidentPages) {
+            residentPages -= TrimResidentPagesToBudget(residentPages, maxResidentPages, meshManager);
+        }
+        loadBudget = residentPages >= maxResidentPages
+            ? 0u
+            : static_cast<uint32_t>(std::min<uint64_t>(budget, maxResidentPages - residentPages));
+    }
+
+    // Speculative loads may only take pages that are free right now, and at
+    // most half of them, so they never push out pages the GPU asked for. They
+    // are popped last; without room they are all dropped.
+    uint64_t speculativePageBudget = 0u;
+    if (m_motionPrefetcher.TrackedCount() != 0u) {
+        if (meshManager != nullptr && pool != nullptr && pageSize != 0u) {
+            uint64_t capacityPages = pool->GetGeneralPageCount();
+            if (residentBudgetBytes != 0u) {
+                capacityPages = std::min<uint64_t>(capacityPages, residentBudgetBytes / pageSize);
+            }
+            const uint64_t residentPages = meshManager->GetCLodStreamingDebugStats().residentAllocations;
+            speculativePageBudget = capacityPages > residentPages ? (capacityPages - residentPages) / 2u : 0u;
+        }
+        if (loadBudget == 0u || speculativePageBudget == 0u) {
+            CancelQueuedSpeculativeRequests();
+            m_prefetchBackoffFrames = kPrefetchPressureBackoffFrames;
+        }
+    }
+
     struct QueuedStreamingCandidate {
         uint32_t groupIndex = 0u;
         MeshManager::CLodGroupDiskIOBatchRequest request;
@@ -4556,7 +4634,7 @@ void CLodStreamingSystem::ProcessStreamingRequestsBudgeted() {
     uint32_t processed = 0;
     {
         ZoneScopedN("CLodStreamingSystem::ProcessStreamingRequestsBudgeted::SelectAndPrepareRequests");
-        while (processed < budget && !m_pendingStreamingRequests.empty()) {
+        while (processed < loadBudget && !m_pendingStreamingRequests.empty()) {
             PendingStreamingRequest pending{};
             {
                 ZoneScopedN("CLodStreamingSystem::ProcessStreamingRequestsBudgeted::PopPendingRequest");
@@ -4583,6 +4661,13 @@ void CLodStreamingSystem::ProcessStreamingRequestsBudgeted() {
                 }
             }
 
+            const bool speculative = m_motionPrefetcher.IsSpeculativeQueued(groupIndex);
+            if (speculative && speculativePageBudget == 0u) {
+                CancelQueuedSpeculativeRequests();
+                m_prefetchBackoffFrames = kPrefetchPressureBackoffFrames;
+                continue;
+            }
+
             // Load path
             frameStats.loadRequested++;
             frameStats.loadUnique++;
@@ -4654,6 +4739,10 @@ void CLodStreamingSystem::ProcessStreamingRequestsBudgeted() {
                         prefetchedIt->second.ownerGroupIndex);
                 }
 
+                if (speculative) {
+                    speculativePageBudget -= std::min<uint64_t>(speculativePageBudget, std::max(paIt->second.segmentCount, 1u));
+                }
+
                 QueuedStreamingCandidate candidate{};
                 candidate.groupIndex = groupIndex;
                 candidate.request.groupGlobalIndex = groupIndex;
@@ -4700,6 +4789,11 @@ void CLodStreamingSystem::ProcessStreamingRequestsBudgeted() {
                 const uint32_t groupIndex = diskIoBatch[i].groupIndex;
                 const bool queued = i < queuedByRequest.size() && queuedByRequest[i];
                 if (queued) {
+                    if (m_motionPrefetcher.IsSpeculativeQueued(groupIndex)) {
+                        const auto& fetches = diskIoBatch[i].request.segmentNeedsFetch;
+                        const uint64_t fetchedPages = static_cast<uint64_t>(std::count(fetches.begin(), fetches.end(), true));
+                        m_motionPrefetcher.OnSpeculativeIssued(groupIndex, fetchedPages * pageSize);
+                    }
                     MarkStreamingRequestDiskIo(groupIndex);
                     continue;
                 }
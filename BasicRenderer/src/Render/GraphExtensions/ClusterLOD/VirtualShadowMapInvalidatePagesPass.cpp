@@ -42,9 +42,8 @@ VirtualShadowMapInvalidatePagesPass::VirtualShadowMapInvalidatePagesPass(
         "CLod.VirtualShadow.InvalidatePages.PSO");
     auto& ecsWorld = RendererECSManager::GetInstance().GetWorld();
 
-    m_transformChangedQuery = ecsWorld.query_builder<const Components::ObjectDrawInfo>()
+    m_transformChangedQuery = ecsWorld.query_builder<const Components::ObjectDrawInfo, const Components::RenderTransformStamp>()
         .with<Components::Active>()
-        .with<Components::RenderTransformUpdated>()
         .without<Components::SkipShadowPass>()
         .without<Components::Skinned>()
         .build();
@@ -91,7 +90,12 @@ void VirtualShadowMapInvalidatePagesPass::Update(const UpdateExecutionContext& e
         invalidatedInstancesBitset[perMeshInstanceBufferIndex >> 5u] |= 1u << (perMeshInstanceBufferIndex & 31u);
     };
 
-    m_transformChangedQuery.each([&](flecs::entity entity, const Components::ObjectDrawInfo& drawInfo) {
+    const Components::RenderTransformSyncWindow window = RendererECSManager::GetInstance().GetWorld().get<Components::RenderTransformSyncWindow>();
+    m_transformChangedQuery.each([&](flecs::entity entity, const Components::ObjectDrawInfo& drawInfo, const Components::RenderTransformStamp& stamp) {
+        if (!window.IsUpdated(stamp)) {
+            return;
+        }
+
         uint32_t flags = 0u;
         flags |= CLodVirtualShadowInvalidationFlagUsePreviousBounds;
         flags |= CLodVirtualShadowInvalidationFlagUseCurrentBounds;
@@ -1,5 +1,8 @@
 #include "Render/SceneRenderBridge.h"
 
+#include <algorithm>
+#include <optional>
+#include <string>
 #include <unordered_set>
 #include <vector>
 
@@ -11,8 +14,10 @@
 #include "Managers/ViewManager.h"
 #include "Managers/Singletons/RendererECSManager.h"
 #include "Managers/Singletons/SettingsManager.h"
+#include "Managers/Singletons/TaskSchedulerManager.h"
 #include "Materials/Material.h"
 #include "Render/DrawWorkload.h"
+#include "Render/RenderableIngestOps.h"
 #include "Mesh/MeshInstance.h"
 #include "Resources/Sampler.h"
 #include "Scene/Components.h"
@@ -147,11 +152,12 @@ void CopyCommonComponents(flecs::entity dst, flecs::entity src) {
     }
 }
 
-void CopyCommonComponents(flecs::entity dst, uint64_t stableSceneID, const std::string& name, const Components::Matrix& matrix) {
+void CopyCommonComponents(flecs::entity dst, uint64_t stableSceneID, const std::string& name, const Components::Matrix& matrix, uint64_t ingestionFrame) {
     dst.add<BridgedSceneEntity>();
     dst.add<Components::Active>();
     dst.set<Components::StableSceneID>({ stableSceneID });
     dst.set<Components::Matrix>(matrix);
+    dst.set<Components::RenderTransformStamp>({ ingestionFrame });
 
     if (!name.empty()) {
         dst.set<Components::Name>(name);
@@ -160,21 +166,36 @@ void CopyCommonComponents(flecs::entity dst, uint64_t stableSceneID, const std::
     }
 }
 
-void SyncPassMembership(flecs::entity dst, const Components::MeshInstances* meshInstances) {
+// CPU-only part of SyncRenderableDerivedState. Touches no ECS state, so
+// IngestSnapshot builds it for many renderables in parallel.
+struct RenderableDerivedData {
+    RenderableSignature signature;
+    Components::PerPassMeshes perPassMeshes;
+    std::unordered_set<uint64_t> passHashes;
+};
+
+RenderableDerivedData BuildRenderableDerivedData(const Components::MeshInstances* meshInstances) {
+    RenderableDerivedData derived;
+    derived.signature = BuildRenderableSignature(meshInstances);
+    derived.perPassMeshes = BuildPerPassMeshes(meshInstances);
+    if (meshInstances) {
+        for (const auto& meshInstance : meshInstances->meshInstances) {
+            ForEachMeshRenderPhase(*meshInstance->GetMesh(), [&](const RenderPhase& pass) {
+                derived.passHashes.insert(pass.hash);
+            });
+        }
+    }
+    return derived;
+}
+
+void SyncPassMembership(flecs::entity dst, const std::unordered_set<uint64_t>& passHashes) {
     dst.remove<Components::ParticipatesInPass>(flecs::Wildcard);
 
-    if (!meshInstances) {
+    if (passHashes.empty()) {
         return;
     }
 
     const auto& renderPhaseEntities = RendererECSManager::GetInstance().GetRenderPhaseEntities();
-    std::unordered_set<uint64_t> passHashes;
-    for (const auto& meshInstance : meshInstances->meshInstances) {
-        ForEachMeshRenderPhase(*meshInstance->GetMesh(), [&](const RenderPhase& pass) {
-            passHashes.insert(pass.hash);
-        });
-    }
-
     for (const auto& [phase, phaseEntity] : renderPhaseEntities) {
         if (passHashes.contains(phase.hash)) {
             dst.add<Components::ParticipatesInPass>(phaseEntity);
@@ -182,16 +203,14 @@ void SyncPassMembership(flecs::entity dst, const Components::MeshInstances* mesh
     }
 }
 
-void SyncRenderableDerivedState(flecs::entity dst, const Components::MeshInstances* meshInstances, ObjectManager& objectManager) {
-    const auto newSignature = BuildRenderableSignature(meshInstances);
-    const auto perPassMeshes = BuildPerPassMeshes(meshInstances);
+void SyncRenderableDerivedState(flecs::entity dst, const Components::MeshInstances* meshInstances, RenderableDerivedData&& derived, ObjectManager& objectManager) {
     const auto* oldSignature = dst.try_get<RenderableSignature>();
-    const bool signatureChanged = oldSignature == nullptr || oldSignature->meshInstanceKeys != newSignature.meshInstanceKeys;
+    const bool signatureChanged = oldSignature == nullptr || oldSignature->meshInstanceKeys != derived.signature.meshInstanceKeys;
     const auto* matrix = dst.try_get<Components::Matrix>();
 
     if (meshInstances) {
         dst.set<Components::MeshInstances>(*meshInstances);
-        dst.set<Components::PerPassMeshes>(perPassMeshes);
+        dst.set<Components::PerPassMeshes>(std::move(derived.perPassMeshes));
     } else {
         dst.remove<Components::MeshInstances>();
         dst.remove<Components::PerPassMeshes>();
@@ -214,10 +233,10 @@ void SyncRenderableDerivedState(flecs::entity dst, const Components::MeshInstanc
         renderable.perObjectCB.normalMatrixBufferIndex = drawInfo.normalMatrixIndex;
         dst.set<Components::RenderableObject>(renderable);
         dst.set<Components::ObjectDrawInfo>(drawInfo);
-        dst.set<RenderableSignature>(newSignature);
+        dst.set<RenderableSignature>(std::move(derived.signature));
     }
 
-    SyncPassMembership(dst, meshInstances);
+    SyncPassMembership(dst, derived.passHashes);
 }
 
 Components::Camera BuildRendererCamera(const Components::Camera& sceneCamera, const Components::DepthMap& depthMap, uint32_t width, uint32_t height) {
@@ -338,6 +357,9 @@ void SyncLightDerivedState(
     ApplyLightRendererBindings(rendererLight, dst);
     if (const auto* viewInfo = dst.try_get<Components::LightViewInfo>()) {
         lightManager.UpdateLightBufferView(viewInfo->lightBufferView.get(), rendererLight.lightInfo);
+        // The upload carries scene defaults for view-derived fields such as the
+        // directional source angle; let the next view update write them again.
+        lightManager.InvalidateLightView(dst.id());
     }
     dst.set<Components::Light>(rendererLight);
 }
@@ -690,6 +712,163 @@ void SceneRenderBridge::Clear(const ManagerInterface& managerInterface) {
     InvalidateExportQueries();
 }
 
+void SceneRenderBridge::IngestChangedRenderables(const SceneFrameSnapshot& snapshot, flecs::world& renderWorld, ObjectManager& objectManager) {
+    ZoneScopedN("SceneRenderBridge::IngestSnapshot::ChangedRenderables");
+
+    const auto& changes = snapshot.changedRenderables;
+    if (changes.empty()) {
+        return;
+    }
+
+    struct RenderableWork {
+        BridgedEntityState* state = nullptr;
+        flecs::entity entity;
+        size_t nameHash = 0;
+        uint8_t targetTags = 0;
+        bool isNew = false;
+        bool meshChanged = false;
+        bool renamed = false;
+        std::optional<RenderableDerivedData> derived;
+    };
+    std::vector<RenderableWork> work(changes.size());
+
+    constexpr size_t kChunkSize = 1024;
+    const size_t chunkCount = (changes.size() + kChunkSize - 1) / kChunkSize;
+    auto forEachChunk = [&](const char* taskName, auto&& body) {
+        TaskSchedulerManager::GetInstance().ParallelFor(taskName, chunkCount, [&](size_t chunkIndex) {
+            const size_t begin = chunkIndex * kChunkSize;
+            const size_t end = (std::min)(begin + kChunkSize, changes.size());
+            for (size_t i = begin; i < end; ++i) {
+                body(i);
+            }
+        });
+    };
+
+    // Find bridge state and the target tags without touching the ECS; the map
+    // is only read here.
+    {
+        ZoneScopedN("SceneRenderBridge::IngestSnapshot::ChangedRenderables::Resolve");
+        forEachChunk("SceneRenderBridge::ResolveRenderables", [&](size_t i) {
+            const SnapshotRenderable& renderable = changes[i];
+            RenderableWork& item = work[i];
+            if (auto it = m_bridgedEntities.find(renderable.stableID); it != m_bridgedEntities.end()) {
+                item.state = &it->second;
+            }
+            item.nameHash = std::hash<std::string>{}(renderable.name);
+            item.targetTags = static_cast<uint8_t>(
+                (renderable.skinned ? RenderableTag::Skinned : 0u) |
+                (HasSkinningPassEligibleMeshes(&renderable.meshInstances) ? RenderableTag::SkinningPassEligible : 0u) |
+                (renderable.skipShadowPass ? RenderableTag::SkipShadowPass : 0u) |
+                (!renderable.name.empty() ? RenderableTag::Named : 0u));
+        });
+    }
+
+    // Create entities for new renderables. Map inserts keep references to
+    // existing states valid.
+    {
+        ZoneScopedN("SceneRenderBridge::IngestSnapshot::ChangedRenderables::Create");
+        m_renderableIngestPlan.Clear();
+        m_renderableIngestPlan.Reserve(changes.size());
+        for (size_t i = 0; i < changes.size(); ++i) {
+            const SnapshotRenderable& renderable = changes[i];
+            RenderableWork& item = work[i];
+            if (item.state) {
+                item.entity = flecs::entity{ renderWorld, item.state->renderEntityId };
+            }
+            if (!item.state || !item.entity.is_alive()) {
+                item.entity = GetOrCreateBridgedEntity(renderWorld, m_bridgedEntities, renderable.stableID, m_currentIngestionFrame);
+                item.state = &m_bridgedEntities[renderable.stableID];
+                item.state->renderableTags = 0;
+                item.state->nameHash = 0;
+            }
+            item.isNew = !item.entity.has<BridgedSceneEntity>();
+            item.meshChanged = item.state->meshGeneration != renderable.meshInstances.generation;
+            item.renamed = item.state->nameHash != item.nameHash;
+            item.state->lastSeenFrame = m_currentIngestionFrame;
+
+            SnapshotIngestItem planItem{};
+            planItem.changeIndex = static_cast<uint32_t>(i);
+            planItem.currentTags = item.isNew ? uint8_t{ 0 } : item.state->renderableTags;
+            planItem.targetTags = item.targetTags;
+            planItem.rebuild = item.isNew || item.meshChanged || item.renamed;
+            m_renderableIngestPlan.Add(planItem);
+        }
+        m_renderableIngestPlan.Build();
+    }
+
+    const auto structural = m_renderableIngestPlan.StructuralChanges();
+    {
+        ZoneScopedN("SceneRenderBridge::IngestSnapshot::ChangedRenderables::BuildDerivedData");
+        TaskSchedulerManager::GetInstance().ParallelFor("SceneRenderBridge::BuildRenderableDerivedData", structural.size(), [&](size_t index) {
+            const uint32_t changeIndex = structural[index];
+            RenderableWork& item = work[changeIndex];
+            if (item.isNew || item.meshChanged) {
+                item.derived = BuildRenderableDerivedData(&changes[changeIndex].meshInstances);
+            }
+        });
+    }
+
+    // Archetype changes, one tag transition at a time so consecutive entities
+    // follow the same table edge.
+    {
+        ZoneScopedN("SceneRenderBridge::IngestSnapshot::ChangedRenderables::Structural");
+        for (const SnapshotIngestGroup& group : m_renderableIngestPlan.Groups()) {
+            for (uint32_t changeIndex : structural.subspan(group.first, group.count)) {
+                const SnapshotRenderable& renderable = changes[changeIndex];
+                RenderableWork& item = work[changeIndex];
+                flecs::entity dst = item.entity;
+
+                if (item.isNew) {
+                    dst.add<BridgedSceneEntity>();
+                    dst.add<Components::Active>();
+                    dst.set<Components::StableSceneID>({ renderable.stableID });
+                    dst.set<Components::Matrix>(renderable.matrix);
+                    dst.set<Components::RenderTransformStamp>({ m_currentIngestionFrame });
+                }
+                if (item.isNew || item.renamed) {
+                    if (!renderable.name.empty()) {
+                        dst.set<Components::Name>(renderable.name);
+                    } else {
+                        dst.remove<Components::Name>();
+                    }
+                }
+
+                ApplyRenderableTagTransition(dst, group.addTags, group.removeTags);
+
+                if (item.derived) {
+                    SyncRenderableDerivedState(dst, &renderable.meshInstances, std::move(*item.derived), objectManager);
+                    item.derived.reset();
+                    item.state->meshGeneration = renderable.meshInstances.generation;
+                }
+                item.state->renderableTags = item.targetTags;
+                item.state->nameHash = item.nameHash;
+            }
+        }
+    }
+
+    // Every changed renderable now sits in its final table. Resolve the column
+    // pointers, then write matrices and transform stamps in parallel.
+    {
+        ZoneScopedN("SceneRenderBridge::IngestSnapshot::ChangedRenderables::ColumnWrites");
+        std::vector<RenderableColumns> targets(changes.size());
+        for (size_t i = 0; i < changes.size(); ++i) {
+            targets[i] = ResolveRenderableColumns(work[i].entity);
+        }
+
+        const uint64_t ingestionFrame = m_currentIngestionFrame;
+        forEachChunk("SceneRenderBridge::WriteRenderableColumns", [&](size_t i) {
+            const SnapshotRenderable& renderable = changes[i];
+            RenderableWork& item = work[i];
+            WriteRenderableColumns(targets[i], renderable.matrix, renderable.transformChanged || item.isNew, ingestionFrame);
+            item.state->lastMatrix = renderable.matrix.matrix;
+        });
+    }
+
+    const SnapshotIngestStats& stats = m_renderableIngestPlan.GetStats();
+    TracyPlot("Bridge renderables column-only", static_cast<int64_t>(stats.columnOnly));
+    TracyPlot("Bridge renderables structural", static_cast<int64_t>(stats.structural));
+}
+
 void SceneRenderBridge::IngestSnapshot(const SceneFrameSnapshot& snapshot, const ManagerInterface& managerInterface) {
     ZoneScopedN("SceneRenderBridge::IngestSnapshot");
 
@@ -739,54 +918,14 @@ void SceneRenderBridge::IngestSnapshot(const SceneFrameSnapshot& snapshot, const
     }
 
     // Process only renderables that actually changed (transform, mesh, or new)
-    {
-        ZoneScopedN("SceneRenderBridge::IngestSnapshot::ChangedRenderables");
-        for (const auto& renderable : snapshot.changedRenderables) {
-            auto dst = GetOrCreateBridgedEntity(renderWorld, m_bridgedEntities, renderable.stableID, m_currentIngestionFrame);
-
-            auto& entityState = m_bridgedEntities[renderable.stableID];
-            const bool meshChanged = entityState.meshGeneration != renderable.meshInstances.generation;
-            const bool isNew = !dst.has<BridgedSceneEntity>();
-
-            // Entity is in the changed list, so always update common components
-            CopyCommonComponents(dst, renderable.stableID, renderable.name, renderable.matrix);
-            entityState.lastMatrix = renderable.matrix.matrix;
-            if (renderable.transformChanged || isNew) {
-                dst.add<Components::RenderTransformUpdated>();
-            } else {
-                dst.remove<Components::RenderTransformUpdated>();
-            }
-
-            if (isNew || meshChanged) {
-                SyncRenderableDerivedState(dst, &renderable.meshInstances, *objectManager);
-                entityState.meshGeneration = renderable.meshInstances.generation;
-            }
-
-            if (renderable.skinned) {
-                dst.add<Components::Skinned>();
-            } else {
-                dst.remove<Components::Skinned>();
-            }
-            if (HasSkinningPassEligibleMeshes(&renderable.meshInstances)) {
-                dst.add<Components::SkinningPassEligible>();
-            } else {
-                dst.remove<Components::SkinningPassEligible>();
-            }
-            if (renderable.skipShadowPass) {
-                dst.add<Components::SkipShadowPass>();
-            } else {
-                dst.remove<Components::SkipShadowPass>();
-            }
-        }
-    }
+    IngestChangedRenderables(snapshot, renderWorld, *objectManager);
 
     // Cameras are always exported (few entities, frequently change)
     {
         ZoneScopedN("SceneRenderBridge::IngestSnapshot::ChangedCameras");
         for (const auto& camera : snapshot.changedCameras) {
             auto dst = GetOrCreateBridgedEntity(renderWorld, m_bridgedEntities, camera.stableID, m_currentIngestionFrame);
-            CopyCommonComponents(dst, camera.stableID, camera.name, camera.matrix);
-            dst.add<Components::RenderTransformUpdated>();
+            CopyCommonComponents(dst, camera.stableID, camera.name, camera.matrix, m_currentIngestionFrame);
             SyncCameraDerivedState(dst, camera.camera, camera.primary, *viewManager, renderResolution.x, renderResolution.y);
             if (camera.primary) {
                 dst.add<Components::PrimaryCamera>();
@@ -803,8 +942,7 @@ void SceneRenderBridge::IngestSnapshot(const SceneFrameSnapshot& snapshot, const
         ZoneScopedN("SceneRenderBridge::IngestSnapshot::ChangedLights");
         for (const auto& light : snapshot.changedLights) {
             auto dst = GetOrCreateBridgedEntity(renderWorld, m_bridgedEntities, light.stableID, m_currentIngestionFrame);
-            CopyCommonComponents(dst, light.stableID, light.name, light.matrix);
-            dst.add<Components::RenderTransformUpdated>();
+            CopyCommonComponents(dst, light.stableID, light.name, light.matrix, m_currentIngestionFrame);
             const auto* frustumPlanes = light.frustumPlanes ? &light.frustumPlanes.value() : nullptr;
             SyncLightDerivedState(dst, light.light, frustumPlanes, *lightManager, shadowResolution, directionalCascadeCount, m_primaryCameraEntityId != 0);
             if (light.skipShadowPass) {
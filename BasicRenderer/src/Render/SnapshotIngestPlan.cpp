@@ -0,0 +1,74 @@
+#include "Render/SnapshotIngestPlan.h"
+
+#include <algorithm>
+
+namespace br::render {
+
+namespace {
+
+uint32_t GroupKey(uint8_t addTags, uint8_t removeTags, bool rebuild) {
+    return (static_cast<uint32_t>(rebuild ? 1u : 0u) << 16) | (static_cast<uint32_t>(addTags) << 8) | removeTags;
+}
+
+} // namespace
+
+void SnapshotIngestPlan::Clear() {
+    m_items.clear();
+    m_pending.clear();
+    m_columnOnly.clear();
+    m_structural.clear();
+    m_groups.clear();
+    m_stats = {};
+}
+
+void SnapshotIngestPlan::Reserve(size_t changeCount) {
+    m_items.reserve(changeCount);
+    m_columnOnly.reserve(changeCount);
+}
+
+void SnapshotIngestPlan::Add(const SnapshotIngestItem& item) {
+    m_items.push_back(item);
+}
+
+void SnapshotIngestPlan::Build() {
+    m_pending.clear();
+    m_columnOnly.clear();
+    m_structural.clear();
+    m_groups.clear();
+
+    for (const SnapshotIngestItem& item : m_items) {
+        const uint8_t addTags = static_cast<uint8_t>(item.targetTags & ~item.currentTags);
+        const uint8_t removeTags = static_cast<uint8_t>(item.currentTags & ~item.targetTags);
+        if (!item.rebuild && addTags == 0 && removeTags == 0) {
+            m_columnOnly.push_back(item.changeIndex);
+            continue;
+        }
+        m_pending.push_back({ GroupKey(addTags, removeTags, item.rebuild), item.changeIndex });
+    }
+
+    // Stable so each group keeps snapshot order.
+    std::stable_sort(m_pending.begin(), m_pending.end(), [](const PendingStructural& a, const PendingStructural& b) {
+        return a.key < b.key;
+    });
+
+    m_structural.reserve(m_pending.size());
+    for (const PendingStructural& pending : m_pending) {
+        if (m_groups.empty() || GroupKey(m_groups.back().addTags, m_groups.back().removeTags, m_groups.back().rebuild) != pending.key) {
+            SnapshotIngestGroup group{};
+            group.addTags = static_cast<uint8_t>((pending.key >> 8) & 0xFFu);
+            group.removeTags = static_cast<uint8_t>(pending.key & 0xFFu);
+            group.rebuild = (pending.key >> 16) != 0u;
+            group.first = static_cast<uint32_t>(m_structural.size());
+            m_groups.push_back(group);
+        }
+        ++m_groups.back().count;
+        m_structural.push_back(pending.changeIndex);
+    }
+
+    m_stats.changes = static_cast<uint32_t>(m_items.size());
+    m_stats.columnOnly = static_cast<uint32_t>(m_columnOnly.size());
+    m_stats.structural = static_cast<uint32_t>(m_structural.size());
+    m_stats.groups = static_cast<uint32_t>(m_groups.size());
+}
+
+} // namespace br::render
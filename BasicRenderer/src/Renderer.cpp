@@ -51,6 +51,7 @@
 #include "Managers/Singletons/RendererECSManager.h"
 #include "Managers/IndirectCommandBufferManager.h"
 #include "Utilities/MathUtils.h"
+#include "Utilities/AffineInverse.h"
 #include "Scene/MovementState.h"
 #include "ThirdParty/XeGTAO.h"
 #include "Managers/EnvironmentManager.h"
@@ -61,6 +62,7 @@
 #include "Managers/Singletons/UpscalingManager.h"
 #include "Managers/Singletons/FFXManager.h"
 #include "Managers/Singletons/DirectStorageManager.h"
+#include "Managers/Singletons/AsyncFileIoManager.h"
 #include "Render/Runtime/OpenRenderGraphSettings.h"
 #include "Render/GraphExtensions/IOExtension.h"
 #include "Render/GraphExtensions/CLodExtension.h"
@@ -234,6 +236,7 @@ void Renderer::Initialize(HWND hwnd, UINT x_res, UINT y_res) {
     settingsManager.registerSetting<bool>("renderGraphLightweightCompileSummaryEnabled", false);
     LoadPipeline(hwnd, x_res, y_res);
     DirectStorageManager::GetInstance().Initialize();
+    AsyncFileIoManager::GetInstance().Initialize();
     ProbeGraphicsCommandListCreation(DeviceManager::GetInstance().GetDevice(), "after LoadPipeline");
     UpscalingManager::GetInstance().InitSL();
     SetSettings();
@@ -702,7 +705,7 @@ void Renderer::ScheduleSceneUpdateTask(float elapsedSeconds) {
 
         m_sceneTaskCompleted.store(true);
         m_sceneTaskInFlight.store(false);
-    });
+    }, TaskOptions{ TaskPriority::High });
 }
 
 bool Renderer::HasCommittedSceneSnapshot() const {
@@ -740,6 +743,66 @@ br::render::SceneOverlapStatus Renderer::GetSceneOverlapStatus() const {
     return status;
 }
 
+void Renderer::SetupMemoryBudgetArbiter() {
+    m_memoryBudgetArbiter.AddConsumer(
+        "textureStreaming",
+        [this](budget::MemoryDemand& demand) {
+            if (m_pMaterialManager) {
+                m_pMaterialManager->GatherTextureStreamingMemoryDemand(demand);
+            }
+        },
+        [this](uint64_t capBytes) {
+            if (m_pMaterialManager) {
+                m_pMaterialManager->SetTextureStreamingBudgetBytes(capBytes);
+            }
+        });
+
+    // Resident groups and the loads the view is waiting on, one unit of
+    // quality per group, sized by the average resident group.
+    m_memoryBudgetArbiter.AddConsumer(
+        "clodPages",
+        [this](budget::MemoryDemand& demand) {
+            TryReadCLodStreamingOperationStats(m_clodStreamingOpsSequence, m_clodStreamingOpsLatest);
+            const CLodStreamingOperationStats& stats = m_clodStreamingOpsLatest;
+            const PagePool* pool = m_pMeshManager ? m_pMeshManager->GetCLodPagePool() : nullptr;
+            const uint64_t pageSize = pool ? pool->GetPageSize() : 0u;
+            if (pageSize == 0u) {
+                return;
+            }
+            const uint64_t bytesPerGroup = stats.residentGroups != 0u
+                ? (std::max<uint64_t>)(stats.residentAllocationBytes / stats.residentGroups, pageSize)
+                : pageSize;
+            const uint64_t wantedGroups = static_cast<uint64_t>(stats.residentGroups) + stats.loadUnique + stats.queuedRequests;
+            demand.quantumBytes = pageSize;
+            demand.segments.push_back({ wantedGroups * bytesPerGroup, budget::kBytesPerMiB / static_cast<double>(bytesPerGroup) });
+        },
+        [this](uint64_t capBytes) {
+            m_setCLodStreamingResidentBudgetBytes(capBytes);
+        });
+}
+
+void Renderer::UpdateMemoryBudget() {
+    const uint64_t budgetMiB = getFrameMemoryBudgetMiB ? getFrameMemoryBudgetMiB() : 0u;
+    if (budgetMiB == 0u) {
+        if (m_memoryBudgetArbiterActive) {
+            if (m_pMaterialManager) {
+                m_pMaterialManager->SetTextureStreamingBudgetBytes(0u);
+            }
+            m_setCLodStreamingResidentBudgetBytes(0u);
+            m_memoryBudgetArbiter.Reset();
+            m_memoryBudgetArbiterActive = false;
+        }
+        return;
+    }
+
+    ZoneScopedN("Renderer::UpdateMemoryBudget");
+    const budget::MemoryBudgetArbiter::Stats& stats = m_memoryBudgetArbiter.Update(budgetMiB * 1024ull * 1024ull);
+    m_memoryBudgetArbiterActive = true;
+    TracyPlot("Memory budget demand MiB", static_cast<int64_t>(stats.demandTotalBytes >> 20));
+    TracyPlot("Memory budget cap MiB", static_cast<int64_t>(stats.capTotalBytes >> 20));
+    TracyPlot("Memory budget quality", stats.quality);
+}
+
 void Renderer::RunRenderResourceSyncStage() {
     ZoneScopedN("Renderer::Update::RenderResourceSync");
 
@@ -747,9 +810,8 @@ void Renderer::RunRenderResourceSyncStage() {
 
     if (!m_renderSyncQueriesBuilt) {
         ZoneScopedN("Renderer::Update::RenderResourceSync::BuildQueries");
-        m_renderSyncObjectQuery = world.query_builder<Components::Matrix, Components::RenderableObject, Components::ObjectDrawInfo, Components::MeshInstances>()
+        m_renderSyncObjectQuery = world.query_builder<Components::Matrix, Components::RenderableObject, Components::ObjectDrawInfo, Components::MeshInstances, const Components::RenderTransformStamp>()
             .with<Components::Active>()
-            .with<Components::RenderTransformUpdated>()
             .build();
         m_renderSyncCameraQuery = world.query_builder<Components::Matrix, Components::Camera, Components::RenderViewRef>()
             .with<Components::Active>()
@@ -757,8 +819,8 @@ void Renderer::RunRenderResourceSyncStage() {
         m_renderSyncLightQuery = world.query_builder<Components::Matrix, Components::Light>()
             .with<Components::Active>()
             .build();
-        m_renderTransformUpdatedCleanupQuery = world.query_builder<>()
-            .with<Components::RenderTransformUpdated>()
+        m_renderSyncSettlingObjectQuery = world.query_builder<Components::RenderableObject, Components::ObjectDrawInfo, const Components::RenderTransformStamp>()
+            .with<Components::Active>()
             .build();
         m_renderSyncQueriesBuilt = true;
     }
@@ -771,21 +833,47 @@ void Renderer::RunRenderResourceSyncStage() {
         Components::MeshInstances* meshInstances;
     };
     std::vector<ObjectSyncItem> objectItems;
+    // Objects that stopped moving last frame; only prevModelMatrix needs to catch up.
+    struct ObjectSettleItem {
+        Components::RenderableObject* object;
+        Components::ObjectDrawInfo* drawInfo;
+    };
+    std::vector<ObjectSettleItem> settleItems;
     {
         ZoneScopedN("Renderer::Update::RenderResourceSync::CollectObjectsAndMaterials");
+        // Transform stamps are plain columns, so this scans them instead of
+        // matching a per-frame tag that would move entities between tables.
+        const Components::RenderTransformSyncWindow window = world.get<Components::RenderTransformSyncWindow>();
         m_renderSyncObjectQuery.run([&](flecs::iter& it) {
             while (it.next()) {
                 auto matrices = it.field<Components::Matrix>(0);
                 auto objects = it.field<Components::RenderableObject>(1);
                 auto drawInfos = it.field<Components::ObjectDrawInfo>(2);
                 auto meshInstances = it.field<Components::MeshInstances>(3);
+                auto stamps = it.field<const Components::RenderTransformStamp>(4);
                 for (auto i : it) {
-                    objectItems.push_back({ &matrices[i], &objects[i], &drawInfos[i], &meshInstances[i] });
+                    if (window.IsUpdated(stamps[i])) {
+                        objectItems.push_back({ &matrices[i], &objects[i], &drawInfos[i], &meshInstances[i] });
+                    }
+                }
+            }
+        });
+        m_renderSyncSettlingObjectQuery.run([&](flecs::iter& it) {
+            while (it.next()) {
+                auto objects = it.field<Components::RenderableObject>(0);
+                auto drawInfos = it.field<Components::ObjectDrawInfo>(1);
+                auto stamps = it.field<const Components::RenderTransformStamp>(2);
+                for (auto i : it) {
+                    if (window.IsSettling(stamps[i])) {
+                        settleItems.push_back({ &objects[i], &drawInfos[i] });
+                    }
                 }
             }
         });
     }
 
+    UpdateMemoryBudget();
+
     auto* textureFactory = m_managerInterface.GetTextureFactory();
     auto* materialManager = m_managerInterface.GetMaterialManager();
     if (textureFactory && materialManager) {
@@ -795,20 +883,14 @@ void Renderer::RunRenderResourceSyncStage() {
     }
 
     auto* objectManager = m_managerInterface.GetObjectManager();
-    std::vector<std::pair<size_t, size_t>> perObjectDirtyRanges;
-    std::vector<std::pair<size_t, size_t>> normalMatrixDirtyRanges;
-    perObjectDirtyRanges.reserve(objectItems.size());
-    normalMatrixDirtyRanges.reserve(objectItems.size());
-
     {
-        ZoneScopedN("Renderer::Update::RenderResourceSync::ScanObjectDirtyRanges");
+        ZoneScopedN("Renderer::Update::RenderResourceSync::MarkObjectDirtyRanges");
         for (const auto& item : objectItems) {
-            const size_t perObjectBegin = item.drawInfo->perObjectCBView->GetOffset();
-            const size_t perObjectEnd = perObjectBegin + sizeof(PerObjectCB);
-            const size_t normalMatrixBegin = item.drawInfo->normalMatrixView->GetOffset();
-            const size_t normalMatrixEnd = normalMatrixBegin + sizeof(DirectX::XMFLOAT4X4);
-            perObjectDirtyRanges.emplace_back(perObjectBegin, perObjectEnd);
-            normalMatrixDirtyRanges.emplace_back(normalMatrixBegin, normalMatrixEnd);
+            m_perObjectDirtyRanges.Mark(item.drawInfo->perObjectCBView->GetOffset(), sizeof(PerObjectCB));
+            m_normalMatrixDirtyRanges.Mark(item.drawInfo->normalMatrixView->GetOffset(), sizeof(DirectX::XMFLOAT4X4));
+        }
+        for (const auto& item : settleItems) {
+            m_perObjectDirtyRanges.Mark(item.drawInfo->perObjectCBView->GetOffset(), sizeof(PerObjectCB));
         }
     }
 
@@ -827,10 +909,10 @@ void Renderer::RunRenderResourceSyncStage() {
                 auto* drawInfo = item.drawInfo;
                 object->perObjectCB.prevModelMatrix = object->perObjectCB.modelMatrix;
                 object->perObjectCB.modelMatrix = worldMatrix->matrix;
-                object->perObjectCB.modelInverseMatrix = XMMatrixInverse(nullptr, worldMatrix->matrix);
 
-                const XMVECTOR det = XMMatrixDeterminant(worldMatrix->matrix);
-                object->perObjectCB.objectFlags = (XMVectorGetX(det) < 0.0f) ? OBJECT_FLAG_REVERSE_WINDING : 0u;
+                const AffineInverse inverse = ComputeAffineInverse(worldMatrix->matrix);
+                object->perObjectCB.modelInverseMatrix = inverse.inverse;
+                object->perObjectCB.objectFlags = inverse.reverseWinding ? OBJECT_FLAG_REVERSE_WINDING : 0u;
 
                 // Write per-object data directly into the scratch buffer (lock-free).
                 {
@@ -839,62 +921,65 @@ void Renderer::RunRenderResourceSyncStage() {
                     std::memcpy(perObjectHandle.data + offset, &object->perObjectCB, sz);
                 }
 
-                const auto& modelMatrix = object->perObjectCB.modelMatrix;
-                const XMMATRIX upperLeft3x3 = XMMatrixSet(
-                    XMVectorGetX(modelMatrix.r[0]), XMVectorGetY(modelMatrix.r[0]), XMVectorGetZ(modelMatrix.r[0]), 0.0f,
-                    XMVectorGetX(modelMatrix.r[1]), XMVectorGetY(modelMatrix.r[1]), XMVectorGetZ(modelMatrix.r[1]), 0.0f,
-                    XMVectorGetX(modelMatrix.r[2]), XMVectorGetY(modelMatrix.r[2]), XMVectorGetZ(modelMatrix.r[2]), 0.0f,
-                    0.0f, 0.0f, 0.0f, 1.0f);
-                XMMATRIX normalMat = XMMatrixInverse(nullptr, upperLeft3x3);
-
                 // Write normal matrix directly into the scratch buffer (lock-free).
                 {
                     const size_t offset = drawInfo->normalMatrixView->GetOffset();
                     const size_t sz = sizeof(DirectX::XMFLOAT4X4);
                     DirectX::XMFLOAT4X4 stored;
-                    XMStoreFloat4x4(&stored, normalMat);
+                    XMStoreFloat4x4(&stored, inverse.normalMatrix);
                     std::memcpy(normalMatrixHandle.data + offset, &stored, sz);
                 }
             });
     }
 
+    if (auto* meshManager = m_managerInterface.GetMeshManager()) {
+        // The prefetcher places instances on the CPU; the GPU copy lives in PerObjectCB.
+        ZoneScopedN("Renderer::Update::RenderResourceSync::CLodPrefetchTransforms");
+        for (const auto& item : objectItems) {
+            for (const auto& meshInstance : item.meshInstances->meshInstances) {
+                meshManager->SetCLodInstanceWorldTransform(meshInstance.get(), item.worldMatrix->matrix);
+            }
+        }
+    }
+
+    {
+        // Inverse and normal matrix are unchanged since last frame; only the
+        // previous-frame matrix moves so motion vectors return to zero.
+        ZoneScopedN("Renderer::Update::RenderResourceSync::ObjectSettle");
+        TaskSchedulerManager::GetInstance().ParallelFor("ObjectSettle", settleItems.size(),
+            [&settleItems, &perObjectHandle](size_t idx) {
+                auto& item = settleItems[idx];
+                item.object->perObjectCB.prevModelMatrix = item.object->perObjectCB.modelMatrix;
+                std::memcpy(perObjectHandle.data + item.drawInfo->perObjectCBView->GetOffset(), &item.object->perObjectCB, sizeof(PerObjectCB));
+            });
+    }
+
     // Register dirty ranges single-threaded.
     // Upload only the range actually written this frame. Uploading the entire
     // grown backing every frame scales badly on large scenes and can starve the frame.
     {
         ZoneScopedN("Renderer::Update::RenderResourceSync::CommitObjectBulkWrites");
-        const auto commitRanges = [](auto& ranges, auto&& commit) {
-            if (ranges.empty()) {
-                return;
+        // Nearby runs are merged by the trackers, so scattered updates cost a
+        // handful of copies rather than one per object.
+        const auto commitRanges = [this](DirtyRangeTracker& tracker, const char* changedPlot, const char* uploadedPlot, auto&& commit) {
+            tracker.CollectRanges(m_objectUploadRanges);
+            for (const DirtyRangeTracker::Range& range : m_objectUploadRanges) {
+                commit(range.offset, range.size);
             }
-            std::sort(ranges.begin(), ranges.end(), [](const auto& lhs, const auto& rhs) {
-                return lhs.first < rhs.first;
-            });
-
-            size_t begin = ranges.front().first;
-            size_t end = ranges.front().second;
-            for (size_t i = 1; i < ranges.size(); ++i) {
-                const auto [nextBegin, nextEnd] = ranges[i];
-                if (nextBegin <= end) {
-                    end = std::max(end, nextEnd);
-                    continue;
-                }
-                commit(begin, end - begin);
-                begin = nextBegin;
-                end = nextEnd;
-            }
-            commit(begin, end - begin);
+            const DirtyRangeTracker::Stats& stats = tracker.GetLastStats();
+            TracyPlot(changedPlot, static_cast<int64_t>(stats.changedBytes));
+            TracyPlot(uploadedPlot, static_cast<int64_t>(stats.uploadedBytes));
         };
 
         {
             ZoneScopedN("Renderer::Update::RenderResourceSync::CommitPerObjectRanges");
-            commitRanges(perObjectDirtyRanges, [objectManager](size_t offset, size_t size) {
+            commitRanges(m_perObjectDirtyRanges, "PerObject changed bytes", "PerObject uploaded bytes", [objectManager](size_t offset, size_t size) {
                 objectManager->EndPerObjectBulkWrite(offset, size);
             });
         }
         {
             ZoneScopedN("Renderer::Update::RenderResourceSync::CommitNormalMatrixRanges");
-            commitRanges(normalMatrixDirtyRanges, [objectManager](size_t offset, size_t size) {
+            commitRanges(m_normalMatrixDirtyRanges, "NormalMatrix changed bytes", "NormalMatrix uploaded bytes", [objectManager](size_t offset, size_t size) {
                 objectManager->EndNormalMatrixBulkWrite(offset, size);
             });
         }
@@ -902,6 +987,7 @@ void Renderer::RunRenderResourceSyncStage() {
 
     {
         ZoneScopedN("Renderer::Update::RenderResourceSync::CameraSync");
+        m_clodPrefetchCameraValid = false;
         m_renderSyncCameraQuery.each([&](flecs::entity entity, Components::Matrix& worldMatrix, Components::Camera& camera, Components::RenderViewRef& renderView) {
             const XMMATRIX cameraModel = RemoveScalingFromMatrix(worldMatrix.matrix);
             const XMMATRIX view = XMMatrixInverse(nullptr, cameraModel);
@@ -932,12 +1018,37 @@ void Renderer::RunRenderResourceSyncStage() {
             camera.info.positionWorldSpace = { pos.x, pos.y, pos.z, 1.0f };
 
             m_managerInterface.GetViewManager()->UpdateCamera(renderView.viewID, camera.info);
+
+            if (entity.has<Components::PrimaryCamera>()) {
+                // Same threshold as the culling camera at one pixel of error.
+                const float projY = XMVectorGetY(projection.r[1]);
+                const float denom = projY * 0.5f * static_cast<float>(camera.info.depthResY);
+                XMFLOAT3 forward;
+                XMStoreFloat3(&forward, XMVector3Normalize(XMVectorNegate(cameraModel.r[2])));
+                CLodPrefetchCameraPose& pose = m_clodPrefetchCamera;
+                pose.position[0] = pos.x;
+                pose.position[1] = pos.y;
+                pose.position[2] = pos.z;
+                pose.forward[0] = forward.x;
+                pose.forward[1] = forward.y;
+                pose.forward[2] = forward.z;
+                pose.errorOverDistanceThreshold = denom > 0.0f ? 1.0f / denom : 0.0f;
+                pose.tanHalfFovY = projY > 0.0f ? 1.0f / projY : 1.0f;
+                pose.aspectRatio = camera.info.aspectRatio;
+                pose.zNear = camera.info.zNear;
+                pose.isOrtho = camera.info.isOrtho != 0u;
+                m_clodPrefetchCameraValid = denom > 0.0f;
+            }
         });
     }
 
     {
         ZoneScopedN("Renderer::Update::RenderResourceSync::LightSync");
+        std::vector<flecs::entity> shadowLights;
         m_renderSyncLightQuery.each([&](flecs::entity entity, Components::Matrix& worldMatrix, Components::Light& light) {
+            const XMVECTOR previousPosition = light.lightInfo.posWorldSpace;
+            const XMVECTOR previousDirection = light.lightInfo.dirWorldSpace;
+            const BoundingSphere previousBounds = light.lightInfo.boundingSphere;
             const XMVECTOR worldForward = XMVectorSet(0.0f, 0.0f, 1.0f, 0.0f);
             light.lightInfo.dirWorldSpace = XMVector3Normalize(XMVector3TransformNormal(worldForward, worldMatrix.matrix));
             light.lightInfo.posWorldSpace = XMVectorSet(
@@ -961,11 +1072,18 @@ void Renderer::RunRenderResourceSyncStage() {
             }
 
             if (light.lightInfo.shadowCaster && entity.has<Components::LightViewInfo>()) {
-                const Components::LightViewInfo& viewInfo = entity.get<Components::LightViewInfo>();
-                m_managerInterface.GetLightManager()->UpdateLightBufferView(viewInfo.lightBufferView.get(), light.lightInfo);
-                m_managerInterface.GetLightManager()->UpdateLightViewInfo(entity);
+                // Unmoved lights keep their uploaded LightInfo.
+                const bool moved = !XMVector4Equal(previousPosition, light.lightInfo.posWorldSpace)
+                    || !XMVector4Equal(previousDirection, light.lightInfo.dirWorldSpace)
+                    || std::memcmp(&previousBounds, &light.lightInfo.boundingSphere, sizeof(BoundingSphere)) != 0;
+                if (moved) {
+                    const Components::LightViewInfo& viewInfo = entity.get<Components::LightViewInfo>();
+                    m_managerInterface.GetLightManager()->UpdateLightBufferView(viewInfo.lightBufferView.get(), light.lightInfo);
+                }
+                shadowLights.push_back(entity);
             }
         });
+        m_managerInterface.GetLightManager()->UpdateLightViewInfos(shadowLights);
     }
 
 }
@@ -1219,6 +1337,8 @@ void Renderer::SetSettings() {
     settingsManager.registerSetting<bool>("heavyDebug", false);
     settingsManager.registerSetting<uint32_t>(CLodStreamingCpuUploadBudgetSettingName, 500u);
     settingsManager.registerSetting<bool>(CLodStreamingEnableDirectStorageSettingName, true);
+    settingsManager.registerSetting<uint32_t>(CLodStreamingReadCoalesceGapBytesSettingName, 64u * 1024u);
+    settingsManager.registerSetting<uint32_t>(CLodStreamingReadCoalesceMaxBytesSettingName, 1024u * 1024u);
     settingsManager.registerSetting<bool>(CLodDisableReyesRasterizationSettingName, true);
 	settingsManager.registerSetting<bool>(CLodDisableVirtualShadowPageCachingSettingName, false);
     settingsManager.registerSetting<uint32_t>(CLodDirectionalVirtualShadowMaxBackingResolutionSettingName, CLodVirtualShadowDefaultBackingResolution);
@@ -1234,10 +1354,23 @@ void Renderer::SetSettings() {
     settingsManager.registerSetting<float>(CLodDirectionalVirtualShadowSmrtRayLengthScaleDirectionalSettingName, CLodVirtualShadowDefaultSmrtRayLengthScaleDirectional);
     settingsManager.registerSetting<float>(CLodDirectionalVirtualShadowSmrtMaxTraceDistanceWorldSettingName, CLodVirtualShadowDefaultSmrtMaxTraceDistanceWorld);
 	settingsManager.registerSetting<uint32_t>(CLodReyesResourceBudgetBytesSettingName, 512u*1024u*1024u); // 500 MB for reyes
-	settingsManager.registerSetting<uint32_t>("usdPointInstancerMaxInstances", 10000u);
+    settingsManager.registerSetting<uint64_t>(CLodStreamingResidentBudgetBytesSettingName, 0ull);
+    settingsManager.registerSetting<bool>(CLodStreamingPrefetchEnabledSettingName, true);
+    settingsManager.registerSetting<uint32_t>(CLodStreamingPrefetchLookaheadFramesSettingName, 8u);
+    settingsManager.registerSetting<uint32_t>(CLodStreamingPrefetchMaxRequestsSettingName, 64u);
+    settingsManager.registerSetting<std::function<bool(CLodPrefetchCameraPose&)>>(CLodStreamingPrefetchCameraGetterSettingName, [this](CLodPrefetchCameraPose& outPose) -> bool {
+        outPose = m_clodPrefetchCamera;
+        return m_clodPrefetchCameraValid;
+        });
+    settingsManager.registerSetting<uint32_t>("frameMemoryBudgetMiB", 0u); // 0 = each streaming pool sizes itself
+	settingsManager.registerSetting<uint32_t>("usdPointInstancerMaxInstances", 10000u); // Instances materialized at once per PointInstancer; 0 = unlimited
+	settingsManager.registerSetting<bool>("parallelImportTextureDecode", true);
     getShadowResolution = settingsManager.getSettingGetter<uint16_t>("shadowResolution");
+    getFrameMemoryBudgetMiB = settingsManager.getSettingGetter<uint32_t>("frameMemoryBudgetMiB");
+    m_setCLodStreamingResidentBudgetBytes = settingsManager.getSettingSetter<uint64_t>(CLodStreamingResidentBudgetBytesSettingName);
+    SetupMemoryBudgetArbiter();
     setCameraSpeed = settingsManager.getSettingSetter<float>("cameraSpeed");
-	getCameraSpeed = settingsManager.getSettingGetter<float>("cameraSpeed");
+	m_cameraSpeedSetting = settingsManager.getSettingHandle<float>("cameraSpeed");
 	setWireframeEnabled = settingsManager.getSettingSetter<bool>("enableWireframe");
 	getWireframeEnabled = settingsManager.getSettingGetter<bool>("enableWireframe");
 	setShadowsEnabled = settingsManager.getSettingSetter<bool>("enableShadows");
@@ -1249,6 +1382,10 @@ void Renderer::SetSettings() {
 	getIndirectDrawsEnabled = settingsManager.getSettingGetter<bool>("enableIndirectDraws");
 	getDrawBoundingSpheres = settingsManager.getSettingGetter<bool>("drawBoundingSpheres");
 	getImageBasedLightingEnabled = settingsManager.getSettingGetter<bool>("enableImageBasedLighting");
+	m_renderResolutionSetting = settingsManager.getSettingHandle<DirectX::XMUINT2>("renderResolution");
+	m_outputResolutionSetting = settingsManager.getSettingHandle<DirectX::XMUINT2>("outputResolution");
+	m_renderGraphBatchTraceSetting = settingsManager.getSettingHandle<bool>("renderGraphBatchTraceEnabled");
+	settingsManager.publishSnapshot();
     
 
     m_settingsSubscriptions.push_back(settingsManager.addObserver<bool>("enableShadows", [this](const bool& newValue) {
@@ -1495,6 +1632,7 @@ void Renderer::ToggleMeshShaders(bool useMeshShaders) {
             for (auto& meshInstance : meshInstances->meshInstances) {
                 m_pMeshManager->RemoveMeshInstance(meshInstance.get());
                 m_pMeshManager->AddMeshInstance(meshInstance.get(), useMeshShaders);
+                m_pMeshManager->SetCLodInstanceWorldTransform(meshInstance.get(), object.perObjectCB.modelMatrix);
             }
         }
 
@@ -1726,6 +1864,9 @@ void Renderer::Update(float elapsedSeconds) {
 
     BeginFrameTaskGraphCapture();
 
+    // Freeze this frame's settings; worker tasks read them from the snapshot.
+    SettingsManager::GetInstance().publishSnapshot();
+
     const auto runCapturedStage = [this](const char* stageName, auto&& stageFn) {
         const auto stageStart = std::chrono::steady_clock::now();
         stageFn();
@@ -1867,6 +2008,11 @@ void Renderer::Update(float elapsedSeconds) {
     RendererUpdateHostData updateHostData;
     updateHostData.data = &updateData;
 
+    runCapturedStage("CommitDrawSets", [&]() {
+        ZoneScopedN("Renderer::Update::CommitDrawSets");
+        m_pObjectManager->CommitDrawSetChanges();
+    });
+
     runCapturedStage("FlushUploadPolicies", [&]() {
         ZoneScopedN("Renderer::Update::FlushUploadPolicies");
         rg::runtime::FlushUploadPolicies();
@@ -1886,13 +2032,15 @@ void Renderer::Update(float elapsedSeconds) {
     });
     ProbeGraphicsCommandListCreation(deviceManager.GetDevice(), "after RenderGraphUpdate");
 
-    // Clear transform-update tags only after render-graph update so passes such as
-    // virtual shadow invalidation can still consume same-frame movement signals.
-    world.defer_begin();
-    m_renderTransformUpdatedCleanupQuery.each([](flecs::entity e) {
-        e.remove<Components::RenderTransformUpdated>();
-    });
-    world.defer_end();
+    // Advance the transform window only after render-graph update so passes such
+    // as virtual shadow invalidation still see same-frame movement. Objects
+    // synced this frame get one settle visit next frame; objects that just
+    // settled drop out of object sync until they are stamped again.
+    {
+        auto& window = world.get_mut<Components::RenderTransformSyncWindow>();
+        window.settlingAfter = window.updatedAfter;
+        window.updatedAfter = m_sceneRenderBridge.GetIngestionFrame();
+    }
 
     runCapturedStage("ScheduleSceneUpdate", [&]() {
         ZoneScopedN("Renderer::Update::ScheduleSceneUpdate");
@@ -1962,14 +2110,15 @@ void Renderer::Render() {
         return;
     }
 
-    const bool renderGraphBatchTraceEnabled = SettingsManager::GetInstance().getSettingGetter<bool>("renderGraphBatchTraceEnabled")();
+    auto& settingsManager = SettingsManager::GetInstance();
+    const bool renderGraphBatchTraceEnabled = settingsManager.get(m_renderGraphBatchTraceSetting);
 
     const uint8_t renderedFrameIndex = m_frameIndex;
 
     auto& world = RendererECSManager::GetInstance().GetWorld();
 	const Components::DrawStats& drawStats = world.get<Components::DrawStats>();
-    auto renderRes = SettingsManager::GetInstance().getSettingGetter<DirectX::XMUINT2>("renderResolution")();
-    auto outputRes = SettingsManager::GetInstance().getSettingGetter<DirectX::XMUINT2>("outputResolution")();
+    auto renderRes = settingsManager.get(m_renderResolutionSetting);
+    auto outputRes = settingsManager.get(m_outputResolutionSetting);
 
     auto& deviceManager = DeviceManager::GetInstance();
 
@@ -2196,7 +2345,7 @@ void Renderer::Cleanup() {
 	m_renderSyncObjectQuery = {};
 	m_renderSyncCameraQuery = {};
 	m_renderSyncLightQuery = {};
-	m_renderTransformUpdatedCleanupQuery = {};
+	m_renderSyncSettlingObjectQuery = {};
 	m_renderSyncQueriesBuilt = false;
 	spdlog::info("Cleaning up resources");
     if (currentRenderGraph) {
@@ -2276,6 +2425,7 @@ void Renderer::Cleanup() {
 	spdlog::info("Cleaning up swap chain");
     m_swapChain.Reset();
 	spdlog::info("Cleaning up device manager");
+    AsyncFileIoManager::GetInstance().Cleanup();
     DirectStorageManager::GetInstance().Cleanup();
     DeviceManager::GetInstance().Cleanup();
 	spdlog::info("Cleanup complete");
@@ -2378,32 +2528,32 @@ void Renderer::SetupInputHandlers() {
 	auto& context = *inputManager.GetCurrentContext();
     context.SetActionHandler(InputAction::MoveForward, [this](float magnitude, const InputData& inputData) {
         //spdlog::info("Moving forward!");
-        movementState.forwardMagnitude = magnitude * getCameraSpeed();
+        movementState.forwardMagnitude = magnitude * SettingsManager::GetInstance().get(m_cameraSpeedSetting);
         });
 
     context.SetActionHandler(InputAction::MoveBackward, [this](float magnitude, const InputData& inputData) {
         //spdlog::info("Moving forward!");
-        movementState.backwardMagnitude = magnitude * getCameraSpeed();
+        movementState.backwardMagnitude = magnitude * SettingsManager::GetInstance().get(m_cameraSpeedSetting);
         });
 
     context.SetActionHandler(InputAction::MoveRight, [this](float magnitude, const InputData& inputData) {
         //spdlog::info("Moving right!");
-        movementState.rightMagnitude = magnitude * getCameraSpeed();
+        movementState.rightMagnitude = magnitude * SettingsManager::GetInstance().get(m_cameraSpeedSetting);
         });
 
     context.SetActionHandler(InputAction::MoveLeft, [this](float magnitude, const InputData& inputData) {
         //spdlog::info("Moving right!");
-        movementState.leftMagnitude = magnitude * getCameraSpeed();
+        movementState.leftMagnitude = magnitude * SettingsManager::GetInstance().get(m_cameraSpeedSetting);
         });
 
     context.SetActionHandler(InputAction::MoveUp, [this](float magnitude, const InputData& inputData) {
         //spdlog::info("Moving up!");
-        movementState.upMagnitude = magnitude * getCameraSpeed();
+        movementState.upMagnitude = magnitude * SettingsManager::GetInstance().get(m_cameraSpeedSetting);
         });
 
     context.SetActionHandler(InputAction::MoveDown, [this](float magnitude, const InputData& inputData) {
         //spdlog::info("Moving up!");
-        movementState.downMagnitude = magnitude * getCameraSpeed();
+        movementState.downMagnitude = magnitude * SettingsManager::GetInstance().get(m_cameraSpeedSetting);
         });
 
     context.SetActionHandler(InputAction::RotateCamera, [this](float magnitude, const InputData& inputData) {
@@ -0,0 +1,142 @@
+#include "Resources/Buffers/DrawSetIndexBuffer.h"
+
+#include <algorithm>
+
+#include "Resources/ExternalBackingResource.h"
+#include "Resources/GPUBacking/GpuBufferBacking.h"
+#include "Render/Runtime/UploadServiceAccess.h"
+#include "Render/Runtime/UploadPolicyServiceAccess.h"
+#include "Managers/Singletons/DeviceManager.h"
+
+void DrawSetIndexBuffer::OnSetName() {
+    if (!m_dataBuffer) {
+        return;
+    }
+
+    if (name != "") {
+        m_dataBuffer->SetName((m_name + ": " + name).c_str());
+    }
+    else {
+        m_dataBuffer->SetName(m_name.c_str());
+    }
+}
+
+void DrawSetIndexBuffer::Commit() {
+    m_lastCommitStats = {};
+    if (!m_membership.HasPendingChanges()) {
+        return;
+    }
+
+    const uint32_t size = m_membership.Size();
+    if (size > m_capacity) {
+        uint64_t newCapacity = (std::max)(m_capacity, uint64_t{ 1 });
+        while (newCapacity < size) {
+            newCapacity *= 2;
+        }
+        GrowBuffer(newCapacity);
+    }
+
+    const uint32_t previousSize = m_membership.GetCommittedSize();
+    m_membership.CollectDirtySpans(m_dirtySpans);
+
+    const unsigned int* data = m_membership.Data();
+    for (const DrawSetMembership::Span& span : m_dirtySpans) {
+        StageOrUpload(
+            data + span.firstSlot,
+            sizeof(unsigned int) * span.slotCount,
+            static_cast<size_t>(span.firstSlot) * sizeof(unsigned int));
+        ++m_lastCommitStats.spans;
+        m_lastCommitStats.uploadedSlots += span.slotCount;
+    }
+
+    // Clear slots vacated by net removals (not strictly required if readers clamp to Size())
+    if (size < previousSize) {
+        const uint32_t staleCount = previousSize - size;
+        m_zeroes.assign(staleCount, 0u);
+        StageOrUpload(m_zeroes.data(), sizeof(unsigned int) * staleCount, static_cast<size_t>(size) * sizeof(unsigned int));
+        ++m_lastCommitStats.spans;
+        m_lastCommitStats.uploadedSlots += staleCount;
+    }
+}
+
+void DrawSetIndexBuffer::StageOrUpload(const void* data, size_t size, size_t offset) {
+    if (GetUploadPolicyTag() != rg::runtime::UploadPolicyTag::Immediate
+        && rg::runtime::GetActiveUploadPolicyService() == nullptr) {
+        BUFFER_UPLOAD(data, size, rg::runtime::UploadTarget::FromShared(shared_from_this()), offset);
+        return;
+    }
+
+    SyncUploadPolicyState();
+    EnsureUploadPolicyRegistration();
+
+#if BUILD_TYPE == BUILD_TYPE_DEBUG
+    const bool staged = m_uploadPolicyState.StageWrite(data, size, offset, GetBufferSize(), __FILE__, __LINE__);
+#else
+    const bool staged = m_uploadPolicyState.StageWrite(data, size, offset, GetBufferSize());
+#endif
+    if (staged) {
+        MarkUploadPolicyDirty();
+        return;
+    }
+
+    BUFFER_UPLOAD(data, size, rg::runtime::UploadTarget::FromShared(shared_from_this()), offset);
+}
+
+void DrawSetIndexBuffer::CreateBuffer(uint64_t capacity) {
+    m_capacity = capacity;
+    auto newDataBuffer = GpuBufferBacking::CreateUnique(rhi::HeapType::DeviceLocal, capacity * sizeof(unsigned int), GetGlobalResourceID(), m_UAV);
+    SetBacking(std::move(newDataBuffer), capacity * sizeof(unsigned int));
+    m_uploadPolicyState.OnBufferResized(GetBufferSize());
+
+    for (const auto& bundle : m_metadataBundles) {
+        ApplyMetadataToBacking(bundle);
+    }
+
+    AssignDescriptorSlots();
+}
+
+void DrawSetIndexBuffer::GrowBuffer(uint64_t newSize) {
+    auto newDataBuffer = GpuBufferBacking::CreateUnique(rhi::HeapType::DeviceLocal, newSize * sizeof(unsigned int), GetGlobalResourceID(), m_UAV);
+    // Only the committed prefix is live on the GPU; everything past it is rewritten by this commit.
+    const uint64_t liveBytes = static_cast<uint64_t>(m_membership.GetCommittedSize()) * sizeof(unsigned int);
+    if (m_dataBuffer) {
+        auto oldBackingResource = ExternalBackingResource::CreateShared(std::move(m_dataBuffer));
+        if (liveBytes != 0) {
+            if (auto* uploadService = rg::runtime::GetActiveUploadService()) {
+                uploadService->QueueResourceCopy(shared_from_this(), oldBackingResource, liveBytes);
+            }
+        }
+    }
+    SetBacking(std::move(newDataBuffer), newSize * sizeof(unsigned int));
+    m_uploadPolicyState.OnBufferResized(GetBufferSize());
+
+    m_capacity = newSize;
+    AssignDescriptorSlots();
+    SetName(name);
+}
+
+void DrawSetIndexBuffer::AssignDescriptorSlots()
+{
+    BufferBase::DescriptorRequirements requirements{};
+
+    const uint32_t numElements = static_cast<uint32_t>(m_capacity);
+
+    requirements.createCBV = false;
+    requirements.createSRV = true;
+    requirements.createUAV = false;
+    requirements.createNonShaderVisibleUAV = false;
+    requirements.uavCounterOffset = 0;
+
+    requirements.srvDesc = rhi::SrvDesc{
+        .dimension = rhi::SrvDim::Buffer,
+        .formatOverride = rhi::Format::Unknown,
+        .buffer = {
+            .kind = rhi::BufferViewKind::Structured,
+            .firstElement = 0,
+            .numElements = numElements,
+            .structureByteStride = 4,
+        },
+    };
+
+    SetDescriptorRequirements(requirements);
+}
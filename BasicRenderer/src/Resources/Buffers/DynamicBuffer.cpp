@@ -9,42 +9,26 @@
 #include "Render/Runtime/UploadServiceAccess.h"
 #include "Render/Runtime/UploadPolicyServiceAccess.h"
 
+const std::weak_ptr<ViewedDynamicBufferBase>& DynamicBuffer::GetCachedWeakPtr() {
+	// Cache the weak pointer to avoid repeated dynamic_pointer_cast
+	if (!m_weakPtrCached) {
+		m_cachedWeakPtr = std::weak_ptr(
+			std::dynamic_pointer_cast<DynamicBuffer>(Resource::weak_from_this().lock())
+		);
+		m_weakPtrCached = true;
+	}
+	return m_cachedWeakPtr;
+}
+
 std::unique_ptr<BufferView> DynamicBuffer::Allocate(size_t size, size_t elementSize) {
 	size_t requiredSize = size;
 
-	// Search for a free block using the size-indexed set - O(log n)
-	auto freeIt = m_freeBlocks.lower_bound({ requiredSize, 0 });
-	if (freeIt != m_freeBlocks.end())
+	// Two-level segregated-fit lookup - O(1)
+	uint64_t blockOffset = 0;
+	uint32_t handle = m_allocator.Allocate(requiredSize, blockOffset);
+	if (handle != TlsfAllocator::kInvalidHandle)
 	{
-		size_t blockOffset = freeIt->second;
-
-		// Remove from free index
-		m_freeBlocks.erase(freeIt);
-
-		// Update block in the offset map
-		auto& block = m_blocksByOffset[blockOffset];
-		size_t remainingSize = block.size - requiredSize;
-
-		block.isFree = false;
-		block.size = requiredSize;
-
-		if (remainingSize > 0)
-		{
-			// Split the block
-			size_t newOffset = blockOffset + requiredSize;
-			m_blocksByOffset[newOffset] = { newOffset, remainingSize, true };
-			m_freeBlocks.insert({ remainingSize, newOffset });
-		}
-
-		// Cache the weak pointer to avoid repeated dynamic_pointer_cast
-		if (!m_weakPtrCached) {
-			m_cachedWeakPtr = std::weak_ptr(
-				std::dynamic_pointer_cast<DynamicBuffer>(Resource::weak_from_this().lock())
-			);
-			m_weakPtrCached = true;
-		}
-        // Return BufferView
-        return BufferView::CreateUnique(m_cachedWeakPtr, blockOffset, requiredSize, elementSize);
+		return BufferView::CreateUnique(GetCachedWeakPtr(), blockOffset, requiredSize, elementSize, handle);
 	}
 
 	// No suitable block found, need to grow the buffer
@@ -56,31 +40,34 @@ std::unique_ptr<BufferView> DynamicBuffer::Allocate(size_t size, size_t elementS
         elementSize,
         m_capacity);
 
-	// Absorb the last block if it is free
+	// The allocator folds the new space into a free tail block, so only grow by what it lacks
     size_t previousCapacity = m_capacity;
 	size_t newBlockSize = (std::max)(m_capacity, requiredSize);
-	size_t growBy = newBlockSize;
-    size_t newBlockOffset = previousCapacity;
-	if (!m_blocksByOffset.empty())
-	{
-		auto lastIt = std::prev(m_blocksByOffset.end());
-		if (lastIt->second.isFree)
-		{
-            newBlockOffset = lastIt->second.offset;
-			growBy -= lastIt->second.size;
-			m_freeBlocks.erase({ lastIt->second.size, lastIt->second.offset });
-			m_blocksByOffset.erase(lastIt);
-		}
-	}
+	size_t trailingFree = static_cast<size_t>(m_allocator.GetTrailingFreeBytes());
+	size_t growBy = newBlockSize > trailingFree ? newBlockSize - trailingFree : 0;
     size_t newCapacity = DynamicBuffer::AlignBufferCapacity(previousCapacity + growBy, m_byteAddress);
 
 	GrowBuffer(newCapacity);
-    size_t trackedFreeSize = m_capacity - newBlockOffset;
-    m_blocksByOffset[newBlockOffset] = { newBlockOffset, trackedFreeSize, true };
-    m_freeBlocks.insert({ trackedFreeSize, newBlockOffset });
+	m_allocator.Grow(m_capacity);
 	spdlog::info("Growing buffer to {} bytes", newCapacity);
-	// Try allocating again
-    return Allocate(size, elementSize);
+
+	handle = m_allocator.Allocate(requiredSize, blockOffset);
+	if (handle == TlsfAllocator::kInvalidHandle) {
+		spdlog::error("DynamicBuffer '{}' id={} failed to allocate {} bytes after growing to {}", m_name, GetGlobalResourceID(), requiredSize, m_capacity);
+		return nullptr;
+	}
+	return BufferView::CreateUnique(GetCachedWeakPtr(), blockOffset, requiredSize, elementSize, handle);
+}
+
+std::unique_ptr<BufferView> DynamicBuffer::ApplyDefragmentationMove(const BufferView* view, const TlsfAllocator::Move& move) {
+	if (view == nullptr || view->GetOffset() != move.sourceOffset || view->GetSize() != move.size) {
+		spdlog::warn("DynamicBuffer '{}': defragmentation move does not match the supplied view", m_name);
+		return nullptr;
+	}
+
+	auto moved = BufferView::CreateUnique(GetCachedWeakPtr(), move.destinationOffset, move.size, view->GetElementSize(), move.destinationHandle);
+	Deallocate(view);
+	return moved;
 }
 
 std::unique_ptr<BufferView> DynamicBuffer::AddData(const void* data, size_t size, size_t elementSize, size_t fullAllocationSize) {
@@ -133,42 +120,8 @@ void DynamicBuffer::Deallocate(const BufferView* view) {
         return;
     }
 
-    size_t offset = view->GetOffset();
-    size_t size = view->GetSize();
-
-    // Find the block by offset - O(log n)
-    auto it = m_blocksByOffset.find(offset);
-    if (it == m_blocksByOffset.end() || it->second.size != size || it->second.isFree)
-    {
-        return;
-    }
-
-    it->second.isFree = true;
-
-    // Coalesce with next block if free
-    auto nextIt = std::next(it);
-    if (nextIt != m_blocksByOffset.end() && nextIt->second.isFree)
-    {
-        m_freeBlocks.erase({ nextIt->second.size, nextIt->second.offset });
-        it->second.size += nextIt->second.size;
-        m_blocksByOffset.erase(nextIt);
-    }
-
-    // Coalesce with previous block if free
-    if (it != m_blocksByOffset.begin())
-    {
-        auto prevIt = std::prev(it);
-        if (prevIt->second.isFree)
-        {
-            m_freeBlocks.erase({ prevIt->second.size, prevIt->second.offset });
-            prevIt->second.size += it->second.size;
-            m_blocksByOffset.erase(it);
-            it = prevIt;
-        }
-    }
-
-    // Add the (possibly coalesced) block to the free index
-    m_freeBlocks.insert({ it->second.size, it->second.offset });
+    // Rejects views whose handle no longer describes a live block here - O(1)
+    m_allocator.Free(view->GetAllocationHandle(), view->GetOffset(), view->GetSize());
 }
 
 void DynamicBuffer::AssignDescriptorSlots()
@@ -216,8 +169,7 @@ void DynamicBuffer::CreateBuffer(size_t capacity) {
 	auto newDataBuffer = GpuBufferBacking::CreateUnique(rhi::HeapType::DeviceLocal, capacity, GetGlobalResourceID(), m_UAV);
 	SetBacking(std::move(newDataBuffer), capacity);
 	m_uploadPolicyState.OnBufferResized(GetBufferSize());
-	m_blocksByOffset[0] = { 0, capacity, true };
-	m_freeBlocks.insert({ capacity, 0 });
+	m_allocator.Grow(capacity);
 
 	for (const auto& bundle : m_metadataBundles) {
 		ApplyMetadataToBacking(bundle);
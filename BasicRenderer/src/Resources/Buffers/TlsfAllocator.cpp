@@ -0,0 +1,353 @@
+#include "Resources/Buffers/TlsfAllocator.h"
+
+#include <algorithm>
+#include <bit>
+
+TlsfAllocator::TlsfAllocator(uint64_t capacity) {
+    for (auto& firstLevel : m_freeHeads) {
+        std::fill(std::begin(firstLevel), std::end(firstLevel), kInvalidHandle);
+    }
+    Grow(capacity);
+}
+
+void TlsfAllocator::MapSize(uint64_t size, uint32_t& outFirstLevel, uint32_t& outSecondLevel) {
+    if (size < kSmallBlockSize) {
+        outFirstLevel = 0;
+        outSecondLevel = static_cast<uint32_t>(size);
+        return;
+    }
+
+    const uint32_t msb = 63u - static_cast<uint32_t>(std::countl_zero(size));
+    outFirstLevel = msb - kSecondLevelBits + 1u;
+    outSecondLevel = static_cast<uint32_t>(size >> (msb - kSecondLevelBits)) ^ kSecondLevelCount;
+}
+
+uint32_t TlsfAllocator::FindFreeBlock(uint64_t size) const {
+    // Round the request up to the next class boundary so the head of any
+    // non-empty class at or above it fits without inspecting the list.
+    uint64_t rounded = size;
+    if (size >= kSmallBlockSize) {
+        const uint32_t msb = 63u - static_cast<uint32_t>(std::countl_zero(size));
+        const uint64_t roundUp = (1ull << (msb - kSecondLevelBits)) - 1ull;
+        rounded = size > ~0ull - roundUp ? size : size + roundUp;
+    }
+
+    uint32_t firstLevel = 0;
+    uint32_t secondLevel = 0;
+    MapSize(rounded, firstLevel, secondLevel);
+
+    uint32_t secondLevelMap = m_secondLevelBitmaps[firstLevel] & (~0u << secondLevel);
+    if (secondLevelMap == 0) {
+        const uint64_t firstLevelMap = firstLevel + 1u < 64u ? (m_firstLevelBitmap & (~0ull << (firstLevel + 1u))) : 0ull;
+        if (firstLevelMap != 0) {
+            firstLevel = static_cast<uint32_t>(std::countr_zero(firstLevelMap));
+            secondLevelMap = m_secondLevelBitmaps[firstLevel];
+        }
+    }
+    if (secondLevelMap != 0) {
+        return m_freeHeads[firstLevel][std::countr_zero(secondLevelMap)];
+    }
+
+    // Nothing in the classes above; the request's own class may still hold a
+    // block that fits. Checking it avoids growing while usable space remains.
+    MapSize(size, firstLevel, secondLevel);
+    for (uint32_t index = m_freeHeads[firstLevel][secondLevel]; index != kInvalidHandle; index = m_blocks[index].nextFree) {
+        if (m_blocks[index].size >= size) {
+            return index;
+        }
+    }
+    return kInvalidHandle;
+}
+
+uint32_t TlsfAllocator::AcquireNode() {
+    if (!m_unusedNodes.empty()) {
+        const uint32_t index = m_unusedNodes.back();
+        m_unusedNodes.pop_back();
+        m_blocks[index] = Block{};
+        m_blocks[index].inUse = true;
+        return index;
+    }
+
+    m_blocks.push_back(Block{});
+    m_blocks.back().inUse = true;
+    return static_cast<uint32_t>(m_blocks.size() - 1u);
+}
+
+void TlsfAllocator::ReleaseNode(uint32_t index) {
+    m_blocks[index].inUse = false;
+    m_unusedNodes.push_back(index);
+}
+
+void TlsfAllocator::InsertFree(uint32_t index) {
+    Block& block = m_blocks[index];
+    uint32_t firstLevel = 0;
+    uint32_t secondLevel = 0;
+    MapSize(block.size, firstLevel, secondLevel);
+
+    const uint32_t head = m_freeHeads[firstLevel][secondLevel];
+    block.isFree = true;
+    block.prevFree = kInvalidHandle;
+    block.nextFree = head;
+    if (head != kInvalidHandle) {
+        m_blocks[head].prevFree = index;
+    }
+    m_freeHeads[firstLevel][secondLevel] = index;
+    m_firstLevelBitmap |= 1ull << firstLevel;
+    m_secondLevelBitmaps[firstLevel] |= 1u << secondLevel;
+    ++m_freeBlockCount;
+}
+
+void TlsfAllocator::RemoveFree(uint32_t index) {
+    Block& block = m_blocks[index];
+    uint32_t firstLevel = 0;
+    uint32_t secondLevel = 0;
+    MapSize(block.size, firstLevel, secondLevel);
+
+    if (block.prevFree != kInvalidHandle) {
+        m_blocks[block.prevFree].nextFree = block.nextFree;
+    }
+    else {
+        m_freeHeads[firstLevel][secondLevel] = block.nextFree;
+        if (block.nextFree == kInvalidHandle) {
+            m_secondLevelBitmaps[firstLevel] &= ~(1u << secondLevel);
+            if (m_secondLevelBitmaps[firstLevel] == 0) {
+                m_firstLevelBitmap &= ~(1ull << firstLevel);
+            }
+        }
+    }
+    if (block.nextFree != kInvalidHandle) {
+        m_blocks[block.nextFree].prevFree = block.prevFree;
+    }
+    block.isFree = false;
+    block.prevFree = kInvalidHandle;
+    block.nextFree = kInvalidHandle;
+    --m_freeBlockCount;
+}
+
+uint32_t TlsfAllocator::UseFreeBlock(uint32_t index, uint64_t size) {
+    RemoveFree(index);
+
+    const uint64_t remaining = m_blocks[index].size - size;
+    if (remaining > 0) {
+        const uint32_t rest = AcquireNode();
+        Block& block = m_blocks[index];
+        Block& restBlock = m_blocks[rest];
+        restBlock.offset = block.offset + size;
+        restBlock.size = remaining;
+        restBlock.prevPhysical = index;
+        restBlock.nextPhysical = block.nextPhysical;
+        if (block.nextPhysical != kInvalidHandle) {
+            m_blocks[block.nextPhysical].prevPhysical = rest;
+        }
+        else {
+            m_lastPhysical = rest;
+        }
+        block.nextPhysical = rest;
+        block.size = size;
+        InsertFree(rest);
+    }
+
+    m_allocatedBytes += size;
+    ++m_allocationCount;
+    return index;
+}
+
+uint32_t TlsfAllocator::Allocate(uint64_t size, uint64_t& outOffset) {
+    const uint32_t index = FindFreeBlock(size);
+    if (index == kInvalidHandle) {
+        return kInvalidHandle;
+    }
+
+    UseFreeBlock(index, size);
+    outOffset = m_blocks[index].offset;
+    return index;
+}
+
+bool TlsfAllocator::Free(uint32_t handle, uint64_t offset, uint64_t size) {
+    if (handle >= m_blocks.size()) {
+        return false;
+    }
+    {
+        const Block& block = m_blocks[handle];
+        if (!block.inUse || block.isFree || block.offset != offset || block.size != size) {
+            return false;
+        }
+    }
+
+    m_allocatedBytes -= size;
+    --m_allocationCount;
+
+    uint32_t index = handle;
+    auto unlink = [this](uint32_t node) {
+        const Block& block = m_blocks[node];
+        if (block.prevPhysical != kInvalidHandle) {
+            m_blocks[block.prevPhysical].nextPhysical = block.nextPhysical;
+        }
+        else {
+            m_firstPhysical = block.nextPhysical;
+        }
+        if (block.nextPhysical != kInvalidHandle) {
+            m_blocks[block.nextPhysical].prevPhysical = block.prevPhysical;
+        }
+        else {
+            m_lastPhysical = block.prevPhysical;
+        }
+        ReleaseNode(node);
+    };
+
+    const uint32_t next = m_blocks[index].nextPhysical;
+    if (next != kInvalidHandle && m_blocks[next].isFree) {
+        RemoveFree(next);
+        m_blocks[index].size += m_blocks[next].size;
+        unlink(next);
+    }
+
+    const uint32_t prev = m_blocks[index].prevPhysical;
+    if (prev != kInvalidHandle && m_blocks[prev].isFree) {
+        RemoveFree(prev);
+        m_blocks[prev].size += m_blocks[index].size;
+        unlink(index);
+        index = prev;
+    }
+
+    // A zero-size allocation wedged between live blocks leaves nothing to track.
+    if (m_blocks[index].size == 0) {
+        unlink(index);
+        return true;
+    }
+
+    InsertFree(index);
+    return true;
+}
+
+void TlsfAllocator::Grow(uint64_t newCapacity) {
+    if (newCapacity <= m_capacity) {
+        return;
+    }
+
+    const uint64_t extra = newCapacity - m_capacity;
+    if (m_lastPhysical != kInvalidHandle && m_blocks[m_lastPhysical].isFree) {
+        RemoveFree(m_lastPhysical);
+        m_blocks[m_lastPhysical].size += extra;
+        InsertFree(m_lastPhysical);
+    }
+    else {
+        const uint32_t index = AcquireNode();
+        Block& block = m_blocks[index];
+        block.offset = m_capacity;
+        block.size = extra;
+        block.prevPhysical = m_lastPhysical;
+        if (m_lastPhysical != kInvalidHandle) {
+            m_blocks[m_lastPhysical].nextPhysical = index;
+        }
+        else {
+            m_firstPhysical = index;
+        }
+        m_lastPhysical = index;
+        InsertFree(index);
+    }
+    m_capacity = newCapacity;
+}
+
+uint64_t TlsfAllocator::GetTrailingFreeBytes() const {
+    if (m_lastPhysical == kInvalidHandle || !m_blocks[m_lastPhysical].isFree) {
+        return 0;
+    }
+    return m_blocks[m_lastPhysical].size;
+}
+
+TlsfAllocator::Stats TlsfAllocator::GetStats() const {
+    Stats stats{};
+    stats.capacity = m_capacity;
+    stats.allocatedBytes = m_allocatedBytes;
+    stats.freeBytes = m_capacity - m_allocatedBytes;
+    stats.allocationCount = m_allocationCount;
+    stats.freeBlockCount = m_freeBlockCount;
+
+    // The largest block sits in the highest non-empty class; only that list is scanned.
+    if (m_firstLevelBitmap != 0) {
+        const uint32_t firstLevel = 63u - static_cast<uint32_t>(std::countl_zero(m_firstLevelBitmap));
+        const uint32_t secondLevel = 31u - static_cast<uint32_t>(std::countl_zero(m_secondLevelBitmaps[firstLevel]));
+        for (uint32_t index = m_freeHeads[firstLevel][secondLevel]; index != kInvalidHandle; index = m_blocks[index].nextFree) {
+            stats.largestFreeBlock = (std::max)(stats.largestFreeBlock, m_blocks[index].size);
+        }
+    }
+    if (stats.freeBytes > 0) {
+        stats.fragmentation = 1.0 - static_cast<double>(stats.largestFreeBlock) / static_cast<double>(stats.freeBytes);
+    }
+    return stats;
+}
+
+void TlsfAllocator::PlanDefragmentation(uint64_t maxMoveBytes, std::vector<Move>& outMoves) {
+    outMoves.clear();
+
+    // Free blocks in address order. Free space is usually far sparser than
+    // live allocations, so each tail allocation only searches this list.
+    std::vector<uint32_t> holes;
+    holes.reserve(m_freeBlockCount);
+    for (uint32_t index = m_firstPhysical; index != kInvalidHandle; index = m_blocks[index].nextPhysical) {
+        if (m_blocks[index].isFree) {
+            holes.push_back(index);
+        }
+    }
+
+    // Destinations land below the cursor; they must not be picked up again as sources.
+    std::vector<uint8_t> isDestination;
+    // Holes only shrink during a pass, so this stays an upper bound on the largest one.
+    uint64_t largestHole = ~0ull;
+    uint64_t movedBytes = 0;
+    for (uint32_t index = m_lastPhysical; index != kInvalidHandle && !holes.empty(); index = m_blocks[index].prevPhysical) {
+        const uint64_t offset = m_blocks[index].offset;
+        while (!holes.empty() && m_blocks[holes.back()].offset >= offset) {
+            holes.pop_back();
+        }
+        if (m_blocks[index].isFree || m_blocks[index].size == 0
+            || (index < isDestination.size() && isDestination[index] != 0u)) {
+            continue;
+        }
+
+        const uint64_t size = m_blocks[index].size;
+        if (movedBytes + size > maxMoveBytes) {
+            break;
+        }
+
+        if (size > largestHole) {
+            continue;
+        }
+
+        auto hole = std::find_if(holes.begin(), holes.end(), [&](uint32_t candidate) {
+            return m_blocks[candidate].size >= size;
+        });
+        if (hole == holes.end()) {
+            // The scan saw every hole, so tighten the bound for later candidates.
+            largestHole = 0;
+            for (uint32_t candidate : holes) {
+                largestHole = (std::max)(largestHole, m_blocks[candidate].size);
+            }
+            continue;
+        }
+
+        const uint32_t holeIndex = *hole;
+        const uint64_t holeSize = m_blocks[holeIndex].size;
+        const uint32_t destination = UseFreeBlock(holeIndex, size);
+        if (holeSize > size) {
+            *hole = m_blocks[destination].nextPhysical;
+        }
+        else {
+            holes.erase(hole);
+        }
+        if (destination >= isDestination.size()) {
+            isDestination.resize(m_blocks.size(), 0u);
+        }
+        isDestination[destination] = 1u;
+
+        Move move{};
+        move.sourceHandle = index;
+        move.sourceOffset = offset;
+        move.destinationHandle = destination;
+        move.destinationOffset = m_blocks[destination].offset;
+        move.size = size;
+        outMoves.push_back(move);
+        movedBytes += size;
+    }
+}
@@ -2,11 +2,13 @@
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <filesystem>
 #include <fstream>
 #include <sstream>
 
 #include <DirectXTex.h>
+#include <objbase.h>
 
 #include <spdlog/spdlog.h>
 
@@ -972,6 +974,110 @@ std::shared_ptr<TextureDirectStorageReloadJobHandle> BeginUploadConditionedCache
 
 	return handle;
 }
+
+// Returns false if another thread already claimed the job.
+bool RunTextureDecodeJob(const std::shared_ptr<TextureDecodeJobHandle>& handle) {
+	TextureDecodeJobState expected = TextureDecodeJobState::Queued;
+	if (!handle->state.compare_exchange_strong(expected, TextureDecodeJobState::Decoding, std::memory_order_acq_rel)) {
+		return false;
+	}
+
+	// WIC decoders need COM on whichever thread ends up running the job.
+	thread_local const HRESULT comInitResult = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+	(void)comInitResult;
+
+	std::shared_ptr<TextureAsset> decoded;
+	std::string error;
+	const auto start = std::chrono::steady_clock::now();
+	try {
+		decoded = handle->decode();
+		if (!decoded) {
+			error = "decode produced no texture";
+		}
+	}
+	catch (const std::exception& ex) {
+		error = ex.what();
+	}
+	const double decodeMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+	{
+		std::scoped_lock lock(handle->mutex);
+		handle->decoded = std::move(decoded);
+		handle->error = std::move(error);
+		handle->decodeMilliseconds = decodeMilliseconds;
+		handle->decode = nullptr;
+		handle->state.store(
+			handle->error.empty() ? TextureDecodeJobState::Ready : TextureDecodeJobState::Failed,
+			std::memory_order_release);
+	}
+	handle->completed.notify_all();
+
+	spdlog::debug("TextureDecode: '{}' decoded in {:.2f} ms", handle->label, decodeMilliseconds);
+	return true;
+}
+}
+
+std::shared_ptr<TextureDecodeJobHandle> RequestTextureDecodeAsync(
+	std::string label,
+	std::function<std::shared_ptr<TextureAsset>()> decode)
+{
+	auto handle = std::make_shared<TextureDecodeJobHandle>();
+	handle->label = std::move(label);
+	handle->decode = std::move(decode);
+	handle->state.store(TextureDecodeJobState::Queued, std::memory_order_release);
+
+	TaskSchedulerManager::GetInstance().RunBackgroundTask("TextureAsset::RequestTextureDecodeAsync", [handle]() {
+		RunTextureDecodeJob(handle);
+	});
+
+	return handle;
+}
+
+std::shared_ptr<TextureAsset> WaitForTextureDecode(
+	const std::shared_ptr<TextureDecodeJobHandle>& handle,
+	std::string* outError)
+{
+	if (!handle) {
+		if (outError) {
+			*outError = "no decode job";
+		}
+		return nullptr;
+	}
+
+	RunTextureDecodeJob(handle);
+
+	std::unique_lock lock(handle->mutex);
+	handle->completed.wait(lock, [&]() {
+		const TextureDecodeJobState state = handle->state.load(std::memory_order_acquire);
+		return state == TextureDecodeJobState::Ready || state == TextureDecodeJobState::Failed;
+	});
+	if (outError) {
+		*outError = handle->error;
+	}
+	return handle->decoded;
+}
+
+std::shared_ptr<TextureAsset> TextureAsset::CreatePendingDecode(
+	std::shared_ptr<TextureDecodeJobHandle> decodeHandle,
+	std::shared_ptr<Sampler> defaultSampler,
+	TextureFileMeta meta)
+{
+	TextureDescription desc{};
+	desc.channels = 4;
+	desc.format = meta.preferSRGB
+		? rhi::Format::R8G8B8A8_UNorm_sRGB
+		: rhi::Format::R8G8B8A8_UNorm;
+
+	ImageDimensions dims{};
+	dims.width = 1;
+	dims.height = 1;
+	dims.rowPitch = 4;
+	dims.slicePitch = 4;
+	desc.imageDimensions.push_back(dims);
+
+	auto texture = CreateShared(std::move(desc), std::monostate{}, std::move(defaultSampler), std::move(meta));
+	texture->m_decodeHandle = std::move(decodeHandle);
+	return texture;
 }
 
 uint32_t TextureAsset::NextStreamingTextureID() {
@@ -1306,6 +1412,68 @@ void TextureAsset::NoteTextureSeen(uint64_t frameIndex) {
 	BumpStreamingStateRevision();
 }
 
+void TextureAsset::UploadPlaceholderImage(const TextureFactory& factory, const std::string& detail) {
+	m_image = CreatePlaceholderTexture(factory, m_meta.processing);
+	m_desc = m_image->GetDescription();
+	RefreshStreamingStateFromDescription();
+	RecordUploadPath(TextureUploadPathTelemetry::AsyncProcessingPlaceholder, detail);
+	m_hasUploadedPlaceholder = true;
+	BumpBindingRevision();
+}
+
+void TextureAsset::AdoptDecodedSource(const TextureAsset& decoded) {
+	const bool generateMipMaps = m_desc.generateMipMaps;
+	m_desc = decoded.m_desc;
+	m_desc.generateMipMaps = generateMipMaps;
+	m_initialStorage = decoded.m_initialStorage;
+	m_initialDataString = decoded.m_initialDataString;
+	m_originalSourceDesc = decoded.m_originalSourceDesc;
+	m_originalSourceBytes = decoded.m_originalSourceBytes;
+	m_meta.fileType = decoded.m_meta.fileType;
+	m_meta.loader = decoded.m_meta.loader;
+	m_meta.alphaIsAllOpaque = decoded.m_meta.alphaIsAllOpaque;
+	RecordLoadPath(decoded.m_meta.loadPath, decoded.m_meta.loadPathDetail + " (decoded asynchronously during import)");
+
+	// Drop the placeholder so the regular upload path below sees an unresolved asset.
+	m_image.reset();
+	m_hasUploadedPlaceholder = false;
+	RefreshStreamingStateFromDescription();
+}
+
+bool TextureAsset::AdvancePendingDecode(const TextureFactory& factory) {
+	const TextureDecodeJobState state = m_decodeHandle->state.load(std::memory_order_acquire);
+	if (state == TextureDecodeJobState::Queued || state == TextureDecodeJobState::Decoding) {
+		if (!HasUsableImage()) {
+			UploadPlaceholderImage(factory, "import decode pending; placeholder texture uploaded");
+		}
+		return false;
+	}
+
+	std::shared_ptr<TextureAsset> decoded;
+	std::string error;
+	{
+		std::scoped_lock lock(m_decodeHandle->mutex);
+		decoded = m_decodeHandle->decoded;
+		error = m_decodeHandle->error;
+	}
+	const std::string label = m_decodeHandle->label;
+	m_decodeHandle.reset();
+
+	if (state == TextureDecodeJobState::Failed || !decoded) {
+		// Keep the neutral placeholder as the final image; there is nothing to retry.
+		spdlog::error("TextureAsset: import decode failed for '{}': {}", label, error);
+		if (!HasUsableImage()) {
+			UploadPlaceholderImage(factory, "import decode failed ('" + error + "'); keeping placeholder texture");
+		}
+		m_hasUploadedPlaceholder = false;
+		m_hasUploadedFinalImage = true;
+		return false;
+	}
+
+	AdoptDecodedSource(*decoded);
+	return true;
+}
+
 void TextureAsset::AdoptUploadedImage(std::shared_ptr<PixelBuffer> image) {
 	const uint32_t residentTopMip = GetDesiredResidentTopMip();
 	if (image && !image->HasValidBackingResource()) {
@@ -1387,6 +1555,10 @@ DirectStorageAsyncRequestHandle TextureAsset::QueueInitialDirectStorageUploadIfN
 }
 
 void TextureAsset::EnsureUploaded(const TextureFactory& factory) {
+	if (m_decodeHandle && !AdvancePendingDecode(factory)) {
+		return;
+	}
+
 	const bool needsStreamingReload =
 		m_hasUploadedFinalImage &&
 		m_streamingState.enabled &&
@@ -1406,12 +1578,7 @@ void TextureAsset::EnsureUploaded(const TextureFactory& factory) {
 			return false;
 		}
 
-		m_image = CreatePlaceholderTexture(factory, m_meta.processing);
-		m_desc = m_image->GetDescription();
-		RefreshStreamingStateFromDescription();
-		RecordUploadPath(TextureUploadPathTelemetry::AsyncProcessingPlaceholder, detail);
-		m_hasUploadedPlaceholder = true;
-		BumpBindingRevision();
+		UploadPlaceholderImage(factory, detail);
 		return true;
 	};
 
@@ -0,0 +1,433 @@
+#include "Scene/InstanceClusterBVH.h"
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+using Float3 = InstanceClusterBVH::Float3;
+using Aabb = InstanceClusterBVH::Aabb;
+
+constexpr uint32_t kMortonAxisBits = 10;
+constexpr uint32_t kRadixBits = 10;
+constexpr uint32_t kRadixBuckets = 1u << kRadixBits;
+static_assert((3 * kMortonAxisBits) % kRadixBits == 0 && (3 * kMortonAxisBits / kRadixBits) % 2 == 1,
+	"Build expects an odd number of radix passes over the Morton code");
+
+// Spreads the low 10 bits of v so there are two zero bits between each.
+uint32_t ExpandMortonBits(uint32_t v) {
+	v &= 0x3FFu;
+	v = (v | (v << 16)) & 0x030000FFu;
+	v = (v | (v << 8)) & 0x0300F00Fu;
+	v = (v | (v << 4)) & 0x030C30C3u;
+	v = (v | (v << 2)) & 0x09249249u;
+	return v;
+}
+
+struct MortonQuantizer {
+	Float3 origin;
+	Float3 scale;
+
+	explicit MortonQuantizer(const Aabb& bounds) {
+		const float cells = static_cast<float>((1u << kMortonAxisBits) - 1u);
+		auto axisScale = [cells](float lo, float hi) {
+			return hi > lo ? cells / (hi - lo) : 0.0f;
+		};
+		origin = bounds.min;
+		scale = { axisScale(bounds.min.x, bounds.max.x), axisScale(bounds.min.y, bounds.max.y), axisScale(bounds.min.z, bounds.max.z) };
+	}
+
+	uint32_t Encode(const Float3& p) const {
+		const float cells = static_cast<float>((1u << kMortonAxisBits) - 1u);
+		auto quantize = [cells](float value) {
+			return static_cast<uint32_t>((std::min)((std::max)(value, 0.0f), cells));
+		};
+		return (ExpandMortonBits(quantize((p.x - origin.x) * scale.x)) << 2)
+			| (ExpandMortonBits(quantize((p.y - origin.y) * scale.y)) << 1)
+			| ExpandMortonBits(quantize((p.z - origin.z) * scale.z));
+	}
+};
+
+void Grow(Aabb& box, const Float3& lo, const Float3& hi) {
+	box.min.x = (std::min)(box.min.x, lo.x);
+	box.min.y = (std::min)(box.min.y, lo.y);
+	box.min.z = (std::min)(box.min.z, lo.z);
+	box.max.x = (std::max)(box.max.x, hi.x);
+	box.max.y = (std::max)(box.max.y, hi.y);
+	box.max.z = (std::max)(box.max.z, hi.z);
+}
+
+Float3 Center(const Aabb& box) {
+	return { (box.min.x + box.max.x) * 0.5f, (box.min.y + box.max.y) * 0.5f, (box.min.z + box.max.z) * 0.5f };
+}
+
+bool Contains(const Aabb& box, const Float3& p) {
+	return p.x >= box.min.x && p.x <= box.max.x
+		&& p.y >= box.min.y && p.y <= box.max.y
+		&& p.z >= box.min.z && p.z <= box.max.z;
+}
+
+float DistanceSquared(const Aabb& box, const Float3& p) {
+	const float dx = (std::max)((std::max)(box.min.x - p.x, p.x - box.max.x), 0.0f);
+	const float dy = (std::max)((std::max)(box.min.y - p.y, p.y - box.max.y), 0.0f);
+	const float dz = (std::max)((std::max)(box.min.z - p.z, p.z - box.max.z), 0.0f);
+	return dx * dx + dy * dy + dz * dz;
+}
+
+// Does the segment from 'from' to 'to' touch the box?
+bool SegmentHitsBox(const Float3& from, const Float3& to, const Aabb& box) {
+	float tMin = 0.0f;
+	float tMax = 1.0f;
+	const float origin[3] = { from.x, from.y, from.z };
+	const float direction[3] = { to.x - from.x, to.y - from.y, to.z - from.z };
+	const float lo[3] = { box.min.x, box.min.y, box.min.z };
+	const float hi[3] = { box.max.x, box.max.y, box.max.z };
+	for (int axis = 0; axis < 3; ++axis) {
+		if (direction[axis] == 0.0f) {
+			if (origin[axis] < lo[axis] || origin[axis] > hi[axis]) {
+				return false;
+			}
+			continue;
+		}
+		const float inverse = 1.0f / direction[axis];
+		float t0 = (lo[axis] - origin[axis]) * inverse;
+		float t1 = (hi[axis] - origin[axis]) * inverse;
+		if (t0 > t1) {
+			std::swap(t0, t1);
+		}
+		tMin = (std::max)(tMin, t0);
+		tMax = (std::min)(tMax, t1);
+		if (tMin > tMax) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// The set of points hidden by a convex occluder is convex, so a box is hidden
+// when all eight of its corners are.
+bool IsOccluded(const Aabb& box, const Float3& eye, std::span<const Aabb> occluders) {
+	for (const Aabb& occluder : occluders) {
+		bool hidden = true;
+		for (uint32_t corner = 0; corner < 8 && hidden; ++corner) {
+			const Float3 point = {
+				(corner & 1u) ? box.max.x : box.min.x,
+				(corner & 2u) ? box.max.y : box.min.y,
+				(corner & 4u) ? box.max.z : box.min.z };
+			hidden = SegmentHitsBox(eye, point, occluder);
+		}
+		if (hidden) {
+			return true;
+		}
+	}
+	return false;
+}
+
+enum class CullResult {
+	Visible,
+	Frustum,
+	Distance,
+	Occluded,
+};
+
+// planeMask bits are cleared for planes the box lies entirely inside, so
+// children skip them.
+CullResult TestBox(
+	const Aabb& box,
+	const InstanceClusterBVH::CullParams& params,
+	float maxDistance,
+	std::span<const Aabb> occluders,
+	uint32_t& planeMask) {
+	for (uint32_t plane = 0; plane < params.frustumPlanes.size(); ++plane) {
+		if ((planeMask & (1u << plane)) == 0) {
+			continue;
+		}
+		const auto& p = params.frustumPlanes[plane];
+		const float farthest = p.normal.x * (p.normal.x >= 0.0f ? box.max.x : box.min.x)
+			+ p.normal.y * (p.normal.y >= 0.0f ? box.max.y : box.min.y)
+			+ p.normal.z * (p.normal.z >= 0.0f ? box.max.z : box.min.z) + p.distance;
+		if (farthest < 0.0f) {
+			return CullResult::Frustum;
+		}
+		const float nearest = p.normal.x * (p.normal.x >= 0.0f ? box.min.x : box.max.x)
+			+ p.normal.y * (p.normal.y >= 0.0f ? box.min.y : box.max.y)
+			+ p.normal.z * (p.normal.z >= 0.0f ? box.min.z : box.max.z) + p.distance;
+		if (nearest >= 0.0f) {
+			planeMask &= ~(1u << plane);
+		}
+	}
+	if (DistanceSquared(box, params.eye) > maxDistance * maxDistance) {
+		return CullResult::Distance;
+	}
+	if (!occluders.empty() && IsOccluded(box, params.eye, occluders)) {
+		return CullResult::Occluded;
+	}
+	return CullResult::Visible;
+}
+
+void Record(CullResult result, InstanceClusterBVH::CullStats& stats) {
+	switch (result) {
+	case CullResult::Frustum: ++stats.frustumCulled; break;
+	case CullResult::Distance: ++stats.distanceCulled; break;
+	case CullResult::Occluded: ++stats.occluded; break;
+	case CullResult::Visible: break;
+	}
+}
+
+struct PreparedCull {
+	std::vector<Aabb> occluders;    // Those not containing the eye
+	uint32_t fullPlaneMask = 0;
+	float nodeMaxDistance = 0.0f;
+};
+
+PreparedCull PrepareCull(const InstanceClusterBVH::CullParams& params, uint32_t prototypeCount) {
+	if (params.frustumPlanes.size() > 32) {
+		throw std::invalid_argument("InstanceClusterBVH supports at most 32 cull planes");
+	}
+	PreparedCull prepared;
+	prepared.fullPlaneMask = params.frustumPlanes.size() == 32 ? ~0u : (1u << params.frustumPlanes.size()) - 1u;
+	for (const Aabb& occluder : params.occluders) {
+		if (!Contains(occluder, params.eye)) {
+			prepared.occluders.push_back(occluder);
+		}
+	}
+	// Nodes mix prototypes, so they can only use the loosest limit.
+	prepared.nodeMaxDistance = params.maxDistance;
+	if (prototypeCount > 0 && params.prototypeMaxDistances.size() >= prototypeCount) {
+		float loosest = 0.0f;
+		for (uint32_t prototype = 0; prototype < prototypeCount; ++prototype) {
+			loosest = (std::max)(loosest, params.prototypeMaxDistances[prototype]);
+		}
+		prepared.nodeMaxDistance = (std::min)(prepared.nodeMaxDistance, loosest);
+	}
+	return prepared;
+}
+
+float ClusterMaxDistance(const InstanceClusterBVH::CullParams& params, uint32_t prototype) {
+	if (prototype < params.prototypeMaxDistances.size()) {
+		return (std::min)(params.maxDistance, params.prototypeMaxDistances[prototype]);
+	}
+	return params.maxDistance;
+}
+}
+
+void InstanceClusterBVH::Build(
+	std::span<const Float3> centers,
+	std::span<const float> radii,
+	std::span<const uint32_t> prototypes,
+	const BuildSettings& settings) {
+	const size_t count = centers.size();
+	if ((!radii.empty() && radii.size() != count) || (!prototypes.empty() && prototypes.size() != count)) {
+		throw std::invalid_argument("InstanceClusterBVH::Build: per-instance arrays differ in length");
+	}
+	if (count > std::numeric_limits<uint32_t>::max()) {
+		throw std::length_error("InstanceClusterBVH::Build: too many instances");
+	}
+
+	m_clusters.clear();
+	m_nodes.clear();
+	m_instanceOrder.clear();
+	m_prototypeCount = 0;
+	if (count == 0) {
+		return;
+	}
+
+	Aabb centerBounds;
+	for (const Float3& center : centers) {
+		Grow(centerBounds, center, center);
+	}
+	const MortonQuantizer quantizer(centerBounds);
+
+	// Counting pass by prototype, then an LSD radix sort on the 30-bit Morton
+	// code inside each prototype's range. Centers and radii travel with the
+	// keys, so the cluster pass below reads sequentially instead of gathering.
+	struct SortItem {
+		uint32_t key;
+		uint32_t instance;
+		Float3 center;
+		float radius;
+	};
+	m_prototypeCount = 1;
+	for (uint32_t prototype : prototypes) {
+		m_prototypeCount = (std::max)(m_prototypeCount, prototype + 1u);
+	}
+	std::vector<uint32_t> prototypeOffsets(static_cast<size_t>(m_prototypeCount) + 1u, 0u);
+	if (prototypes.empty()) {
+		prototypeOffsets[0] = static_cast<uint32_t>(count);
+	}
+	for (uint32_t prototype : prototypes) {
+		++prototypeOffsets[prototype];
+	}
+	uint32_t running = 0;
+	for (uint32_t& offset : prototypeOffsets) {
+		running += std::exchange(offset, running);
+	}
+	std::vector<SortItem> items(count);
+	std::vector<SortItem> scratch(count);
+	{
+		std::vector<uint32_t> cursor(prototypeOffsets.begin(), prototypeOffsets.end() - 1);
+		for (size_t i = 0; i < count; ++i) {
+			const uint32_t prototype = prototypes.empty() ? 0u : prototypes[i];
+			items[cursor[prototype]++] = { quantizer.Encode(centers[i]), static_cast<uint32_t>(i), centers[i], radii.empty() ? 0.0f : radii[i] };
+		}
+	}
+	std::vector<uint32_t> buckets(kRadixBuckets);
+	for (uint32_t prototype = 0; prototype < m_prototypeCount; ++prototype) {
+		const uint32_t begin = prototypeOffsets[prototype];
+		const uint32_t end = prototypeOffsets[prototype + 1];
+		for (uint32_t shift = 0; shift < 3 * kMortonAxisBits; shift += kRadixBits) {
+			std::vector<SortItem>& source = (shift / kRadixBits) % 2 == 0 ? items : scratch;
+			std::vector<SortItem>& target = (shift / kRadixBits) % 2 == 0 ? scratch : items;
+			std::fill(buckets.begin(), buckets.end(), 0u);
+			for (uint32_t i = begin; i < end; ++i) {
+				++buckets[(source[i].key >> shift) & (kRadixBuckets - 1u)];
+			}
+			uint32_t bucketStart = begin;
+			for (uint32_t& bucket : buckets) {
+				bucketStart += std::exchange(bucket, bucketStart);
+			}
+			for (uint32_t i = begin; i < end; ++i) {
+				target[buckets[(source[i].key >> shift) & (kRadixBuckets - 1u)]++] = source[i];
+			}
+		}
+	}
+	// An odd pass count leaves the sorted ranges in scratch.
+	items = {};
+	const std::vector<SortItem>& sorted = scratch;
+
+	// Consecutive runs of one prototype become clusters of bounded size.
+	m_instanceOrder.resize(count);
+	const uint32_t clusterLimit = (std::max)(settings.maxInstancesPerCluster, 1u);
+	for (uint32_t prototype = 0; prototype < m_prototypeCount; ++prototype) {
+		const uint32_t end = prototypeOffsets[prototype + 1];
+		for (uint32_t position = prototypeOffsets[prototype]; position < end;) {
+			Cluster cluster;
+			cluster.prototype = prototype;
+			cluster.firstInstance = position;
+			cluster.instanceCount = (std::min)(clusterLimit, end - position);
+			for (const uint32_t clusterEnd = position + cluster.instanceCount; position < clusterEnd; ++position) {
+				const SortItem& item = sorted[position];
+				const Float3& c = item.center;
+				const float r = item.radius;
+				Grow(cluster.bounds, { c.x - r, c.y - r, c.z - r }, { c.x + r, c.y + r, c.z + r });
+				m_instanceOrder[position] = item.instance;
+			}
+			m_clusters.push_back(cluster);
+		}
+	}
+	scratch = {};
+
+	// Re-sort clusters by their own Morton code so neighbouring prototypes
+	// share BVH nodes, then split the sequence in halves.
+	std::vector<std::pair<uint32_t, uint32_t>> clusterKeys(m_clusters.size());
+	for (uint32_t i = 0; i < m_clusters.size(); ++i) {
+		clusterKeys[i] = { quantizer.Encode(Center(m_clusters[i].bounds)), i };
+	}
+	std::sort(clusterKeys.begin(), clusterKeys.end());
+	std::vector<Cluster> sortedClusters;
+	sortedClusters.reserve(m_clusters.size());
+	for (const auto& [key, index] : clusterKeys) {
+		sortedClusters.push_back(m_clusters[index]);
+	}
+	m_clusters.swap(sortedClusters);
+
+	const uint32_t leafLimit = (std::max)(settings.maxClustersPerLeaf, 1u);
+	m_nodes.reserve(2 * (m_clusters.size() / leafLimit + 1));
+	m_nodes.emplace_back();
+	BuildNode(0, 0, static_cast<uint32_t>(m_clusters.size()), leafLimit);
+}
+
+void InstanceClusterBVH::BuildNode(uint32_t nodeIndex, uint32_t begin, uint32_t end, uint32_t leafLimit) {
+	if (end - begin <= leafLimit) {
+		Aabb bounds;
+		for (uint32_t cluster = begin; cluster < end; ++cluster) {
+			Grow(bounds, m_clusters[cluster].bounds.min, m_clusters[cluster].bounds.max);
+		}
+		m_nodes[nodeIndex] = { bounds, begin, end - begin };
+		return;
+	}
+
+	const uint32_t children = static_cast<uint32_t>(m_nodes.size());
+	m_nodes.emplace_back();
+	m_nodes.emplace_back();
+	const uint32_t middle = begin + (end - begin) / 2;
+	BuildNode(children, begin, middle, leafLimit);
+	BuildNode(children + 1, middle, end, leafLimit);
+
+	Aabb bounds = m_nodes[children].bounds;
+	Grow(bounds, m_nodes[children + 1].bounds.min, m_nodes[children + 1].bounds.max);
+	m_nodes[nodeIndex] = { bounds, children, 0 };
+}
+
+void InstanceClusterBVH::Cull(const CullParams& params, std::vector<uint32_t>& visibleClusters, CullStats* stats) const {
+	CullStats localStats;
+	if (m_nodes.empty()) {
+		if (stats) {
+			*stats = localStats;
+		}
+		return;
+	}
+	const PreparedCull prepared = PrepareCull(params, m_prototypeCount);
+
+	struct Entry {
+		uint32_t node;
+		uint32_t planeMask;
+	};
+	std::array<Entry, 64> stack;
+	uint32_t stackSize = 0;
+	stack[stackSize++] = { 0, prepared.fullPlaneMask };
+	while (stackSize > 0) {
+		Entry entry = stack[--stackSize];
+		const Node& node = m_nodes[entry.node];
+		++localStats.nodesVisited;
+		const CullResult nodeResult = TestBox(node.bounds, params, prepared.nodeMaxDistance, prepared.occluders, entry.planeMask);
+		if (nodeResult != CullResult::Visible) {
+			Record(nodeResult, localStats);
+			continue;
+		}
+		if (node.count == 0) {
+			// Right first so clusters come out in ascending order.
+			stack[stackSize++] = { node.first + 1, entry.planeMask };
+			stack[stackSize++] = { node.first, entry.planeMask };
+			continue;
+		}
+		for (uint32_t index = node.first; index < node.first + node.count; ++index) {
+			const Cluster& cluster = m_clusters[index];
+			uint32_t planeMask = entry.planeMask;
+			++localStats.clustersTested;
+			const CullResult result = TestBox(cluster.bounds, params, ClusterMaxDistance(params, cluster.prototype), prepared.occluders, planeMask);
+			if (result != CullResult::Visible) {
+				Record(result, localStats);
+				continue;
+			}
+			visibleClusters.push_back(index);
+			++localStats.clustersVisible;
+			localStats.visibleInstances += cluster.instanceCount;
+		}
+	}
+	if (stats) {
+		*stats = localStats;
+	}
+}
+
+void InstanceClusterBVH::CullFlat(const CullParams& params, std::vector<uint32_t>& visibleClusters, CullStats* stats) const {
+	CullStats localStats;
+	const PreparedCull prepared = PrepareCull(params, m_prototypeCount);
+	for (uint32_t index = 0; index < m_clusters.size(); ++index) {
+		const Cluster& cluster = m_clusters[index];
+		uint32_t planeMask = prepared.fullPlaneMask;
+		++localStats.clustersTested;
+		const CullResult result = TestBox(cluster.bounds, params, ClusterMaxDistance(params, cluster.prototype), prepared.occluders, planeMask);
+		if (result != CullResult::Visible) {
+			Record(result, localStats);
+			continue;
+		}
+		visibleClusters.push_back(index);
+		++localStats.clustersVisible;
+		localStats.visibleInstances += cluster.instanceCount;
+	}
+	if (stats) {
+		*stats = localStats;
+	}
+}
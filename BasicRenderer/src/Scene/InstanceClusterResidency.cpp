@@ -0,0 +1,96 @@
+#include "Scene/InstanceClusterResidency.h"
+
+#include <algorithm>
+#include <limits>
+#include <tuple>
+
+namespace {
+float DistanceSquared(const InstanceClusterBVH::Aabb& box, const InstanceClusterBVH::Float3& p) {
+	const float dx = (std::max)((std::max)(box.min.x - p.x, p.x - box.max.x), 0.0f);
+	const float dy = (std::max)((std::max)(box.min.y - p.y, p.y - box.max.y), 0.0f);
+	const float dz = (std::max)((std::max)(box.min.z - p.z, p.z - box.max.z), 0.0f);
+	return dx * dx + dy * dy + dz * dz;
+}
+}
+
+void InstanceClusterResidency::Reset(const InstanceClusterBVH& bvh, std::span<const uint8_t> drawablePrototypes) {
+	const auto& clusters = bvh.GetClusters();
+	m_drawable.resize(clusters.size());
+	for (size_t index = 0; index < clusters.size(); ++index) {
+		const uint32_t prototype = clusters[index].prototype;
+		m_drawable[index] = prototype < drawablePrototypes.size() && drawablePrototypes[prototype] != 0 ? 1u : 0u;
+	}
+	m_resident.assign(clusters.size(), 0u);
+	m_keep.assign(clusters.size(), 0u);
+	m_lastVisibleUpdate.assign(clusters.size(), 0u);
+	m_residentClusters.clear();
+	m_candidates.clear();
+	m_update = 0;
+	m_residentInstances = 0;
+}
+
+void InstanceClusterResidency::Update(
+	const InstanceClusterBVH& bvh,
+	std::span<const uint32_t> visibleClusters,
+	const InstanceClusterBVH::Float3& eye,
+	const Settings& settings,
+	Changes& changes) {
+	changes.added.clear();
+	changes.removed.clear();
+	const auto& clusters = bvh.GetClusters();
+	if (clusters.size() != m_drawable.size()) {
+		return;
+	}
+	++m_update;
+
+	// Visible clusters first, nearest first, then the resident ones still
+	// inside their linger window.
+	m_candidates.clear();
+	for (uint32_t cluster : visibleClusters) {
+		if (cluster >= clusters.size() || !m_drawable[cluster]) {
+			continue;
+		}
+		m_lastVisibleUpdate[cluster] = m_update;
+		m_candidates.push_back({ false, DistanceSquared(clusters[cluster].bounds, eye), cluster });
+	}
+	for (uint32_t cluster : m_residentClusters) {
+		const uint64_t lastVisible = m_lastVisibleUpdate[cluster];
+		if (lastVisible != m_update && m_update - lastVisible <= settings.lingerUpdates) {
+			m_candidates.push_back({ true, DistanceSquared(clusters[cluster].bounds, eye), cluster });
+		}
+	}
+	std::sort(m_candidates.begin(), m_candidates.end(), [](const Candidate& a, const Candidate& b) {
+		return std::tie(a.lingering, a.distanceSquared, a.cluster) < std::tie(b.lingering, b.distanceSquared, b.cluster);
+	});
+
+	// Clusters are admitted whole; one that does not fit is skipped so a
+	// smaller one further out can still use the rest of the budget.
+	uint64_t remaining = settings.maxResidentInstances > 0 ? settings.maxResidentInstances : std::numeric_limits<uint64_t>::max();
+	for (const Candidate& candidate : m_candidates) {
+		const uint32_t instanceCount = clusters[candidate.cluster].instanceCount;
+		if (instanceCount > remaining) {
+			continue;
+		}
+		remaining -= instanceCount;
+		m_keep[candidate.cluster] = 1u;
+	}
+
+	for (uint32_t cluster : m_residentClusters) {
+		if (!m_keep[cluster]) {
+			m_resident[cluster] = 0u;
+			m_residentInstances -= clusters[cluster].instanceCount;
+			changes.removed.push_back(cluster);
+		}
+	}
+	std::erase_if(m_residentClusters, [this](uint32_t cluster) { return m_resident[cluster] == 0u; });
+	for (const Candidate& candidate : m_candidates) {
+		const uint32_t cluster = candidate.cluster;
+		if (m_keep[cluster] && !m_resident[cluster]) {
+			m_resident[cluster] = 1u;
+			m_residentInstances += clusters[cluster].instanceCount;
+			m_residentClusters.push_back(cluster);
+			changes.added.push_back(cluster);
+		}
+		m_keep[cluster] = 0u;
+	}
+}
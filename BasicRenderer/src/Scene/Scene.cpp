@@ -27,6 +27,7 @@
 #include "Resources/PixelBuffer.h"
 #include "Render/DrawWorkload.h"
 #include "Render/GraphExtensions/ClusterLOD/CLodCommon.h"
+#include "Scene/InstanceClusters.h"
 
 namespace {
 	std::atomic<uint64_t> globalStableSceneId = 0;
@@ -191,6 +192,7 @@ Scene::Scene(){
     getNumDirectionalLightCascades = SettingsManager::GetInstance().getSettingGetter<uint8_t>("numDirectionalLightCascades");
     setDirectionalLightCascadeSplits = SettingsManager::GetInstance().getSettingSetter<std::vector<float>>("directionalLightCascadeSplits");
 	getMeshShadersEnabled = SettingsManager::GetInstance().getSettingGetter<bool>("enableMeshShader");
+	getUsdPointInstancerMaxInstances = SettingsManager::GetInstance().getSettingGetter<uint32_t>("usdPointInstancerMaxInstances");
 
     //Initialize ECS scene
 	auto& world = GetSceneWorld();
@@ -373,6 +375,43 @@ void Scene::ActivateRenderable(flecs::entity& entity) {
 	}
 }
 
+void Scene::DeactivateRenderable(flecs::entity& entity) {
+	auto meshInstances = entity.try_get<Components::MeshInstances>();
+	if (!meshInstances) {
+		return;
+	}
+
+	auto& drawStats = GetSceneWorld().get_mut<Components::DrawStats>();
+	auto* indirectCommandBufferManager = m_managerInterface.GetIndirectCommandBufferManager();
+
+	for (auto& meshInstance : meshInstances->meshInstances) {
+		auto mesh = meshInstance->GetMesh();
+		if (!mesh) {
+			continue;
+		}
+
+		m_managerInterface.GetMeshManager()->RemoveMeshInstance(meshInstance.get());
+		m_managerInterface.GetMaterialManager()->ReleaseRasterBucket(ComposeRuntimeRasterFlags(*mesh));
+		m_managerInterface.GetMaterialManager()->DecrementMaterialUsageCount(*mesh->material);
+
+		// Undo ActivateRenderable's draw stats so streamed renderables do not
+		// grow the indirect workloads without bound
+		ForEachMeshDrawWorkload(*mesh, [&](const DrawWorkloadKey& workloadKey) {
+			auto it = drawStats.numDrawsPerTechnique.find(workloadKey);
+			if (it == drawStats.numDrawsPerTechnique.end() || it->second == 0) {
+				return;
+			}
+			--it->second;
+			if (indirectCommandBufferManager) {
+				indirectCommandBufferManager->UpdateBuffersForWorkload(workloadKey, it->second);
+			}
+		});
+		if (drawStats.numDrawsInScene > 0) {
+			drawStats.numDrawsInScene--;
+		}
+	}
+}
+
 void Scene::ActivateLight(flecs::entity& entity) {
 }
 
@@ -504,6 +543,12 @@ void Scene::Update(float elapsedSeconds) {
 	for (auto& child : m_childScenes) {
 		child->Update(elapsedSeconds);
 	}
+
+	// Child scenes have no camera of their own; the query below covers their
+	// instancers too.
+	if (IsActive() && HasUsablePrimaryCamera()) {
+		UpdateInstanceClusters();
+	}
 }
 
 void Scene::SetCamera(XMFLOAT3 lookAt, XMFLOAT3 up, float fov, float aspect, float zNear, float zFar) {
@@ -689,21 +734,7 @@ void Scene::MakeNonResident() {
 	});
 
 	for (auto& entity : renderables) {
-		auto meshInstances = entity.try_get<Components::MeshInstances>();
-		if (!meshInstances) {
-			continue;
-		}
-
-		for (auto& meshInstance : meshInstances->meshInstances) {
-			auto mesh = meshInstance->GetMesh();
-			if (!mesh) {
-				continue;
-			}
-
-			m_managerInterface.GetMeshManager()->RemoveMeshInstance(meshInstance.get());
-			m_managerInterface.GetMaterialManager()->ReleaseRasterBucket(ComposeRuntimeRasterFlags(*mesh));
-			m_managerInterface.GetMaterialManager()->DecrementMaterialUsageCount(*mesh->material);
-		}
+		DeactivateRenderable(entity);
 	}
 }
 
@@ -731,6 +762,8 @@ Scene::~Scene() {
 	m_updatedCleanupQuery = {};
 	m_dirtyQuery = {};
 	m_propagateQueriesBuilt = false;
+	m_instanceClusterQuery = {};
+	m_instanceClusterQueryBuilt = false;
 	Deactivate();
 }
 
@@ -782,8 +815,12 @@ void recurse_hierarchy(flecs::entity src, flecs::entity dst_parent = {}) {
 	if (src.has<Components::SkeletonRoot>()) {
 		return; // Skip skeleton roots, they are handled separately
 	}
+	if (src.has<Components::StreamedInstanceCluster>()) {
+		return; // The clone streams its own clusters
+	}
 	flecs::entity cloned = src.clone();
 	AssignStableSceneID(cloned);
+	cloned.remove<Components::InstanceClusterStreaming>();
 
 	if (dst_parent.is_alive()) {
 		cloned.child_of(dst_parent);
@@ -828,3 +865,150 @@ void Scene::DisableShadows() {
 	}
 	world.defer_end();
 }
+
+namespace {
+	void SetInstanceClusterTransform(flecs::entity entity, const InstanceClusterSet::Transform& transform) {
+		entity.set<Components::Position>({ transform.position });
+		entity.set<Components::Rotation>({ transform.rotation });
+		entity.set<Components::Scale>({ transform.scale });
+	}
+}
+
+void Scene::UpdateInstanceClusters() {
+	auto& world = GetSceneWorld();
+	if (!m_instanceClusterQueryBuilt) {
+		m_instanceClusterQuery = world.query_builder<>()
+			.with<Components::InstanceClusters>()
+			.with<Components::Matrix>()
+			.with<Components::Active>()
+			.build();
+		m_instanceClusterQueryBuilt = true;
+	}
+
+	// Materializing clusters creates entities, so collect the instancers first
+	std::vector<flecs::entity> sources;
+	m_instanceClusterQuery.each([&](flecs::entity e) {
+		sources.push_back(e);
+	});
+	if (sources.empty()) {
+		return;
+	}
+
+	// The view the renderer derives for this camera. Matrices propagate after
+	// Update, so this is last frame's camera and instancer placement.
+	const auto& camera = m_primaryCamera.get<Components::Camera>();
+	const DirectX::XMMATRIX cameraWorld = m_primaryCamera.get<Components::Matrix>().matrix;
+	const DirectX::XMMATRIX view = DirectX::XMMatrixInverse(nullptr, RemoveScalingFromMatrix(cameraWorld));
+	const auto viewPlanes = GetFrustumPlanesPerspective(camera.aspect, camera.fov, camera.zNear, camera.zFar);
+	const DirectX::XMFLOAT3 eyeWorld = GetGlobalPositionFromMatrix(cameraWorld);
+
+	InstanceClusterResidency::Settings settings;
+	settings.maxResidentInstances = getUsdPointInstancerMaxInstances();
+	InstanceClusterResidency::Changes changes;
+
+	for (flecs::entity source : sources) {
+		const std::shared_ptr<const InstanceClusterSet> set = source.get<Components::InstanceClusters>().set;
+		if (!set) {
+			continue;
+		}
+		if (!source.has<Components::InstanceClusterStreaming>()) {
+			Components::InstanceClusterStreaming streaming;
+			streaming.residency.Reset(set->bvh, set->drawablePrototypes);
+			source.set<Components::InstanceClusterStreaming>(std::move(streaming));
+		}
+
+		// Cull in the instancer's space, where the clusters were built
+		const DirectX::XMMATRIX instancerWorld = source.get<Components::Matrix>().matrix;
+		const DirectX::XMMATRIX planeTransform = DirectX::XMMatrixTranspose(DirectX::XMMatrixMultiply(instancerWorld, view));
+		std::array<InstanceClusterBVH::Plane, 6> planes;
+		for (size_t i = 0; i < planes.size(); ++i) {
+			DirectX::XMFLOAT4 plane;
+			DirectX::XMStoreFloat4(&plane, DirectX::XMPlaneNormalize(
+				DirectX::XMVector4Transform(DirectX::XMLoadFloat4(&viewPlanes[i].plane), planeTransform)));
+			planes[i] = { { plane.x, plane.y, plane.z }, plane.w };
+		}
+		DirectX::XMFLOAT3 eye;
+		DirectX::XMStoreFloat3(&eye, DirectX::XMVector3Transform(
+			DirectX::XMLoadFloat3(&eyeWorld), DirectX::XMMatrixInverse(nullptr, instancerWorld)));
+
+		// No occluder proxies exist in the scene yet, so the cull is frustum only
+		InstanceClusterBVH::CullParams params;
+		params.frustumPlanes = planes;
+		params.eye = { eye.x, eye.y, eye.z };
+		m_visibleInstanceClusters.clear();
+		set->bvh.Cull(params, m_visibleInstanceClusters);
+
+		std::vector<flecs::entity> released;
+		{
+			auto& streaming = source.get_mut<Components::InstanceClusterStreaming>();
+			streaming.residency.Update(set->bvh, m_visibleInstanceClusters, params.eye, settings, changes);
+			for (uint32_t clusterIndex : changes.removed) {
+				auto it = streaming.clusterEntities.find(clusterIndex);
+				if (it != streaming.clusterEntities.end()) {
+					released.push_back(it->second);
+					streaming.clusterEntities.erase(it);
+				}
+			}
+		}
+		for (flecs::entity clusterEntity : released) {
+			ReleaseInstanceCluster(clusterEntity);
+		}
+
+		std::vector<flecs::entity> materialized;
+		materialized.reserve(changes.added.size());
+		for (uint32_t clusterIndex : changes.added) {
+			materialized.push_back(MaterializeInstanceCluster(source, *set, clusterIndex));
+		}
+		auto& streaming = source.get_mut<Components::InstanceClusterStreaming>();
+		for (size_t i = 0; i < materialized.size(); ++i) {
+			streaming.clusterEntities[changes.added[i]] = materialized[i];
+		}
+	}
+}
+
+flecs::entity Scene::MaterializeInstanceCluster(flecs::entity source, const InstanceClusterSet& set, uint32_t clusterIndex) {
+	const auto& cluster = set.bvh.GetClusters()[clusterIndex];
+	const auto& instanceOrder = set.bvh.GetInstanceOrder();
+	const auto& prototypeRenderables = set.prototypes[cluster.prototype];
+
+	flecs::entity clusterEntity = CreateNodeECS(set.name + L"_cluster_" + std::to_wstring(clusterIndex));
+	clusterEntity.add<Components::StreamedInstanceCluster>();
+	clusterEntity.child_of(source);
+
+	for (uint32_t position = cluster.firstInstance; position < cluster.firstInstance + cluster.instanceCount; ++position) {
+		const uint32_t instanceIndex = instanceOrder[position];
+		auto instanceEntity = CreateNodeECS(set.name + L"_instance_" + std::to_wstring(instanceIndex));
+		SetInstanceClusterTransform(instanceEntity, set.instances[instanceIndex]);
+		instanceEntity.child_of(clusterEntity);
+
+		for (const auto& prototypeRenderable : prototypeRenderables) {
+			auto renderableEntity = CreateRenderableEntityECS(prototypeRenderable.meshes, prototypeRenderable.name);
+			SetInstanceClusterTransform(renderableEntity, prototypeRenderable.localTransform);
+			renderableEntity.child_of(instanceEntity);
+		}
+	}
+
+	// CreateNodeECS leaves nodes inactive, and the transform system only
+	// places renderables whose whole parent chain is active
+	ActivateHierarchy(clusterEntity);
+	return clusterEntity;
+}
+
+void Scene::ReleaseInstanceCluster(flecs::entity clusterEntity) {
+	if (!clusterEntity.is_alive()) {
+		return;
+	}
+
+	std::vector<flecs::entity> renderables;
+	VisitSceneDescendants(clusterEntity, [&](flecs::entity entity) {
+		if (entity.has<Components::MeshInstances>()) {
+			renderables.push_back(entity);
+		}
+	});
+	for (auto& entity : renderables) {
+		DeactivateRenderable(entity);
+	}
+
+	// The MeshInstances OnRemove observer queues each removal for the bridge
+	clusterEntity.destruct();
+}
@@ -18,6 +18,7 @@
 #include "Utilities/ProcessedTextureCache.h"
 
 #include "DefaultDirection.h"
+#include "Import/Ktx2Transcoder.h"
 #include "Managers/Singletons/DirectStorageManager.h"
 #include "Resources/Sampler.h"
 #include "Render/DescriptorHeap.h"
@@ -700,6 +701,12 @@ LoadTextureFromMemory(const void* bytes,
     if (!bytes || !byteCount)
         throw std::runtime_error("LoadTextureFromMemory: null/empty buffer");
 
+    if (Ktx2Transcoder::IsKtx2Container(bytes, byteCount)) {
+        Ktx2Transcoder::TranscodeRequest request;
+        request.preferSRGB = preferSRGB;
+        return Ktx2Transcoder::LoadTextureFromMemory(bytes, byteCount, sampler, request);
+    }
+
     auto finalizeTexture = [](std::shared_ptr<TextureAsset> texture, const char* detail) {
         if (texture) {
             texture->RecordLoadPath(TextureLoadPathTelemetry::InMemoryContainer, detail);
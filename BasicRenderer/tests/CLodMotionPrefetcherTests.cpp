@@ -0,0 +1,502 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Render/GraphExtensions/ClusterLOD/CLodMotionPrefetcher.h"
+
+namespace
+{
+    constexpr float kPi = 3.14159265358979f;
+
+    void Require(bool condition, const std::string& message)
+    {
+        if (!condition) {
+            throw std::runtime_error(message);
+        }
+    }
+
+    void RunTest(
+        const char* name,
+        const std::function<void()>& fn,
+        int& failureCount)
+    {
+        try {
+            fn();
+            std::cout << "[PASS] " << name << '\n';
+        }
+        catch (const std::exception& ex) {
+            ++failureCount;
+            std::cerr << "[FAIL] " << name << ": " << ex.what() << '\n';
+        }
+    }
+
+    CLodPrefetchCameraPose MakePose(float x, float y, float z, float yawRadians)
+    {
+        CLodPrefetchCameraPose pose{};
+        pose.position[0] = x;
+        pose.position[1] = y;
+        pose.position[2] = z;
+        pose.forward[0] = std::sin(yawRadians);
+        pose.forward[1] = 0.0f;
+        pose.forward[2] = std::cos(yawRadians);
+        pose.tanHalfFovY = std::tan(kPi / 6.0f);
+        pose.aspectRatio = 16.0f / 9.0f;
+        pose.zNear = 0.1f;
+        pose.errorOverDistanceThreshold = 0.02f;
+        return pose;
+    }
+
+    CLodPrefetchInstance MakeInstance(uint32_t groupsBase, float x, float y, float z)
+    {
+        CLodPrefetchInstance instance{};
+        instance.groupsBase = groupsBase;
+        instance.rows[0][0] = 1.0f;
+        instance.rows[1][1] = 1.0f;
+        instance.rows[2][2] = 1.0f;
+        instance.rows[3][0] = x;
+        instance.rows[3][1] = y;
+        instance.rows[3][2] = z;
+        return instance;
+    }
+
+    // Quadtree over a square tile in the XZ plane; error halves per level.
+    std::vector<CLodPrefetchGroup> BuildTileHierarchy(float halfSize, float rootError, uint32_t depth)
+    {
+        std::vector<CLodPrefetchGroup> groups;
+        struct Node { float x; float z; float half; float error; int32_t parent; uint32_t level; };
+        std::vector<Node> frontier{ { 0.0f, 0.0f, halfSize, rootError, -1, 0u } };
+        while (!frontier.empty()) {
+            std::vector<Node> next;
+            for (const Node& node : frontier) {
+                const int32_t index = static_cast<int32_t>(groups.size());
+                CLodPrefetchGroup group{};
+                group.center[0] = node.x;
+                group.center[2] = node.z;
+                group.radius = node.half * std::sqrt(2.0f);
+                group.error = node.error;
+                group.parentLocal = node.parent;
+                groups.push_back(group);
+                if (node.level == depth) {
+                    continue;
+                }
+                const float childHalf = node.half * 0.5f;
+                for (int cz = 0; cz < 2; ++cz) {
+                    for (int cx = 0; cx < 2; ++cx) {
+                        next.push_back({
+                            node.x + (cx == 0 ? -childHalf : childHalf),
+                            node.z + (cz == 0 ? -childHalf : childHalf),
+                            childHalf,
+                            node.error * 0.5f,
+                            index,
+                            node.level + 1u });
+                    }
+                }
+            }
+            frontier = std::move(next);
+        }
+        return groups;
+    }
+
+    struct TileScene {
+        std::vector<std::vector<CLodPrefetchGroup>> tileGroups;
+        std::vector<CLodPrefetchMesh> meshes;
+        std::vector<CLodPrefetchInstance> instances;
+        std::vector<std::vector<std::vector<uint32_t>>> childrenByMesh;
+        std::vector<std::vector<uint32_t>> rootsByMesh;
+        uint32_t groupCount = 0;
+    };
+
+    // Terrain of distinct tiles along +Z, three tiles wide.
+    TileScene BuildTileScene(uint32_t rows)
+    {
+        constexpr float kTileHalf = 32.0f;
+        TileScene scene;
+        scene.tileGroups.reserve(static_cast<size_t>(rows) * 3u);
+        for (uint32_t row = 0; row < rows; ++row) {
+            for (int column = -1; column <= 1; ++column) {
+                scene.tileGroups.push_back(BuildTileHierarchy(kTileHalf, 8.0f, 5u));
+                const uint32_t groupsBase = scene.groupCount;
+                scene.groupCount += static_cast<uint32_t>(scene.tileGroups.back().size());
+                scene.meshes.push_back({ groupsBase, scene.tileGroups.back() });
+                scene.instances.push_back(MakeInstance(
+                    groupsBase,
+                    static_cast<float>(column) * kTileHalf * 2.0f,
+                    0.0f,
+                    static_cast<float>(row) * kTileHalf * 2.0f));
+            }
+        }
+        for (const auto& groups : scene.tileGroups) {
+            auto& children = scene.childrenByMesh.emplace_back(groups.size());
+            auto& roots = scene.rootsByMesh.emplace_back();
+            for (uint32_t local = 0; local < groups.size(); ++local) {
+                if (groups[local].parentLocal < 0) {
+                    roots.push_back(local);
+                } else {
+                    children[static_cast<uint32_t>(groups[local].parentLocal)].push_back(local);
+                }
+            }
+        }
+        return scene;
+    }
+
+    // Groups the exact view needs: the prefetcher's metric without the cone
+    // margin, standing in for GPU feedback.
+    void CollectNeeded(const TileScene& scene, const CLodPrefetchCameraPose& pose, std::vector<uint32_t>& out)
+    {
+        out.clear();
+        const float tanHalfFovX = pose.tanHalfFovY * pose.aspectRatio;
+        const float halfAngle = std::atan(std::sqrt(pose.tanHalfFovY * pose.tanHalfFovY + tanHalfFovX * tanHalfFovX));
+        for (size_t meshIndex = 0; meshIndex < scene.meshes.size(); ++meshIndex) {
+            const CLodPrefetchMesh& mesh = scene.meshes[meshIndex];
+            const CLodPrefetchInstance& instance = scene.instances[meshIndex];
+            const auto& children = scene.childrenByMesh[meshIndex];
+            std::vector<uint32_t> stack = scene.rootsByMesh[meshIndex];
+            while (!stack.empty()) {
+                const uint32_t local = stack.back();
+                stack.pop_back();
+                const CLodPrefetchGroup& group = mesh.groups[local];
+                const float d[3] = {
+                    group.center[0] + instance.rows[3][0] - pose.position[0],
+                    group.center[1] + instance.rows[3][1] - pose.position[1],
+                    group.center[2] + instance.rows[3][2] - pose.position[2],
+                };
+                const float distance = std::sqrt(d[0] * d[0] + d[1] * d[1] + d[2] * d[2]);
+                if (distance > group.radius) {
+                    const float cosAngle = std::clamp((d[0] * pose.forward[0] + d[1] * pose.forward[1] + d[2] * pose.forward[2]) / distance, -1.0f, 1.0f);
+                    if (std::acos(cosAngle) - std::asin(group.radius / distance) > halfAngle) {
+                        continue;
+                    }
+                }
+                out.push_back(mesh.groupsBase + local);
+                if (group.error / (std::max)(distance - group.radius, pose.zNear) >= pose.errorOverDistanceThreshold) {
+                    stack.insert(stack.end(), children[local].begin(), children[local].end());
+                }
+            }
+        }
+    }
+
+    struct ReplayResult {
+        uint64_t missedGroupFrames = 0; // Sum over frames of needed groups not resident
+        CLodMotionPrefetcher::Stats prefetch;
+    };
+
+    // Replays a recorded path against a streamer with fixed IO latency and a
+    // per-frame request cap. Demand requests always go first; speculative
+    // ones only use the capacity left over, as in the streaming system.
+    ReplayResult ReplayPath(
+        const TileScene& scene,
+        const std::vector<CLodPrefetchCameraPose>& path,
+        bool prefetch,
+        uint32_t ioLatencyFrames,
+        uint32_t requestsPerFrame)
+    {
+        CLodMotionPrefetcher prefetcher;
+        CLodMotionPrefetcher::Options options{};
+        options.lookaheadFrames = ioLatencyFrames + 2u;
+        options.maxCandidatesPerUpdate = requestsPerFrame;
+        prefetcher.SetOptions(options);
+        prefetcher.SetMeshes(scene.meshes);
+        prefetcher.SetInstances(scene.instances);
+
+        std::vector<uint8_t> resident(scene.groupCount, 0u);
+        std::vector<uint8_t> inFlight(scene.groupCount, 0u);
+        for (const CLodPrefetchMesh& mesh : scene.meshes) {
+            resident[mesh.groupsBase] = 1u;
+        }
+        struct Completion { uint32_t frame; uint32_t group; };
+        std::deque<Completion> completions;
+        std::deque<uint32_t> demandQueue;
+
+        ReplayResult result;
+        std::vector<uint32_t> needed;
+        std::vector<uint32_t> expired;
+        std::vector<CLodMotionPrefetcher::Candidate> candidates;
+        for (uint32_t frame = 0; frame < path.size(); ++frame) {
+            while (!completions.empty() && completions.front().frame <= frame) {
+                const uint32_t group = completions.front().group;
+                completions.pop_front();
+                inFlight[group] = 0u;
+                resident[group] = 1u;
+                prefetcher.OnGroupResidencyChanged(group, true);
+            }
+
+            CollectNeeded(scene, path[frame], needed);
+            for (uint32_t group : needed) {
+                prefetcher.OnGroupDemanded(group);
+                if (!resident[group]) {
+                    ++result.missedGroupFrames;
+                    if (!inFlight[group]) {
+                        inFlight[group] = 1u;
+                        demandQueue.push_back(group);
+                    }
+                }
+            }
+
+            uint32_t issued = 0;
+            while (issued < requestsPerFrame && !demandQueue.empty()) {
+                completions.push_back({ frame + ioLatencyFrames, demandQueue.front() });
+                demandQueue.pop_front();
+                ++issued;
+            }
+
+            if (prefetch) {
+                prefetcher.ObserveCamera(path[frame]);
+                candidates.clear();
+                prefetcher.CollectCandidates([&](uint32_t group) {
+                    return resident[group] != 0u || inFlight[group] != 0u;
+                }, candidates);
+                for (const auto& candidate : candidates) {
+                    if (issued >= requestsPerFrame) {
+                        break;
+                    }
+                    inFlight[candidate.groupIndex] = 1u;
+                    prefetcher.OnSpeculativeQueued(candidate.groupIndex);
+                    prefetcher.OnSpeculativeIssued(candidate.groupIndex, 64u * 1024u);
+                    completions.push_back({ frame + ioLatencyFrames, candidate.groupIndex });
+                    ++issued;
+                }
+            }
+
+            expired.clear();
+            prefetcher.AdvanceFrame(expired);
+            for (uint32_t group : expired) {
+                prefetcher.OnSpeculativeCancelled(group);
+            }
+        }
+        result.prefetch = prefetcher.GetStats();
+        return result;
+    }
+
+    // Recorded paths: straight fly-over, a banking turn and a stop-and-go run.
+    std::vector<CLodPrefetchCameraPose> RecordStraightPath()
+    {
+        std::vector<CLodPrefetchCameraPose> path;
+        for (uint32_t frame = 0; frame < 300; ++frame) {
+            path.push_back(MakePose(0.0f, 6.0f, -40.0f + 2.0f * static_cast<float>(frame), 0.0f));
+        }
+        return path;
+    }
+
+    std::vector<CLodPrefetchCameraPose> RecordTurningPath()
+    {
+        std::vector<CLodPrefetchCameraPose> path;
+        float x = -20.0f;
+        float z = -40.0f;
+        for (uint32_t frame = 0; frame < 300; ++frame) {
+            const float yaw = 0.35f * std::sin(static_cast<float>(frame) * 0.02f);
+            path.push_back(MakePose(x, 6.0f, z, yaw));
+            x += 2.0f * std::sin(yaw);
+            z += 2.0f * std::cos(yaw);
+        }
+        return path;
+    }
+
+    std::vector<CLodPrefetchCameraPose> RecordStopAndGoPath()
+    {
+        std::vector<CLodPrefetchCameraPose> path;
+        float z = -40.0f;
+        for (uint32_t frame = 0; frame < 360; ++frame) {
+            const bool moving = (frame / 60u) % 2u == 0u;
+            path.push_back(MakePose(0.0f, 6.0f, z, 0.0f));
+            z += moving ? 2.5f : 0.0f;
+        }
+        return path;
+    }
+
+    void CheckPathImproves(const char* label, const std::vector<CLodPrefetchCameraPose>& path, double maxMissRatio, double minHitRate)
+    {
+        const TileScene scene = BuildTileScene(12u);
+        const ReplayResult baseline = ReplayPath(scene, path, false, 6u, 64u);
+        const ReplayResult predicted = ReplayPath(scene, path, true, 6u, 64u);
+        const double missRatio = baseline.missedGroupFrames != 0
+            ? static_cast<double>(predicted.missedGroupFrames) / static_cast<double>(baseline.missedGroupFrames)
+            : 1.0;
+        const CLodMotionPrefetcher::Stats& stats = predicted.prefetch;
+        const double wasteRatio = stats.issued != 0 ? static_cast<double>(stats.wasted) / static_cast<double>(stats.issued) : 0.0;
+        std::cout << "  " << label
+            << ": missed group-frames " << baseline.missedGroupFrames << " -> " << predicted.missedGroupFrames
+            << ", speculative issued " << stats.issued
+            << ", hits " << stats.hits << ", late hits " << stats.lateHits
+            << ", wasted " << stats.wasted << " (" << (stats.wastedBytes >> 10) << " KiB)"
+            << ", hit rate " << stats.HitRate()
+            << ", waste " << wasteRatio << '\n';
+
+        Require(baseline.missedGroupFrames > 0, std::string(label) + ": path never outruns streaming");
+        Require(missRatio <= maxMissRatio, std::string(label) + ": prefetch did not cut missed group-frames enough");
+        Require(stats.HitRate() >= minHitRate, std::string(label) + ": speculative hit rate too low");
+        Require(wasteRatio <= 1.0 - minHitRate, std::string(label) + ": too much wasted IO");
+    }
+}
+
+int main()
+{
+    int failureCount = 0;
+
+    RunTest("PredictPose extrapolates constant linear velocity", [] {
+        CLodMotionPrefetcher prefetcher;
+        for (int frame = 0; frame < 4; ++frame) {
+            prefetcher.ObserveCamera(MakePose(1.0f * frame, 0.0f, -0.5f * frame, 0.0f));
+        }
+        CLodPrefetchCameraPose predicted{};
+        Require(prefetcher.PredictPose(10.0f, predicted), "prediction unavailable");
+        Require(std::abs(predicted.position[0] - 13.0f) < 1e-4f, "x not extrapolated");
+        Require(std::abs(predicted.position[2] + 6.5f) < 1e-4f, "z not extrapolated");
+        Require(std::abs(predicted.forward[2] - 1.0f) < 1e-5f, "forward changed without rotation");
+    }, failureCount);
+
+    RunTest("PredictPose extrapolates constant yaw rate", [] {
+        CLodMotionPrefetcher prefetcher;
+        constexpr float kYawPerFrame = 0.05f;
+        for (int frame = 0; frame < 4; ++frame) {
+            prefetcher.ObserveCamera(MakePose(0.0f, 0.0f, 0.0f, kYawPerFrame * frame));
+        }
+        CLodPrefetchCameraPose predicted{};
+        Require(prefetcher.PredictPose(6.0f, predicted), "prediction unavailable");
+        const float expectedYaw = kYawPerFrame * 9.0f;
+        Require(std::abs(predicted.forward[0] - std::sin(expectedYaw)) < 1e-4f, "yaw x wrong");
+        Require(std::abs(predicted.forward[2] - std::cos(expectedYaw)) < 1e-4f, "yaw z wrong");
+        Require(std::abs(predicted.forward[1]) < 1e-5f, "yaw leaked into pitch");
+    }, failureCount);
+
+    RunTest("A teleport restarts the camera history", [] {
+        CLodMotionPrefetcher prefetcher;
+        CLodPrefetchCameraPose predicted{};
+        Require(!prefetcher.PredictPose(1.0f, predicted), "prediction without history");
+        for (int frame = 0; frame < 4; ++frame) {
+            prefetcher.ObserveCamera(MakePose(0.1f * frame, 0.0f, 0.0f, 0.0f));
+        }
+        Require(prefetcher.PredictPose(1.0f, predicted), "prediction unavailable");
+        prefetcher.ObserveCamera(MakePose(500.0f, 0.0f, 0.0f, 0.0f));
+        Require(!prefetcher.PredictPose(1.0f, predicted), "extrapolated across a teleport");
+        prefetcher.ObserveCamera(MakePose(500.1f, 0.0f, 0.0f, 0.0f));
+        Require(prefetcher.PredictPose(10.0f, predicted), "history did not restart");
+        Require(std::abs(predicted.position[0] - 501.1f) < 1e-3f, "restarted history wrong");
+    }, failureCount);
+
+    RunTest("Candidates follow the predicted view and respect skip and cap", [] {
+        const std::vector<CLodPrefetchGroup> groups = BuildTileHierarchy(32.0f, 8.0f, 4u);
+        const std::vector<CLodPrefetchMesh> meshes{ { 100u, groups }, { 2000u, groups } };
+        // One tile ahead of the camera along +Z, one far behind it.
+        const std::vector<CLodPrefetchInstance> instances{
+            MakeInstance(100u, 0.0f, 0.0f, 80.0f),
+            MakeInstance(2000u, 0.0f, 0.0f, -400.0f),
+        };
+
+        CLodMotionPrefetcher prefetcher;
+        CLodMotionPrefetcher::Options options{};
+        options.maxCandidatesPerUpdate = 16u;
+        prefetcher.SetOptions(options);
+        prefetcher.SetMeshes(meshes);
+        prefetcher.SetInstances(instances);
+
+        std::vector<CLodMotionPrefetcher::Candidate> candidates;
+        prefetcher.CollectCandidates({}, candidates);
+        Require(candidates.empty(), "candidates without camera history");
+
+        for (int frame = 0; frame < 4; ++frame) {
+            prefetcher.ObserveCamera(MakePose(0.0f, 4.0f, 2.0f * frame, 0.0f));
+        }
+        prefetcher.CollectCandidates([](uint32_t group) { return group == 100u; }, candidates);
+        Require(candidates.size() == 16u, "cap not applied");
+        for (size_t i = 0; i < candidates.size(); ++i) {
+            Require(candidates[i].groupIndex > 100u && candidates[i].groupIndex < 100u + groups.size(),
+                "candidate outside the tile in view, or skipped root returned");
+            if (i > 0) {
+                Require(candidates[i - 1].errorOverDistance >= candidates[i].errorOverDistance, "candidates not ordered by urgency");
+            }
+        }
+
+        // Tracked groups are not proposed again.
+        const uint32_t first = candidates.front().groupIndex;
+        prefetcher.OnSpeculativeQueued(first);
+        std::vector<CLodMotionPrefetcher::Candidate> again;
+        prefetcher.CollectCandidates([](uint32_t group) { return group == 100u; }, again);
+        Require(std::none_of(again.begin(), again.end(), [&](const auto& c) { return c.groupIndex == first; }),
+            "queued group proposed twice");
+    }, failureCount);
+
+    RunTest("Speculative loads are classified as hits, late hits, waste or cancellations", [] {
+        CLodMotionPrefetcher prefetcher;
+        CLodMotionPrefetcher::Options options{};
+        options.expiryFrames = 3u;
+        prefetcher.SetOptions(options);
+        std::vector<uint32_t> expired;
+
+        // Hit: resident before it is demanded.
+        prefetcher.OnSpeculativeQueued(1u);
+        Require(prefetcher.IsSpeculativeQueued(1u), "queued group not reported");
+        prefetcher.OnSpeculativeIssued(1u, 1000u);
+        Require(!prefetcher.IsSpeculativeQueued(1u), "issued group still cancellable");
+        prefetcher.OnGroupResidencyChanged(1u, true);
+        prefetcher.OnGroupDemanded(1u);
+
+        // Late hit: demanded while in flight.
+        prefetcher.OnSpeculativeQueued(2u);
+        prefetcher.OnSpeculativeIssued(2u, 1000u);
+        prefetcher.OnGroupDemanded(2u);
+
+        // Promoted while queued: not counted.
+        prefetcher.OnSpeculativeQueued(3u);
+        prefetcher.OnGroupDemanded(3u);
+
+        // Wasted: evicted without demand.
+        prefetcher.OnSpeculativeQueued(4u);
+        prefetcher.OnSpeculativeIssued(4u, 4096u);
+        prefetcher.OnGroupResidencyChanged(4u, true);
+        prefetcher.OnGroupResidencyChanged(4u, false);
+
+        // Cancelled under pressure.
+        prefetcher.OnSpeculativeQueued(5u);
+        prefetcher.OnSpeculativeCancelled(5u);
+
+        // Wasted by expiry, and a queued request expiring for the caller to cancel.
+        prefetcher.OnSpeculativeQueued(6u);
+        prefetcher.OnSpeculativeIssued(6u, 2048u);
+        prefetcher.OnGroupResidencyChanged(6u, true);
+        prefetcher.OnSpeculativeQueued(7u);
+        for (int frame = 0; frame < 4; ++frame) {
+            prefetcher.AdvanceFrame(expired);
+        }
+        Require(expired.size() == 1u && expired.front() == 7u, "queued request did not expire");
+        prefetcher.OnSpeculativeCancelled(7u);
+
+        // Demands for untracked groups are ignored.
+        prefetcher.OnGroupDemanded(6u);
+        prefetcher.OnGroupDemanded(123456u);
+
+        const CLodMotionPrefetcher::Stats& stats = prefetcher.GetStats();
+        Require(stats.queued == 7u, "queued count");
+        Require(stats.issued == 4u && stats.issuedBytes == 1000u + 1000u + 4096u + 2048u, "issued count");
+        Require(stats.hits == 1u, "hit count");
+        Require(stats.lateHits == 1u, "late hit count");
+        Require(stats.wasted == 2u && stats.wastedBytes == 4096u + 2048u, "waste count");
+        Require(stats.cancelled == 2u, "cancel count");
+        Require(std::abs(stats.HitRate() - 0.5) < 1e-9, "hit rate");
+        Require(prefetcher.TrackedCount() == 0u, "tracking leaked");
+    }, failureCount);
+
+    RunTest("Recorded straight fly-over: prefetch hides streaming latency", [] {
+        CheckPathImproves("straight", RecordStraightPath(), 0.4, 0.8);
+    }, failureCount);
+
+    RunTest("Recorded banking turn: prefetch hides streaming latency", [] {
+        CheckPathImproves("turning", RecordTurningPath(), 0.4, 0.8);
+    }, failureCount);
+
+    RunTest("Recorded stop-and-go: prefetch stays useful across stops", [] {
+        CheckPathImproves("stop-and-go", RecordStopAndGoPath(), 0.6, 0.8);
+    }, failureCount);
+
+    if (failureCount != 0) {
+        std::cerr << failureCount << " test(s) failed\n";
+        return 1;
+    }
+    std::cout << "All CLod motion prefetcher tests passed\n";
+    return 0;
+}
@@ -0,0 +1,331 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Import/CLodReadScheduler.h"
+
+namespace
+{
+    using CLodCache::ReadCoalescingOptions;
+    using CLodCache::ReadScheduler;
+
+    // Container layout written by CLodCache: header, page directory, blobs.
+    constexpr uint32_t kContainerMagic = 0x444F4C43u; // CLOD
+    constexpr uint32_t kContainerVersion = 4u;
+
+    struct ContainerHeader {
+        uint32_t magic = kContainerMagic;
+        uint32_t version = kContainerVersion;
+        uint32_t reserved = 0;
+        uint32_t pageCount = 0;
+    };
+
+    struct PageLocator {
+        uint64_t blobOffset = 0;
+        uint32_t blobSizeBytes = 0;
+        uint32_t reserved = 0;
+    };
+
+    void Require(bool condition, const std::string& message)
+    {
+        if (!condition) {
+            throw std::runtime_error(message);
+        }
+    }
+
+    void RunTest(
+        const char* name,
+        const std::function<void()>& fn,
+        int& failureCount)
+    {
+        try {
+            fn();
+            std::cout << "[PASS] " << name << '\n';
+        }
+        catch (const std::exception& ex) {
+            ++failureCount;
+            std::cerr << "[FAIL] " << name << ": " << ex.what() << '\n';
+        }
+    }
+
+    std::byte PatternByte(uint32_t page, uint32_t index)
+    {
+        return static_cast<std::byte>((page * 131u + index * 7u) & 0xFFu);
+    }
+
+    // Writes a container like CLodCache does, with page sizes in [minSize, maxSize].
+    std::vector<PageLocator> WriteContainer(const std::filesystem::path& path, uint32_t pageCount, uint32_t minSize, uint32_t maxSize, uint32_t seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<uint32_t> sizeDist(minSize, maxSize);
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        Require(file.is_open(), "cannot create container");
+        ContainerHeader header{};
+        header.pageCount = pageCount;
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+        std::vector<PageLocator> locators(pageCount);
+        uint64_t offset = sizeof(ContainerHeader) + uint64_t(pageCount) * sizeof(PageLocator);
+        for (PageLocator& locator : locators) {
+            locator.blobOffset = offset;
+            locator.blobSizeBytes = sizeDist(rng);
+            offset += locator.blobSizeBytes;
+        }
+        file.write(reinterpret_cast<const char*>(locators.data()), static_cast<std::streamsize>(locators.size() * sizeof(PageLocator)));
+
+        std::vector<std::byte> blob;
+        for (uint32_t page = 0; page < pageCount; ++page) {
+            blob.resize(locators[page].blobSizeBytes);
+            for (uint32_t i = 0; i < blob.size(); ++i) {
+                blob[i] = PatternByte(page, i);
+            }
+            file.write(reinterpret_cast<const char*>(blob.data()), static_cast<std::streamsize>(blob.size()));
+        }
+        Require(file.good(), "container write failed");
+        return locators;
+    }
+
+    std::vector<PageLocator> ReadDirectory(std::ifstream& file)
+    {
+        ContainerHeader header{};
+        file.read(reinterpret_cast<char*>(&header), sizeof(header));
+        Require(file.good() && header.magic == kContainerMagic && header.version == kContainerVersion, "not a CLod container");
+        std::vector<PageLocator> locators(header.pageCount);
+        file.read(reinterpret_cast<char*>(locators.data()), static_cast<std::streamsize>(locators.size() * sizeof(PageLocator)));
+        Require(file.good(), "truncated page directory");
+        return locators;
+    }
+
+    // One streamed group: the container pages it needs, in output slot order.
+    struct GroupRequest {
+        std::vector<uint32_t> pages;
+    };
+
+    // Sibling groups own consecutive pages; some also reference a page of
+    // their neighbour, as groups sharing a boundary page do.
+    std::vector<GroupRequest> MakeSiblingRequests(uint32_t pageCount, uint32_t groupCount, uint32_t seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<uint32_t> pagesPerGroup(1u, 4u);
+        std::uniform_int_distribution<uint32_t> startDist(0u, pageCount - 1u);
+        std::bernoulli_distribution shareNeighbour(0.25);
+        std::bernoulli_distribution skipSibling(0.3);
+
+        std::vector<GroupRequest> requests;
+        uint32_t page = startDist(rng);
+        while (requests.size() < groupCount) {
+            GroupRequest request;
+            const uint32_t count = pagesPerGroup(rng);
+            for (uint32_t i = 0; i < count && page < pageCount; ++i) {
+                request.pages.push_back(page++);
+            }
+            if (shareNeighbour(rng) && page < pageCount) {
+                request.pages.push_back(page);
+            }
+            if (!request.pages.empty()) {
+                requests.push_back(std::move(request));
+            }
+            if (skipSibling(rng)) {
+                page += pagesPerGroup(rng); // Not requested this frame
+            }
+            if (page >= pageCount) {
+                page = startDist(rng);
+            }
+        }
+        return requests;
+    }
+
+    void PlanRequests(ReadScheduler& plan, const std::vector<GroupRequest>& requests, const std::vector<PageLocator>& locators)
+    {
+        plan.Clear();
+        for (uint32_t requestIndex = 0; requestIndex < requests.size(); ++requestIndex) {
+            const auto& pages = requests[requestIndex].pages;
+            for (uint32_t slot = 0; slot < pages.size(); ++slot) {
+                const PageLocator& locator = locators[pages[slot]];
+                plan.AddRead(requestIndex, slot, locator.blobOffset, locator.blobSizeBytes);
+            }
+        }
+        plan.Build();
+    }
+
+    // Reads the plan from disk and checks every group's pages against a
+    // direct per-page read.
+    void VerifyAgainstDirectReads(std::ifstream& file, const ReadScheduler& plan, const std::vector<GroupRequest>& requests, const std::vector<PageLocator>& locators)
+    {
+        std::vector<std::vector<std::vector<std::byte>>> coalesced(requests.size());
+        for (size_t i = 0; i < requests.size(); ++i) {
+            coalesced[i].resize(requests[i].pages.size());
+        }
+
+        const auto extents = plan.Extents();
+        std::vector<std::byte> extentData;
+        for (uint32_t extentIndex = 0; extentIndex < extents.size(); ++extentIndex) {
+            Require(CLodCache::ReadExtentFromStream(file, extents[extentIndex], extentData), "extent read failed");
+            Require(plan.Scatter(extentIndex, extentData, [&](uint32_t requestIndex, uint32_t pageSlot, std::span<const std::byte> data) {
+                coalesced[requestIndex][pageSlot].assign(data.begin(), data.end());
+            }), "scatter rejected extent data");
+        }
+
+        std::vector<std::byte> direct;
+        for (size_t requestIndex = 0; requestIndex < requests.size(); ++requestIndex) {
+            for (size_t slot = 0; slot < requests[requestIndex].pages.size(); ++slot) {
+                const PageLocator& locator = locators[requests[requestIndex].pages[slot]];
+                CLodCache::ReadExtent single{};
+                single.offset = locator.blobOffset;
+                single.sizeBytes = locator.blobSizeBytes;
+                Require(CLodCache::ReadExtentFromStream(file, single, direct), "direct read failed");
+                Require(coalesced[requestIndex][slot] == direct,
+                    "group " + std::to_string(requestIndex) + " slot " + std::to_string(slot) + " differs from direct read");
+            }
+        }
+    }
+
+    void ReportStats(const char* label, const ReadScheduler& plan)
+    {
+        const auto& stats = plan.GetStats();
+        std::cout << "  " << label << ": page reads " << stats.pageReads
+                  << " -> issued reads " << stats.issuedReads
+                  << ", requested " << (stats.requestedBytes >> 10) << " KiB"
+                  << ", read " << (stats.bytesRead >> 10) << " KiB\n";
+    }
+}
+
+int main(int argc, char** argv)
+{
+    int failureCount = 0;
+    const std::filesystem::path scratch = std::filesystem::temp_directory_path() / "basicrenderer_clod_read_scheduler_tests";
+    std::filesystem::create_directories(scratch);
+
+    RunTest("adjacent and near-adjacent reads merge within the gap limit", []() {
+        ReadCoalescingOptions options;
+        options.maxGapBytes = 64;
+        options.maxReadBytes = 4096;
+        ReadScheduler plan(options);
+        plan.AddRead(0, 0, 100, 100);
+        plan.AddRead(1, 0, 0, 100);
+        plan.AddRead(2, 0, 250, 50);  // 50-byte hole
+        plan.AddRead(3, 0, 1000, 10); // Too far
+        plan.Build();
+
+        const auto extents = plan.Extents();
+        Require(extents.size() == 2, "expected two extents");
+        Require(extents[0].offset == 0 && extents[0].sizeBytes == 300 && extents[0].readCount == 3, "first extent wrong");
+        Require(extents[1].offset == 1000 && extents[1].sizeBytes == 10, "second extent wrong");
+        Require(plan.ExtentReads(0)[0].requestIndex == 1, "reads must be in offset order");
+        Require(plan.GetStats().pageReads == 4 && plan.GetStats().issuedReads == 2, "wrong read counts");
+        Require(plan.GetStats().requestedBytes == 260 && plan.GetStats().bytesRead == 310, "wrong byte counts");
+
+        options.maxGapBytes = 32;
+        plan.SetOptions(options);
+        plan.AddRead(0, 0, 100, 100);
+        plan.AddRead(1, 0, 0, 100);
+        plan.AddRead(2, 0, 250, 50);
+        plan.Build();
+        Require(plan.Extents().size() == 2, "a hole above maxGapBytes must split the read");
+    }, failureCount);
+
+    RunTest("merged reads respect the size limit", []() {
+        ReadCoalescingOptions options;
+        options.maxGapBytes = 0;
+        options.maxReadBytes = 250;
+        ReadScheduler plan(options);
+        for (uint32_t i = 0; i < 5; ++i) {
+            plan.AddRead(i, 0, uint64_t(i) * 100u, 100);
+        }
+        plan.AddRead(5, 0, 500, 1000); // Larger than the limit on its own
+        plan.Build();
+
+        const auto extents = plan.Extents();
+        Require(extents.size() == 4, "expected [0,200) [200,400) [400,500) [500,1500)");
+        for (const auto& extent : extents.first(3)) {
+            Require(extent.sizeBytes <= options.maxReadBytes, "extent exceeds maxReadBytes");
+        }
+        Require(extents[3].sizeBytes == 1000 && extents[3].readCount == 1, "oversized blob must be read alone");
+    }, failureCount);
+
+    RunTest("pages shared by two groups are read once and delivered to both", []() {
+        ReadScheduler plan;
+        plan.AddRead(0, 0, 0, 64);
+        plan.AddRead(0, 1, 64, 64);
+        plan.AddRead(1, 0, 64, 64);
+        plan.Build();
+        Require(plan.Extents().size() == 1 && plan.GetStats().bytesRead == 128, "shared page should be read once");
+
+        std::vector<std::byte> data(128);
+        for (size_t i = 0; i < data.size(); ++i) {
+            data[i] = static_cast<std::byte>(i);
+        }
+        uint32_t delivered = 0;
+        Require(plan.Scatter(0, data, [&](uint32_t requestIndex, uint32_t pageSlot, std::span<const std::byte> page) {
+            const uint32_t expectedFirst = (requestIndex == 0 && pageSlot == 0) ? 0u : 64u;
+            Require(page.size() == 64 && page[0] == static_cast<std::byte>(expectedFirst), "wrong page bytes");
+            ++delivered;
+        }), "scatter failed");
+        Require(delivered == 3, "every read must be delivered");
+
+        std::vector<std::byte> shortData(100);
+        Require(!plan.Scatter(0, shortData, [](uint32_t, uint32_t, std::span<const std::byte>) {
+            throw std::runtime_error("sink called for short data");
+        }), "short extent data must be rejected");
+    }, failureCount);
+
+    RunTest("coalesced reads of an on-disk container match per-page reads", [&scratch]() {
+        const std::filesystem::path path = scratch / "synthetic.clodbin";
+        const std::vector<PageLocator> written = WriteContainer(path, 2048, 2u * 1024u, 48u * 1024u, 7u);
+
+        std::ifstream file(path, std::ios::binary);
+        const std::vector<PageLocator> locators = ReadDirectory(file);
+        Require(locators.size() == written.size(), "directory mismatch");
+
+        const std::vector<GroupRequest> requests = MakeSiblingRequests(static_cast<uint32_t>(locators.size()), 128, 11u);
+        ReadScheduler plan;
+        PlanRequests(plan, requests, locators);
+        VerifyAgainstDirectReads(file, plan, requests, locators);
+        ReportStats("synthetic", plan);
+
+        const auto& stats = plan.GetStats();
+        Require(stats.issuedReads * 2u < stats.pageReads, "sibling requests should at least halve the read count");
+        Require(stats.bytesRead < stats.requestedBytes + uint64_t(stats.issuedReads) * 64u * 1024u, "gap bytes exceed the configured bound");
+        for (const auto& extent : plan.Extents()) {
+            Require(extent.sizeBytes <= plan.GetOptions().maxReadBytes || extent.readCount == 1, "extent exceeds maxReadBytes");
+        }
+
+        file.close();
+        std::filesystem::remove(path);
+    }, failureCount);
+
+    // Any .clodbin containers given on the command line are checked the same way.
+    for (int arg = 1; arg < argc; ++arg) {
+        const std::string path = argv[arg];
+        RunTest(("container " + path).c_str(), [&path]() {
+            std::ifstream file(path, std::ios::binary);
+            Require(file.is_open(), "cannot open container");
+            const std::vector<PageLocator> locators = ReadDirectory(file);
+            Require(!locators.empty(), "container has no pages");
+            const std::vector<GroupRequest> requests = MakeSiblingRequests(static_cast<uint32_t>(locators.size()), 128, 3u);
+            ReadScheduler plan;
+            PlanRequests(plan, requests, locators);
+            VerifyAgainstDirectReads(file, plan, requests, locators);
+            ReportStats(path.c_str(), plan);
+        }, failureCount);
+    }
+
+    std::filesystem::remove_all(scratch);
+
+    if (failureCount != 0) {
+        std::cerr << failureCount << " CLod read scheduler test(s) failed\n";
+        return 1;
+    }
+
+    std::cout << "All CLod read scheduler tests passed\n";
+    return 0;
+}
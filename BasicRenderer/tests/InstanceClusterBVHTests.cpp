@@ -0,0 +1,291 @@
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Scene/InstanceClusterBVH.h"
+#include "Scene/InstanceClusterResidency.h"
+
+using Float3 = InstanceClusterBVH::Float3;
+using Aabb = InstanceClusterBVH::Aabb;
+using Plane = InstanceClusterBVH::Plane;
+
+namespace
+{
+    constexpr uint32_t kInstanceCount = 1000;
+
+    void Require(bool condition, const std::string& message)
+    {
+        if (!condition) {
+            throw std::runtime_error(message);
+        }
+    }
+
+    void RunTest(
+        const char* name,
+        const std::function<void()>& fn,
+        int& failureCount)
+    {
+        try {
+            fn();
+            std::cout << "[PASS] " << name << '\n';
+        }
+        catch (const std::exception& ex) {
+            ++failureCount;
+            std::cerr << "[FAIL] " << name << ": " << ex.what() << '\n';
+        }
+    }
+
+    // A row of instances along +x, one unit apart, with a little spread in y.
+    // Even instances use prototype 0, odd ones prototype 1.
+    struct Row {
+        std::vector<Float3> centers;
+        std::vector<uint32_t> prototypes;
+        InstanceClusterBVH bvh;
+    };
+
+    Row BuildRow()
+    {
+        Row row;
+        for (uint32_t i = 0; i < kInstanceCount; ++i) {
+            row.centers.push_back({ static_cast<float>(i), static_cast<float>(i % 3) - 1.0f, 0.0f });
+            row.prototypes.push_back(i % 2u);
+        }
+        InstanceClusterBVH::BuildSettings settings;
+        settings.maxInstancesPerCluster = 16;
+        settings.maxClustersPerLeaf = 2;
+        row.bvh.Build(row.centers, {}, row.prototypes, settings);
+        return row;
+    }
+
+    // Cull, check the flat path agrees, and return which instances survived.
+    std::vector<bool> CullInstances(const Row& row, const InstanceClusterBVH::CullParams& params, InstanceClusterBVH::CullStats& stats)
+    {
+        std::vector<uint32_t> visible;
+        row.bvh.Cull(params, visible, &stats);
+
+        std::vector<uint32_t> flat;
+        row.bvh.CullFlat(params, flat);
+        std::vector<uint32_t> sortedVisible = visible;
+        std::sort(sortedVisible.begin(), sortedVisible.end());
+        std::sort(flat.begin(), flat.end());
+        Require(sortedVisible == flat, "hierarchical and flat culls disagree");
+
+        std::vector<bool> survived(kInstanceCount, false);
+        uint64_t instanceCount = 0;
+        for (uint32_t clusterIndex : visible) {
+            const auto& cluster = row.bvh.GetClusters()[clusterIndex];
+            for (uint32_t position = cluster.firstInstance; position < cluster.firstInstance + cluster.instanceCount; ++position) {
+                const uint32_t instance = row.bvh.GetInstanceOrder()[position];
+                Require(!survived[instance], "instance in two visible clusters");
+                survived[instance] = true;
+            }
+            instanceCount += cluster.instanceCount;
+        }
+        Require(stats.clustersVisible == visible.size(), "visible cluster stat");
+        Require(stats.visibleInstances == instanceCount, "visible instance stat");
+        return survived;
+    }
+
+    std::vector<bool> ResidentInstances(const Row& row, const InstanceClusterResidency& residency)
+    {
+        std::vector<bool> resident(kInstanceCount, false);
+        uint64_t instanceCount = 0;
+        for (uint32_t clusterIndex : residency.GetResidentClusters()) {
+            const auto& cluster = row.bvh.GetClusters()[clusterIndex];
+            for (uint32_t position = cluster.firstInstance; position < cluster.firstInstance + cluster.instanceCount; ++position) {
+                resident[row.bvh.GetInstanceOrder()[position]] = true;
+            }
+            instanceCount += cluster.instanceCount;
+        }
+        Require(residency.GetResidentInstanceCount() == instanceCount, "resident instance count");
+        return resident;
+    }
+}
+
+int main()
+{
+    int failureCount = 0;
+    const Row row = BuildRow();
+
+    RunTest("build partitions instances into single-prototype clusters", [&]() {
+        Require(row.bvh.GetInstanceCount() == kInstanceCount, "instance count");
+        std::vector<bool> seen(kInstanceCount, false);
+        for (const auto& cluster : row.bvh.GetClusters()) {
+            Require(cluster.instanceCount > 0 && cluster.instanceCount <= 16u, "cluster size");
+            for (uint32_t position = cluster.firstInstance; position < cluster.firstInstance + cluster.instanceCount; ++position) {
+                const uint32_t instance = row.bvh.GetInstanceOrder()[position];
+                Require(!seen[instance], "instance in two clusters");
+                seen[instance] = true;
+                Require(row.prototypes[instance] == cluster.prototype, "mixed prototypes in a cluster");
+                const Float3& c = row.centers[instance];
+                Require(c.x >= cluster.bounds.min.x && c.x <= cluster.bounds.max.x
+                    && c.y >= cluster.bounds.min.y && c.y <= cluster.bounds.max.y, "center outside cluster bounds");
+            }
+        }
+        Require(std::all_of(seen.begin(), seen.end(), [](bool value) { return value; }), "instance missing from clusters");
+    }, failureCount);
+
+    RunTest("default params keep everything", [&]() {
+        InstanceClusterBVH::CullStats stats;
+        const std::vector<bool> survived = CullInstances(row, {}, stats);
+        Require(std::all_of(survived.begin(), survived.end(), [](bool value) { return value; }), "instance culled");
+        Require(stats.frustumCulled == 0 && stats.distanceCulled == 0 && stats.occluded == 0, "unexpected rejections");
+    }, failureCount);
+
+    RunTest("frustum planes reject clusters outside", [&]() {
+        // 500 <= x <= 599.5
+        const Plane planes[] = {
+            { { 1.0f, 0.0f, 0.0f }, -500.0f },
+            { { -1.0f, 0.0f, 0.0f }, 599.5f },
+        };
+        InstanceClusterBVH::CullParams params;
+        params.frustumPlanes = planes;
+        InstanceClusterBVH::CullStats stats;
+        const std::vector<bool> survived = CullInstances(row, params, stats);
+        for (uint32_t i = 0; i < kInstanceCount; ++i) {
+            if (i >= 500 && i < 600) {
+                Require(survived[i], "instance inside the frustum culled: " + std::to_string(i));
+            }
+        }
+        // Clusters span at most 32 units of x, so anything far outside is gone.
+        Require(!survived[400] && !survived[0] && !survived[700] && !survived[999], "instance outside the frustum kept");
+        Require(stats.frustumCulled > 0, "no frustum rejections recorded");
+    }, failureCount);
+
+    RunTest("distance limits are global and per prototype", [&]() {
+        InstanceClusterBVH::CullParams params;
+        params.eye = { -10.0f, 0.0f, 0.0f };
+        params.maxDistance = 110.0f;
+        InstanceClusterBVH::CullStats stats;
+        std::vector<bool> survived = CullInstances(row, params, stats);
+        for (uint32_t i = 0; i <= 99; ++i) {
+            Require(survived[i], "near instance culled: " + std::to_string(i));
+        }
+        Require(!survived[200] && !survived[999], "far instance kept");
+        Require(stats.distanceCulled > 0, "no distance rejections recorded");
+
+        // Prototype 1 may not appear beyond 5 units, so none of it survives.
+        const float prototypeLimits[] = { 1000.0f, 5.0f };
+        params.prototypeMaxDistances = prototypeLimits;
+        survived = CullInstances(row, params, stats);
+        for (uint32_t i = 0; i < kInstanceCount; ++i) {
+            if (i % 2u == 1u) {
+                Require(!survived[i], "prototype 1 instance kept: " + std::to_string(i));
+            }
+            else if (i <= 99) {
+                Require(survived[i], "prototype 0 instance culled: " + std::to_string(i));
+            }
+        }
+    }, failureCount);
+
+    RunTest("occluders hide clusters entirely behind them", [&]() {
+        // A wall across the row at x = 300 hides everything past it from an
+        // eye on the row; clusters straddling the wall stay visible.
+        const Aabb wall[] = { { { 300.0f, -50.0f, -50.0f }, { 301.0f, 50.0f, 50.0f } } };
+        InstanceClusterBVH::CullParams params;
+        params.eye = { -10.0f, 0.0f, 0.0f };
+        params.occluders = wall;
+        InstanceClusterBVH::CullStats stats;
+        std::vector<bool> survived = CullInstances(row, params, stats);
+        for (uint32_t i = 0; i <= 300; ++i) {
+            Require(survived[i], "instance in front of the wall culled: " + std::to_string(i));
+        }
+        Require(!survived[400] && !survived[999], "instance behind the wall kept");
+        Require(stats.occluded > 0, "no occlusion recorded");
+
+        // The same wall moved off to the side hides nothing.
+        const Aabb sideWall[] = { { { 300.0f, 10.0f, -50.0f }, { 301.0f, 60.0f, 50.0f } } };
+        params.occluders = sideWall;
+        survived = CullInstances(row, params, stats);
+        Require(std::all_of(survived.begin(), survived.end(), [](bool value) { return value; }), "side wall hid an instance");
+        Require(stats.occluded == 0, "unexpected occlusion");
+    }, failureCount);
+
+    RunTest("residency admits the nearest visible clusters within the budget", [&]() {
+        const uint8_t drawable[] = { 1, 1 };
+        InstanceClusterResidency residency;
+        residency.Reset(row.bvh, drawable);
+        std::vector<uint32_t> visible;
+        row.bvh.Cull({}, visible);
+
+        InstanceClusterResidency::Settings settings;
+        settings.maxResidentInstances = 100;
+        InstanceClusterResidency::Changes changes;
+        residency.Update(row.bvh, visible, { -10.0f, 0.0f, 0.0f }, settings, changes);
+        Require(changes.added.size() == residency.GetResidentClusters().size() && changes.removed.empty(), "first update changes");
+        Require(residency.GetResidentInstanceCount() <= 100 && residency.GetResidentInstanceCount() > 100 - 16, "budget not spent");
+        const std::vector<bool> resident = ResidentInstances(row, residency);
+        Require(resident[0] && resident[1], "nearest instances not resident");
+        Require(!resident[500] && !resident[999], "far instances resident");
+
+        // Moving the eye to the other end swaps the resident set.
+        residency.Update(row.bvh, visible, { 1010.0f, 0.0f, 0.0f }, settings, changes);
+        const std::vector<bool> moved = ResidentInstances(row, residency);
+        Require(moved[999] && !moved[0], "residency did not follow the eye");
+        Require(!changes.removed.empty() && !changes.added.empty(), "move reported no changes");
+        Require(residency.GetResidentInstanceCount() <= 100, "budget exceeded after the move");
+    }, failureCount);
+
+    RunTest("residency skips and does not charge undrawable prototypes", [&]() {
+        const uint8_t drawable[] = { 1, 0 };
+        InstanceClusterResidency residency;
+        residency.Reset(row.bvh, drawable);
+        std::vector<uint32_t> visible;
+        row.bvh.Cull({}, visible);
+
+        InstanceClusterResidency::Settings settings;
+        settings.maxResidentInstances = 100;
+        InstanceClusterResidency::Changes changes;
+        residency.Update(row.bvh, visible, { -10.0f, 0.0f, 0.0f }, settings, changes);
+        const std::vector<bool> resident = ResidentInstances(row, residency);
+        for (uint32_t i = 1; i < kInstanceCount; i += 2) {
+            Require(!resident[i], "undrawable instance resident: " + std::to_string(i));
+        }
+        Require(residency.GetResidentInstanceCount() > 100 - 16, "undrawable clusters were charged to the budget");
+
+        // Prototypes past the drawable list have nothing to draw either.
+        residency.Reset(row.bvh, std::span<const uint8_t>(drawable, 1));
+        residency.Update(row.bvh, visible, { -10.0f, 0.0f, 0.0f }, settings, changes);
+        Require(!ResidentInstances(row, residency)[1], "prototype past the drawable list resident");
+    }, failureCount);
+
+    RunTest("residency keeps clusters for a while after they leave the view", [&]() {
+        const uint8_t drawable[] = { 1, 1 };
+        InstanceClusterResidency residency;
+        residency.Reset(row.bvh, drawable);
+        std::vector<uint32_t> visible;
+        row.bvh.Cull({}, visible);
+
+        InstanceClusterResidency::Settings settings;
+        settings.lingerUpdates = 2;
+        InstanceClusterResidency::Changes changes;
+        residency.Update(row.bvh, visible, {}, settings, changes);
+        Require(residency.GetResidentInstanceCount() == kInstanceCount, "unlimited budget left instances out");
+
+        residency.Update(row.bvh, {}, {}, settings, changes);
+        residency.Update(row.bvh, {}, {}, settings, changes);
+        Require(changes.removed.empty() && residency.GetResidentInstanceCount() == kInstanceCount, "cluster evicted inside the linger window");
+
+        // Coming back into view inside the window rebuilds nothing.
+        residency.Update(row.bvh, visible, {}, settings, changes);
+        Require(changes.added.empty() && changes.removed.empty(), "returning clusters were rebuilt");
+
+        for (uint32_t update = 0; update < 3; ++update) {
+            residency.Update(row.bvh, {}, {}, settings, changes);
+        }
+        Require(residency.GetResidentClusters().empty() && residency.GetResidentInstanceCount() == 0, "clusters outlived the linger window");
+        Require(changes.removed.size() == row.bvh.GetClusters().size(), "evictions not reported");
+    }, failureCount);
+
+    if (failureCount != 0) {
+        std::cerr << failureCount << " instance cluster test(s) failed\n";
+        return 1;
+    }
+
+    std::cout << "All instance cluster tests passed\n";
+    return 0;
+}
@@ -0,0 +1,286 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Utilities/MemoryBudgetArbiter.h"
+
+namespace
+{
+    constexpr uint64_t kMiB = 1024ull * 1024ull;
+
+    void Require(bool condition, const std::string& message)
+    {
+        if (!condition) {
+            throw std::runtime_error(message);
+        }
+    }
+
+    void RunTest(
+        const char* name,
+        const std::function<void()>& fn,
+        int& failureCount)
+    {
+        try {
+            fn();
+            std::cout << "[PASS] " << name << '\n';
+        }
+        catch (const std::exception& ex) {
+            ++failureCount;
+            std::cerr << "[FAIL] " << name << ": " << ex.what() << '\n';
+        }
+    }
+
+    // Quality of the first `bytes` above minBytes on a normalized curve.
+    double CurveQuality(const budget::MemoryDemand& demand, uint64_t bytes)
+    {
+        double quality = 0.0;
+        for (const budget::MemoryDemandSegment& segment : demand.segments) {
+            const uint64_t taken = (std::min)(bytes, segment.bytes);
+            quality += static_cast<double>(taken) / budget::kBytesPerMiB * segment.qualityPerMiB;
+            bytes -= taken;
+        }
+        return quality;
+    }
+
+    // Best quality over every split of the budget in whole MiB.
+    double BruteForceQuality(const std::vector<budget::MemoryDemand>& demands, size_t index, uint64_t remainingMiB)
+    {
+        if (index == demands.size()) {
+            return 0.0;
+        }
+        const budget::MemoryDemand& demand = demands[index];
+        const uint64_t headroomMiB = (demand.TotalBytes() - demand.minBytes) / kMiB;
+        double best = 0.0;
+        for (uint64_t mib = 0; mib <= (std::min)(headroomMiB, remainingMiB); ++mib) {
+            best = (std::max)(best, CurveQuality(demand, mib * kMiB) + BruteForceQuality(demands, index + 1u, remainingMiB - mib));
+        }
+        return best;
+    }
+
+    // A scripted consumer for the frame simulator: demand follows a trace
+    // with optional per-frame noise, and the published cap is recorded.
+    struct SimulatedConsumer {
+        std::function<budget::MemoryDemand(uint32_t frame)> trace;
+        double noise = 0.0;
+        uint64_t cap = 0u;
+        uint32_t publishCount = 0u;
+    };
+
+    budget::MemoryDemand FlatDemand(uint64_t minMiB, uint64_t wantedMiB, double qualityPerMiB)
+    {
+        budget::MemoryDemand demand;
+        demand.minBytes = minMiB * kMiB;
+        demand.quantumBytes = 64u * 1024u;
+        demand.segments.push_back({ wantedMiB * kMiB, qualityPerMiB });
+        return demand;
+    }
+
+    // Mip-chain shaped: each step costs four times the previous one and buys
+    // the same one unit of quality.
+    budget::MemoryDemand MipChainDemand(uint64_t minMiB, uint32_t steps, double firstStepMiB)
+    {
+        budget::MemoryDemand demand;
+        demand.minBytes = minMiB * kMiB;
+        demand.quantumBytes = 64u * 1024u;
+        double stepMiB = firstStepMiB;
+        for (uint32_t i = 0; i < steps; ++i) {
+            demand.segments.push_back({ static_cast<uint64_t>(stepMiB * kMiB), 1.0 / stepMiB });
+            stepMiB *= 4.0;
+        }
+        return demand;
+    }
+
+    void Register(budget::MemoryBudgetArbiter& arbiter, const std::string& name, SimulatedConsumer& consumer, std::mt19937& rng, const uint32_t& frame)
+    {
+        arbiter.AddConsumer(
+            name,
+            [&consumer, &rng, &frame](budget::MemoryDemand& demand) {
+                demand = consumer.trace(frame);
+                if (consumer.noise > 0.0) {
+                    std::uniform_real_distribution<double> jitter(1.0 - consumer.noise, 1.0 + consumer.noise);
+                    for (budget::MemoryDemandSegment& segment : demand.segments) {
+                        segment.bytes = static_cast<uint64_t>(static_cast<double>(segment.bytes) * jitter(rng));
+                        segment.qualityPerMiB *= jitter(rng);
+                    }
+                }
+            },
+            [&consumer](uint64_t cap) {
+                consumer.cap = cap;
+                ++consumer.publishCount;
+            });
+    }
+}
+
+int main()
+{
+    int failureCount = 0;
+
+    RunTest("normalization pools a convex step into its concave envelope", []() {
+        budget::MemoryDemand demand;
+        demand.quantumBytes = kMiB;
+        demand.segments = { { 10u * kMiB, 1.0 }, { 10u * kMiB, 3.0 }, { 4u * kMiB, 0.5 } };
+        const budget::MemoryDemand normalized = budget::NormalizeMemoryDemand(demand);
+
+        Require(normalized.segments.size() == 2u, "the rising pair should merge into one segment");
+        Require(normalized.segments[0].bytes == 20u * kMiB, "merged segment keeps both sizes");
+        Require(std::abs(normalized.segments[0].qualityPerMiB - 2.0) < 1e-9, "merged segment averages the quality");
+        Require(normalized.segments[1].bytes == 4u * kMiB, "falling tail is kept");
+    }, failureCount);
+
+    RunTest("normalization rounds boundaries to the quantum", []() {
+        budget::MemoryDemand demand;
+        demand.minBytes = 100u;
+        demand.quantumBytes = 4096u;
+        demand.segments = { { 1000u, 8.0 }, { 1000u, 4.0 }, { 9000u, 1.0 } };
+        const budget::MemoryDemand normalized = budget::NormalizeMemoryDemand(demand);
+
+        Require(normalized.minBytes == 4096u, "minimum rounds up");
+        for (const budget::MemoryDemandSegment& segment : normalized.segments) {
+            Require(segment.bytes % 4096u == 0u, "segment is not a whole number of quanta");
+        }
+        Require(normalized.TotalBytes() == 16384u, "total should cover min plus every segment, rounded up");
+    }, failureCount);
+
+    RunTest("solver matches brute force on small concave curves", []() {
+        std::mt19937 rng(3u);
+        std::uniform_int_distribution<uint32_t> segmentCount(1u, 4u);
+        std::uniform_int_distribution<uint32_t> segmentMiB(1u, 6u);
+        std::uniform_real_distribution<double> quality(0.1, 10.0);
+        for (uint32_t trial = 0; trial < 200; ++trial) {
+            std::vector<budget::MemoryDemand> demands(3);
+            for (budget::MemoryDemand& demand : demands) {
+                demand.minBytes = (trial % 3u) * kMiB;
+                demand.quantumBytes = kMiB;
+                const uint32_t count = segmentCount(rng);
+                for (uint32_t s = 0; s < count; ++s) {
+                    demand.segments.push_back({ segmentMiB(rng) * kMiB, quality(rng) });
+                }
+                demand = budget::NormalizeMemoryDemand(demand);
+            }
+
+            const uint64_t budgetMiB = 6u + trial % 30u;
+            const budget::MemoryBudgetSolution solution = budget::SolveMemoryBudget(demands, budgetMiB * kMiB);
+            uint64_t minimumMiB = 0u;
+            for (const budget::MemoryDemand& demand : demands) {
+                minimumMiB += demand.minBytes / kMiB;
+            }
+            const double best = BruteForceQuality(demands, 0u, budgetMiB - minimumMiB);
+
+            Require(solution.allocatedTotalBytes <= budgetMiB * kMiB, "allocation exceeds the budget");
+            Require(std::abs(solution.quality - best) <= 1e-6 * (std::max)(best, 1.0),
+                "trial " + std::to_string(trial) + ": greedy quality " + std::to_string(solution.quality) +
+                " differs from optimum " + std::to_string(best));
+        }
+    }, failureCount);
+
+    RunTest("unsatisfiable minimums are reported and granted as-is", []() {
+        const std::vector<budget::MemoryDemand> demands = {
+            budget::NormalizeMemoryDemand(FlatDemand(300u, 100u, 1.0)),
+            budget::NormalizeMemoryDemand(FlatDemand(300u, 100u, 2.0)),
+        };
+        const budget::MemoryBudgetSolution solution = budget::SolveMemoryBudget(demands, 512u * kMiB);
+        Require(!solution.satisfiesMinimumBudget, "minimums over budget must be flagged");
+        Require(solution.allocatedBytes[0] == 300u * kMiB && solution.allocatedBytes[1] == 300u * kMiB, "minimums must still be granted");
+    }, failureCount);
+
+    RunTest("scripted trace: caps fit the budget, hold under noise and follow a pressure spike", []() {
+        std::mt19937 rng(17u);
+        uint32_t frame = 0u;
+
+        // Textures want a full mip chain, CLod pages a flat pool that doubles
+        // while the camera flies into a dense area, voxels a small flat pool.
+        SimulatedConsumer textures{ [](uint32_t) { return MipChainDemand(64u, 5u, 2.0); }, 0.03 };
+        SimulatedConsumer pages{ [](uint32_t f) { return FlatDemand(32u, f >= 200u && f < 400u ? 1024u : 512u, 0.6); }, 0.03 };
+        SimulatedConsumer voxels{ [](uint32_t) { return FlatDemand(16u, 128u, 0.4); }, 0.03 };
+
+        budget::MemoryBudgetArbiterSettings settings;
+        settings.settleFrames = 6u;
+        budget::MemoryBudgetArbiter arbiter(settings);
+        Register(arbiter, "textures", textures, rng, frame);
+        Register(arbiter, "clodPages", pages, rng, frame);
+        Register(arbiter, "voxels", voxels, rng, frame);
+
+        uint32_t changesWhileSteady = 0u;
+        for (frame = 0u; frame < 600u; ++frame) {
+            // The OS takes a third of the budget away for 100 frames.
+            const uint64_t budgetBytes = (frame >= 450u && frame < 550u ? 1024u : 1536u) * kMiB;
+            const budget::MemoryBudgetArbiter::Stats& stats = arbiter.Update(budgetBytes);
+
+            Require(stats.capTotalBytes <= budgetBytes,
+                "frame " + std::to_string(frame) + ": caps " + std::to_string(stats.capTotalBytes / kMiB) +
+                " MiB exceed budget " + std::to_string(budgetBytes / kMiB) + " MiB");
+            Require(textures.cap + pages.cap + voxels.cap == stats.capTotalBytes, "published caps disagree with stats");
+            Require(textures.cap >= 64u * kMiB && pages.cap >= 32u * kMiB && voxels.cap >= 16u * kMiB, "a cap fell below its minimum");
+
+            if ((frame > 20u && frame < 200u) || (frame > 230u && frame < 400u)) {
+                changesWhileSteady += stats.capChanges;
+            }
+            if (frame == 450u) {
+                Require(stats.capChanges > 0u, "caps must shrink on the frame the budget drops");
+            }
+        }
+        Require(changesWhileSteady == 0u, "caps moved " + std::to_string(changesWhileSteady) + " times under steady noisy demand");
+        Require(pages.publishCount >= 3u, "page cap should follow the demand change and the spike");
+    }, failureCount);
+
+    RunTest("alternating priorities do not flip caps every frame", []() {
+        std::mt19937 rng(5u);
+        uint32_t frame = 0u;
+        SimulatedConsumer a{ [](uint32_t f) { return FlatDemand(0u, 800u, f % 2u == 0u ? 1.0 : 0.5); } };
+        SimulatedConsumer b{ [](uint32_t f) { return FlatDemand(0u, 800u, f % 2u == 0u ? 0.5 : 1.0); } };
+
+        budget::MemoryBudgetArbiter arbiter;
+        Register(arbiter, "a", a, rng, frame);
+        Register(arbiter, "b", b, rng, frame);
+        for (frame = 0u; frame < 120u; ++frame) {
+            arbiter.Update(1024u * kMiB);
+        }
+        Require(a.publishCount == 1u && b.publishCount == 1u, "caps should hold while the targets keep swapping");
+    }, failureCount);
+
+    RunTest("growth waits for the memory another consumer is still holding", []() {
+        std::mt19937 rng(9u);
+        uint32_t frame = 0u;
+        SimulatedConsumer a{ [](uint32_t f) { return FlatDemand(0u, 1024u, f < 10u ? 1.0 : 0.1); } };
+        SimulatedConsumer b{ [](uint32_t) { return FlatDemand(0u, 1024u, 0.5); } };
+
+        budget::MemoryBudgetArbiterSettings settings;
+        settings.settleFrames = 4u;
+        budget::MemoryBudgetArbiter arbiter(settings);
+        Register(arbiter, "a", a, rng, frame);
+        Register(arbiter, "b", b, rng, frame);
+        for (frame = 0u; frame < 40u; ++frame) {
+            const uint64_t budgetBytes = 1024u * kMiB;
+            Require(arbiter.Update(budgetBytes).capTotalBytes <= budgetBytes, "caps exceed the budget during the handover");
+        }
+        Require(a.cap == 0u && b.cap == 1024u * kMiB, "budget should end up with the consumer that values it more");
+    }, failureCount);
+
+    RunTest("duplicate consumer names are rejected", []() {
+        budget::MemoryBudgetArbiter arbiter;
+        arbiter.AddConsumer("textures", {}, {});
+        bool threw = false;
+        try {
+            arbiter.AddConsumer("textures", {}, {});
+        }
+        catch (const std::runtime_error&) {
+            threw = true;
+        }
+        Require(threw, "second registration must throw");
+        Require(arbiter.RemoveConsumer("textures") && !arbiter.RemoveConsumer("textures"), "remove should succeed exactly once");
+    }, failureCount);
+
+    if (failureCount != 0) {
+        std::cerr << failureCount << " memory budget test(s) failed\n";
+        return 1;
+    }
+
+    std::cout << "All memory budget tests passed\n";
+    return 0;
+}
@@ -0,0 +1,280 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Managers/ReadbackDiskWriter.h"
+
+namespace
+{
+    constexpr uint32_t kFormatR8G8B8A8Unorm = 28;
+    constexpr uint32_t kFormatBC7Unorm = 98;
+    constexpr size_t kDdsPayloadOffset = 4 + 124 + 20;
+
+    void Require(bool condition, const std::string& message)
+    {
+        if (!condition) {
+            throw std::runtime_error(message);
+        }
+    }
+
+    uint32_t ReadU32(const std::string& bytes, size_t offset)
+    {
+        uint32_t value = 0;
+        std::memcpy(&value, bytes.data() + offset, sizeof(value));
+        return value;
+    }
+
+    std::string LoadFile(const std::filesystem::path& path)
+    {
+        std::ifstream stream(path, std::ios::binary);
+        return std::string((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+    }
+
+    // A synthetic readback buffer laid out like D3D12 copyable footprints:
+    // 256-byte row pitch and 512-byte aligned subresources, each pixel
+    // encoding (subresource, x, y) so misplaced rows are detectable.
+    struct SyntheticFootprint {
+        std::vector<std::byte> buffer;
+        std::vector<br::ReadbackSubresourceLayout> layouts;
+        std::string expectedPayload;
+    };
+
+    SyntheticFootprint BuildFootprint(uint32_t width, uint32_t height, uint32_t mipLevels, uint32_t slices)
+    {
+        SyntheticFootprint footprint;
+        uint64_t offset = 0;
+        for (uint32_t slice = 0; slice < slices; ++slice) {
+            for (uint32_t mip = 0; mip < mipLevels; ++mip) {
+                const uint32_t mipWidth = (std::max)(width >> mip, 1u);
+                const uint32_t mipHeight = (std::max)(height >> mip, 1u);
+                br::ReadbackSubresourceLayout layout;
+                layout.offset = (offset + 511u) & ~uint64_t(511u);
+                layout.rowBytes = mipWidth * 4u;
+                layout.rowPitch = (layout.rowBytes + 255u) & ~255u;
+                layout.rowCount = mipHeight;
+                footprint.layouts.push_back(layout);
+                offset = layout.offset + uint64_t(layout.rowPitch) * layout.rowCount;
+            }
+        }
+
+        footprint.buffer.assign(offset, std::byte{ 0xCD });
+        for (size_t index = 0; index < footprint.layouts.size(); ++index) {
+            const auto& layout = footprint.layouts[index];
+            for (uint32_t y = 0; y < layout.rowCount; ++y) {
+                for (uint32_t x = 0; x < layout.rowBytes / 4u; ++x) {
+                    const uint8_t pixel[4] = {
+                        static_cast<uint8_t>(index), static_cast<uint8_t>(x), static_cast<uint8_t>(y), 0xFF };
+                    std::memcpy(footprint.buffer.data() + layout.offset + uint64_t(y) * layout.rowPitch + x * 4u, pixel, 4);
+                    footprint.expectedPayload.append(reinterpret_cast<const char*>(pixel), 4);
+                }
+            }
+        }
+        return footprint;
+    }
+
+    br::ReadbackDiskWriter::TaskRunner ThreadRunner()
+    {
+        return [](std::function<void()> task) {
+            std::thread(std::move(task)).detach();
+        };
+    }
+
+    void RunTest(
+        const char* name,
+        const std::function<void()>& fn,
+        int& failureCount)
+    {
+        try {
+            fn();
+            std::cout << "[PASS] " << name << '\n';
+        }
+        catch (const std::exception& ex) {
+            ++failureCount;
+            std::cerr << "[FAIL] " << name << ": " << ex.what() << '\n';
+        }
+    }
+}
+
+int main()
+{
+    int failureCount = 0;
+    const std::filesystem::path scratch = std::filesystem::temp_directory_path() / "basicrenderer_readback_tests";
+    std::filesystem::create_directories(scratch);
+
+    RunTest("dds payload strips footprint row padding", []() {
+        const SyntheticFootprint footprint = BuildFootprint(37, 19, 3, 1);
+        br::ReadbackImageDesc image{ 37, 19, 3, 1, false, kFormatR8G8B8A8Unorm };
+
+        std::ostringstream out;
+        Require(br::WriteReadbackDds(out, image, footprint.layouts, footprint.buffer.data()), "write failed");
+        const std::string bytes = out.str();
+
+        Require(bytes.size() == kDdsPayloadOffset + footprint.expectedPayload.size(), "unexpected file size");
+        Require(bytes.compare(0, 4, "DDS ") == 0, "missing DDS magic");
+        Require(ReadU32(bytes, 4 + 12) == 37 && ReadU32(bytes, 4 + 8) == 19, "wrong dimensions");
+        Require(ReadU32(bytes, 4 + 24) == 3, "wrong mip count");
+        Require(ReadU32(bytes, 4 + 124) == kFormatR8G8B8A8Unorm, "wrong DXGI format");
+        Require(ReadU32(bytes, 4 + 124 + 12) == 1, "wrong array size");
+        Require(bytes.compare(kDdsPayloadOffset, std::string::npos, footprint.expectedPayload) == 0, "payload mismatch");
+    }, failureCount);
+
+    RunTest("pitch flags follow the format", []() {
+        const SyntheticFootprint footprint = BuildFootprint(37, 19, 1, 1);
+        br::ReadbackImageDesc image{ 37, 19, 1, 1, false, kFormatR8G8B8A8Unorm };
+        std::ostringstream out;
+        Require(br::WriteReadbackDds(out, image, footprint.layouts, footprint.buffer.data()), "write failed");
+        const std::string bytes = out.str();
+        Require((ReadU32(bytes, 4 + 4) & 0x8) != 0 && (ReadU32(bytes, 4 + 4) & 0x80000) == 0, "uncompressed should set DDSD_PITCH");
+        Require(ReadU32(bytes, 4 + 16) == 37u * 4u, "wrong row pitch");
+
+        // 64x32 BC7 is 16x8 blocks of 16 bytes.
+        std::vector<br::ReadbackSubresourceLayout> layouts(1);
+        layouts[0].rowBytes = 16u * 16u;
+        layouts[0].rowPitch = 256u;
+        layouts[0].rowCount = 8u;
+        const std::vector<std::byte> blocks(layouts[0].rowPitch * layouts[0].rowCount, std::byte{ 0x5A });
+        br::ReadbackImageDesc compressed{ 64, 32, 1, 1, false, kFormatBC7Unorm };
+        std::ostringstream compressedOut;
+        Require(br::WriteReadbackDds(compressedOut, compressed, layouts, blocks.data()), "compressed write failed");
+        const std::string compressedBytes = compressedOut.str();
+        Require((ReadU32(compressedBytes, 4 + 4) & 0x80000) != 0 && (ReadU32(compressedBytes, 4 + 4) & 0x8) == 0, "compressed should set DDSD_LINEARSIZE");
+        Require(ReadU32(compressedBytes, 4 + 16) == 16u * 16u * 8u, "wrong linear size");
+    }, failureCount);
+
+    RunTest("cubemap header and face-major payload", []() {
+        const SyntheticFootprint footprint = BuildFootprint(16, 16, 5, 6);
+        br::ReadbackImageDesc image{ 16, 16, 5, 6, true, kFormatR8G8B8A8Unorm };
+
+        std::ostringstream out;
+        Require(br::WriteReadbackDds(out, image, footprint.layouts, footprint.buffer.data()), "write failed");
+        const std::string bytes = out.str();
+
+        Require(ReadU32(bytes, 4 + 108) == 0xFE00, "cubemap caps2 not set");
+        Require(ReadU32(bytes, 4 + 124 + 8) == 0x4, "cubemap misc flag not set");
+        Require(ReadU32(bytes, 4 + 124 + 12) == 1, "cubemap array size should count cubes");
+        Require(bytes.compare(kDdsPayloadOffset, std::string::npos, footprint.expectedPayload) == 0, "payload mismatch");
+    }, failureCount);
+
+    RunTest("mismatched subresource count is rejected", []() {
+        const SyntheticFootprint footprint = BuildFootprint(8, 8, 2, 1);
+        br::ReadbackImageDesc image{ 8, 8, 3, 1, false, kFormatR8G8B8A8Unorm };
+        std::ostringstream out;
+        Require(!br::WriteReadbackDds(out, image, footprint.layouts, footprint.buffer.data()), "expected failure");
+    }, failureCount);
+
+    RunTest("writer streams dds and raw files and unmaps", [&scratch]() {
+        const SyntheticFootprint footprint = BuildFootprint(64, 32, 1, 1);
+        std::atomic<int> mapCalls{ 0 };
+        std::atomic<int> unmapCalls{ 0 };
+        std::atomic<int> succeeded{ -1 };
+
+        {
+            br::ReadbackDiskWriter writer(1u << 20, ThreadRunner());
+            br::ReadbackWriteJob job;
+            job.image = { 64, 32, 1, 1, false, kFormatR8G8B8A8Unorm };
+            job.subresources = footprint.layouts;
+            job.footprintBytes = footprint.buffer.size();
+            job.ddsPath = scratch / "writer.dds";
+            job.rawPath = scratch / "writer.raw";
+            job.map = [&]() { ++mapCalls; return footprint.buffer.data(); };
+            job.unmap = [&]() { ++unmapCalls; };
+            job.onComplete = [&](bool ok) { succeeded = ok ? 1 : 0; };
+            writer.Submit(std::move(job));
+            writer.WaitIdle();
+            Require(writer.GetInFlightBytes() == 0, "budget not released");
+        }
+
+        Require(succeeded == 1, "job did not report success");
+        Require(mapCalls == 1 && unmapCalls == 1, "map/unmap not paired");
+        Require(LoadFile(scratch / "writer.raw") == footprint.expectedPayload, "raw payload mismatch");
+        Require(LoadFile(scratch / "writer.dds").substr(kDdsPayloadOffset) == footprint.expectedPayload, "dds payload mismatch");
+    }, failureCount);
+
+    RunTest("in-flight bytes stay within budget", [&scratch]() {
+        const SyntheticFootprint footprint = BuildFootprint(128, 128, 1, 1);
+        const uint64_t jobBytes = footprint.buffer.size();
+        const uint64_t budget = jobBytes * 2;
+
+        br::ReadbackDiskWriter writer(budget, ThreadRunner());
+        std::mutex gateMutex;
+        gateMutex.lock();
+        std::atomic<uint64_t> peakBytes{ 0 };
+        std::atomic<int> completed{ 0 };
+
+        auto makeJob = [&](int index) {
+            br::ReadbackWriteJob job;
+            job.image = { 128, 128, 1, 1, false, kFormatR8G8B8A8Unorm };
+            job.subresources = footprint.layouts;
+            job.footprintBytes = jobBytes;
+            job.rawPath = scratch / ("budget" + std::to_string(index) + ".raw");
+            job.map = [&]() {
+                // Hold the first jobs open until the test has probed backpressure.
+                std::scoped_lock hold(gateMutex);
+                return footprint.buffer.data();
+            };
+            job.onComplete = [&](bool) {
+                uint64_t observed = writer.GetInFlightBytes();
+                uint64_t peak = peakBytes.load();
+                while (observed > peak && !peakBytes.compare_exchange_weak(peak, observed)) {
+                }
+                ++completed;
+            };
+            return job;
+        };
+
+        br::ReadbackWriteJob first = makeJob(0);
+        br::ReadbackWriteJob second = makeJob(1);
+        br::ReadbackWriteJob third = makeJob(2);
+        Require(writer.TrySubmit(first), "first job should fit");
+        Require(writer.TrySubmit(second), "second job should fit");
+        Require(!writer.TrySubmit(third), "third job should be refused while the budget is full");
+        Require(static_cast<bool>(third.map), "refused job must be left intact");
+
+        std::thread producer([&]() {
+            for (int index = 3; index < 8; ++index) {
+                writer.Submit(makeJob(index));
+            }
+        });
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        Require(writer.GetInFlightBytes() <= budget, "blocking submit exceeded the budget");
+        gateMutex.unlock();
+        producer.join();
+        writer.Submit(std::move(third));
+        writer.WaitIdle();
+
+        Require(completed == 8, "not every job completed");
+        Require(peakBytes.load() <= budget, "peak in-flight bytes exceeded the budget");
+    }, failureCount);
+
+    RunTest("oversized job is admitted when idle", []() {
+        const SyntheticFootprint footprint = BuildFootprint(32, 32, 1, 1);
+        br::ReadbackDiskWriter writer(16, [](std::function<void()> task) { task(); });
+        br::ReadbackWriteJob job;
+        job.footprintBytes = footprint.buffer.size();
+        job.map = [&]() { return footprint.buffer.data(); };
+        Require(writer.TrySubmit(job), "idle writer must accept an oversized job");
+        Require(writer.GetInFlightBytes() == 0, "inline job should have finished");
+    }, failureCount);
+
+    std::filesystem::remove_all(scratch);
+
+    if (failureCount != 0) {
+        std::cerr << failureCount << " readback writer test(s) failed\n";
+        return 1;
+    }
+
+    std::cout << "All readback writer tests passed\n";
+    return 0;
+}
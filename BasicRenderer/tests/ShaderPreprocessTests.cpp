@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "Managers/Singletons/brslHelpers.h"
+#include "Managers/Singletons/ShaderPreprocessCache.h"
 
 namespace
 {
@@ -454,6 +455,110 @@ void OverflowCS(uint3 dispatchThreadId : SV_DispatchThreadID)
             "found non-UTF-8 shader files under " + shaderRoot.string());
         }, failureCount);
 
+    RunTest("line directive file list is unique and unescaped", []() {
+        const std::string source =
+            "#line 1 \"hlsl.hlsl\"\n"
+            "#line 1 \"C:\\\\shaders\\\\include\\\\common.hlsli\"\n"
+            "float A() { return 1.0f; }\n"
+            "#line 4 \"hlsl.hlsl\"\n"
+            "# 7 \"lighting.hlsli\"\n";
+
+        const std::vector<std::string> files = CollectPreprocessedSourceFiles(source.data(), source.size());
+        Require(files.size() == 3, "expected three distinct source files");
+        Require(files[0] == "hlsl.hlsl", "root buffer should be listed first");
+        Require(files[1] == "C:\\shaders\\include\\common.hlsli", "escaped backslashes should be collapsed");
+        Require(files[2] == "lighting.hlsli", "short-form line markers should be recognised");
+        }, failureCount);
+
+    RunTest("preprocess cache invalidates when a nested include changes", []() {
+        const std::filesystem::path root = std::filesystem::temp_directory_path() / "basicrenderer_preprocess_cache_tests";
+        std::filesystem::remove_all(root);
+        std::filesystem::create_directories(root / "include");
+
+        const std::filesystem::path rootFile = root / "main.hlsl";
+        const std::filesystem::path outerInclude = root / "include" / "outer.hlsli";
+        const std::filesystem::path nestedInclude = root / "include" / "nested.hlsli";
+        WriteUtf8File(rootFile, "#include \"include/outer.hlsli\"\n");
+        WriteUtf8File(outerInclude, "#include \"nested.hlsli\"\n");
+        WriteUtf8File(nestedInclude, "#define NESTED_VALUE 1\n");
+
+        // Shaped like DXC -P output: the buffer name first, includes by relative and absolute path.
+        const std::string preprocessed =
+            "#line 1 \"hlsl.hlsl\"\n"
+            "#line 1 \"include/outer.hlsli\"\n"
+            "#line 1 \"" + nestedInclude.generic_string() + "\"\n"
+            "float Nested() { return 1.0f; }\n";
+
+        ShaderPreprocessCache cache({ root });
+        const uint64_t key = 42;
+        Require(!cache.FindPreprocessed(key).has_value(), "empty cache should miss");
+
+        cache.StorePreprocessed(key, preprocessed, rootFile);
+        const std::optional<std::string> hit = cache.FindPreprocessed(key);
+        Require(hit.has_value() && *hit == preprocessed, "unchanged closure should return the stored bytes");
+
+        WriteUtf8File(nestedInclude, "#define NESTED_VALUE 22\n");
+        Require(!cache.FindPreprocessed(key).has_value(), "editing a nested include should invalidate the entry");
+        Require(cache.GetStats().preprocessInvalidations == 1, "expected one invalidation");
+
+        cache.StorePreprocessed(key, preprocessed, rootFile);
+        Require(cache.FindPreprocessed(key).has_value(), "re-stored entry should hit again");
+
+        WriteUtf8File(rootFile, "#include \"include/outer.hlsli\"\n// edited\n");
+        Require(!cache.FindPreprocessed(key).has_value(), "editing the root file should invalidate the entry");
+
+        std::filesystem::remove_all(root);
+        }, failureCount);
+
+    RunTest("preprocess cache skips entries with unresolvable includes", []() {
+        const std::string preprocessed =
+            "#line 1 \"hlsl.hlsl\"\n"
+            "#line 1 \"does/not/exist.hlsli\"\n"
+            "float Missing() { return 1.0f; }\n";
+
+        ShaderPreprocessCache cache;
+        cache.StorePreprocessed(7, preprocessed);
+        Require(!cache.FindPreprocessed(7).has_value(), "entries with unknown dependencies must not be cached");
+        Require(cache.GetStats().uncacheablePreprocesses == 1, "expected the entry to be reported as uncacheable");
+        }, failureCount);
+
+    RunTest("prepared source cache output is byte-identical", []() {
+        const std::string source = R"(
+float UsedHelper()
+{
+    return 1.0f;
+}
+
+float DeadLeaf()
+{
+    return 2.0f;
+}
+
+[numthreads(8, 8, 1)]
+void CachedCS(uint3 dispatchThreadId : SV_DispatchThreadID)
+{
+    uint cameraBufferIndex = ResourceDescriptorIndex(Builtin::CameraBuffer);
+    float value = UsedHelper();
+}
+)";
+
+        ShaderPreprocessCache cache;
+        const std::shared_ptr<const PreparedShaderSource> first = cache.Prepare(MakeBuffer(source), { "CachedCS" });
+        const std::shared_ptr<const PreparedShaderSource> second = cache.Prepare(MakeBuffer(source), { "CachedCS" });
+        Require(first == second, "identical source and roots should share one analysis");
+        Require(cache.GetStats().prepareHits == 1 && cache.GetStats().prepareMisses == 1, "expected one miss then one hit");
+
+        PreparedShaderSource direct = PrepareShaderSourceForEntryPoint(MakeBuffer(source), "CachedCS");
+        PreparedShaderSource cached = *second;
+        const std::unordered_map<std::string, std::string> replacementMap = BuildSequentialReplacementMap(direct);
+        Require(FinalizePreparedShaderSource(cached, replacementMap) == FinalizePreparedShaderSource(direct, replacementMap),
+            "cached analysis should finalize to the same bytes as a fresh parse");
+
+        const std::string edited = source + "\nfloat Appended() { return 3.0f; }\n";
+        Require(cache.Prepare(MakeBuffer(edited), { "CachedCS" }) != first, "different source should not hit");
+        Require(cache.Prepare(MakeBuffer(source), { "UsedHelper" }) != first, "different roots should not hit");
+        }, failureCount);
+
     if (failureCount != 0) {
         std::cerr << failureCount << " shader preprocessing test(s) failed\n";
         return 1;
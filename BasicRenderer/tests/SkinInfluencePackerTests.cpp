@@ -0,0 +1,221 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Import/SkinInfluencePacker.h"
+
+namespace
+{
+    constexpr uint32_t kMaxInfluences = SkinInfluencePacker::kMaxInfluences;
+
+    struct BoneWeight {
+        uint32_t vertexId = 0;
+        float weight = 0.0f;
+    };
+
+    // Bone-major weights, as Assimp stores them.
+    using Bones = std::vector<std::vector<BoneWeight>>;
+
+    struct Packed {
+        uint32_t joints[kMaxInfluences] = {};
+        float weights[kMaxInfluences] = {};
+    };
+    static_assert(sizeof(Packed) == SkinInfluencePacker::kPackedBytes, "packed layout");
+
+    void Require(bool condition, const std::string& message)
+    {
+        if (!condition) {
+            throw std::runtime_error(message);
+        }
+    }
+
+    void RunTest(
+        const char* name,
+        const std::function<void()>& fn,
+        int& failureCount)
+    {
+        try {
+            fn();
+            std::cout << "[PASS] " << name << '\n';
+        }
+        catch (const std::exception& ex) {
+            ++failureCount;
+            std::cerr << "[FAIL] " << name << ": " << ex.what() << '\n';
+        }
+    }
+
+    std::vector<Packed> PackWith(SkinInfluencePacker& packer, const Bones& bones, uint32_t vertexCount)
+    {
+        packer.Reset(vertexCount);
+        for (const auto& bone : bones) {
+            for (const BoneWeight& w : bone) {
+                packer.CountInfluence(w.vertexId, w.weight);
+            }
+        }
+        for (uint32_t joint = 0; joint < bones.size(); ++joint) {
+            for (const BoneWeight& w : bones[joint]) {
+                packer.AddInfluence(w.vertexId, joint, w.weight);
+            }
+        }
+
+        // Interleave with unrelated bytes to check the stride.
+        constexpr size_t kStride = SkinInfluencePacker::kPackedBytes + 24u;
+        std::vector<std::byte> stream(static_cast<size_t>(vertexCount) * kStride, std::byte{ 0xCD });
+        packer.Pack(stream.data() + 24u, kStride);
+
+        std::vector<Packed> packed(vertexCount);
+        for (uint32_t v = 0; v < vertexCount; ++v) {
+            Require(stream[static_cast<size_t>(v) * kStride] == std::byte{ 0xCD }, "wrote outside the influence slot");
+            std::memcpy(&packed[v], stream.data() + static_cast<size_t>(v) * kStride + 24u, sizeof(Packed));
+        }
+        return packed;
+    }
+
+    // The per-vertex top-N table the Assimp extractor used before the packer.
+    std::vector<Packed> PackReference(const Bones& bones, uint32_t vertexCount)
+    {
+        struct Influence {
+            uint32_t joint;
+            float weight;
+        };
+        std::vector<std::vector<Influence>> perVertex(vertexCount);
+        for (uint32_t joint = 0; joint < bones.size(); ++joint) {
+            for (const BoneWeight& w : bones[joint]) {
+                if (w.weight > 0.0f && w.vertexId < vertexCount) {
+                    perVertex[w.vertexId].push_back({ joint, w.weight });
+                }
+            }
+        }
+
+        std::vector<Packed> packed(vertexCount);
+        for (uint32_t v = 0; v < vertexCount; ++v) {
+            auto& influences = perVertex[v];
+            std::stable_sort(influences.begin(), influences.end(), [](const Influence& a, const Influence& b) {
+                return a.weight > b.weight;
+            });
+            influences.resize((std::min)(influences.size(), size_t{ kMaxInfluences }));
+            float sum = 0.0f;
+            for (const Influence& influence : influences) {
+                sum += influence.weight;
+            }
+            for (size_t i = 0; i < influences.size(); ++i) {
+                packed[v].joints[i] = influences[i].joint;
+                packed[v].weights[i] = influences[i].weight / sum;
+            }
+        }
+        return packed;
+    }
+
+    Bones RandomBones(uint32_t vertexCount, uint32_t boneCount, uint32_t maxPerVertex, std::mt19937& rng)
+    {
+        Bones bones(boneCount);
+        std::uniform_int_distribution<uint32_t> countDist(1, maxPerVertex);
+        std::uniform_int_distribution<uint32_t> boneDist(0, boneCount - 1);
+        std::uniform_real_distribution<float> weightDist(0.01f, 1.0f);
+        for (uint32_t v = 0; v < vertexCount; ++v) {
+            std::vector<uint32_t> used;
+            const uint32_t count = countDist(rng);
+            while (used.size() < count) {
+                const uint32_t bone = boneDist(rng);
+                if (std::find(used.begin(), used.end(), bone) == used.end()) {
+                    used.push_back(bone);
+                    bones[bone].push_back({ v, weightDist(rng) });
+                }
+            }
+        }
+        return bones;
+    }
+
+    void RequireSame(const std::vector<Packed>& actual, const std::vector<Packed>& expected)
+    {
+        Require(actual.size() == expected.size(), "vertex count");
+        for (size_t v = 0; v < actual.size(); ++v) {
+            for (uint32_t i = 0; i < kMaxInfluences; ++i) {
+                Require(actual[v].joints[i] == expected[v].joints[i], "joint mismatch at vertex " + std::to_string(v));
+                Require(std::abs(actual[v].weights[i] - expected[v].weights[i]) <= 1.0e-6f, "weight mismatch at vertex " + std::to_string(v));
+            }
+        }
+    }
+}
+
+int main()
+{
+    int failureCount = 0;
+    std::mt19937 rng(7u);
+
+    RunTest("matches the per-vertex reference", [&]() {
+        const Bones bones = RandomBones(5000, 64, 6, rng);
+        SkinInfluencePacker packer;
+        RequireSame(PackWith(packer, bones, 5000), PackReference(bones, 5000));
+        Require(packer.TruncatedVertexCount() == 0u, "nothing should be truncated");
+        Require(packer.MaxInfluenceCount() <= 6u, "max influence count");
+    }, failureCount);
+
+    RunTest("keeps the heaviest eight and renormalizes", [&]() {
+        const Bones bones = RandomBones(2000, 32, 12, rng);
+        SkinInfluencePacker packer;
+        const std::vector<Packed> packed = PackWith(packer, bones, 2000);
+        RequireSame(packed, PackReference(bones, 2000));
+        Require(packer.TruncatedVertexCount() > 0u, "expected truncated vertices");
+        for (const Packed& p : packed) {
+            float sum = 0.0f;
+            for (uint32_t i = 0; i < kMaxInfluences; ++i) {
+                sum += p.weights[i];
+                Require(i == 0 || p.weights[i] <= p.weights[i - 1], "weights not descending");
+            }
+            Require(std::abs(sum - 1.0f) < 1.0e-5f, "weights do not sum to one");
+        }
+    }, failureCount);
+
+    RunTest("ties keep joint order", [&]() {
+        Bones bones(10);
+        for (uint32_t joint = 0; joint < bones.size(); ++joint) {
+            bones[joint].push_back({ 0, 0.1f });
+        }
+        SkinInfluencePacker packer;
+        const std::vector<Packed> packed = PackWith(packer, bones, 1);
+        for (uint32_t i = 0; i < kMaxInfluences; ++i) {
+            Require(packed[0].joints[i] == i, "tie order");
+            Require(std::abs(packed[0].weights[i] - 0.125f) < 1.0e-6f, "tie weight");
+        }
+    }, failureCount);
+
+    RunTest("ignores non-positive weights and bad vertices", [&]() {
+        Bones bones(3);
+        bones[0] = { { 0, 0.0f }, { 1, 1.0f }, { 9, 1.0f } };
+        bones[1] = { { 0, -0.5f }, { 1, 1.0f } };
+        bones[2] = { { 0, std::nanf("") } };
+        SkinInfluencePacker packer;
+        const std::vector<Packed> packed = PackWith(packer, bones, 2);
+        for (uint32_t i = 0; i < kMaxInfluences; ++i) {
+            Require(packed[0].joints[i] == 0u && packed[0].weights[i] == 0.0f, "unweighted vertex not zeroed");
+        }
+        Require(packed[1].joints[0] == 0u && packed[1].joints[1] == 1u, "vertex 1 joints");
+        Require(packed[1].weights[0] == 0.5f && packed[1].weights[1] == 0.5f, "vertex 1 weights");
+    }, failureCount);
+
+    RunTest("reuse across meshes", [&]() {
+        SkinInfluencePacker packer;
+        const Bones large = RandomBones(3000, 40, 8, rng);
+        const Bones small = RandomBones(100, 4, 3, rng);
+        PackWith(packer, large, 3000);
+        RequireSame(PackWith(packer, small, 100), PackReference(small, 100));
+        RequireSame(PackWith(packer, large, 3000), PackReference(large, 3000));
+    }, failureCount);
+
+    if (failureCount != 0) {
+        std::cerr << failureCount << " skin influence packer test(s) failed\n";
+        return 1;
+    }
+
+    std::cout << "All skin influence packer tests passed\n";
+    return 0;
+}
@@ -0,0 +1,376 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Mesh/SkinnedBounds.h"
+
+namespace
+{
+    // Row-vector affine matrix laid out like XMMATRIX: p' = p * M.
+    using Mat4 = std::array<float, 16>;
+
+    constexpr uint32_t kBoneCount = 8;
+    constexpr float kBoneLength = 1.0f;
+    constexpr float kLimbRadius = 0.25f;
+
+    struct SkinningVertex {
+        float position[3] = {};
+        float normal[3] = { 0.0f, 1.0f, 0.0f };
+        uint32_t joints[8] = {};
+        float weights[8] = {};
+    };
+    static_assert(sizeof(SkinningVertex) == 88, "matches the packed skinning stream");
+
+    void Require(bool condition, const std::string& message)
+    {
+        if (!condition) {
+            throw std::runtime_error(message);
+        }
+    }
+
+    void RunTest(
+        const char* name,
+        const std::function<void()>& fn,
+        int& failureCount)
+    {
+        try {
+            fn();
+            std::cout << "[PASS] " << name << '\n';
+        }
+        catch (const std::exception& ex) {
+            ++failureCount;
+            std::cerr << "[FAIL] " << name << ": " << ex.what() << '\n';
+        }
+    }
+
+    Mat4 Identity()
+    {
+        return { 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1 };
+    }
+
+    Mat4 Multiply(const Mat4& a, const Mat4& b)
+    {
+        Mat4 r{};
+        for (int row = 0; row < 4; ++row) {
+            for (int col = 0; col < 4; ++col) {
+                float sum = 0.0f;
+                for (int k = 0; k < 4; ++k) {
+                    sum += a[row * 4 + k] * b[k * 4 + col];
+                }
+                r[row * 4 + col] = sum;
+            }
+        }
+        return r;
+    }
+
+    Mat4 Translation(float x, float y, float z)
+    {
+        Mat4 m = Identity();
+        m[12] = x;
+        m[13] = y;
+        m[14] = z;
+        return m;
+    }
+
+    Mat4 Scale(float x, float y, float z)
+    {
+        Mat4 m = Identity();
+        m[0] = x;
+        m[5] = y;
+        m[10] = z;
+        return m;
+    }
+
+    // Rotation about a unit axis, row-vector form.
+    Mat4 Rotation(float ax, float ay, float az, float angle)
+    {
+        const float c = std::cos(angle);
+        const float s = std::sin(angle);
+        const float t = 1.0f - c;
+        Mat4 m = Identity();
+        m[0] = t * ax * ax + c;      m[1] = t * ax * ay + s * az; m[2] = t * ax * az - s * ay;
+        m[4] = t * ax * ay - s * az; m[5] = t * ay * ay + c;      m[6] = t * ay * az + s * ax;
+        m[8] = t * ax * az + s * ay; m[9] = t * ay * az - s * ax; m[10] = t * az * az + c;
+        return m;
+    }
+
+    void TransformPoint(const float p[3], const Mat4& m, float out[3])
+    {
+        for (int axis = 0; axis < 3; ++axis) {
+            out[axis] = p[0] * m[0 + axis] + p[1] * m[4 + axis] + p[2] * m[8 + axis] + m[12 + axis];
+        }
+    }
+
+    // A limb along +Y: kBoneCount segments, each vertex blended between the
+    // two nearest bones like a typical skinned arm or tail.
+    std::vector<SkinningVertex> BuildLimb(uint32_t ringCount, uint32_t ringVertices)
+    {
+        std::vector<SkinningVertex> vertices;
+        const float height = kBoneLength * static_cast<float>(kBoneCount);
+        for (uint32_t ring = 0; ring < ringCount; ++ring) {
+            const float y = height * static_cast<float>(ring) / static_cast<float>(ringCount - 1);
+            const float boneCoord = (std::min)(y / kBoneLength, static_cast<float>(kBoneCount) - 1e-4f);
+            const uint32_t bone = static_cast<uint32_t>(boneCoord);
+            const float local = boneCoord - static_cast<float>(bone);
+            for (uint32_t i = 0; i < ringVertices; ++i) {
+                const float angle = 6.2831853f * static_cast<float>(i) / static_cast<float>(ringVertices);
+                SkinningVertex v{};
+                v.position[0] = kLimbRadius * std::cos(angle);
+                v.position[1] = y;
+                v.position[2] = kLimbRadius * std::sin(angle);
+                // Blend into the next bone over the upper half of each segment.
+                const float blend = (bone + 1 < kBoneCount && local > 0.5f) ? (local - 0.5f) : 0.0f;
+                v.joints[0] = bone;
+                v.weights[0] = 1.0f - blend;
+                if (blend > 0.0f) {
+                    v.joints[1] = bone + 1;
+                    v.weights[1] = blend;
+                }
+                vertices.push_back(v);
+            }
+        }
+        return vertices;
+    }
+
+    std::span<const std::byte> AsBytes(const std::vector<SkinningVertex>& vertices)
+    {
+        return std::as_bytes(std::span<const SkinningVertex>(vertices));
+    }
+
+    // Skin matrices for a curled chain: bone k rotates about its joint and
+    // carries its children; the root also moves and optionally scales.
+    std::vector<float> PoseChain(std::mt19937& rng, float maxAngle, bool nonUniformScale)
+    {
+        std::uniform_real_distribution<float> angleDist(-maxAngle, maxAngle);
+        std::uniform_real_distribution<float> offsetDist(-2.0f, 2.0f);
+        std::uniform_real_distribution<float> scaleDist(0.7f, 1.4f);
+
+        Mat4 root = Translation(offsetDist(rng), offsetDist(rng), offsetDist(rng));
+        if (nonUniformScale) {
+            root = Multiply(Scale(scaleDist(rng), scaleDist(rng), scaleDist(rng)), root);
+        }
+
+        std::vector<float> skinMatrices(kBoneCount * 16u);
+        Mat4 parentSkin = root;
+        for (uint32_t bone = 0; bone < kBoneCount; ++bone) {
+            const float jointY = kBoneLength * static_cast<float>(bone);
+            const Mat4 local = Multiply(
+                Multiply(Translation(0.0f, -jointY, 0.0f), Multiply(Rotation(0.0f, 0.0f, 1.0f, angleDist(rng)), Rotation(1.0f, 0.0f, 0.0f, angleDist(rng)))),
+                Translation(0.0f, jointY, 0.0f));
+            // Row vectors: the bone's own rotation applies before its parent's.
+            const Mat4 skin = Multiply(local, parentSkin);
+            std::memcpy(skinMatrices.data() + bone * 16u, skin.data(), sizeof(float) * 16u);
+            parentSkin = skin;
+        }
+        return skinMatrices;
+    }
+
+    void SkinVertex(const SkinningVertex& v, std::span<const float> skinMatrices, float out[3])
+    {
+        out[0] = out[1] = out[2] = 0.0f;
+        for (int influence = 0; influence < 8; ++influence) {
+            if (v.weights[influence] == 0.0f) {
+                continue;
+            }
+            Mat4 m{};
+            std::memcpy(m.data(), skinMatrices.data() + v.joints[influence] * 16u, sizeof(float) * 16u);
+            float p[3];
+            TransformPoint(v.position, m, p);
+            for (int axis = 0; axis < 3; ++axis) {
+                out[axis] += v.weights[influence] * p[axis];
+            }
+        }
+    }
+
+    bool Contains(const SkinnedBoundsSphere& sphere, const float p[3])
+    {
+        const float dx = p[0] - sphere.center[0];
+        const float dy = p[1] - sphere.center[1];
+        const float dz = p[2] - sphere.center[2];
+        const float slack = 1.0e-4f * (std::max)(1.0f, sphere.radius);
+        return std::sqrt(dx * dx + dy * dy + dz * dz) <= sphere.radius + slack;
+    }
+
+    // The previous bound: the whole-mesh sphere posed by every bone.
+    std::vector<BoneInfluenceSphere> WholeMeshSpheres(const std::vector<SkinningVertex>& vertices)
+    {
+        float lo[3] = { 1e30f, 1e30f, 1e30f };
+        float hi[3] = { -1e30f, -1e30f, -1e30f };
+        for (const auto& v : vertices) {
+            for (int axis = 0; axis < 3; ++axis) {
+                lo[axis] = (std::min)(lo[axis], v.position[axis]);
+                hi[axis] = (std::max)(hi[axis], v.position[axis]);
+            }
+        }
+        BoneInfluenceSphere mesh{};
+        for (int axis = 0; axis < 3; ++axis) {
+            mesh.center[axis] = 0.5f * (lo[axis] + hi[axis]);
+        }
+        for (const auto& v : vertices) {
+            const float dx = v.position[0] - mesh.center[0];
+            const float dy = v.position[1] - mesh.center[1];
+            const float dz = v.position[2] - mesh.center[2];
+            mesh.radius = (std::max)(mesh.radius, std::sqrt(dx * dx + dy * dy + dz * dz));
+        }
+        std::vector<BoneInfluenceSphere> spheres;
+        for (uint32_t bone = 0; bone < kBoneCount; ++bone) {
+            mesh.boneIndex = bone;
+            spheres.push_back(mesh);
+        }
+        return spheres;
+    }
+
+    // Samples an "animation" of poseCount poses, checks every skinned vertex of
+    // every pose against the per-bone bound and returns the two radii.
+    void CheckAnimation(const std::vector<SkinningVertex>& vertices, uint32_t seed, uint32_t poseCount, float maxAngle, bool nonUniformScale, float& outPerBoneRadius, float& outWholeMeshRadius)
+    {
+        std::vector<BoneInfluenceSphere> boneSpheres;
+        Require(BuildBoneInfluenceSpheres(AsBytes(vertices), sizeof(SkinningVertex), boneSpheres), "limb stream rejected");
+        Require(boneSpheres.size() == kBoneCount, "expected one sphere per bone");
+        const std::vector<BoneInfluenceSphere> meshSpheres = WholeMeshSpheres(vertices);
+
+        std::mt19937 rng(seed);
+        std::vector<std::vector<float>> poses;
+        SkinnedBoundsBuilder perBone(boneSpheres);
+        SkinnedBoundsBuilder wholeMesh(meshSpheres);
+        for (uint32_t pose = 0; pose < poseCount; ++pose) {
+            poses.push_back(PoseChain(rng, maxAngle, nonUniformScale));
+            perBone.AddPose(poses.back());
+            wholeMesh.AddPose(poses.back());
+        }
+
+        const SkinnedBoundsSphere bounds = perBone.Build();
+        for (const auto& pose : poses) {
+            for (const auto& v : vertices) {
+                float skinned[3];
+                SkinVertex(v, pose, skinned);
+                Require(Contains(bounds, skinned), "skinned vertex outside the per-bone bound");
+            }
+        }
+
+        outPerBoneRadius = bounds.radius;
+        outWholeMeshRadius = wholeMesh.Build().radius;
+    }
+
+    void ReportReduction(const char* label, float perBoneRadius, float wholeMeshRadius)
+    {
+        const double ratio = static_cast<double>(perBoneRadius) / static_cast<double>(wholeMeshRadius);
+        std::cout << "  " << label << ": per-bone radius " << perBoneRadius
+                  << ", whole-mesh radius " << wholeMeshRadius
+                  << ", volume " << (ratio * ratio * ratio * 100.0) << "% of before\n";
+    }
+}
+
+int main()
+{
+    int failureCount = 0;
+    const std::vector<SkinningVertex> limb = BuildLimb(65, 24);
+
+    RunTest("per-bone spheres cover each bone's vertices", [&]() {
+        std::vector<BoneInfluenceSphere> spheres;
+        Require(BuildBoneInfluenceSpheres(AsBytes(limb), sizeof(SkinningVertex), spheres), "limb stream rejected");
+        for (const auto& sphere : spheres) {
+            Require(sphere.radius < kBoneLength, "bone sphere should only span its segment and the blend region");
+            for (const auto& v : limb) {
+                for (int influence = 0; influence < 8; ++influence) {
+                    if (v.weights[influence] > 0.0f && v.joints[influence] == sphere.boneIndex) {
+                        const float dx = v.position[0] - sphere.center[0];
+                        const float dy = v.position[1] - sphere.center[1];
+                        const float dz = v.position[2] - sphere.center[2];
+                        Require(std::sqrt(dx * dx + dy * dy + dz * dz) <= sphere.radius * 1.0001f, "vertex outside its bone sphere");
+                    }
+                }
+            }
+        }
+    }, failureCount);
+
+    RunTest("bind pose", [&]() {
+        std::vector<BoneInfluenceSphere> spheres;
+        Require(BuildBoneInfluenceSpheres(AsBytes(limb), sizeof(SkinningVertex), spheres), "limb stream rejected");
+        std::vector<float> identity(kBoneCount * 16u);
+        for (uint32_t bone = 0; bone < kBoneCount; ++bone) {
+            const Mat4 m = Identity();
+            std::memcpy(identity.data() + bone * 16u, m.data(), sizeof(float) * 16u);
+        }
+        SkinnedBoundsBuilder builder(spheres);
+        builder.AddPose(identity);
+        const SkinnedBoundsSphere bounds = builder.Build();
+        for (const auto& v : limb) {
+            Require(Contains(bounds, v.position), "bind pose vertex outside the bound");
+        }
+    }, failureCount);
+
+    RunTest("animated bounds are conservative and tighter", [&]() {
+        float perBone = 0.0f;
+        float wholeMesh = 0.0f;
+        CheckAnimation(limb, 7u, 64u, 0.6f, false, perBone, wholeMesh);
+        ReportReduction("curl", perBone, wholeMesh);
+        Require(perBone < wholeMesh, "per-bone bound should be tighter than the whole-mesh bound");
+    }, failureCount);
+
+    RunTest("non-uniform scale stays conservative", [&]() {
+        float perBone = 0.0f;
+        float wholeMesh = 0.0f;
+        CheckAnimation(limb, 11u, 32u, 1.2f, true, perBone, wholeMesh);
+        ReportReduction("scaled", perBone, wholeMesh);
+        Require(perBone < wholeMesh, "per-bone bound should be tighter than the whole-mesh bound");
+    }, failureCount);
+
+    RunTest("unbounded streams are rejected", [&]() {
+        std::vector<BoneInfluenceSphere> spheres;
+        std::vector<SkinningVertex> vertices = limb;
+        vertices[5].weights[0] = 0.5f;
+        vertices[5].weights[1] = 0.0f;
+        Require(!BuildBoneInfluenceSpheres(AsBytes(vertices), sizeof(SkinningVertex), spheres), "weights summing to 0.5 accepted");
+        Require(spheres.empty(), "rejected stream left spheres behind");
+
+        vertices = limb;
+        vertices[5].weights[0] = 1.25f;
+        vertices[5].joints[1] = 1;
+        vertices[5].weights[1] = -0.25f;
+        Require(!BuildBoneInfluenceSpheres(AsBytes(vertices), sizeof(SkinningVertex), spheres), "negative weight accepted");
+
+        vertices = limb;
+        vertices[5].joints[0] = 0xFFFFFFFFu;
+        Require(!BuildBoneInfluenceSpheres(AsBytes(vertices), sizeof(SkinningVertex), spheres), "garbage joint accepted");
+
+        Require(!BuildBoneInfluenceSpheres(AsBytes(limb), 40u, spheres), "stride without influences accepted");
+    }, failureCount);
+
+    RunTest("unweighted joints get no sphere", [&]() {
+        std::vector<SkinningVertex> vertices = limb;
+        for (auto& v : vertices) {
+            // Zero-weight slots routinely carry stale joint indices.
+            v.joints[7] = 3;
+            if (v.joints[0] == 3 || v.joints[1] == 3) {
+                v.joints[0] = 2;
+                v.weights[0] = 1.0f;
+                v.joints[1] = 0;
+                v.weights[1] = 0.0f;
+            }
+        }
+        std::vector<BoneInfluenceSphere> spheres;
+        Require(BuildBoneInfluenceSpheres(AsBytes(vertices), sizeof(SkinningVertex), spheres), "stream rejected");
+        for (const auto& sphere : spheres) {
+            Require(sphere.boneIndex != 3u, "bone without weighted vertices has a sphere");
+        }
+    }, failureCount);
+
+    if (failureCount != 0) {
+        std::cerr << failureCount << " skinned bounds test(s) failed\n";
+        return 1;
+    }
+
+    std::cout << "All skinned bounds tests passed\n";
+    return 0;
+}
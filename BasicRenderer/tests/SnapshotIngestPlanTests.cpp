@@ -0,0 +1,128 @@
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Render/SnapshotIngestPlan.h"
+
+using br::render::SnapshotIngestGroup;
+using br::render::SnapshotIngestPlan;
+namespace RenderableTag = br::render::RenderableTag;
+
+namespace
+{
+    void Require(bool condition, const std::string& message)
+    {
+        if (!condition) {
+            throw std::runtime_error(message);
+        }
+    }
+
+    void RunTest(
+        const char* name,
+        const std::function<void()>& fn,
+        int& failureCount)
+    {
+        try {
+            fn();
+            std::cout << "[PASS] " << name << '\n';
+        }
+        catch (const std::exception& ex) {
+            ++failureCount;
+            std::cerr << "[FAIL] " << name << ": " << ex.what() << '\n';
+        }
+    }
+
+    std::vector<uint32_t> GroupChanges(const SnapshotIngestPlan& plan, const SnapshotIngestGroup& group)
+    {
+        const auto structural = plan.StructuralChanges();
+        return { structural.begin() + group.first, structural.begin() + group.first + group.count };
+    }
+}
+
+int main()
+{
+    int failureCount = 0;
+
+    RunTest("unchanged tags are column-only in snapshot order", [&]() {
+        SnapshotIngestPlan plan;
+        const uint8_t tags = RenderableTag::Skinned | RenderableTag::SkinningPassEligible;
+        for (uint32_t i = 0; i < 5; ++i) {
+            plan.Add({ i, tags, tags, false });
+        }
+        plan.Build();
+
+        const auto columnOnly = plan.ColumnOnlyChanges();
+        Require(columnOnly.size() == 5u, "column-only count");
+        Require(std::is_sorted(columnOnly.begin(), columnOnly.end()), "column-only order");
+        Require(plan.StructuralChanges().empty() && plan.Groups().empty(), "unexpected structural work");
+        Require(plan.GetStats().columnOnly == 5u && plan.GetStats().changes == 5u, "stats");
+    }, failureCount);
+
+    RunTest("rebuild is structural even without a tag delta", [&]() {
+        SnapshotIngestPlan plan;
+        plan.Add({ 0, RenderableTag::Named, RenderableTag::Named, true });
+        plan.Add({ 1, RenderableTag::Named, RenderableTag::Named, false });
+        plan.Build();
+
+        Require(plan.ColumnOnlyChanges().size() == 1u && plan.ColumnOnlyChanges()[0] == 1u, "column-only change");
+        Require(plan.Groups().size() == 1u, "group count");
+        const SnapshotIngestGroup& group = plan.Groups()[0];
+        Require(group.rebuild && group.addTags == 0u && group.removeTags == 0u, "group transition");
+        Require(GroupChanges(plan, group) == std::vector<uint32_t>{ 0u }, "group members");
+    }, failureCount);
+
+    RunTest("same transitions share a group and keep order", [&]() {
+        SnapshotIngestPlan plan;
+        // Interleave two transitions: gain SkipShadowPass, lose Skinned.
+        for (uint32_t i = 0; i < 8; ++i) {
+            if (i % 2 == 0) {
+                plan.Add({ i, 0, RenderableTag::SkipShadowPass, false });
+            }
+            else {
+                plan.Add({ i, RenderableTag::Skinned | RenderableTag::Named, RenderableTag::Named, false });
+            }
+        }
+        plan.Build();
+
+        Require(plan.ColumnOnlyChanges().empty(), "no column-only changes");
+        Require(plan.Groups().size() == 2u, "group count");
+        uint32_t covered = 0;
+        for (const SnapshotIngestGroup& group : plan.Groups()) {
+            const std::vector<uint32_t> changes = GroupChanges(plan, group);
+            Require(changes.size() == 4u, "group size");
+            Require(std::is_sorted(changes.begin(), changes.end()), "group order");
+            if (group.addTags == RenderableTag::SkipShadowPass) {
+                Require(group.removeTags == 0u, "add group removes tags");
+                Require(changes.front() % 2u == 0u, "add group members");
+            }
+            else {
+                Require(group.addTags == 0u && group.removeTags == RenderableTag::Skinned, "remove group transition");
+                Require(changes.front() % 2u == 1u, "remove group members");
+            }
+            covered += group.count;
+        }
+        Require(covered == plan.GetStats().structural, "groups cover structural changes");
+    }, failureCount);
+
+    RunTest("clear resets the plan", [&]() {
+        SnapshotIngestPlan plan;
+        plan.Add({ 0, 0, RenderableTag::Skinned, false });
+        plan.Build();
+        plan.Clear();
+        plan.Build();
+        Require(plan.ColumnOnlyChanges().empty() && plan.StructuralChanges().empty() && plan.Groups().empty(), "plan not empty");
+        Require(plan.GetStats().changes == 0u, "stats not reset");
+    }, failureCount);
+
+    if (failureCount != 0) {
+        std::cerr << failureCount << " snapshot ingest plan test(s) failed\n";
+        return 1;
+    }
+
+    std::cout << "All snapshot ingest plan tests passed\n";
+    return 0;
+}
@@ -14,6 +14,7 @@
 #include "Managers/Singletons/SettingsManager.h"
 
 class DynamicGloballyIndexedResource;
+struct InstanceClusterSet;
 
 class Scene {
 public:
@@ -59,6 +60,7 @@ private:
     std::function<uint8_t()> getNumDirectionalLightCascades;
     std::function<float()> getMaxShadowDistance;
     std::function<bool()> getMeshShadersEnabled;
+    std::function<uint32_t()> getUsdPointInstancerMaxInstances;
 
     SettingsManager::Subscription m_renderResSubscription;
 
@@ -66,6 +68,7 @@ private:
     void MakeNonResident();
     flecs::entity CreateLightECS(std::wstring name, Components::LightType type, DirectX::XMFLOAT3 position, DirectX::XMFLOAT3 color, float intensity, DirectX::XMFLOAT3 attenuation = { 0, 0, 0 }, DirectX::XMFLOAT3 direction = { 0, 0, 0 }, float innerConeAngle = 0, float outerConeAngle = 0, bool shadowCasting = false);
     void ActivateRenderable(flecs::entity& entity);
+    void DeactivateRenderable(flecs::entity& entity);
     void ActivateLight(flecs::entity& entity);
     void ActivateCamera(flecs::entity& entity);
 
@@ -74,6 +77,15 @@ private:
     flecs::query<> m_dirtyQuery;
     bool m_propagateQueriesBuilt = false;
 
+    // PointInstancer cluster streaming, driven by the primary camera
+    flecs::query<> m_instanceClusterQuery;
+    bool m_instanceClusterQueryBuilt = false;
+    std::vector<uint32_t> m_visibleInstanceClusters;
+
+    void UpdateInstanceClusters();
+    flecs::entity MaterializeInstanceCluster(flecs::entity source, const InstanceClusterSet& set, uint32_t clusterIndex);
+    void ReleaseInstanceCluster(flecs::entity clusterEntity);
+
     void ActivateAllAnimatedEntities();
     bool IsActive() const;
 };
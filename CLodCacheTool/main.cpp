@@ -17,6 +17,7 @@
 #include <cstdlib>
 #include <filesystem>
 #include <iostream>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -106,9 +107,30 @@ static bool TryConsumeOption(const std::string& arg) {
         consumeValue(pruningPrefix, "BASICRENDERER_CLOD_VOXEL_PRUNING");
 }
 
+// Removes a UsdcFile package's crate file on scope exit. Declare it before
+// the layer and stage that read the file: USD maps crate files lazily, so the
+// file must outlive them.
+class NifPayloadRelease {
+public:
+    explicit NifPayloadRelease(const BRNiflyClient::UsdAssetPackage& package) : m_package(package) {}
+    ~NifPayloadRelease() { BRNiflyClient::ReleasePayload(m_package); }
+
+    NifPayloadRelease(const NifPayloadRelease&) = delete;
+    NifPayloadRelease& operator=(const NifPayloadRelease&) = delete;
+
+private:
+    const BRNiflyClient::UsdAssetPackage& m_package;
+};
+
 // Processing
 
-static bool ProcessFile(const fs::path& path) {
+static BRNiflyClient::ClientOptions NifClientOptions() {
+    BRNiflyClient::ClientOptions options;
+    options.preferredPayload = BRNiflyClient::PayloadFormat::UsdcFile;
+    return options;
+}
+
+static bool ProcessFile(const fs::path& path, const BRNiflyClient::ConversionResult* prefetchedNif) {
     auto canonical = fs::weakly_canonical(path);
     auto pathStr   = canonical.string();
     auto fmt       = DetectFormat(canonical);
@@ -142,9 +164,15 @@ static bool ProcessFile(const fs::path& path) {
             break;
         }
         case AssetFormat::Nif: {
-            spdlog::info("  Converting NIF through BRNifly...");
+            std::optional<BRNiflyClient::UsdAssetPackage> package;
             std::string errorMessage;
-            auto package = BRNiflyClient::ConvertNifToUsd(pathStr, {}, &errorMessage);
+            if (prefetchedNif) {
+                package = prefetchedNif->package;
+                errorMessage = prefetchedNif->errorMessage;
+            } else {
+                spdlog::info("  Converting NIF through BRNifly...");
+                package = BRNiflyClient::ConvertNifToUsd(pathStr, NifClientOptions(), &errorMessage);
+            }
             if (!package) {
                 spdlog::error("  BRNifly conversion failed: {}", errorMessage);
                 return false;
@@ -159,9 +187,17 @@ static bool ProcessFile(const fs::path& path) {
                     spdlog::info("  BRNifly: {}", diagnostic.message);
             }
 
-            auto layer = pxr::SdfLayer::CreateAnonymous("brnifly_clod.usda");
-            if (!layer || !layer->ImportFromString(package->rootLayerText)) {
-                spdlog::error("  Failed to import BRNifly USDA payload.");
+            const NifPayloadRelease payloadRelease(*package);
+            pxr::SdfLayerRefPtr layer;
+            if (package->payloadFormat == BRNiflyClient::PayloadFormat::UsdcFile) {
+                layer = pxr::SdfLayer::OpenAsAnonymous(package->rootLayerFile, false, "brnifly_clod.usdc");
+            } else {
+                layer = pxr::SdfLayer::CreateAnonymous("brnifly_clod.usda");
+                if (layer && !layer->ImportFromString(package->rootLayerText))
+                    layer = nullptr;
+            }
+            if (!layer) {
+                spdlog::error("  Failed to import BRNifly USD payload.");
                 return false;
             }
             auto stage = pxr::UsdStage::Open(layer);
@@ -282,11 +318,33 @@ int main(int argc, char* argv[]) {
     int successes = 0;
     int failures  = 0;
 
-    for (auto& f : files) {
-        if (ProcessFile(f))
-            ++successes;
-        else
-            ++failures;
+    // NIFs are converted a chunk at a time across the BRNifly server pool, so
+    // conversion runs in parallel without staging every payload on disk at once.
+    constexpr size_t kNifBatchSize = 64;
+    for (size_t chunkBegin = 0; chunkBegin < files.size(); chunkBegin += kNifBatchSize) {
+        const size_t chunkEnd = std::min(files.size(), chunkBegin + kNifBatchSize);
+
+        std::vector<std::string> nifPaths;
+        for (size_t i = chunkBegin; i < chunkEnd; ++i) {
+            if (DetectFormat(files[i]) == AssetFormat::Nif)
+                nifPaths.push_back(fs::weakly_canonical(files[i]).string());
+        }
+        std::vector<BRNiflyClient::ConversionResult> nifResults;
+        if (nifPaths.size() > 1) {
+            spdlog::info("Converting {} NIF(s) through BRNifly...", nifPaths.size());
+            nifResults = BRNiflyClient::ConvertNifsToUsd(nifPaths, NifClientOptions());
+        }
+
+        size_t nifIndex = 0;
+        for (size_t i = chunkBegin; i < chunkEnd; ++i) {
+            const BRNiflyClient::ConversionResult* prefetched = nullptr;
+            if (DetectFormat(files[i]) == AssetFormat::Nif && !nifResults.empty())
+                prefetched = &nifResults[nifIndex++];
+            if (ProcessFile(files[i], prefetched))
+                ++successes;
+            else
+                ++failures;
+        }
     }
 
     auto totalT1 = std::chrono::steady_clock::now();
@@ -314,6 +372,7 @@ int main(int argc, char* argv[]) {
         }
     }
 
+    BRNiflyClient::ShutdownServers();
     scheduler.Cleanup();
     return failures > 0 ? 1 : 0;
 }
@@ -0,0 +1,781 @@
+#include "HttpAssetCache.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <random>
+#include <sstream>
+
+#include <curl/curl.h>
+#include <spdlog/spdlog.h>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr uint64_t kFnvOffset = 1469598103934665603ull;
+constexpr uint64_t kFnvPrime = 1099511628211ull;
+constexpr const char* kIndexHeader = "# HttpAssetCache index v1";
+
+uint64_t Fnv1a64(const void* data, size_t size, uint64_t hash = kFnvOffset)
+{
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= kFnvPrime;
+    }
+    return hash;
+}
+
+uint64_t Fnv1a64(const std::string& text)
+{
+    return Fnv1a64(text.data(), text.size());
+}
+
+std::string Hex64(uint64_t value)
+{
+    char buffer[17];
+    std::snprintf(buffer, sizeof(buffer), "%016llx", static_cast<unsigned long long>(value));
+    return buffer;
+}
+
+int64_t NowSeconds()
+{
+    return std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+// Distinguishes temp files of processes sharing one cache directory.
+uint64_t ProcessSalt()
+{
+    static const uint64_t salt = (static_cast<uint64_t>(std::random_device{}()) << 32) ^ std::random_device{}();
+    return salt;
+}
+
+void EnsureCurlInitialized()
+{
+    // curl_global_init is not thread-safe; curl_easy_init would call it lazily.
+    static std::once_flag initOnce;
+    std::call_once(initOnce, []() { curl_global_init(CURL_GLOBAL_DEFAULT); });
+}
+
+std::string UrlWithoutQuery(const std::string& url)
+{
+    return url.substr(0, url.find_first_of("?#"));
+}
+
+std::string UrlFileName(const std::string& url)
+{
+    const std::string path = UrlWithoutQuery(url);
+    const size_t schemeEnd = path.find("://");
+    const size_t slash = path.rfind('/');
+    std::string name = (slash == std::string::npos || (schemeEnd != std::string::npos && slash < schemeEnd + 3))
+        ? std::string()
+        : path.substr(slash + 1);
+    if (name.empty()) {
+        name = "index";
+    }
+    for (char& ch : name) {
+        if (ch == '<' || ch == '>' || ch == ':' || ch == '"' || ch == '\\' || ch == '|' || ch == '*') {
+            ch = '_';
+        }
+    }
+    return name;
+}
+
+bool IsLayerUrl(const std::string& url)
+{
+    std::string extension = fs::path(UrlFileName(url)).extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char ch) { return static_cast<char>(std::tolower(ch)); });
+    return extension == ".usd" || extension == ".usda" || extension == ".usdc";
+}
+
+bool HeaderNameEquals(const std::string& line, const char* name)
+{
+    const size_t length = std::char_traits<char>::length(name);
+    if (line.size() <= length || line[length] != ':') {
+        return false;
+    }
+    for (size_t i = 0; i < length; ++i) {
+        if (std::tolower(static_cast<unsigned char>(line[i])) != std::tolower(static_cast<unsigned char>(name[i]))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::string HeaderValue(const std::string& line)
+{
+    size_t begin = line.find(':') + 1;
+    size_t end = line.size();
+    while (begin < end && std::isspace(static_cast<unsigned char>(line[begin]))) ++begin;
+    while (end > begin && std::isspace(static_cast<unsigned char>(line[end - 1]))) --end;
+    return line.substr(begin, end - begin);
+}
+
+struct BodyWriter {
+    std::ofstream stream;
+    uint64_t hash = kFnvOffset;
+    uint64_t bytes = 0;
+};
+
+size_t WriteBody(void* ptr, size_t size, size_t nmemb, void* userp) noexcept
+{
+    auto* writer = static_cast<BodyWriter*>(userp);
+    const size_t byteCount = size * nmemb;
+    writer->stream.write(static_cast<const char*>(ptr), static_cast<std::streamsize>(byteCount));
+    if (!writer->stream) {
+        return 0;
+    }
+    writer->hash = Fnv1a64(ptr, byteCount, writer->hash);
+    writer->bytes += byteCount;
+    return byteCount;
+}
+
+int AbortCheck(void* userp, curl_off_t, curl_off_t, curl_off_t, curl_off_t) noexcept
+{
+    return static_cast<const std::atomic<bool>*>(userp)->load(std::memory_order_relaxed) ? 1 : 0;
+}
+
+struct ResponseHeaders {
+    long status = 0;
+    std::string etag;
+    std::string lastModified;
+};
+
+size_t ReadHeader(char* buffer, size_t size, size_t nitems, void* userp) noexcept
+{
+    auto* response = static_cast<ResponseHeaders*>(userp);
+    const std::string line(buffer, size * nitems);
+    if (line.rfind("HTTP/", 0) == 0) {
+        // A new status line starts each response in a redirect chain.
+        response->etag.clear();
+        response->lastModified.clear();
+    }
+    else if (HeaderNameEquals(line, "ETag")) {
+        response->etag = HeaderValue(line);
+    }
+    else if (HeaderNameEquals(line, "Last-Modified")) {
+        response->lastModified = HeaderValue(line);
+    }
+    return size * nitems;
+}
+
+} // namespace
+
+HttpAssetCache::Options HttpAssetCache::OptionsFromEnvironment()
+{
+    Options options;
+    std::error_code ec;
+    fs::path tempRoot = fs::temp_directory_path(ec);
+    if (ec) {
+        tempRoot = fs::current_path();
+    }
+    options.root = tempRoot / "BasicRenderer" / "HttpResolverCache";
+
+    auto env = [](const char* name) -> const char* {
+        const char* value = std::getenv(name);
+        return value && *value ? value : nullptr;
+    };
+    if (const char* value = env("BASICRENDERER_HTTP_CACHE_DIR")) {
+        options.root = value;
+    }
+    if (const char* value = env("BASICRENDERER_HTTP_CACHE_MAX_MB")) {
+        options.maxBytes = std::strtoull(value, nullptr, 10) * 1024ull * 1024ull;
+    }
+    if (const char* value = env("BASICRENDERER_HTTP_CACHE_REVALIDATE_SECONDS")) {
+        options.revalidateAfter = std::chrono::seconds(std::strtoll(value, nullptr, 10));
+    }
+    if (const char* value = env("BASICRENDERER_HTTP_FETCH_THREADS")) {
+        options.prefetchThreads = static_cast<unsigned int>(std::strtoul(value, nullptr, 10));
+    }
+    if (const char* value = env("BASICRENDERER_HTTP_PREFETCH")) {
+        options.prefetchDependencies = std::string(value) != "0";
+    }
+    return options;
+}
+
+HttpAssetCache::HttpAssetCache(Options options)
+    : m_options(std::move(options))
+{
+    std::error_code ec;
+    fs::create_directories(m_options.root / "blobs", ec);
+    fs::create_directories(m_options.root / "objects", ec);
+    fs::create_directories(m_options.root / "tmp", ec);
+
+    // Leftovers of interrupted downloads. Recent ones may belong to another process.
+    const auto cutoff = fs::file_time_type::clock::now() - std::chrono::hours(24);
+    for (const auto& entry : fs::directory_iterator(m_options.root / "tmp", ec)) {
+        std::error_code entryEc;
+        if (entry.path().extension() == ".part" && entry.last_write_time(entryEc) < cutoff && !entryEc) {
+            fs::remove(entry.path(), entryEc);
+        }
+    }
+
+    LoadIndex();
+    std::lock_guard<std::mutex> lock(m_mutex);
+    EvictLocked(std::string());
+}
+
+HttpAssetCache::~HttpAssetCache()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_prefetchMutex);
+        m_stopping = true;
+        m_prefetchQueue.clear();
+    }
+    m_abortTransfers = true;
+    m_prefetchWake.notify_all();
+    m_prefetchIdle.notify_all();
+    for (std::thread& thread : m_prefetchThreads) {
+        thread.join();
+    }
+}
+
+std::string HttpAssetCache::Fetch(const std::string& url)
+{
+    std::promise<std::string> promise;
+    std::shared_future<std::string> pending;
+    Entry stale;
+    bool hasStale = false;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto inFlight = m_inFlight.find(url);
+        if (inFlight != m_inFlight.end()) {
+            ++m_stats.sharedWaits;
+            pending = inFlight->second;
+        }
+        else {
+            auto it = m_entries.find(url);
+            if (it != m_entries.end()) {
+                Entry& entry = it->second;
+                entry.lastAccess = ++m_accessClock;
+                if (NowSeconds() - entry.validatedAt < m_options.revalidateAfter.count()) {
+                    ++m_stats.hits;
+                    return entry.localPath;
+                }
+                stale = entry;
+                hasStale = true;
+            }
+            m_inFlight.emplace(url, promise.get_future().share());
+        }
+    }
+
+    if (pending.valid()) {
+        return pending.get();
+    }
+
+    std::string localPath;
+    try {
+        localPath = Download(url, hasStale ? &stale : nullptr);
+    }
+    catch (const std::exception& ex) {
+        spdlog::error("HttpResolver: failed to fetch {}: {}", url, ex.what());
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_inFlight.erase(url);
+    }
+    promise.set_value(localPath);
+    return localPath;
+}
+
+std::string HttpAssetCache::Download(const std::string& url, const Entry* stale)
+{
+    EnsureCurlInitialized();
+
+    static std::atomic<uint64_t> tempSerial{ 0 };
+    const fs::path tempFile = m_options.root / "tmp" /
+        (Hex64(Fnv1a64(url) ^ ProcessSalt()) + "-" + std::to_string(tempSerial.fetch_add(1)) + ".part");
+
+    std::error_code ec;
+    auto fail = [&](const std::string& reason) -> std::string {
+        fs::remove(tempFile, ec);
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            ++m_stats.failures;
+        }
+        if (stale) {
+            spdlog::warn("HttpResolver: revalidating {} failed ({}); serving cached copy.", url, reason);
+            return stale->localPath;
+        }
+        spdlog::error("HttpResolver: failed to fetch {}: {}", url, reason);
+        return std::string();
+    };
+
+    BodyWriter writer;
+    writer.stream.open(tempFile, std::ios::binary | std::ios::trunc);
+    if (!writer.stream) {
+        return fail("cannot create " + tempFile.string());
+    }
+
+    curl_slist* headers = nullptr;
+    if (stale && !stale->etag.empty()) {
+        headers = curl_slist_append(headers, ("If-None-Match: " + stale->etag).c_str());
+    }
+    if (stale && !stale->lastModified.empty()) {
+        headers = curl_slist_append(headers, ("If-Modified-Since: " + stale->lastModified).c_str());
+    }
+
+    ResponseHeaders response;
+    curl_off_t contentLength = -1;
+    CURL* curl = curl_easy_init();
+    if (!curl) {
+        curl_slist_free_all(headers);
+        return fail("curl_easy_init failed");
+    }
+    curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
+    curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
+    curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1L);
+    curl_easy_setopt(curl, CURLOPT_CONNECTTIMEOUT, m_options.connectTimeoutSeconds);
+    curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
+    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, WriteBody);
+    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &writer);
+    curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, ReadHeader);
+    curl_easy_setopt(curl, CURLOPT_HEADERDATA, &response);
+    curl_easy_setopt(curl, CURLOPT_NOPROGRESS, 0L);
+    curl_easy_setopt(curl, CURLOPT_XFERINFOFUNCTION, AbortCheck);
+    curl_easy_setopt(curl, CURLOPT_XFERINFODATA, &m_abortTransfers);
+    const CURLcode result = curl_easy_perform(curl);
+    curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &response.status);
+    curl_easy_getinfo(curl, CURLINFO_CONTENT_LENGTH_DOWNLOAD_T, &contentLength);
+    curl_easy_cleanup(curl);
+    curl_slist_free_all(headers);
+
+    writer.stream.close();
+    if (result != CURLE_OK) {
+        return fail(curl_easy_strerror(result));
+    }
+
+    if (response.status == 304 && stale) {
+        fs::remove(tempFile, ec);
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_entries.find(url);
+        if (it != m_entries.end()) {
+            it->second.validatedAt = NowSeconds();
+            ++m_stats.notModified;
+            SaveIndexLocked();
+        }
+        return stale->localPath;
+    }
+
+    if (response.status != 200) {
+        return fail("HTTP " + std::to_string(response.status));
+    }
+    if (writer.stream.fail()) {
+        return fail("cannot write " + tempFile.string());
+    }
+    if (contentLength >= 0 && static_cast<uint64_t>(contentLength) != writer.bytes) {
+        return fail("received " + std::to_string(writer.bytes) + " of " + std::to_string(contentLength) + " bytes");
+    }
+
+    return Publish(url, tempFile, writer.hash, writer.bytes, response.etag, response.lastModified);
+}
+
+std::string HttpAssetCache::Publish(
+    const std::string& url,
+    const fs::path& tempFile,
+    uint64_t contentHash,
+    uint64_t size,
+    const std::string& etag,
+    const std::string& lastModified)
+{
+    const std::string hashName = Hex64(contentHash) + "-" + std::to_string(size);
+    const fs::path blobPath = m_options.root / "blobs" / hashName;
+    const fs::path localPath = m_options.root / "objects" / Hex64(Fnv1a64(url)) / hashName / UrlFileName(url);
+
+    std::error_code ec;
+    {
+        // File operations stay under the lock so eviction cannot delete a blob
+        // between the existence check and the link.
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (fs::exists(blobPath, ec)) {
+            fs::remove(tempFile, ec);
+        }
+        else {
+            // A rename within one volume is atomic; readers never see a partial blob.
+            fs::rename(tempFile, blobPath, ec);
+            if (ec) {
+                fs::remove(tempFile, ec);
+                ++m_stats.failures;
+                spdlog::error("HttpResolver: cannot publish {} to {}", url, blobPath.string());
+                return std::string();
+            }
+        }
+
+        if (!fs::exists(localPath, ec)) {
+            fs::create_directories(localPath.parent_path(), ec);
+            ec.clear();
+            fs::create_hard_link(blobPath, localPath, ec);
+            if (ec) {
+                ec.clear();
+                fs::copy_file(blobPath, localPath, fs::copy_options::overwrite_existing, ec);
+            }
+            if (ec) {
+                ++m_stats.failures;
+                spdlog::error("HttpResolver: cannot link {} to {}: {}", url, localPath.string(), ec.message());
+                return std::string();
+            }
+        }
+
+        Entry entry;
+        entry.localPath = localPath.string();
+        entry.contentHash = hashName;
+        entry.size = size;
+        entry.etag = etag;
+        entry.lastModified = lastModified;
+        entry.validatedAt = NowSeconds();
+        entry.lastAccess = ++m_accessClock;
+        AddEntryLocked(url, std::move(entry));
+        ++m_stats.downloads;
+        EvictLocked(url);
+        SaveIndexLocked();
+    }
+
+    spdlog::info("HttpResolver: fetched {} ({} bytes)", url, size);
+    if (m_options.prefetchDependencies && IsLayerUrl(url)) {
+        QueueDependencies(url, localPath.string());
+    }
+    return localPath.string();
+}
+
+void HttpAssetCache::AddEntryLocked(const std::string& url, Entry entry)
+{
+    auto it = m_entries.find(url);
+    if (it != m_entries.end()) {
+        if (it->second.localPath == entry.localPath) {
+            it->second = std::move(entry);
+            return;
+        }
+        RemoveEntryLocked(it);
+    }
+
+    if (m_blobRefs[entry.contentHash]++ == 0) {
+        m_stats.cachedBytes += entry.size;
+    }
+    m_urlByLocalPath[entry.localPath] = url;
+    m_entries.emplace(url, std::move(entry));
+}
+
+void HttpAssetCache::RemoveEntryLocked(std::unordered_map<std::string, Entry>::iterator it)
+{
+    const Entry& entry = it->second;
+    std::error_code ec;
+    // Windows refuses to delete a file USD still has open; the orphan only keeps
+    // its old URL mapping so relative references from it still anchor correctly.
+    fs::remove(entry.localPath, ec);
+    if (!ec) {
+        m_urlByLocalPath.erase(entry.localPath);
+        std::error_code dirEc;
+        fs::remove(fs::path(entry.localPath).parent_path(), dirEc);
+    }
+
+    auto ref = m_blobRefs.find(entry.contentHash);
+    if (ref != m_blobRefs.end() && --ref->second == 0) {
+        m_blobRefs.erase(ref);
+        m_stats.cachedBytes -= (std::min)(m_stats.cachedBytes, entry.size);
+        fs::remove(m_options.root / "blobs" / entry.contentHash, ec);
+    }
+    m_entries.erase(it);
+}
+
+void HttpAssetCache::EvictLocked(const std::string& keepUrl)
+{
+    while (m_stats.cachedBytes > m_options.maxBytes) {
+        auto victim = m_entries.end();
+        for (auto it = m_entries.begin(); it != m_entries.end(); ++it) {
+            if (it->first == keepUrl || m_inFlight.count(it->first) != 0) {
+                continue;
+            }
+            if (victim == m_entries.end() || it->second.lastAccess < victim->second.lastAccess) {
+                victim = it;
+            }
+        }
+        if (victim == m_entries.end()) {
+            break;
+        }
+        RemoveEntryLocked(victim);
+        ++m_stats.evictions;
+    }
+}
+
+// One tab-separated line per URL: url, local path relative to root, content
+// hash, size, ETag, Last-Modified, validatedAt, lastAccess.
+void HttpAssetCache::LoadIndex()
+{
+    std::ifstream input(m_options.root / "index.tsv", std::ios::binary);
+    if (!input) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::string line;
+    std::getline(input, line);
+    if (line != kIndexHeader) {
+        return;
+    }
+
+    while (std::getline(input, line)) {
+        std::vector<std::string> fields;
+        std::stringstream stream(line);
+        std::string field;
+        while (std::getline(stream, field, '\t')) {
+            fields.push_back(field);
+        }
+        if (fields.size() != 8) {
+            continue;
+        }
+
+        Entry entry;
+        entry.localPath = (m_options.root / fs::path(fields[1])).string();
+        entry.contentHash = fields[2];
+        entry.size = std::strtoull(fields[3].c_str(), nullptr, 10);
+        entry.etag = fields[4];
+        entry.lastModified = fields[5];
+        entry.validatedAt = std::strtoll(fields[6].c_str(), nullptr, 10);
+        entry.lastAccess = std::strtoull(fields[7].c_str(), nullptr, 10);
+
+        // Drop entries whose file went missing or was modified behind our back.
+        std::error_code ec;
+        if (fs::file_size(entry.localPath, ec) != entry.size || ec ||
+            fs::file_size(m_options.root / "blobs" / entry.contentHash, ec) != entry.size || ec)
+        {
+            continue;
+        }
+        m_accessClock = (std::max)(m_accessClock, entry.lastAccess);
+        AddEntryLocked(fields[0], std::move(entry));
+    }
+}
+
+void HttpAssetCache::SaveIndexLocked() const
+{
+    const fs::path indexPath = m_options.root / "index.tsv";
+    const fs::path tempPath = m_options.root / ("index.tsv." + Hex64(ProcessSalt()) + ".tmp");
+    {
+        std::ofstream output(tempPath, std::ios::binary | std::ios::trunc);
+        if (!output) {
+            return;
+        }
+        output << kIndexHeader << '\n';
+        for (const auto& [url, entry] : m_entries) {
+            output << url << '\t'
+                << fs::path(entry.localPath).lexically_relative(m_options.root).generic_string() << '\t'
+                << entry.contentHash << '\t'
+                << entry.size << '\t'
+                << entry.etag << '\t'
+                << entry.lastModified << '\t'
+                << entry.validatedAt << '\t'
+                << entry.lastAccess << '\n';
+        }
+    }
+    std::error_code ec;
+    fs::rename(tempPath, indexPath, ec);
+    if (ec) {
+        fs::remove(tempPath, ec);
+    }
+}
+
+void HttpAssetCache::Prefetch(const std::string& url)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_prefetchRequested.insert(url).second) {
+            return;
+        }
+    }
+    EnqueuePrefetch([this, url]() {
+        Fetch(url);
+        // Only queued prefetches are deduplicated. Once this one finishes, a
+        // later Prefetch is a cache hit, or a re-download if it was evicted.
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_prefetchRequested.erase(url);
+    });
+}
+
+void HttpAssetCache::QueueDependencies(const std::string& url, const std::string& localPath)
+{
+    if (!m_options.dependencyScanner) {
+        return;
+    }
+    EnqueuePrefetch([this, url, localPath]() {
+        for (const std::string& reference : m_options.dependencyScanner(localPath)) {
+            // Skip UDIM tiles and expression-valued paths; they are not literal URLs.
+            if (reference.find_first_of("<`") != std::string::npos) {
+                continue;
+            }
+            const std::string dependency = JoinUrl(url, reference);
+            if (IsHttpUrl(dependency)) {
+                Prefetch(dependency);
+            }
+        }
+    });
+}
+
+void HttpAssetCache::EnqueuePrefetch(std::function<void()> job)
+{
+    std::lock_guard<std::mutex> lock(m_prefetchMutex);
+    if (m_stopping) {
+        return;
+    }
+    if (m_prefetchThreads.empty()) {
+        const unsigned int threadCount = (std::max)(1u, m_options.prefetchThreads);
+        for (unsigned int i = 0; i < threadCount; ++i) {
+            m_prefetchThreads.emplace_back(&HttpAssetCache::PrefetchWorker, this);
+        }
+    }
+    m_prefetchQueue.push_back(std::move(job));
+    m_prefetchWake.notify_one();
+}
+
+void HttpAssetCache::PrefetchWorker()
+{
+    for (;;) {
+        std::function<void()> job;
+        {
+            std::unique_lock<std::mutex> lock(m_prefetchMutex);
+            m_prefetchWake.wait(lock, [this]() { return m_stopping || !m_prefetchQueue.empty(); });
+            if (m_stopping) {
+                return;
+            }
+            job = std::move(m_prefetchQueue.front());
+            m_prefetchQueue.pop_front();
+            ++m_prefetchActive;
+        }
+
+        job();
+
+        std::lock_guard<std::mutex> lock(m_prefetchMutex);
+        --m_prefetchActive;
+        if (m_prefetchActive == 0 && m_prefetchQueue.empty()) {
+            m_prefetchIdle.notify_all();
+        }
+    }
+}
+
+void HttpAssetCache::WaitForPrefetches()
+{
+    std::unique_lock<std::mutex> lock(m_prefetchMutex);
+    m_prefetchIdle.wait(lock, [this]() { return m_stopping || (m_prefetchActive == 0 && m_prefetchQueue.empty()); });
+}
+
+std::string HttpAssetCache::UrlForLocalPath(const std::string& localPath) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_urlByLocalPath.find(localPath);
+    if (it == m_urlByLocalPath.end()) {
+        it = m_urlByLocalPath.find(fs::path(localPath).lexically_normal().string());
+    }
+    return it != m_urlByLocalPath.end() ? it->second : std::string();
+}
+
+HttpAssetCache::Stats HttpAssetCache::GetStats() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+bool HttpAssetCache::IsHttpUrl(const std::string& path)
+{
+    return path.rfind("http://", 0) == 0 || path.rfind("https://", 0) == 0;
+}
+
+std::string HttpAssetCache::JoinUrl(const std::string& base, const std::string& reference)
+{
+    if (IsHttpUrl(reference)) {
+        return reference;
+    }
+    if (reference.empty()) {
+        return base;
+    }
+    // Another scheme, or a Windows drive path: not addressable relative to a URL.
+    if (reference.find("://") != std::string::npos || (reference.size() >= 2 && reference[1] == ':')) {
+        return std::string();
+    }
+
+    const std::string cleanBase = UrlWithoutQuery(base);
+    const size_t schemeEnd = cleanBase.find("://");
+    if (schemeEnd == std::string::npos) {
+        return std::string();
+    }
+    if (reference.rfind("//", 0) == 0) {
+        return cleanBase.substr(0, schemeEnd + 1) + reference;
+    }
+
+    const size_t pathStart = cleanBase.find('/', schemeEnd + 3);
+    const std::string origin = cleanBase.substr(0, pathStart);
+    const std::string basePath = pathStart == std::string::npos ? std::string("/") : cleanBase.substr(pathStart);
+
+    std::string referencePath = reference;
+    std::replace(referencePath.begin(), referencePath.end(), '\\', '/');
+    const size_t suffixStart = referencePath.find_first_of("?#");
+    const std::string suffix = suffixStart == std::string::npos ? std::string() : referencePath.substr(suffixStart);
+    referencePath = referencePath.substr(0, suffixStart);
+
+    const std::string merged = referencePath.front() == '/'
+        ? referencePath
+        : basePath.substr(0, basePath.rfind('/') + 1) + referencePath;
+
+    std::vector<std::string> segments;
+    size_t begin = 1;
+    while (begin <= merged.size()) {
+        size_t end = merged.find('/', begin);
+        if (end == std::string::npos) {
+            end = merged.size();
+        }
+        const std::string segment = merged.substr(begin, end - begin);
+        if (segment == "..") {
+            if (!segments.empty()) {
+                segments.pop_back();
+            }
+        }
+        else if (segment != "." && !(segment.empty() && end != merged.size())) {
+            segments.push_back(segment);
+        }
+        begin = end + 1;
+    }
+
+    std::string path;
+    for (const std::string& segment : segments) {
+        path += "/" + segment;
+    }
+    return origin + (path.empty() ? "/" : path) + suffix;
+}
+
+std::vector<std::string> HttpAssetCache::ScanTextLayerDependencies(const std::string& localPath)
+{
+    std::vector<std::string> references;
+    std::ifstream input(localPath, std::ios::binary);
+    if (!input) {
+        return references;
+    }
+    const std::string text((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+    if (text.rfind("#usda", 0) != 0) {
+        return references;
+    }
+
+    size_t position = 0;
+    while ((position = text.find('@', position)) != std::string::npos) {
+        const bool tripleQuoted = text.compare(position, 3, "@@@") == 0;
+        const size_t start = position + (tripleQuoted ? 3 : 1);
+        const size_t end = tripleQuoted ? text.find("@@@", start) : text.find('@', start);
+        if (end == std::string::npos) {
+            break;
+        }
+        const std::string reference = text.substr(start, end - start);
+        if (reference.find('\n') != std::string::npos) {
+            // A stray '@' (in a comment or string); resynchronize on the next one.
+            position = start;
+            continue;
+        }
+        if (!reference.empty()) {
+            references.push_back(reference);
+        }
+        position = end + (tripleQuoted ? 3 : 1);
+    }
+
+    std::sort(references.begin(), references.end());
+    references.erase(std::unique(references.begin(), references.end()), references.end());
+    return references;
+}
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// Disk cache behind HttpResolver. Independent of USD so it can be exercised
+// against any local HTTP server.
+//
+// Layout under root:
+//   blobs/<contentHash>                      one copy of each distinct payload
+//   objects/<urlHash>/<contentHash>/<name>   per-URL hard link handed to USD; a new
+//                                            version never overwrites an open file
+//   tmp/                                     in-progress downloads, renamed into blobs/
+//   index.tsv                                URL -> validators, size, LRU timestamps
+class HttpAssetCache {
+public:
+    // Returns asset paths referenced by a layer file, as authored (possibly relative).
+    using DependencyScanner = std::function<std::vector<std::string>(const std::string& localPath)>;
+
+    struct Options {
+        std::filesystem::path root;
+        uint64_t maxBytes = 2ull * 1024ull * 1024ull * 1024ull;
+        // Entries validated more recently than this are served without a request.
+        std::chrono::seconds revalidateAfter{ 300 };
+        unsigned int prefetchThreads = 8;
+        bool prefetchDependencies = true;
+        long connectTimeoutSeconds = 15;
+        DependencyScanner dependencyScanner = ScanTextLayerDependencies;
+    };
+
+    struct Stats {
+        uint64_t downloads = 0;
+        uint64_t notModified = 0;
+        uint64_t hits = 0;
+        uint64_t sharedWaits = 0;
+        uint64_t evictions = 0;
+        uint64_t failures = 0;
+        uint64_t cachedBytes = 0;
+    };
+
+    // Reads BASICRENDERER_HTTP_CACHE_DIR, BASICRENDERER_HTTP_CACHE_MAX_MB,
+    // BASICRENDERER_HTTP_CACHE_REVALIDATE_SECONDS, BASICRENDERER_HTTP_FETCH_THREADS
+    // and BASICRENDERER_HTTP_PREFETCH on top of the defaults.
+    static Options OptionsFromEnvironment();
+
+    explicit HttpAssetCache(Options options);
+    ~HttpAssetCache();
+
+    HttpAssetCache(const HttpAssetCache&) = delete;
+    HttpAssetCache& operator=(const HttpAssetCache&) = delete;
+
+    // Returns a local file holding the URL's content, downloading or revalidating
+    // it first if needed. Concurrent calls for one URL share a single request.
+    // A stale copy is served if revalidation fails; empty if nothing is available.
+    std::string Fetch(const std::string& url);
+
+    // Queues a background Fetch; returns immediately.
+    void Prefetch(const std::string& url);
+    void WaitForPrefetches();
+
+    // Maps a path returned by Fetch back to its URL, so references authored
+    // relative to a downloaded layer can be anchored to the remote location.
+    std::string UrlForLocalPath(const std::string& localPath) const;
+
+    Stats GetStats() const;
+
+    static bool IsHttpUrl(const std::string& path);
+    // RFC 3986 style reference resolution for the path forms USD authors.
+    static std::string JoinUrl(const std::string& base, const std::string& reference);
+    // Default scanner: @asset@ references in .usda text.
+    static std::vector<std::string> ScanTextLayerDependencies(const std::string& localPath);
+
+private:
+    struct Entry {
+        std::string localPath;
+        std::string contentHash;
+        uint64_t size = 0;
+        std::string etag;
+        std::string lastModified;
+        int64_t validatedAt = 0;
+        uint64_t lastAccess = 0;
+    };
+
+    std::string Download(const std::string& url, const Entry* stale);
+    std::string Publish(
+        const std::string& url,
+        const std::filesystem::path& tempFile,
+        uint64_t contentHash,
+        uint64_t size,
+        const std::string& etag,
+        const std::string& lastModified);
+    void AddEntryLocked(const std::string& url, Entry entry);
+    void RemoveEntryLocked(std::unordered_map<std::string, Entry>::iterator it);
+    void EvictLocked(const std::string& keepUrl);
+    void LoadIndex();
+    void SaveIndexLocked() const;
+
+    void QueueDependencies(const std::string& url, const std::string& localPath);
+    void EnqueuePrefetch(std::function<void()> job);
+    void PrefetchWorker();
+
+    Options m_options;
+
+    mutable std::mutex m_mutex;
+    std::unordered_map<std::string, Entry> m_entries;
+    std::unordered_map<std::string, std::string> m_urlByLocalPath;
+    std::unordered_map<std::string, uint32_t> m_blobRefs;
+    std::unordered_map<std::string, std::shared_future<std::string>> m_inFlight;
+    std::unordered_set<std::string> m_prefetchRequested;
+    Stats m_stats;
+    uint64_t m_accessClock = 0;
+
+    std::mutex m_prefetchMutex;
+    std::condition_variable m_prefetchWake;
+    std::condition_variable m_prefetchIdle;
+    std::deque<std::function<void()>> m_prefetchQueue;
+    std::vector<std::thread> m_prefetchThreads;
+    uint32_t m_prefetchActive = 0;
+    bool m_stopping = false;
+    std::atomic<bool> m_abortTransfers{ false };
+};
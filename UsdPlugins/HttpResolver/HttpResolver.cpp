@@ -1,62 +1,103 @@
 #include "HttpResolver.h"
 
 #include <pxr/usd/ar/defineResolver.h> 
+#include <pxr/usd/sdf/assetPath.h>
+#include <pxr/usd/sdf/attributeSpec.h>
+#include <pxr/usd/sdf/layer.h>
+#include <pxr/base/vt/array.h>
 #include <spdlog/spdlog.h>
-#include <curl/curl.h>
+
+#include "HttpAssetCache.h"
 
 PXR_NAMESPACE_OPEN_SCOPE
 
-size_t HttpResolver::_WriteData(void* ptr, size_t size, size_t nmemb, void* userp) noexcept {
-    auto* stream = static_cast<std::ofstream*>(userp);
-    try {
-        stream->write(static_cast<char*>(ptr), static_cast<std::streamsize>(size * nmemb));
-    } catch (const std::ofstream::failure& e) {
-        spdlog::error("Failed to write data to file: {}", e.what());
-        return 0;
-	}
-    return size * nmemb;
+namespace {
+
+// Runs on cache prefetch threads. The layer is opened by its local path, so
+// this never re-enters the resolver for http identifiers.
+std::vector<std::string> ScanUsdLayerDependencies(const std::string& localPath) {
+    std::vector<std::string> dependencies;
+    SdfLayerRefPtr layer = SdfLayer::OpenAsAnonymous(localPath);
+    if (!layer) {
+        return HttpAssetCache::ScanTextLayerDependencies(localPath);
+    }
+
+    for (const std::string& path : layer->GetCompositionAssetDependencies()) {
+        dependencies.push_back(path);
+    }
+
+    layer->Traverse(SdfPath::AbsoluteRootPath(), [&](const SdfPath& path) {
+        if (!path.IsPropertyPath()) {
+            return;
+        }
+        SdfAttributeSpecHandle attribute = layer->GetAttributeAtPath(path);
+        if (!attribute || !attribute->HasDefaultValue()) {
+            return;
+        }
+        const VtValue value = attribute->GetDefaultValue();
+        if (value.IsHolding<SdfAssetPath>()) {
+            dependencies.push_back(value.UncheckedGet<SdfAssetPath>().GetAssetPath());
+        }
+        else if (value.IsHolding<VtArray<SdfAssetPath>>()) {
+            for (const SdfAssetPath& assetPath : value.UncheckedGet<VtArray<SdfAssetPath>>()) {
+                dependencies.push_back(assetPath.GetAssetPath());
+            }
+        }
+    });
+    return dependencies;
+}
+
+HttpAssetCache& Cache() {
+    static HttpAssetCache cache([]() {
+        HttpAssetCache::Options options = HttpAssetCache::OptionsFromEnvironment();
+        options.dependencyScanner = ScanUsdLayerDependencies;
+        return options;
+    }());
+    return cache;
+}
+
 }
 
 bool HttpResolver::_IsHttpURL(const std::string& path) {
-    return TfStringStartsWith(path, "http://") ||
-        TfStringStartsWith(path, "https://");
+    return HttpAssetCache::IsHttpUrl(path);
 }
 
-void HttpResolver::_FetchURLToFile(const std::string& url, const fs::path& outPath) const {
-    CURL* curl = curl_easy_init();
-    if (!curl) return;
+std::string HttpResolver::_CreateIdentifier(
+    const std::string& assetPath,
+    const ArResolvedPath& anchor) const
+{
+    if (_IsHttpURL(assetPath)) {
+        return assetPath;
+    }
 
-    std::ofstream ofs(outPath, std::ios::binary);
-    if (!ofs) {
-        curl_easy_cleanup(curl);
-        return;
+    if (!assetPath.empty() && anchor) {
+        std::string anchorUrl = anchor.GetPathString();
+        if (!_IsHttpURL(anchorUrl)) {
+            anchorUrl = Cache().UrlForLocalPath(anchorUrl);
+        }
+        if (!anchorUrl.empty()) {
+            const std::string joined = HttpAssetCache::JoinUrl(anchorUrl, assetPath);
+            if (!joined.empty()) {
+                return joined;
+            }
+        }
     }
 
-    curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
-    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, _WriteData);
-    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &ofs);
-    curl_easy_perform(curl);
-    curl_easy_cleanup(curl);
+    return ArDefaultResolver().CreateIdentifier(assetPath, anchor);
 }
 
 ArResolvedPath HttpResolver::_Resolve(const std::string& assetPath) const {
-    spdlog::info("HttpResolver resolving: {}", assetPath);
     if (_IsHttpURL(assetPath)) {
-        fs::path tmpDir = fs::temp_directory_path();
-        auto ext = fs::path(assetPath).extension().string();
-        auto hashValue = std::to_string(TfHash{}(assetPath));
-        fs::path cacheFile = tmpDir / (hashValue + ext);
-
-        static std::mutex s_mutex;
-        std::lock_guard<std::mutex> lock(s_mutex);
-        if (!fs::exists(cacheFile)) {
-            _FetchURLToFile(assetPath, cacheFile);
+        const std::string localPath = Cache().Fetch(assetPath);
+        if (localPath.empty()) {
+            spdlog::error("HttpResolver: unable to resolve {}", assetPath);
+            return ArResolvedPath();
         }
-        return ArResolvedPath(cacheFile.string());
+        return ArResolvedPath(localPath);
     }
     return ArDefaultResolver().Resolve(assetPath);
 }
 
 AR_DEFINE_RESOLVER(HttpResolver, ArResolver);
 
-PXR_NAMESPACE_CLOSE_SCOPE
\ No newline at end of file
+PXR_NAMESPACE_CLOSE_SCOPE
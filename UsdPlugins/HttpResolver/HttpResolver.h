@@ -30,19 +30,13 @@ public:
     ~HttpResolver() override = default;
 
 protected:
-    // Write callback for libcurl, writes directly into ofstream
-    static size_t _WriteData(void* ptr, size_t size, size_t nmemb, void* userp) noexcept;
-
     static bool _IsHttpURL(const std::string& path);
 
-    void _FetchURLToFile(const std::string& url, const fs::path& outPath) const;
-
+    // Relative references inside a downloaded layer are anchored to the layer's
+    // URL rather than to its location in the local cache.
     std::string _CreateIdentifier(
         const std::string& assetPath,
-        const ArResolvedPath& anchor) const override
-    {
-        return ArDefaultResolver().CreateIdentifier(assetPath, anchor);
-    }
+        const ArResolvedPath& anchor) const override;
 
     std::string _CreateIdentifierForNewAsset(
         const std::string& assetPath,
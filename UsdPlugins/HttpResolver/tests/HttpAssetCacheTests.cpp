@@ -0,0 +1,386 @@
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <winsock2.h>
+#include <ws2tcpip.h>
+using SocketHandle = SOCKET;
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+using SocketHandle = int;
+#endif
+
+#include "HttpAssetCache.h"
+
+namespace
+{
+    void Require(bool condition, const std::string& message)
+    {
+        if (!condition) {
+            throw std::runtime_error(message);
+        }
+    }
+
+    void CloseSocket(SocketHandle socket)
+    {
+#ifdef _WIN32
+        closesocket(socket);
+#else
+        close(socket);
+#endif
+    }
+
+    // Minimal HTTP/1.1 server on 127.0.0.1 with one connection per request.
+    // Supports ETag revalidation and per-route latency so tests can observe
+    // request counts, conditional GETs and overlapping fetches.
+    class LoopbackHttpServer
+    {
+    public:
+        struct Route
+        {
+            std::string body;
+            std::string etag;
+            int status = 200;
+            int delayMilliseconds = 0;
+        };
+
+        LoopbackHttpServer()
+        {
+#ifdef _WIN32
+            WSADATA data{};
+            WSAStartup(MAKEWORD(2, 2), &data);
+#endif
+            m_listener = socket(AF_INET, SOCK_STREAM, 0);
+            sockaddr_in address{};
+            address.sin_family = AF_INET;
+            address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            address.sin_port = 0;
+            Require(bind(m_listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0, "bind failed");
+            Require(listen(m_listener, 64) == 0, "listen failed");
+            socklen_t length = sizeof(address);
+            getsockname(m_listener, reinterpret_cast<sockaddr*>(&address), &length);
+            m_port = ntohs(address.sin_port);
+            m_acceptThread = std::thread([this]() { AcceptLoop(); });
+        }
+
+        ~LoopbackHttpServer()
+        {
+            m_stopping = true;
+            // Wake accept() with a throwaway connection.
+            SocketHandle wake = socket(AF_INET, SOCK_STREAM, 0);
+            sockaddr_in address{};
+            address.sin_family = AF_INET;
+            address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            address.sin_port = htons(m_port);
+            connect(wake, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+            CloseSocket(wake);
+            m_acceptThread.join();
+            for (std::thread& thread : m_connectionThreads) {
+                thread.join();
+            }
+            CloseSocket(m_listener);
+#ifdef _WIN32
+            WSACleanup();
+#endif
+        }
+
+        std::string Url(const std::string& path) const
+        {
+            return "http://127.0.0.1:" + std::to_string(m_port) + path;
+        }
+
+        void SetRoute(const std::string& path, Route route)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_routes[path] = std::move(route);
+        }
+
+        int Requests(const std::string& path) const
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto it = m_requests.find(path);
+            return it != m_requests.end() ? it->second : 0;
+        }
+
+        int ConditionalRequests() const
+        {
+            return m_conditionalRequests.load();
+        }
+
+    private:
+        void AcceptLoop()
+        {
+            while (!m_stopping) {
+                SocketHandle client = accept(m_listener, nullptr, nullptr);
+                if (m_stopping) {
+                    CloseSocket(client);
+                    break;
+                }
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_connectionThreads.emplace_back([this, client]() { Serve(client); });
+            }
+        }
+
+        void Serve(SocketHandle client)
+        {
+            std::string request;
+            char buffer[4096];
+            while (request.find("\r\n\r\n") == std::string::npos) {
+                const int received = static_cast<int>(recv(client, buffer, sizeof(buffer), 0));
+                if (received <= 0) {
+                    CloseSocket(client);
+                    return;
+                }
+                request.append(buffer, buffer + received);
+            }
+
+            const size_t pathStart = request.find(' ') + 1;
+            const std::string path = request.substr(pathStart, request.find(' ', pathStart) - pathStart);
+            std::string ifNoneMatch;
+            const size_t conditional = request.find("If-None-Match: ");
+            if (conditional != std::string::npos) {
+                const size_t valueStart = conditional + 15;
+                ifNoneMatch = request.substr(valueStart, request.find("\r\n", valueStart) - valueStart);
+                ++m_conditionalRequests;
+            }
+
+            Route route;
+            bool found = false;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                ++m_requests[path];
+                auto it = m_routes.find(path);
+                if (it != m_routes.end()) {
+                    route = it->second;
+                    found = true;
+                }
+            }
+            if (route.delayMilliseconds > 0) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(route.delayMilliseconds));
+            }
+
+            std::string response;
+            if (!found) {
+                response = "HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+            }
+            else if (route.status != 200) {
+                response = "HTTP/1.1 " + std::to_string(route.status) + " Error\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+            }
+            else if (!route.etag.empty() && ifNoneMatch == route.etag) {
+                response = "HTTP/1.1 304 Not Modified\r\nETag: " + route.etag + "\r\nConnection: close\r\n\r\n";
+            }
+            else {
+                response = "HTTP/1.1 200 OK\r\nContent-Length: " + std::to_string(route.body.size()) + "\r\n";
+                if (!route.etag.empty()) {
+                    response += "ETag: " + route.etag + "\r\n";
+                }
+                response += "Connection: close\r\n\r\n" + route.body;
+            }
+            send(client, response.data(), static_cast<int>(response.size()), 0);
+            CloseSocket(client);
+        }
+
+        SocketHandle m_listener{};
+        uint16_t m_port = 0;
+        std::atomic<bool> m_stopping{ false };
+        std::atomic<int> m_conditionalRequests{ 0 };
+        std::thread m_acceptThread;
+        std::vector<std::thread> m_connectionThreads;
+        mutable std::mutex m_mutex;
+        std::map<std::string, Route> m_routes;
+        std::map<std::string, int> m_requests;
+    };
+
+    std::string ReadFile(const std::string& path)
+    {
+        std::ifstream stream(path, std::ios::binary);
+        return std::string((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+    }
+
+    HttpAssetCache::Options TestOptions(const std::filesystem::path& root)
+    {
+        HttpAssetCache::Options options;
+        options.root = root;
+        options.prefetchThreads = 4;
+        options.prefetchDependencies = false;
+        return options;
+    }
+
+    void TestCachesAndSharesInFlightRequests(LoopbackHttpServer& server, const std::filesystem::path& root)
+    {
+        server.SetRoute("/slow.png", { "slow-texture-bytes", "\"slow-v1\"", 200, 200 });
+        HttpAssetCache cache(TestOptions(root));
+
+        std::vector<std::string> results(8);
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < results.size(); ++i) {
+            threads.emplace_back([&, i]() { results[i] = cache.Fetch(server.Url("/slow.png")); });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+
+        Require(server.Requests("/slow.png") == 1, "concurrent fetches of one URL should share a request");
+        for (const std::string& result : results) {
+            Require(!result.empty() && result == results.front(), "every waiter should receive the same local path");
+        }
+        Require(ReadFile(results.front()) == "slow-texture-bytes", "cached file should hold the response body");
+
+        Require(cache.Fetch(server.Url("/slow.png")) == results.front(), "a fresh entry should be served from the cache");
+        Require(server.Requests("/slow.png") == 1, "a fresh entry should not hit the network");
+    }
+
+    void TestRevalidatesWithETag(LoopbackHttpServer& server, const std::filesystem::path& root)
+    {
+        server.SetRoute("/layer.usda", { "#usda 1.0\n", "\"layer-v1\"" });
+        HttpAssetCache::Options options = TestOptions(root);
+        options.revalidateAfter = std::chrono::seconds(0);
+        HttpAssetCache cache(options);
+
+        const std::string first = cache.Fetch(server.Url("/layer.usda"));
+        const int conditionalBefore = server.ConditionalRequests();
+        const std::string second = cache.Fetch(server.Url("/layer.usda"));
+        Require(server.ConditionalRequests() == conditionalBefore + 1, "stale entries should be revalidated with If-None-Match");
+        Require(second == first && cache.GetStats().notModified == 1, "304 responses should keep the cached file");
+
+        server.SetRoute("/layer.usda", { "#usda 1.0\n(doc = \"v2\")\n", "\"layer-v2\"" });
+        const std::string third = cache.Fetch(server.Url("/layer.usda"));
+        Require(third != first, "changed content should be published under a new path");
+        Require(ReadFile(third) == "#usda 1.0\n(doc = \"v2\")\n", "changed content should be downloaded");
+
+        server.SetRoute("/layer.usda", { "", "", 500 });
+        Require(cache.Fetch(server.Url("/layer.usda")) == third, "a failed revalidation should serve the cached copy");
+    }
+
+    void TestEvictsLeastRecentlyUsed(LoopbackHttpServer& server, const std::filesystem::path& root)
+    {
+        const std::string body(1000, 'x');
+        server.SetRoute("/a.bin", { body + "a", "" });
+        server.SetRoute("/b.bin", { body + "b", "" });
+        server.SetRoute("/c.bin", { body + "c", "" });
+
+        HttpAssetCache::Options options = TestOptions(root);
+        options.maxBytes = 2500;
+        HttpAssetCache cache(options);
+
+        const std::string a = cache.Fetch(server.Url("/a.bin"));
+        const std::string b = cache.Fetch(server.Url("/b.bin"));
+        cache.Fetch(server.Url("/a.bin"));
+        const std::string c = cache.Fetch(server.Url("/c.bin"));
+
+        Require(std::filesystem::exists(a) && std::filesystem::exists(c), "recently used entries should survive");
+        Require(!std::filesystem::exists(b), "the least recently used entry should be evicted");
+        Require(cache.GetStats().evictions == 1 && cache.GetStats().cachedBytes <= options.maxBytes, "cache should respect its size cap");
+    }
+
+    void TestIndexSurvivesRestart(LoopbackHttpServer& server, const std::filesystem::path& root)
+    {
+        server.SetRoute("/persist.png", { "persisted", "\"p1\"" });
+        std::string path;
+        {
+            HttpAssetCache cache(TestOptions(root));
+            path = cache.Fetch(server.Url("/persist.png"));
+        }
+        HttpAssetCache cache(TestOptions(root));
+        Require(cache.Fetch(server.Url("/persist.png")) == path, "entries should be reloaded from the index");
+        Require(server.Requests("/persist.png") == 1, "reloaded entries should not be downloaded again");
+        Require(cache.UrlForLocalPath(path) == server.Url("/persist.png"), "local paths should map back to their URL");
+    }
+
+    void TestPrefetchesLayerDependencies(LoopbackHttpServer& server, const std::filesystem::path& root)
+    {
+        server.SetRoute("/scene/root.usda", { "#usda 1.0\n(subLayers = [@./sub/detail.usda@])\ndef \"A\" { asset tex = @textures/albedo.png@ }\n", "" });
+        server.SetRoute("/scene/sub/detail.usda", { "#usda 1.0\ndef \"B\" { asset tex = @../textures/normal.png@ }\n", "" });
+        server.SetRoute("/scene/textures/albedo.png", { "albedo", "" });
+        server.SetRoute("/scene/textures/normal.png", { "normal", "" });
+
+        HttpAssetCache::Options options = TestOptions(root);
+        options.prefetchDependencies = true;
+        HttpAssetCache cache(options);
+        cache.Fetch(server.Url("/scene/root.usda"));
+        cache.WaitForPrefetches();
+
+        Require(server.Requests("/scene/sub/detail.usda") == 1, "sublayers should be prefetched");
+        Require(server.Requests("/scene/textures/albedo.png") == 1, "asset attributes should be prefetched");
+        Require(server.Requests("/scene/textures/normal.png") == 1, "dependencies of prefetched layers should be prefetched");
+
+        cache.Fetch(server.Url("/scene/textures/normal.png"));
+        Require(server.Requests("/scene/textures/normal.png") == 1, "prefetched assets should resolve from the cache");
+    }
+
+    void TestPrefetchesAgainAfterEviction(LoopbackHttpServer& server, const std::filesystem::path& root)
+    {
+        const std::string body(1000, 'x');
+        server.SetRoute("/evicted.bin", { body + "e", "" });
+        server.SetRoute("/filler.bin", { body + "f", "" });
+        server.SetRoute("/filler2.bin", { body + "g", "" });
+
+        HttpAssetCache::Options options = TestOptions(root);
+        options.maxBytes = 2500;
+        HttpAssetCache cache(options);
+
+        cache.Prefetch(server.Url("/evicted.bin"));
+        cache.WaitForPrefetches();
+        cache.Fetch(server.Url("/filler.bin"));
+        cache.Fetch(server.Url("/filler2.bin"));
+        Require(cache.GetStats().evictions == 1, "the prefetched entry should be evicted");
+
+        cache.Prefetch(server.Url("/evicted.bin"));
+        cache.WaitForPrefetches();
+        Require(server.Requests("/evicted.bin") == 2, "an evicted URL should be prefetched again");
+    }
+
+    void TestJoinUrl()
+    {
+        Require(HttpAssetCache::JoinUrl("http://h/a/b/c.usda", "d.png") == "http://h/a/b/d.png", "sibling reference");
+        Require(HttpAssetCache::JoinUrl("http://h/a/b/c.usda", "./x/../d.png") == "http://h/a/b/d.png", "dot segments");
+        Require(HttpAssetCache::JoinUrl("http://h/a/b/c.usda?v=1", "../d.png") == "http://h/a/d.png", "parent reference");
+        Require(HttpAssetCache::JoinUrl("http://h/a/c.usda", "/root.png") == "http://h/root.png", "absolute path reference");
+        Require(HttpAssetCache::JoinUrl("https://h/a/c.usda", "//cdn/x.png") == "https://cdn/x.png", "scheme-relative reference");
+        Require(HttpAssetCache::JoinUrl("http://h/a/c.usda", "C:/local.png").empty(), "drive paths are not URLs");
+    }
+}
+
+int main()
+{
+    const auto root = std::filesystem::temp_directory_path() / ("HttpAssetCacheTests-" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()));
+    int failures = 0;
+    auto run = [&](const char* name, auto&& test) {
+        try {
+            test();
+            std::cout << "[PASS] " << name << "\n";
+        }
+        catch (const std::exception& ex) {
+            ++failures;
+            std::cout << "[FAIL] " << name << ": " << ex.what() << "\n";
+        }
+    };
+
+    {
+        LoopbackHttpServer server;
+        run("CachesAndSharesInFlightRequests", [&]() { TestCachesAndSharesInFlightRequests(server, root / "shared"); });
+        run("RevalidatesWithETag", [&]() { TestRevalidatesWithETag(server, root / "revalidate"); });
+        run("EvictsLeastRecentlyUsed", [&]() { TestEvictsLeastRecentlyUsed(server, root / "lru"); });
+        run("IndexSurvivesRestart", [&]() { TestIndexSurvivesRestart(server, root / "persist"); });
+        run("PrefetchesLayerDependencies", [&]() { TestPrefetchesLayerDependencies(server, root / "prefetch"); });
+        run("PrefetchesAgainAfterEviction", [&]() { TestPrefetchesAgainAfterEviction(server, root / "reprefetch"); });
+        run("JoinUrl", []() { TestJoinUrl(); });
+    }
+
+    std::error_code ec;
+    std::filesystem::remove_all(root, ec);
+    return failures == 0 ? 0 : 1;
+}